@@ -9,6 +9,8 @@
 
 #include "../world/defaultgmsts.hpp"
 
+#include "../prefs/state.hpp"
+
 #ifndef Q_MOC_RUN
 #include <components/files/configurationmanager.hpp>
 #endif
@@ -288,6 +290,9 @@ CSMDoc::Document::Document (const Files::ConfigurationManager& configuration,
     if (mContentFiles.empty())
         throw std::runtime_error ("Empty content file sequence");
 
+    mUndoStack.setMemoryLimit (
+        static_cast<std::size_t> (CSMPrefs::get()["Records"]["undo-memory"].toInt()) * 1024 * 1024);
+
     if (mNew || !boost::filesystem::exists (mProjectPath))
     {
         boost::filesystem::path customFiltersPath (configuration.getUserDataPath());
@@ -332,13 +337,16 @@ CSMDoc::Document::Document (const Files::ConfigurationManager& configuration,
         this, SLOT (reportMessage (const CSMDoc::Message&, int)));
 
     connect (&mRunner, SIGNAL (runStateChanged()), this, SLOT (runStateChanged()));
+
+    connect (&CSMPrefs::State::get(), SIGNAL (settingChanged (const CSMPrefs::Setting *)),
+        this, SLOT (settingChanged (const CSMPrefs::Setting *)));
 }
 
 CSMDoc::Document::~Document()
 {
 }
 
-QUndoStack& CSMDoc::Document::getUndoStack()
+CSMWorld::UndoStack& CSMDoc::Document::getUndoStack()
 {
     return mUndoStack;
 }
@@ -509,6 +517,12 @@ void CSMDoc::Document::runStateChanged()
     emit stateChanged (getState(), this);
 }
 
+void CSMDoc::Document::settingChanged (const CSMPrefs::Setting *setting)
+{
+    if (*setting=="Records/undo-memory")
+        mUndoStack.setMemoryLimit (static_cast<std::size_t> (setting->toInt()) * 1024 * 1024);
+}
+
 void CSMDoc::Document::progress (int current, int max, int type)
 {
     emit progress (current, max, type, 1, this);
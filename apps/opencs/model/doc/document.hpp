@@ -5,7 +5,6 @@
 
 #include <boost/filesystem/path.hpp>
 
-#include <QUndoStack>
 #include <QObject>
 #include <QTimer>
 
@@ -14,6 +13,7 @@
 
 #include "../world/data.hpp"
 #include "../world/idcompletionmanager.hpp"
+#include "../world/undostack.hpp"
 
 #include "../tools/tools.hpp"
 
@@ -52,6 +52,11 @@ namespace CSMWorld
     class ResourcesManager;
 }
 
+namespace CSMPrefs
+{
+    class Setting;
+}
+
 namespace CSMDoc
 {
     class Document : public QObject
@@ -78,7 +83,7 @@ namespace CSMDoc
 
             // It is important that the undo stack is declared last, because on desctruction it fires a signal, that is connected to a slot, that is
             // using other member variables.  Unfortunately this connection is cut only in the QObject destructor, which is way too late.
-            QUndoStack mUndoStack;
+            CSMWorld::UndoStack mUndoStack;
 
             // not implemented
             Document (const Document&);
@@ -111,7 +116,7 @@ namespace CSMDoc
 
             ~Document();
 
-            QUndoStack& getUndoStack();
+            CSMWorld::UndoStack& getUndoStack();
 
             int getState() const;
 
@@ -178,6 +183,8 @@ namespace CSMDoc
 
             void runStateChanged();
 
+            void settingChanged (const CSMPrefs::Setting *setting);
+
         public slots:
 
             void progress (int current, int max, int type);
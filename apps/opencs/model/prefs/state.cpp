@@ -81,6 +81,10 @@ void CSMPrefs::State::declare()
         addValues (recordValues);
     declareEnum ("type-format", "ID type display format", iconAndText).
         addValues (recordValues);
+    declareInt ("undo-memory", "Undo memory limit (MB)", 256).
+        setTooltip ("Once the undo steps of a document use more memory than this, the oldest "
+        "steps are discarded. 0 means no limit.").
+        setMin (0);
 
     declareCategory ("ID Tables");
     EnumValue inPlaceEdit ("Edit in Place", "Edit the clicked cell");
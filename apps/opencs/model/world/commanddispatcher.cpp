@@ -208,7 +208,7 @@ void CSMWorld::CommandDispatcher::executeDelete()
                     model.findColumnIndex (CSMWorld::Columns::ColumnId_RecordType))).toInt())));
         }
         else
-            mDocument.getUndoStack().push (new CSMWorld::DeleteCommand (model, id));
+            macro.push (new CSMWorld::DeleteCommand (model, id));
     }
 }
 
@@ -1,10 +1,12 @@
 
 #include "commandmacro.hpp"
 
-#include <QUndoStack>
 #include <QUndoCommand>
 
-CSMWorld::CommandMacro::CommandMacro (QUndoStack& undoStack, const QString& description)
+#include "commands.hpp"
+#include "undostack.hpp"
+
+CSMWorld::CommandMacro::CommandMacro (UndoStack& undoStack, const QString& description)
 : mUndoStack (undoStack), mDescription (description), mStarted (false)
 {}
 
@@ -22,5 +24,9 @@ void CSMWorld::CommandMacro::push (QUndoCommand *command)
         mStarted = true;
     }
 
+    // Keep bulk operations compact by letting consecutive record state changes merge
+    if (RecordStateCommand *stateCommand = dynamic_cast<RecordStateCommand *> (command))
+        stateCommand->setCoalescing (true);
+
     mUndoStack.push (command);
 }
@@ -1,16 +1,17 @@
 #ifndef CSM_WOLRD_COMMANDMACRO_H
 #define CSM_WOLRD_COMMANDMACRO_H
 
-class QUndoStack;
 class QUndoCommand;
 
 #include <QString>
 
 namespace CSMWorld
 {
+    class UndoStack;
+
     class CommandMacro
     {
-            QUndoStack& mUndoStack;
+            UndoStack& mUndoStack;
             QString mDescription;
             bool mStarted;
 
@@ -23,7 +24,7 @@ namespace CSMWorld
         public:
 
             /// If \a description is empty, the description of the first command is used.
-            CommandMacro (QUndoStack& undoStack, const QString& description = "");
+            CommandMacro (UndoStack& undoStack, const QString& description = "");
 
             ~CommandMacro();
 
@@ -1,5 +1,6 @@
 #include "commands.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <sstream>
 #include <unordered_set>
@@ -16,6 +17,19 @@
 #include "nestedtablewrapper.hpp"
 #include "pathgrid.hpp"
 
+namespace
+{
+    std::size_t getVariantMemory (const QVariant& value)
+    {
+        switch (value.type())
+        {
+            case QVariant::String: return value.toString().size() * sizeof (QChar);
+            case QVariant::ByteArray: return value.toByteArray().size();
+            default: return 0;
+        }
+    }
+}
+
 CSMWorld::TouchCommand::TouchCommand(IdTable& table, const std::string& id, QUndoCommand* parent)
     : QUndoCommand(parent)
     , mTable(table)
@@ -41,6 +55,11 @@ void CSMWorld::TouchCommand::undo()
     }
 }
 
+std::size_t CSMWorld::TouchCommand::getMemoryUsage() const
+{
+    return sizeof(*this) - sizeof(QUndoCommand) + mId.capacity() + mOld->getMemoryUsage();
+}
+
 CSMWorld::ImportLandTexturesCommand::ImportLandTexturesCommand(IdTable& landTable,
     IdTable& ltexTable, QUndoCommand* parent)
     : QUndoCommand(parent)
@@ -132,6 +151,16 @@ void CSMWorld::ImportLandTexturesCommand::undo()
     mCreatedTextures.clear();
 }
 
+std::size_t CSMWorld::ImportLandTexturesCommand::getMemoryUsage() const
+{
+    std::size_t memory = sizeof(*this) - sizeof(QUndoCommand) + mOld.size() * sizeof(DataType::value_type);
+
+    for (const std::string& id : mCreatedTextures)
+        memory += sizeof(std::string) + id.capacity();
+
+    return memory;
+}
+
 CSMWorld::CopyLandTexturesCommand::CopyLandTexturesCommand(IdTable& landTable, IdTable& ltexTable,
     const std::string& origin, const std::string& dest, QUndoCommand* parent)
     : ImportLandTexturesCommand(landTable, ltexTable, parent)
@@ -185,9 +214,16 @@ void CSMWorld::TouchLandCommand::onUndo()
     }
 }
 
+std::size_t CSMWorld::TouchLandCommand::getMemoryUsage() const
+{
+    return ImportLandTexturesCommand::getMemoryUsage() + sizeof(*this) - sizeof(ImportLandTexturesCommand) +
+        mId.capacity() + mOld->getMemoryUsage();
+}
+
 CSMWorld::ModifyCommand::ModifyCommand (QAbstractItemModel& model, const QModelIndex& index,
                                         const QVariant& new_, QUndoCommand* parent)
-    : QUndoCommand (parent), mModel (&model), mIndex (index), mNew (new_), mHasRecordState(false), mOldRecordState(CSMWorld::RecordBase::State_BaseOnly)
+    : QUndoCommand (parent), mModel (&model), mIndex (index), mNew (new_), mDiff (false), mPrefix (0), mSuffix (0),
+      mHasRecordState(false), mOldRecordState(CSMWorld::RecordBase::State_BaseOnly)
 {
     if (QAbstractProxyModel *proxy = dynamic_cast<QAbstractProxyModel *> (&model))
     {
@@ -223,21 +259,76 @@ CSMWorld::ModifyCommand::ModifyCommand (QAbstractItemModel& model, const QModelI
     }
 }
 
+void CSMWorld::ModifyCommand::storeDiff()
+{
+    if (mOld.type()!=QVariant::String || mNew.type()!=QVariant::String)
+        return;
+
+    // Use the value as the model stores it, since that is what undo will find.
+    QVariant newValue = mModel->data (mIndex, Qt::EditRole);
+
+    if (newValue.type()!=QVariant::String)
+        return;
+
+    QString old = mOld.toString();
+    QString new_ = newValue.toString();
+
+    if (std::max (old.size(), new_.size())<sDiffLength)
+        return;
+
+    int length = std::min (old.size(), new_.size());
+
+    int prefix = 0;
+    while (prefix<length && old[prefix]==new_[prefix])
+        ++prefix;
+
+    int suffix = 0;
+    while (suffix<length-prefix && old[old.size()-1-suffix]==new_[new_.size()-1-suffix])
+        ++suffix;
+
+    mPrefix = prefix;
+    mSuffix = suffix;
+    mOld = old.mid (prefix, old.size()-prefix-suffix);
+    mNew = new_.mid (prefix, new_.size()-prefix-suffix);
+    mDiff = true;
+}
+
 void CSMWorld::ModifyCommand::redo()
 {
-    mOld = mModel->data (mIndex, Qt::EditRole);
-    mModel->setData (mIndex, mNew);
+    if (mDiff)
+    {
+        QString current = mModel->data (mIndex, Qt::EditRole).toString();
+        mModel->setData (mIndex, current.left (mPrefix) + mNew.toString() + current.right (mSuffix));
+    }
+    else
+    {
+        mOld = mModel->data (mIndex, Qt::EditRole);
+        mModel->setData (mIndex, mNew);
+        storeDiff();
+    }
 }
 
 void CSMWorld::ModifyCommand::undo()
 {
-    mModel->setData (mIndex, mOld);
+    if (mDiff)
+    {
+        QString current = mModel->data (mIndex, Qt::EditRole).toString();
+        mModel->setData (mIndex, current.left (mPrefix) + mOld.toString() + current.right (mSuffix));
+    }
+    else
+        mModel->setData (mIndex, mOld);
+
     if (mHasRecordState)
     {
         mModel->setData(mRecordStateIndex, mOldRecordState);
     }
 }
 
+std::size_t CSMWorld::ModifyCommand::getMemoryUsage() const
+{
+    return sizeof (*this) - sizeof (QUndoCommand) + getVariantMemory (mNew) + getVariantMemory (mOld);
+}
+
 
 void CSMWorld::CreateCommand::applyModifications()
 {
@@ -293,75 +384,118 @@ void CSMWorld::CreateCommand::undo()
     mModel.removeRow (mModel.getModelIndex (mId, 0).row());
 }
 
-CSMWorld::RevertCommand::RevertCommand (IdTable& model, const std::string& id, QUndoCommand* parent)
-: QUndoCommand (parent), mModel (model), mId (id), mOld (0)
+CSMWorld::RecordStateCommand::RecordStateCommand (int commandId, IdTable& model, const std::string& id,
+    RecordBase::State newState, UniversalId::Type type, QUndoCommand *parent)
+: QUndoCommand (parent), mCommandId (commandId), mNewState (newState), mCoalescing (false), mModel (model)
 {
-    setText (("Revert record " + id).c_str());
+    OldRecord old;
+    old.mId = id;
+    old.mType = type;
+
+    // Tables with several record types need the type to add the record again on undo.
+    int typeColumn = model.searchColumnIndex (Columns::ColumnId_RecordType);
+
+    if (type==UniversalId::Type_None && typeColumn!=-1)
+        old.mType = static_cast<UniversalId::Type> (
+            model.data (model.getModelIndex (id, typeColumn)).toInt());
 
-    mOld = model.getRecord (id).clone();
+    const RecordBase& record = model.getRecord (id);
+    old.mState = record.mState;
+
+    // A record that only exists in the base is restored by changing its state back.
+    if (record.mState==RecordBase::State_Modified)
+        old.mRecord.reset (record.clone());
+    else if (record.mState==RecordBase::State_ModifiedOnly)
+        old.mRecord.reset (record.modifiedCopy());
+
+    mOld.push_back (old);
 }
 
-CSMWorld::RevertCommand::~RevertCommand()
+void CSMWorld::RecordStateCommand::setCoalescing (bool coalescing)
 {
-    delete mOld;
+    mCoalescing = coalescing;
 }
 
-void CSMWorld::RevertCommand::redo()
+int CSMWorld::RecordStateCommand::id() const
 {
-    int column = mModel.findColumnIndex (Columns::ColumnId_Modification);
+    return mCoalescing ? mCommandId : -1;
+}
 
-    QModelIndex index = mModel.getModelIndex (mId, column);
-    RecordBase::State state = static_cast<RecordBase::State> (mModel.data (index).toInt());
+bool CSMWorld::RecordStateCommand::mergeWith (const QUndoCommand *other)
+{
+    const RecordStateCommand& command = static_cast<const RecordStateCommand&> (*other);
 
-    if (state==RecordBase::State_ModifiedOnly)
-    {
-        mModel.removeRows (index.row(), 1);
-    }
-    else
-    {
-        mModel.setData (index, static_cast<int> (RecordBase::State_BaseOnly));
-    }
+    if (&command.mModel!=&mModel)
+        return false;
+
+    mOld.insert (mOld.end(), command.mOld.begin(), command.mOld.end());
+    return true;
 }
 
-void CSMWorld::RevertCommand::undo()
+int CSMWorld::RecordStateCommand::getSize() const
 {
-    mModel.setRecord (mId, *mOld);
+    return static_cast<int> (mOld.size());
 }
 
-CSMWorld::DeleteCommand::DeleteCommand (IdTable& model,
-        const std::string& id, CSMWorld::UniversalId::Type type, QUndoCommand* parent)
-: QUndoCommand (parent), mModel (model), mId (id), mOld (0), mType(type)
+void CSMWorld::RecordStateCommand::redo()
 {
-    setText (("Delete record " + id).c_str());
+    int column = mModel.findColumnIndex (Columns::ColumnId_Modification);
 
-    mOld = model.getRecord (id).clone();
-}
+    for (std::vector<OldRecord>::const_iterator iter (mOld.begin()); iter!=mOld.end(); ++iter)
+    {
+        QModelIndex index = mModel.getModelIndex (iter->mId, column);
+        RecordBase::State state = static_cast<RecordBase::State> (mModel.data (index).toInt());
 
-CSMWorld::DeleteCommand::~DeleteCommand()
-{
-    delete mOld;
+        if (state==RecordBase::State_ModifiedOnly)
+        {
+            mModel.removeRows (index.row(), 1);
+        }
+        else
+        {
+            mModel.setData (index, static_cast<int> (mNewState));
+        }
+    }
 }
 
-void CSMWorld::DeleteCommand::redo()
+void CSMWorld::RecordStateCommand::undo()
 {
     int column = mModel.findColumnIndex (Columns::ColumnId_Modification);
 
-    QModelIndex index = mModel.getModelIndex (mId, column);
-    RecordBase::State state = static_cast<RecordBase::State> (mModel.data (index).toInt());
-
-    if (state==RecordBase::State_ModifiedOnly)
+    for (std::vector<OldRecord>::const_reverse_iterator iter (mOld.rbegin()); iter!=mOld.rend(); ++iter)
     {
-        mModel.removeRows (index.row(), 1);
+        if (iter->mRecord)
+            mModel.setRecord (iter->mId, *iter->mRecord, iter->mType);
+        else
+            mModel.setData (mModel.getModelIndex (iter->mId, column), static_cast<int> (iter->mState));
     }
-    else
+}
+
+std::size_t CSMWorld::RecordStateCommand::getMemoryUsage() const
+{
+    std::size_t memory = sizeof (*this) - sizeof (QUndoCommand) + mOld.capacity() * sizeof (OldRecord);
+
+    for (std::vector<OldRecord>::const_iterator iter (mOld.begin()); iter!=mOld.end(); ++iter)
     {
-        mModel.setData (index, static_cast<int> (RecordBase::State_Deleted));
+        memory += iter->mId.capacity();
+
+        if (iter->mRecord)
+            memory += iter->mRecord->getMemoryUsage();
     }
+
+    return memory;
+}
+
+CSMWorld::RevertCommand::RevertCommand (IdTable& model, const std::string& id, QUndoCommand* parent)
+: RecordStateCommand (Id, model, id, RecordBase::State_BaseOnly, UniversalId::Type_None, parent)
+{
+    setText (("Revert record " + id).c_str());
 }
 
-void CSMWorld::DeleteCommand::undo()
+CSMWorld::DeleteCommand::DeleteCommand (IdTable& model,
+        const std::string& id, CSMWorld::UniversalId::Type type, QUndoCommand* parent)
+: RecordStateCommand (Id, model, id, RecordBase::State_Deleted, type, parent)
 {
-    mModel.setRecord (mId, *mOld, mType);
+    setText (("Delete record " + id).c_str());
 }
 
 
@@ -496,6 +630,7 @@ void CSMWorld::DeleteNestedCommand::redo()
 {
     QModelIndex parentIndex = mModel.getModelIndex(mId, mParentColumn);
     mModel.removeRows (mNestedRow, 1, parentIndex);
+    storeRemovedRow (mModel, parentIndex, mNestedRow);
     mModifyParentCommand->redo();
 }
 
@@ -503,10 +638,15 @@ void CSMWorld::DeleteNestedCommand::redo()
 void CSMWorld::DeleteNestedCommand::undo()
 {
     QModelIndex parentIndex = mModel.getModelIndex(mId, mParentColumn);
-    mModel.setNestedTable(parentIndex, getOld());
+    restore (mModel, parentIndex);
     mModifyParentCommand->undo();
 }
 
+std::size_t CSMWorld::DeleteNestedCommand::getMemoryUsage() const
+{
+    return sizeof (*this) - sizeof (QUndoCommand) + mId.capacity() + getStoredMemory();
+}
+
 CSMWorld::AddNestedCommand::AddNestedCommand(IdTree& model, const std::string& id, int nestedRow, int parentColumn, QUndoCommand* parent)
     : QUndoCommand(parent),
       NestedTableStoring(model, id, parentColumn),
@@ -527,25 +667,72 @@ void CSMWorld::AddNestedCommand::redo()
 {
     QModelIndex parentIndex = mModel.getModelIndex(mId, mParentColumn);
     mModel.addNestedRow (parentIndex, mNewRow);
+    storeAddedRow (mModel, parentIndex, mNewRow);
     mModifyParentCommand->redo();
 }
 
 void CSMWorld::AddNestedCommand::undo()
 {
     QModelIndex parentIndex = mModel.getModelIndex(mId, mParentColumn);
-    mModel.setNestedTable(parentIndex, getOld());
+    restore (mModel, parentIndex);
     mModifyParentCommand->undo();
 }
 
+std::size_t CSMWorld::AddNestedCommand::getMemoryUsage() const
+{
+    return sizeof (*this) - sizeof (QUndoCommand) + mId.capacity() + getStoredMemory();
+}
+
 CSMWorld::NestedTableStoring::NestedTableStoring(const IdTree& model, const std::string& id, int parentColumn)
-    : mOld(model.nestedTable(model.getModelIndex(id, parentColumn))) {}
+    : mOld(model.nestedTable(model.getModelIndex(id, parentColumn))), mOldSize(mOld->size()), mRow(-1) {}
 
 CSMWorld::NestedTableStoring::~NestedTableStoring()
 {
     delete mOld;
 }
 
-const CSMWorld::NestedTableWrapperBase& CSMWorld::NestedTableStoring::getOld() const
+void CSMWorld::NestedTableStoring::storeRemovedRow (const IdTree& model, const QModelIndex& parentIndex, int row)
+{
+    if (mRow!=-1 || !mOld->canChangeRows() || row<0 || row>=mOldSize ||
+        model.rowCount (parentIndex)!=mOldSize-1)
+        return;
+
+    NestedTableWrapperBase *removed = mOld->cloneRow (row);
+    delete mOld;
+    mOld = removed;
+    mRow = row;
+}
+
+void CSMWorld::NestedTableStoring::storeAddedRow (const IdTree& model, const QModelIndex& parentIndex, int position)
+{
+    if (mRow!=-1 || !mOld->canChangeRows() || position<0 ||
+        model.rowCount (parentIndex)!=mOldSize+1)
+        return;
+
+    delete mOld;
+    mOld = 0;
+    mRow = std::min (position, mOldSize); // adapters append rows at positions past the end
+}
+
+void CSMWorld::NestedTableStoring::restore (IdTree& model, const QModelIndex& parentIndex) const
+{
+    if (mRow==-1)
+    {
+        model.setNestedTable (parentIndex, *mOld);
+        return;
+    }
+
+    std::unique_ptr<NestedTableWrapperBase> table (model.nestedTable (parentIndex));
+
+    if (mOld)
+        table->insertRows (mRow, *mOld);
+    else
+        table->removeRow (mRow);
+
+    model.setNestedTable (parentIndex, *table);
+}
+
+std::size_t CSMWorld::NestedTableStoring::getStoredMemory() const
 {
-    return *mOld;
+    return sizeof (*this) + (mOld ? mOld->getMemoryUsage() : 0);
 }
@@ -15,6 +15,7 @@
 #include "columnimp.hpp"
 #include "universalid.hpp"
 #include "nestedtablewrapper.hpp"
+#include "undostack.hpp"
 
 class QModelIndex;
 class QAbstractItemModel;
@@ -26,7 +27,7 @@ namespace CSMWorld
     struct RecordBase;
     struct NestedTableWrapperBase;
 
-    class TouchCommand : public QUndoCommand
+    class TouchCommand : public QUndoCommand, public CommandMemory
     {
         public:
 
@@ -35,6 +36,8 @@ namespace CSMWorld
             void redo() override;
             void undo() override;
 
+            std::size_t getMemoryUsage() const override;
+
         private:
 
             IdTable& mTable;
@@ -53,7 +56,7 @@ namespace CSMWorld
     /// have indices that conflict with pre-existing LandTextures in the current
     /// plugin, the indices might have to be changed, both for the newly added
     /// LandRecord and within the Land record.
-    class ImportLandTexturesCommand : public QUndoCommand
+    class ImportLandTexturesCommand : public QUndoCommand, public CommandMemory
     {
         public:
 
@@ -63,6 +66,8 @@ namespace CSMWorld
             void redo() override;
             void undo() override;
 
+            std::size_t getMemoryUsage() const override;
+
         protected:
 
             using DataType = LandTexturesColumn::DataType;
@@ -112,6 +117,8 @@ namespace CSMWorld
             TouchLandCommand(IdTable& landTable, IdTable& ltexTable,
                 const std::string& id, QUndoCommand* parent = nullptr);
 
+            std::size_t getMemoryUsage() const override;
+
         private:
 
             const std::string& getOriginId() const override;
@@ -126,17 +133,30 @@ namespace CSMWorld
             bool mChanged;
     };
 
-    class ModifyCommand : public QUndoCommand
+    /// \brief Changes the value of a single cell
+    ///
+    /// For long strings (e.g. script texts) only the changed part of the old and the new value is
+    /// kept after the first execution. The full values are then rebuilt from the current value of
+    /// the cell, which relies on the commands being undone and redone in stack order.
+    class ModifyCommand : public QUndoCommand, public CommandMemory
     {
+            static const int sDiffLength = 256; ///< Minimum length of strings that are kept as a diff
+
             QAbstractItemModel *mModel;
             QModelIndex mIndex;
             QVariant mNew;
             QVariant mOld;
+            bool mDiff; // mNew and mOld only hold the part between mPrefix and mSuffix
+            int mPrefix;
+            int mSuffix;
 
             bool mHasRecordState;
             QModelIndex mRecordStateIndex;
             CSMWorld::RecordBase::State mOldRecordState;
 
+            void storeDiff();
+            ///< Replace the old and the new value by their changed parts, if they are long strings.
+
         public:
 
             ModifyCommand (QAbstractItemModel& model, const QModelIndex& index, const QVariant& new_,
@@ -145,6 +165,8 @@ namespace CSMWorld
             virtual void redo();
 
             virtual void undo();
+
+            virtual std::size_t getMemoryUsage() const;
     };
 
     class CreateCommand : public QUndoCommand
@@ -196,48 +218,70 @@ namespace CSMWorld
             virtual void undo();
     };
 
-    class RevertCommand : public QUndoCommand
+    /// \brief Base class for commands that change the state of whole records
+    ///
+    /// Commands never change the base data of a record, so only the state is kept for undo,
+    /// unless the record holds modified data. Within a CommandMacro, consecutive commands of
+    /// the same kind on the same table are merged into one, so that a bulk operation is kept
+    /// as a single list of record states instead of a command per record.
+    class RecordStateCommand : public QUndoCommand, public CommandMemory
     {
+            struct OldRecord
+            {
+                std::string mId;
+                UniversalId::Type mType;
+                RecordBase::State mState;
+                std::shared_ptr<const RecordBase> mRecord; // only set if the record has modified data
+            };
+
+            int mCommandId;
+            RecordBase::State mNewState;
+            bool mCoalescing;
+            std::vector<OldRecord> mOld;
+
+        protected:
+
             IdTable& mModel;
-            std::string mId;
-            RecordBase *mOld;
 
-            // not implemented
-            RevertCommand (const RevertCommand&);
-            RevertCommand& operator= (const RevertCommand&);
+            RecordStateCommand (int commandId, IdTable& model, const std::string& id,
+                RecordBase::State newState, UniversalId::Type type, QUndoCommand *parent);
 
         public:
 
-            RevertCommand (IdTable& model, const std::string& id, QUndoCommand *parent = 0);
+            /// Allow merging with the following command of the same kind (used by CommandMacro).
+            void setCoalescing (bool coalescing);
+
+            virtual int id() const;
+
+            virtual bool mergeWith (const QUndoCommand *other);
 
-            virtual ~RevertCommand();
+            /// Number of records changed by this command.
+            int getSize() const;
 
             virtual void redo();
 
             virtual void undo();
+
+            virtual std::size_t getMemoryUsage() const;
     };
 
-    class DeleteCommand : public QUndoCommand
+    class RevertCommand : public RecordStateCommand
     {
-            IdTable& mModel;
-            std::string mId;
-            RecordBase *mOld;
-            UniversalId::Type mType;
+        public:
 
-            // not implemented
-            DeleteCommand (const DeleteCommand&);
-            DeleteCommand& operator= (const DeleteCommand&);
+            enum { Id = 1001 };
 
+            RevertCommand (IdTable& model, const std::string& id, QUndoCommand *parent = 0);
+    };
+
+    class DeleteCommand : public RecordStateCommand
+    {
         public:
 
+            enum { Id = 1002 };
+
             DeleteCommand (IdTable& model, const std::string& id,
                     UniversalId::Type type = UniversalId::Type_None, QUndoCommand *parent = 0);
-
-            virtual ~DeleteCommand();
-
-            virtual void redo();
-
-            virtual void undo();
     };
 
     class ReorderRowsCommand : public QUndoCommand
@@ -287,9 +331,20 @@ namespace CSMWorld
     };
 
 
+    /// \brief Keeps the old state of a nested table for undo
+    ///
+    /// A copy of the whole table is taken until the command has been executed. If the command
+    /// only removed or added a single row of a sequence, the copy is then replaced by the removed
+    /// row (or by nothing at all) and undo is applied to the current table instead.
     class NestedTableStoring
     {
-        NestedTableWrapperBase* mOld;
+        NestedTableWrapperBase* mOld; // whole table, removed row or 0
+        int mOldSize;
+        int mRow; // -1, if mOld holds the whole table
+
+        // not implemented
+        NestedTableStoring (const NestedTableStoring&);
+        NestedTableStoring& operator= (const NestedTableStoring&);
 
     public:
         NestedTableStoring(const IdTree& model, const std::string& id, int parentColumn);
@@ -298,10 +353,18 @@ namespace CSMWorld
 
     protected:
 
-        const NestedTableWrapperBase& getOld() const;
+        void storeRemovedRow (const IdTree& model, const QModelIndex& parentIndex, int row);
+        ///< Keep only the row \a row, if it is the only row that was removed from the table.
+
+        void storeAddedRow (const IdTree& model, const QModelIndex& parentIndex, int position);
+        ///< Drop the copy, if a single row was added to the table at \a position.
+
+        void restore (IdTree& model, const QModelIndex& parentIndex) const;
+
+        std::size_t getStoredMemory() const;
     };
 
-    class DeleteNestedCommand : public QUndoCommand, private NestedTableStoring
+    class DeleteNestedCommand : public QUndoCommand, public CommandMemory, private NestedTableStoring
     {
             IdTree& mModel;
 
@@ -321,9 +384,11 @@ namespace CSMWorld
             virtual void redo();
 
             virtual void undo();
+
+            virtual std::size_t getMemoryUsage() const;
     };
 
-    class AddNestedCommand : public QUndoCommand, private NestedTableStoring
+    class AddNestedCommand : public QUndoCommand, public CommandMemory, private NestedTableStoring
     {
             IdTree& mModel;
 
@@ -343,6 +408,8 @@ namespace CSMWorld
             virtual void redo();
 
             virtual void undo();
+
+            virtual std::size_t getMemoryUsage() const;
     };
 }
 
@@ -76,6 +76,8 @@ CSMWorld::Data::Data (ToUTF8::FromType encoding, bool fsStrict, const Files::Pat
     mResourceSystem.reset(new Resource::ResourceSystem(mVFS.get()));
 
     mResourceSystem->getSceneManager()->setShaderPath((resDir / "shaders").string());
+    // Picking intersects the meshes and the terrain
+    mResourceSystem->getSceneManager()->setBuildKdTrees(true);
 
     int index = 0;
 
@@ -5,6 +5,7 @@
 #include "../../view/widget/completerpopup.hpp"
 
 #include "data.hpp"
+#include "idcompletionmodel.hpp"
 #include "idtablebase.hpp"
 
 namespace
@@ -97,11 +98,14 @@ void CSMWorld::IdCompletionManager::generateCompleters(CSMWorld::Data &data)
             int idColumn = table->searchColumnIndex(CSMWorld::Columns::ColumnId_Id);
             if (idColumn != -1)
             {
-                std::shared_ptr<QCompleter> completer = std::make_shared<QCompleter>(table);
-                completer->setCompletionColumn(idColumn);
-                // The completion role must be Qt::DisplayRole to get the ID values from the model
-                completer->setCompletionRole(Qt::DisplayRole);
+                std::shared_ptr<CSMWorld::IdCompletionModel> &ids = mModels[current->second];
+                if (!ids)
+                    ids = std::make_shared<CSMWorld::IdCompletionModel>(*table, idColumn);
+
+                std::shared_ptr<QCompleter> completer = std::make_shared<QCompleter>(ids.get());
                 completer->setCaseSensitivity(Qt::CaseInsensitive);
+                // The IDs are kept sorted, so that completions are found by binary search
+                completer->setModelSorting(QCompleter::CaseInsensitivelySortedModel);
 
                 QAbstractItemView *popup = new CSVWidget::CompleterPopup();
                 completer->setPopup(popup); // The completer takes ownership of the popup
@@ -13,12 +13,15 @@ class QCompleter;
 namespace CSMWorld
 {
     class Data;
+    class IdCompletionModel;
 
     /// \brief Creates and stores all ID completers
     class IdCompletionManager
     {
             static const std::map<ColumnBase::Display, UniversalId::Type> sCompleterModelTypes;
 
+            // Shared by all completers for the same table; declared first to outlive the completers
+            std::map<UniversalId::Type, std::shared_ptr<IdCompletionModel> > mModels;
             std::map<ColumnBase::Display, std::shared_ptr<QCompleter> > mCompleters;
 
             // Don't allow copying
@@ -0,0 +1,139 @@
+#include "idcompletionmodel.hpp"
+
+#include <vector>
+
+#include "idtablebase.hpp"
+
+namespace
+{
+    /// Blocks of more rows than this are merged by resetting the model instead of row by row
+    const int sMaxSingleRowUpdates = 64;
+}
+
+QString CSMWorld::IdOrder::makeKey (const QString& id)
+{
+    return id;
+}
+
+int CSMWorld::IdOrder::compare (const QString& left, const QString& right)
+{
+    return QString::compare (left, right, Qt::CaseInsensitive);
+}
+
+bool CSMWorld::IdOrder::startsWith (const QString& id, const QString& prefix)
+{
+    return id.startsWith (prefix, Qt::CaseInsensitive);
+}
+
+QString CSMWorld::IdCompletionModel::getId (int row) const
+{
+    return mTable.data (mTable.index (row, mIdColumn)).toString();
+}
+
+void CSMWorld::IdCompletionModel::rebuild()
+{
+    mIds.clear();
+
+    int rows = mTable.rowCount();
+    std::vector<QString> ids;
+    ids.reserve (rows);
+    for (int row = 0; row<rows; ++row)
+        ids.push_back (getId (row));
+
+    // sorted and without duplicates
+    mIds.insert (ids);
+}
+
+CSMWorld::IdCompletionModel::IdCompletionModel (IdTableBase& table, int idColumn, QObject *parent)
+: QAbstractListModel (parent), mTable (table), mIdColumn (idColumn)
+{
+    rebuild();
+
+    connect (&mTable, SIGNAL (rowsInserted (const QModelIndex&, int, int)),
+        this, SLOT (rowsInserted (const QModelIndex&, int, int)));
+    connect (&mTable, SIGNAL (rowsAboutToBeRemoved (const QModelIndex&, int, int)),
+        this, SLOT (rowsAboutToBeRemoved (const QModelIndex&, int, int)));
+    connect (&mTable, SIGNAL (modelReset()), this, SLOT (tableReset()));
+}
+
+int CSMWorld::IdCompletionModel::rowCount (const QModelIndex& parent) const
+{
+    if (parent.isValid())
+        return 0;
+
+    return static_cast<int> (mIds.size());
+}
+
+QVariant CSMWorld::IdCompletionModel::data (const QModelIndex& index, int role) const
+{
+    if (!index.isValid() || index.column()!=0 || (role!=Qt::DisplayRole && role!=Qt::EditRole))
+        return QVariant();
+
+    return mIds.get (index.row());
+}
+
+void CSMWorld::IdCompletionModel::rowsInserted (const QModelIndex& parent, int start, int end)
+{
+    // nested rows don't add IDs
+    if (parent.isValid())
+        return;
+
+    if (end-start>=sMaxSingleRowUpdates)
+    {
+        tableReset();
+        return;
+    }
+
+    for (int row = start; row<=end; ++row)
+    {
+        QString id = getId (row);
+        int index = static_cast<int> (mIds.find (id));
+
+        if (index<static_cast<int> (mIds.size()) && mIds.get (index)==id)
+            continue;
+
+        beginInsertRows (QModelIndex(), index, index);
+        mIds.insert (id);
+        endInsertRows();
+    }
+}
+
+void CSMWorld::IdCompletionModel::rowsAboutToBeRemoved (const QModelIndex& parent, int start, int end)
+{
+    if (parent.isValid())
+        return;
+
+    if (end-start>=sMaxSingleRowUpdates)
+    {
+        // the rows are still in the table, so the reset has to skip them
+        beginResetModel();
+
+        std::vector<QString> removed;
+        for (int row = start; row<=end; ++row)
+            removed.push_back (getId (row));
+        mIds.remove (removed);
+
+        endResetModel();
+        return;
+    }
+
+    for (int row = start; row<=end; ++row)
+    {
+        QString id = getId (row);
+        int index = static_cast<int> (mIds.find (id));
+
+        if (index>=static_cast<int> (mIds.size()) || mIds.get (index)!=id)
+            continue;
+
+        beginRemoveRows (QModelIndex(), index, index);
+        mIds.remove (id);
+        endRemoveRows();
+    }
+}
+
+void CSMWorld::IdCompletionModel::tableReset()
+{
+    beginResetModel();
+    rebuild();
+    endResetModel();
+}
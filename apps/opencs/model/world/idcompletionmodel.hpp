@@ -0,0 +1,60 @@
+#ifndef CSM_WORLD_IDCOMPLETIONMODEL_H
+#define CSM_WORLD_IDCOMPLETIONMODEL_H
+
+#include <QAbstractListModel>
+#include <QString>
+
+#include <components/misc/prefixindex.hpp>
+
+namespace CSMWorld
+{
+    class IdTableBase;
+
+    /// \brief Case-insensitive order of QCompleter for Misc::BasicPrefixIndex
+    struct IdOrder
+    {
+        typedef QString Key;
+
+        static QString makeKey (const QString& id);
+
+        static int compare (const QString& left, const QString& right);
+
+        static bool startsWith (const QString& id, const QString& prefix);
+    };
+
+    /// \brief The IDs of a table, sorted case-insensitively for an ID completer
+    ///
+    /// The IDs are ordered with the same case-insensitive comparison QCompleter uses for a
+    /// CaseInsensitivelySortedModel, so that completions are found by binary search instead of
+    /// filtering the table. Row insertions and removals of the table are followed row by row.
+    class IdCompletionModel : public QAbstractListModel
+    {
+            Q_OBJECT
+
+            IdTableBase& mTable;
+            int mIdColumn;
+            Misc::BasicPrefixIndex<QString, IdOrder> mIds;
+
+            QString getId (int row) const;
+
+            void rebuild();
+
+        public:
+
+            IdCompletionModel (IdTableBase& table, int idColumn, QObject *parent = nullptr);
+
+            int rowCount (const QModelIndex& parent = QModelIndex()) const override;
+
+            QVariant data (const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+        private slots:
+
+            void rowsInserted (const QModelIndex& parent, int start, int end);
+
+            void rowsAboutToBeRemoved (const QModelIndex& parent, int start, int end);
+
+            void tableReset();
+    };
+}
+
+#endif
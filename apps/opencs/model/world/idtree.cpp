@@ -1,5 +1,7 @@
 #include "idtree.hpp"
 
+#include <memory>
+
 #include "nestedtablewrapper.hpp"
 
 #include "collectionbase.hpp"
@@ -244,7 +246,8 @@ void CSMWorld::IdTree::setNestedTable(const QModelIndex& index, const CSMWorld::
         throw std::logic_error("Tried to set nested table, but index has no children");
 
     bool removeRowsMode = false;
-    if (nestedTable.size() != this->nestedTable(index)->size())
+    std::unique_ptr<NestedTableWrapperBase> current (this->nestedTable(index));
+    if (nestedTable.size() != current->size())
     {
         emit resetStart(this->index(index.row(), 0).data().toString());
         removeRowsMode = true;
@@ -10,3 +10,28 @@ int CSMWorld::NestedTableWrapperBase::size() const
 {
     return -5;
 }
+
+bool CSMWorld::NestedTableWrapperBase::canChangeRows() const
+{
+    return false;
+}
+
+CSMWorld::NestedTableWrapperBase *CSMWorld::NestedTableWrapperBase::cloneRow (int row) const
+{
+    throw std::logic_error ("nested table does not support row operations");
+}
+
+void CSMWorld::NestedTableWrapperBase::insertRows (int row, const NestedTableWrapperBase& rows)
+{
+    throw std::logic_error ("nested table does not support row operations");
+}
+
+void CSMWorld::NestedTableWrapperBase::removeRow (int row)
+{
+    throw std::logic_error ("nested table does not support row operations");
+}
+
+std::size_t CSMWorld::NestedTableWrapperBase::getMemoryUsage() const
+{
+    return sizeof (*this);
+}
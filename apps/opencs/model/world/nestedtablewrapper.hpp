@@ -1,13 +1,107 @@
 #ifndef CSM_WOLRD_NESTEDTABLEWRAPPER_H
 #define CSM_WOLRD_NESTEDTABLEWRAPPER_H
 
+#include <cstddef>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
 namespace CSMWorld
 {
+    /// \brief Row operations on the containers that are used for nested tables
+    ///
+    /// Only sequences support them. Tables in other containers must be copied as a whole.
+    namespace NestedTableRows
+    {
+        template<typename Table>
+        bool canChangeRows (const Table& table)
+        {
+            return false;
+        }
+
+        template<typename Row>
+        bool canChangeRows (const std::vector<Row>& table)
+        {
+            return true;
+        }
+
+        template<typename Table>
+        Table copyRow (const Table& table, int row)
+        {
+            throw std::logic_error ("nested table does not support row operations");
+        }
+
+        template<typename Row>
+        std::vector<Row> copyRow (const std::vector<Row>& table, int row)
+        {
+            return std::vector<Row> (1, table.at (row));
+        }
+
+        template<typename Table>
+        void insertRows (Table& table, int row, const Table& rows)
+        {
+            throw std::logic_error ("nested table does not support row operations");
+        }
+
+        template<typename Row>
+        void insertRows (std::vector<Row>& table, int row, const std::vector<Row>& rows)
+        {
+            table.insert (table.begin()+row, rows.begin(), rows.end());
+        }
+
+        template<typename Table>
+        void removeRow (Table& table, int row)
+        {
+            throw std::logic_error ("nested table does not support row operations");
+        }
+
+        template<typename Row>
+        void removeRow (std::vector<Row>& table, int row)
+        {
+            table.erase (table.begin()+row);
+        }
+
+        template<typename Table>
+        std::size_t getMemoryUsage (const Table& table)
+        {
+            return sizeof (table);
+        }
+
+        template<typename Row>
+        std::size_t getMemoryUsage (const std::vector<Row>& table)
+        {
+            return sizeof (table) + table.capacity() * sizeof (Row);
+        }
+
+        template<typename Key, typename Value>
+        std::size_t getMemoryUsage (const std::map<Key, Value>& table)
+        {
+            // each node also holds three pointers and a colour
+            return sizeof (table) + table.size() *
+                (sizeof (typename std::map<Key, Value>::value_type) + 4 * sizeof (void *));
+        }
+    }
+
     struct NestedTableWrapperBase
     {
         virtual ~NestedTableWrapperBase();
         
         virtual int size() const;
+
+        virtual bool canChangeRows() const;
+        ///< Are cloneRow, insertRows and removeRow supported?
+
+        virtual NestedTableWrapperBase *cloneRow (int row) const;
+        ///< Create a table that contains only row \a row of this table.
+
+        virtual void insertRows (int row, const NestedTableWrapperBase& rows);
+        ///< Insert the rows of \a rows (a table of the same type) before \a row.
+
+        virtual void removeRow (int row);
+
+        virtual std::size_t getMemoryUsage() const;
+        ///< Estimated number of bytes used by the table (data on the heap owned by the rows is not
+        /// included).
         
         NestedTableWrapperBase();
     };
@@ -26,6 +120,32 @@ namespace CSMWorld
         {
             return mNestedTable.size(); //i hope that this will be enough
         }
+
+        virtual bool canChangeRows() const
+        {
+            return NestedTableRows::canChangeRows (mNestedTable);
+        }
+
+        virtual NestedTableWrapperBase *cloneRow (int row) const
+        {
+            return new NestedTableWrapper (NestedTableRows::copyRow (mNestedTable, row));
+        }
+
+        virtual void insertRows (int row, const NestedTableWrapperBase& rows)
+        {
+            NestedTableRows::insertRows (mNestedTable, row,
+                dynamic_cast<const NestedTableWrapper&> (rows).mNestedTable);
+        }
+
+        virtual void removeRow (int row)
+        {
+            NestedTableRows::removeRow (mNestedTable, row);
+        }
+
+        virtual std::size_t getMemoryUsage() const
+        {
+            return sizeof (*this) - sizeof (mNestedTable) + NestedTableRows::getMemoryUsage (mNestedTable);
+        }
     };
 }
 #endif
@@ -1,6 +1,7 @@
 #ifndef CSM_WOLRD_RECORD_H
 #define CSM_WOLRD_RECORD_H
 
+#include <cstddef>
 #include <stdexcept>
 
 namespace CSMWorld
@@ -27,6 +28,10 @@ namespace CSMWorld
         virtual void assign (const RecordBase& record) = 0;
         ///< Will throw an exception if the types don't match.
 
+        virtual std::size_t getMemoryUsage() const = 0;
+        ///< Estimated number of bytes used by the record (data on the heap owned by the ESX
+        /// records is not included).
+
         bool isDeleted() const;
 
         bool isErased() const;
@@ -51,6 +56,8 @@ namespace CSMWorld
 
         virtual void assign (const RecordBase& record);
 
+        virtual std::size_t getMemoryUsage() const;
+
         const ESXRecordT& get() const;
         ///< Throws an exception, if the record is deleted.
 
@@ -102,6 +109,12 @@ namespace CSMWorld
         *this = dynamic_cast<const Record<ESXRecordT>& > (record);
     }
 
+    template <typename ESXRecordT>
+    std::size_t Record<ESXRecordT>::getMemoryUsage() const
+    {
+        return sizeof (*this);
+    }
+
     template <typename ESXRecordT>
     const ESXRecordT& Record<ESXRecordT>::get() const
     {
@@ -0,0 +1,77 @@
+#include "refcellindex.hpp"
+
+void CSMWorld::RefCellIndex::addRow (int row, const std::string& cell)
+{
+    mCellIndex[cell].insert (row);
+}
+
+void CSMWorld::RefCellIndex::removeRow (int row, const std::string& cell)
+{
+    std::map<std::string, std::set<int> >::iterator iter = mCellIndex.find (cell);
+
+    if (iter==mCellIndex.end())
+        return;
+
+    iter->second.erase (row);
+
+    if (iter->second.empty())
+        mCellIndex.erase (iter);
+}
+
+void CSMWorld::RefCellIndex::moveRow (int row, int newRow)
+{
+    std::set<int>& rows = mCellIndex.find (mRowCells[row])->second;
+
+    // newRow takes the place of row in the order of the set, so it can be inserted right there
+    std::set<int>::iterator next = rows.erase (rows.find (row));
+    rows.insert (next, newRow);
+}
+
+int CSMWorld::RefCellIndex::getSize() const
+{
+    return static_cast<int> (mRowCells.size());
+}
+
+const std::set<int>& CSMWorld::RefCellIndex::getRows (const std::string& cell) const
+{
+    static const std::set<int> empty;
+
+    std::map<std::string, std::set<int> >::const_iterator iter = mCellIndex.find (cell);
+
+    return iter==mCellIndex.end() ? empty : iter->second;
+}
+
+void CSMWorld::RefCellIndex::insertRow (int row, const std::string& cell)
+{
+    // Going from the back, every row moves to a number its successor in the same cell has left
+    for (int i=static_cast<int> (mRowCells.size())-1; i>=row; --i)
+        moveRow (i, i+1);
+
+    mRowCells.insert (mRowCells.begin()+row, cell);
+    addRow (row, cell);
+}
+
+void CSMWorld::RefCellIndex::removeRows (int row, int count)
+{
+    for (int i=row; i<row+count; ++i)
+        removeRow (i, mRowCells[i]);
+
+    // Going from the front, every row moves to a number that has been removed or left by its
+    // predecessor in the same cell
+    for (int i=row+count; i<static_cast<int> (mRowCells.size()); ++i)
+        moveRow (i, i-count);
+
+    mRowCells.erase (mRowCells.begin()+row, mRowCells.begin()+row+count);
+}
+
+void CSMWorld::RefCellIndex::setCell (int row, const std::string& cell)
+{
+    std::string& oldCell = mRowCells.at (row);
+
+    if (cell==oldCell)
+        return;
+
+    removeRow (row, oldCell);
+    addRow (row, cell);
+    oldCell = cell;
+}
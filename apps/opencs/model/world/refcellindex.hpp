@@ -0,0 +1,46 @@
+#ifndef CSM_WOLRD_REFCELLINDEX_H
+#define CSM_WOLRD_REFCELLINDEX_H
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace CSMWorld
+{
+    /// \brief Rows of the references in each cell
+    ///
+    /// Keeps the cell key of every row of a reference table and the rows belonging to each cell
+    /// key. Inserting or removing rows shifts the row numbers of the following rows in place.
+    class RefCellIndex
+    {
+            std::vector<std::string> mRowCells; // cell key of each row
+            std::map<std::string, std::set<int> > mCellIndex; // cell key, rows
+
+            void addRow (int row, const std::string& cell);
+
+            void removeRow (int row, const std::string& cell);
+
+            void moveRow (int row, int newRow);
+            ///< Change the number of \a row to \a newRow, which must not be taken by a row of the
+            /// same cell and must not pass any other row of the same cell.
+
+        public:
+
+            int getSize() const;
+
+            const std::set<int>& getRows (const std::string& cell) const;
+            ///< Return the rows of \a cell (an empty set, if there are none).
+
+            void insertRow (int row, const std::string& cell);
+            ///< Insert a row before \a row, moving all rows starting from \a row by one.
+
+            void removeRows (int row, int count);
+            ///< Remove \a count rows starting from \a row, moving the following rows back.
+
+            void setCell (int row, const std::string& cell);
+            ///< Change the cell of \a row.
+    };
+}
+
+#endif
@@ -144,3 +144,65 @@ std::string CSMWorld::RefCollection::getNewId()
     stream << "ref#" << mNextId++;
     return stream.str();
 }
+
+const std::set<int>& CSMWorld::RefCollection::getRefsInCell (const std::string& cellId) const
+{
+    return mCellIndex.getRows (Misc::StringUtils::lowerCase (cellId));
+}
+
+void CSMWorld::RefCollection::setData (int index, int column, const QVariant& data)
+{
+    Collection<CellRef>::setData (index, column, data);
+    updateCellIndex (index);
+}
+
+void CSMWorld::RefCollection::removeRows (int index, int count)
+{
+    Collection<CellRef>::removeRows (index, count);
+    mCellIndex.removeRows (index, count);
+}
+
+void CSMWorld::RefCollection::replace (int index, const RecordBase& record)
+{
+    Collection<CellRef>::replace (index, record);
+    updateCellIndex (index);
+}
+
+void CSMWorld::RefCollection::insertRecord (const RecordBase& record, int index,
+    UniversalId::Type type)
+{
+    Collection<CellRef>::insertRecord (record, index, type);
+    mCellIndex.insertRow (index, getCellKey (index));
+}
+
+bool CSMWorld::RefCollection::reorderRows (int baseIndex, const std::vector<int>& newOrder)
+{
+    if (!Collection<CellRef>::reorderRows (baseIndex, newOrder))
+        return false;
+
+    for (int i=0; i<static_cast<int> (newOrder.size()); ++i)
+        updateCellIndex (baseIndex+i);
+
+    return true;
+}
+
+void CSMWorld::RefCollection::setRecord (int index, const Record<CellRef>& record)
+{
+    Collection<CellRef>::setRecord (index, record);
+    updateCellIndex (index);
+}
+
+std::string CSMWorld::RefCollection::getCellKey (int index) const
+{
+    const Record<CellRef>& record = getRecord (index);
+
+    if (record.isErased())
+        return "";
+
+    return Misc::StringUtils::lowerCase (record.get().mCell);
+}
+
+void CSMWorld::RefCollection::updateCellIndex (int index)
+{
+    mCellIndex.setCell (index, getCellKey (index));
+}
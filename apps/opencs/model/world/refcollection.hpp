@@ -2,12 +2,14 @@
 #define CSM_WOLRD_REFCOLLECTION_H
 
 #include <map>
+#include <set>
 
 #include "../doc/stage.hpp"
 
 #include "collection.hpp"
 #include "ref.hpp"
 #include "record.hpp"
+#include "refcellindex.hpp"
 
 namespace CSMWorld
 {
@@ -20,6 +22,13 @@ namespace CSMWorld
             Collection<Cell>& mCells;
             int mNextId;
 
+            RefCellIndex mCellIndex; // lower case cell ID
+
+            std::string getCellKey (int index) const;
+
+            void updateCellIndex (int index);
+            ///< Update the index after the cell or the state of the record at \a index has changed.
+
         public:
             // MSVC needs the constructor for a class inheriting a template to be defined in header
             RefCollection (Collection<Cell>& cells)
@@ -31,6 +40,23 @@ namespace CSMWorld
             ///< Load a sequence of references.
 
             std::string getNewId();
+
+            const std::set<int>& getRefsInCell (const std::string& cellId) const;
+            ///< Return the rows of the references in \a cellId (case-insensitive), including
+            /// deleted references.
+
+            virtual void setData (int index, int column, const QVariant& data);
+
+            virtual void removeRows (int index, int count);
+
+            virtual void replace (int index, const RecordBase& record);
+
+            virtual void insertRecord (const RecordBase& record, int index,
+                UniversalId::Type type = UniversalId::Type_None);
+
+            virtual bool reorderRows (int baseIndex, const std::vector<int>& newOrder);
+
+            void setRecord (int index, const Record<CellRef>& record);
     };
 }
 
@@ -49,6 +49,37 @@ CSMWorld::CellCoordinates CSMWorld::RegionMap::getIndex (const Cell& cell) const
     return CellCoordinates (x, y);
 }
 
+CSMWorld::CellCoordinates CSMWorld::RegionMap::getChunk (const CellCoordinates& index)
+{
+    int x = index.getX()>=0 ? index.getX()/sChunkSize : -((-index.getX()-1)/sChunkSize)-1;
+    int y = index.getY()>=0 ? index.getY()/sChunkSize : -((-index.getY()-1)/sChunkSize)-1;
+
+    return CellCoordinates (x, y);
+}
+
+int CSMWorld::RegionMap::getChunkOffset (const CellCoordinates& index)
+{
+    CellCoordinates chunk = getChunk (index);
+
+    return (index.getY()-chunk.getY()*sChunkSize)*sChunkSize + index.getX()-chunk.getX()*sChunkSize;
+}
+
+const CSMWorld::RegionMap::CellDescription *CSMWorld::RegionMap::findCell (
+    const CellCoordinates& index) const
+{
+    std::map<CellCoordinates, Chunk>::const_iterator chunk = mChunks.find (getChunk (index));
+
+    if (chunk==mChunks.end())
+        return 0;
+
+    int offset = getChunkOffset (index);
+
+    if (!chunk->second.mPresent[offset])
+        return 0;
+
+    return &chunk->second.mCells[offset];
+}
+
 void CSMWorld::RegionMap::buildRegions()
 {
     const IdCollection<ESM::Region>& regions = mData.getRegions();
@@ -78,13 +109,7 @@ void CSMWorld::RegionMap::buildMap()
         const Cell& cell2 = cell.get();
 
         if (cell2.isExterior())
-        {
-            CellDescription description (cell);
-
-            CellCoordinates index = getIndex (cell2);
-
-            mMap.insert (std::make_pair (index, description));
-        }
+            addCell (getIndex (cell2), CellDescription (cell));
     }
 
     std::pair<CellCoordinates, CellCoordinates> mapSize = getSize();
@@ -95,28 +120,33 @@ void CSMWorld::RegionMap::buildMap()
 
 void CSMWorld::RegionMap::addCell (const CellCoordinates& index, const CellDescription& description)
 {
-    std::map<CellCoordinates, CellDescription>::iterator cell = mMap.find (index);
+    Chunk& chunk = mChunks[getChunk (index)];
 
-    if (cell!=mMap.end())
-    {
-        cell->second = description;
-    }
+    int offset = getChunkOffset (index);
+
+    CellDescription& cell = chunk.mCells[offset];
+
+    if (chunk.mPresent[offset])
+        removeRegionCell (cell.mRegion, index);
     else
     {
-        updateSize();
-
-        mMap.insert (std::make_pair (index, description));
+        chunk.mPresent.set (offset);
+        ++mColumns[index.getX()];
+        ++mRows[index.getY()];
     }
 
-    QModelIndex index2 = getIndex (index);
+    cell = description;
 
-    dataChanged (index2, index2);
+    if (!cell.mRegion.empty())
+        mRegionCells[Misc::StringUtils::lowerCase (cell.mRegion)].insert (index);
 }
 
 void CSMWorld::RegionMap::addCells (int start, int end)
 {
     const IdCollection<Cell>& cells = mData.getCells();
 
+    std::vector<std::pair<CellCoordinates, CellDescription> > added;
+
     for (int i=start; i<=end; ++i)
     {
         const Record<Cell>& cell = cells.getRecord (i);
@@ -124,29 +154,92 @@ void CSMWorld::RegionMap::addCells (int start, int end)
         const Cell& cell2 = cell.get();
 
         if (cell2.isExterior())
-        {
-            CellCoordinates index = getIndex (cell2);
+            added.push_back (std::make_pair (getIndex (cell2), CellDescription (cell)));
+    }
+
+    if (added.empty())
+        return;
+
+    // Grow the map first, so that views never see a cell before the row and column it is in
+    std::pair<CellCoordinates, CellCoordinates> size = getSize();
+
+    bool empty = mColumns.empty();
 
-            CellDescription description (cell);
+    for (std::vector<std::pair<CellCoordinates, CellDescription> >::const_iterator iter (added.begin());
+        iter!=added.end(); ++iter)
+    {
+        const CellCoordinates& index = iter->first;
 
-            addCell (index, description);
+        if (empty)
+        {
+            size = std::make_pair (index, index.move (1, 1));
+            empty = false;
         }
+        else
+            size = std::make_pair (
+                CellCoordinates (std::min (size.first.getX(), index.getX()),
+                    std::min (size.first.getY(), index.getY())),
+                CellCoordinates (std::max (size.second.getX(), index.getX()+1),
+                    std::max (size.second.getY(), index.getY()+1)));
     }
+
+    updateColumns (size.first.getX(), size.second.getX());
+    updateRows (size.first.getY(), size.second.getY());
+
+    std::vector<CellCoordinates> update;
+
+    for (std::vector<std::pair<CellCoordinates, CellDescription> >::const_iterator iter (added.begin());
+        iter!=added.end(); ++iter)
+    {
+        addCell (iter->first, iter->second);
+        update.push_back (iter->first);
+    }
+
+    updateCells (update);
 }
 
-void CSMWorld::RegionMap::removeCell (const CellCoordinates& index)
+bool CSMWorld::RegionMap::removeCell (const CellCoordinates& index)
 {
-    std::map<CellCoordinates, CellDescription>::iterator cell = mMap.find (index);
+    std::map<CellCoordinates, Chunk>::iterator chunk = mChunks.find (getChunk (index));
 
-    if (cell!=mMap.end())
-    {
-        mMap.erase (cell);
+    if (chunk==mChunks.end())
+        return false;
+
+    int offset = getChunkOffset (index);
+
+    if (!chunk->second.mPresent[offset])
+        return false;
+
+    CellDescription& cell = chunk->second.mCells[offset];
+
+    removeRegionCell (cell.mRegion, index);
+
+    cell = CellDescription();
+    chunk->second.mPresent.reset (offset);
+
+    if (chunk->second.mPresent.none())
+        mChunks.erase (chunk);
+
+    if (--mColumns[index.getX()]==0)
+        mColumns.erase (index.getX());
+
+    if (--mRows[index.getY()]==0)
+        mRows.erase (index.getY());
 
-        QModelIndex index2 = getIndex (index);
+    return true;
+}
 
-        dataChanged (index2, index2);
+void CSMWorld::RegionMap::removeRegionCell (const std::string& region, const CellCoordinates& index)
+{
+    std::map<std::string, std::set<CellCoordinates> >::iterator iter =
+        mRegionCells.find (Misc::StringUtils::lowerCase (region));
 
-        updateSize();
+    if (iter!=mRegionCells.end())
+    {
+        iter->second.erase (index);
+
+        if (iter->second.empty())
+            mRegionCells.erase (iter);
     }
 }
 
@@ -166,22 +259,49 @@ void CSMWorld::RegionMap::removeRegion (const std::string& region)
 
 void CSMWorld::RegionMap::updateRegions (const std::vector<std::string>& regions)
 {
-    std::vector<std::string> regions2 (regions);
+    std::vector<CellCoordinates> update;
+
+    for (std::vector<std::string>::const_iterator iter (regions.begin()); iter!=regions.end(); ++iter)
+    {
+        std::map<std::string, std::set<CellCoordinates> >::const_iterator cells =
+            mRegionCells.find (Misc::StringUtils::lowerCase (*iter));
+
+        if (cells!=mRegionCells.end())
+            update.insert (update.end(), cells->second.begin(), cells->second.end());
+    }
+
+    updateCells (update);
+}
+
+void CSMWorld::RegionMap::updateCells (const std::vector<CellCoordinates>& cells)
+{
+    std::vector<std::pair<int, int> > indices; // row, column
 
-    std::for_each (regions2.begin(), regions2.end(), Misc::StringUtils::lowerCaseInPlace);
-    std::sort (regions2.begin(), regions2.end());
+    indices.reserve (cells.size());
 
-    for (std::map<CellCoordinates, CellDescription>::const_iterator iter (mMap.begin());
-         iter!=mMap.end(); ++iter)
+    for (std::vector<CellCoordinates>::const_iterator iter (cells.begin()); iter!=cells.end(); ++iter)
     {
-        if (!iter->second.mRegion.empty() &&
-            std::find (regions2.begin(), regions2.end(),
-            Misc::StringUtils::lowerCase (iter->second.mRegion))!=regions2.end())
-        {
-            QModelIndex index = getIndex (iter->first);
+        QModelIndex index = getIndex (*iter);
+        indices.push_back (std::make_pair (index.row(), index.column()));
+    }
 
-            dataChanged (index, index);
-        }
+    std::sort (indices.begin(), indices.end());
+    indices.erase (std::unique (indices.begin(), indices.end()), indices.end());
+
+    std::vector<std::pair<int, int> >::const_iterator iter (indices.begin());
+
+    while (iter!=indices.end())
+    {
+        std::vector<std::pair<int, int> >::const_iterator last = iter;
+
+        for (std::vector<std::pair<int, int> >::const_iterator next = iter+1;
+            next!=indices.end() && next->first==iter->first && next->second==last->second+1; ++next)
+            last = next;
+
+        dataChanged (QAbstractTableModel::index (iter->first, iter->second),
+            QAbstractTableModel::index (last->first, last->second));
+
+        iter = last+1;
     }
 }
 
@@ -189,21 +309,55 @@ void CSMWorld::RegionMap::updateSize()
 {
     std::pair<CellCoordinates, CellCoordinates> size = getSize();
 
-    if (int diff = size.first.getX() - mMin.getX())
+    updateColumns (size.first.getX(), size.second.getX());
+    updateRows (size.first.getY(), size.second.getY());
+}
+
+void CSMWorld::RegionMap::updateColumns (int min, int max)
+{
+    // columns are ordered by ascending X coordinate
+    if (min>=mMax.getX() || max<=mMin.getX())
     {
-        beginInsertColumns (QModelIndex(), 0, std::abs (diff)-1);
-        mMin = CellCoordinates (size.first.getX(), mMin.getY());
-        endInsertColumns();
+        // no overlap with the current range
+        if (int columns = columnCount())
+        {
+            beginRemoveColumns (QModelIndex(), 0, columns-1);
+            mMin = CellCoordinates (min, mMin.getY());
+            mMax = CellCoordinates (min, mMax.getY());
+            endRemoveColumns();
+        }
+        else
+        {
+            mMin = CellCoordinates (min, mMin.getY());
+            mMax = CellCoordinates (min, mMax.getY());
+        }
+
+        if (max>min)
+        {
+            beginInsertColumns (QModelIndex(), 0, max-min-1);
+            mMax = CellCoordinates (max, mMax.getY());
+            endInsertColumns();
+        }
+
+        return;
     }
 
-    if (int diff = size.first.getY() - mMin.getY())
+    if (int diff = min - mMin.getX())
     {
-        beginInsertRows (QModelIndex(), 0, std::abs (diff)-1);
-        mMin = CellCoordinates (mMin.getX(), size.first.getY());
-        endInsertRows();
+        if (diff<0)
+            beginInsertColumns (QModelIndex(), 0, -diff-1);
+        else
+            beginRemoveColumns (QModelIndex(), 0, diff-1);
+
+        mMin = CellCoordinates (min, mMin.getY());
+
+        if (diff<0)
+            endInsertColumns();
+        else
+            endRemoveColumns();
     }
 
-    if (int diff = size.second.getX() - mMax.getX())
+    if (int diff = max - mMax.getX())
     {
         int columns = columnCount();
 
@@ -212,62 +366,84 @@ void CSMWorld::RegionMap::updateSize()
         else
             beginRemoveColumns (QModelIndex(), columns+diff, columns-1);
 
-        mMax = CellCoordinates (size.second.getX(), mMax.getY());
-        endInsertColumns();
-    }
-
-    if (int diff = size.second.getY() - mMax.getY())
-    {
-        int rows = rowCount();
+        mMax = CellCoordinates (max, mMax.getY());
 
         if (diff>0)
-            beginInsertRows (QModelIndex(), rows, rows+diff-1);
+            endInsertColumns();
         else
-            beginRemoveRows (QModelIndex(), rows+diff, rows-1);
-
-        mMax = CellCoordinates (mMax.getX(), size.second.getY());
-        endInsertRows();
+            endRemoveColumns();
     }
 }
 
-std::pair<CSMWorld::CellCoordinates, CSMWorld::CellCoordinates> CSMWorld::RegionMap::getSize() const
+void CSMWorld::RegionMap::updateRows (int min, int max)
 {
-    const IdCollection<Cell>& cells = mData.getCells();
+    // rows are ordered by descending Y coordinate
+    if (min>=mMax.getY() || max<=mMin.getY())
+    {
+        // no overlap with the current range
+        if (int rows = rowCount())
+        {
+            beginRemoveRows (QModelIndex(), 0, rows-1);
+            mMin = CellCoordinates (mMin.getX(), min);
+            mMax = CellCoordinates (mMax.getX(), min);
+            endRemoveRows();
+        }
+        else
+        {
+            mMin = CellCoordinates (mMin.getX(), min);
+            mMax = CellCoordinates (mMax.getX(), min);
+        }
 
-    int size = cells.getSize();
+        if (max>min)
+        {
+            beginInsertRows (QModelIndex(), 0, max-min-1);
+            mMax = CellCoordinates (mMax.getX(), max);
+            endInsertRows();
+        }
+
+        return;
+    }
 
-    CellCoordinates min (0, 0);
-    CellCoordinates max (0, 0);
+    if (int diff = max - mMax.getY())
+    {
+        if (diff>0)
+            beginInsertRows (QModelIndex(), 0, diff-1);
+        else
+            beginRemoveRows (QModelIndex(), 0, -diff-1);
 
-    for (int i=0; i<size; ++i)
+        mMax = CellCoordinates (mMax.getX(), max);
+
+        if (diff>0)
+            endInsertRows();
+        else
+            endRemoveRows();
+    }
+
+    if (int diff = min - mMin.getY())
     {
-        const Record<Cell>& cell = cells.getRecord (i);
+        int rows = rowCount();
 
-        const Cell& cell2 = cell.get();
+        if (diff<0)
+            beginInsertRows (QModelIndex(), rows, rows-diff-1);
+        else
+            beginRemoveRows (QModelIndex(), rows-diff, rows-1);
 
-        if (cell2.isExterior())
-        {
-            CellCoordinates index = getIndex (cell2);
+        mMin = CellCoordinates (mMin.getX(), min);
 
-            if (min==max)
-            {
-                min = index;
-                max = min.move (1, 1);
-            }
-            else
-            {
-                if (index.getX()<min.getX())
-                    min = CellCoordinates (index.getX(), min.getY());
-                else if (index.getX()>=max.getX())
-                    max = CellCoordinates (index.getX()+1, max.getY());
-
-                if (index.getY()<min.getY())
-                    min = CellCoordinates (min.getX(), index.getY());
-                else if (index.getY()>=max.getY())
-                    max = CellCoordinates (max.getX(), index.getY() + 1);
-            }
-        }
+        if (diff<0)
+            endInsertRows();
+        else
+            endRemoveRows();
     }
+}
+
+std::pair<CSMWorld::CellCoordinates, CSMWorld::CellCoordinates> CSMWorld::RegionMap::getSize() const
+{
+    if (mColumns.empty())
+        return std::make_pair (CellCoordinates (0, 0), CellCoordinates (0, 0));
+
+    CellCoordinates min (mColumns.begin()->first, mRows.begin()->first);
+    CellCoordinates max (mColumns.rbegin()->first+1, mRows.rbegin()->first+1);
 
     return std::make_pair (min, max);
 }
@@ -321,23 +497,20 @@ QVariant CSMWorld::RegionMap::data (const QModelIndex& index, int role) const
     {
         /// \todo GUI class in non-GUI code. Needs to be addressed eventually.
 
-        std::map<CellCoordinates, CellDescription>::const_iterator cell =
-            mMap.find (getIndex (index));
-
-        if (cell!=mMap.end())
+        if (const CellDescription *cell = findCell (getIndex (index)))
         {
-            if (cell->second.mDeleted)
+            if (cell->mDeleted)
                 return QBrush (Qt::red, Qt::DiagCrossPattern);
 
             std::map<std::string, unsigned int>::const_iterator iter =
-                mColours.find (Misc::StringUtils::lowerCase (cell->second.mRegion));
+                mColours.find (Misc::StringUtils::lowerCase (cell->mRegion));
 
             if (iter!=mColours.end())
                 return QBrush (QColor (iter->second & 0xff, 
                                        (iter->second >> 8) & 0xff, 
                                        (iter->second >> 16) & 0xff));
 
-            if (cell->second.mRegion.empty())
+            if (cell->mRegion.empty())
                 return QBrush (Qt::Dense6Pattern); // no region
 
             return QBrush (Qt::red, Qt::Dense6Pattern); // invalid region
@@ -354,28 +527,25 @@ QVariant CSMWorld::RegionMap::data (const QModelIndex& index, int role) const
 
         stream << cellIndex;
 
-        std::map<CellCoordinates, CellDescription>::const_iterator cell =
-            mMap.find (cellIndex);
-
-        if (cell!=mMap.end())
+        if (const CellDescription *cell = findCell (cellIndex))
         {
-            if (!cell->second.mName.empty())
-                stream << " " << cell->second.mName;
+            if (!cell->mName.empty())
+                stream << " " << cell->mName;
 
-            if (cell->second.mDeleted)
+            if (cell->mDeleted)
                 stream << " (deleted)";
 
-            if (!cell->second.mRegion.empty())
+            if (!cell->mRegion.empty())
             {
                 stream << "<br>";
 
                 std::map<std::string, unsigned int>::const_iterator iter =
-                    mColours.find (Misc::StringUtils::lowerCase (cell->second.mRegion));
+                    mColours.find (Misc::StringUtils::lowerCase (cell->mRegion));
 
                 if (iter!=mColours.end())
-                    stream << cell->second.mRegion;
+                    stream << cell->mRegion;
                 else
-                    stream << "<font color=red>" << cell->second.mRegion << "</font>";
+                    stream << "<font color=red>" << cell->mRegion << "</font>";
             }
         }
         else
@@ -388,11 +558,10 @@ QVariant CSMWorld::RegionMap::data (const QModelIndex& index, int role) const
     {
         CellCoordinates cellIndex = getIndex (index);
 
-        std::map<CellCoordinates, CellDescription>::const_iterator cell =
-            mMap.find (cellIndex);
+        const CellDescription *cell = findCell (cellIndex);
 
-        if (cell!=mMap.end() && !cell->second.mRegion.empty())
-            return QString::fromUtf8 (Misc::StringUtils::lowerCase (cell->second.mRegion).c_str());
+        if (cell && !cell->mRegion.empty())
+            return QString::fromUtf8 (Misc::StringUtils::lowerCase (cell->mRegion).c_str());
     }
 
     if (role==Role_CellId)
@@ -461,7 +630,7 @@ void CSMWorld::RegionMap::regionsChanged (const QModelIndex& topLeft, const QMod
 
     const IdCollection<ESM::Region>& regions = mData.getRegions();
 
-    for (int i=topLeft.row(); i<=bottomRight.column(); ++i)
+    for (int i=topLeft.row(); i<=bottomRight.row(); ++i)
     {
         const Record<ESM::Region>& region = regions.getRecord (i);
 
@@ -480,6 +649,8 @@ void CSMWorld::RegionMap::cellsAboutToBeRemoved (const QModelIndex& parent, int
 {
     const IdCollection<Cell>& cells = mData.getCells();
 
+    std::vector<CellCoordinates> update;
+
     for (int i=start; i<=end; ++i)
     {
         const Record<Cell>& cell = cells.getRecord (i);
@@ -487,8 +658,16 @@ void CSMWorld::RegionMap::cellsAboutToBeRemoved (const QModelIndex& parent, int
         const Cell& cell2 = cell.get();
 
         if (cell2.isExterior())
-            removeCell (getIndex (cell2));
+        {
+            CellCoordinates index = getIndex (cell2);
+
+            if (removeCell (index))
+                update.push_back (index);
+        }
     }
+
+    updateCells (update);
+    updateSize();
 }
 
 void CSMWorld::RegionMap::cellsInserted (const QModelIndex& parent, int start, int end)
@@ -1,7 +1,9 @@
 #ifndef CSM_WOLRD_REGIONMAP_H
 #define CSM_WOLRD_REGIONMAP_H
 
+#include <bitset>
 #include <map>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -43,8 +45,22 @@ namespace CSMWorld
                 CellDescription (const Record<Cell>& cell);
             };
 
+            static const int sChunkSize = 16;
+
+            /// \brief Square block of cells
+            ///
+            /// Chunks are only allocated for areas of the map that contain cells.
+            struct Chunk
+            {
+                CellDescription mCells[sChunkSize*sChunkSize];
+                std::bitset<sChunkSize*sChunkSize> mPresent;
+            };
+
             Data& mData;
-            std::map<CellCoordinates, CellDescription> mMap;
+            std::map<CellCoordinates, Chunk> mChunks; ///< chunk coordinates, chunk
+            std::map<int, int> mColumns; ///< X coordinate, number of cells
+            std::map<int, int> mRows; ///< Y coordinate, number of cells
+            std::map<std::string, std::set<CellCoordinates> > mRegionCells; ///< region ID, cells
             CellCoordinates mMin; ///< inclusive
             CellCoordinates mMax; ///< exclusive
             std::map<std::string, unsigned int> mColours; ///< region ID, colour (RGBA)
@@ -56,18 +72,34 @@ namespace CSMWorld
 
             CellCoordinates getIndex (const Cell& cell) const;
 
+            static CellCoordinates getChunk (const CellCoordinates& index);
+
+            static int getChunkOffset (const CellCoordinates& index);
+
+            const CellDescription *findCell (const CellCoordinates& index) const;
+            ///< Return 0, if there is no cell at \a index.
+
             void buildRegions();
 
             void buildMap();
 
             void addCell (const CellCoordinates& index, const CellDescription& description);
             ///< May be called on a cell that is already in the map (in which case an update is
-            // performed)
+            /// performed)
+            ///
+            /// \note This function does not update the size of the model or notify views.
 
             void addCells (int start, int end);
 
-            void removeCell (const CellCoordinates& index);
+            bool removeCell (const CellCoordinates& index);
             ///< May be called on a cell that is not in the map (in which case the call is ignored)
+            ///
+            /// \return Was a cell removed?
+            ///
+            /// \note This function does not update the size of the model or notify views.
+
+            void removeRegionCell (const std::string& region, const CellCoordinates& index);
+            ///< Remove \a index from the list of cells in \a region
 
             void addRegion (const std::string& region, unsigned int colour);
             ///< May be called on a region that is already listed (in which case an update is
@@ -83,8 +115,16 @@ namespace CSMWorld
             void updateRegions (const std::vector<std::string>& regions);
             ///< Update cells affected by the listed regions
 
+            void updateCells (const std::vector<CellCoordinates>& cells);
+            ///< Notify views about changes to the listed cells (one dataChanged signal per
+            /// horizontal run of cells)
+
             void updateSize();
 
+            void updateColumns (int min, int max);
+
+            void updateRows (int min, int max);
+
             std::pair<CellCoordinates, CellCoordinates> getSize() const;
 
         public:
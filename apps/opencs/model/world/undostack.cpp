@@ -0,0 +1,364 @@
+#include "undostack.hpp"
+
+#include <stdexcept>
+
+#include <QUndoCommand>
+
+class CSMWorld::UndoStack::Macro : public QUndoCommand, public CommandMemory
+{
+        std::vector<QUndoCommand *> mCommands;
+
+    public:
+
+        Macro (const QString& text) : QUndoCommand (text) {}
+
+        virtual ~Macro()
+        {
+            for (std::vector<QUndoCommand *>::iterator iter (mCommands.begin()); iter!=mCommands.end(); ++iter)
+                delete *iter;
+        }
+
+        void add (QUndoCommand *command)
+        {
+            mCommands.push_back (command);
+        }
+
+        QUndoCommand *getLast() const
+        {
+            return mCommands.empty() ? 0 : mCommands.back();
+        }
+
+        virtual void redo()
+        {
+            for (std::vector<QUndoCommand *>::iterator iter (mCommands.begin()); iter!=mCommands.end(); ++iter)
+                (*iter)->redo();
+        }
+
+        virtual void undo()
+        {
+            for (std::vector<QUndoCommand *>::reverse_iterator iter (mCommands.rbegin());
+                iter!=mCommands.rend(); ++iter)
+                (*iter)->undo();
+        }
+
+        virtual std::size_t getMemoryUsage() const
+        {
+            std::size_t memory = sizeof (Macro) - sizeof (QUndoCommand) +
+                mCommands.capacity() * sizeof (QUndoCommand *);
+
+            for (std::vector<QUndoCommand *>::const_iterator iter (mCommands.begin()); iter!=mCommands.end(); ++iter)
+                memory += UndoStack::getMemoryUsage (**iter);
+
+            return memory;
+        }
+};
+
+CSMWorld::CommandMemory::~CommandMemory() {}
+
+void CSMWorld::UndoStack::setIndex (int index, bool clean)
+{
+    bool wasClean = mIndex==mCleanIndex;
+
+    mIndex = index;
+
+    if (clean)
+        mCleanIndex = mIndex;
+
+    emit indexChanged (mIndex);
+    emit canUndoChanged (canUndo());
+    emit undoTextChanged (undoText());
+    emit canRedoChanged (canRedo());
+    emit redoTextChanged (redoText());
+
+    bool isClean = mIndex==mCleanIndex;
+
+    if (isClean!=wasClean)
+        emit cleanChanged (isClean);
+}
+
+void CSMWorld::UndoStack::discardRedo()
+{
+    while (static_cast<int> (mCommands.size())>mIndex)
+    {
+        mMemory -= mCommands.back().mMemory;
+        delete mCommands.back().mCommand;
+        mCommands.pop_back();
+    }
+
+    if (mCleanIndex>mIndex)
+        mCleanIndex = -1;
+}
+
+void CSMWorld::UndoStack::addCommand (QUndoCommand *command)
+{
+    Entry entry;
+    entry.mCommand = command;
+    entry.mMemory = getMemoryUsage (*command);
+
+    mCommands.push_back (entry);
+    mMemory += entry.mMemory;
+
+    checkMemoryLimit (mIndex);
+    setIndex (mIndex+1, false);
+}
+
+void CSMWorld::UndoStack::checkMemoryLimit (int discardable)
+{
+    while (mMemoryLimit>0 && mMemory>mMemoryLimit && discardable>0)
+    {
+        mMemory -= mCommands.front().mMemory;
+        delete mCommands.front().mCommand;
+        mCommands.pop_front();
+
+        --discardable;
+        --mIndex;
+
+        // the state before the discarded command can not be reached anymore
+        if (mCleanIndex==0)
+            mCleanIndex = -1;
+        else if (mCleanIndex>0)
+            --mCleanIndex;
+    }
+}
+
+CSMWorld::UndoStack::UndoStack (QObject *parent)
+: QObject (parent), mIndex (0), mCleanIndex (0), mMemory (0), mMemoryLimit (0)
+{}
+
+CSMWorld::UndoStack::~UndoStack()
+{
+    // open macros are owned by the top-level macro on the stack
+    for (std::deque<Entry>::iterator iter (mCommands.begin()); iter!=mCommands.end(); ++iter)
+        delete iter->mCommand;
+}
+
+void CSMWorld::UndoStack::push (QUndoCommand *command)
+{
+    command->redo();
+
+    bool macro = !mMacros.empty();
+
+    QUndoCommand *previous = 0;
+
+    if (macro)
+        previous = mMacros.back()->getLast();
+    else
+    {
+        discardRedo();
+
+        if (mIndex>0)
+            previous = mCommands[mIndex-1].mCommand;
+    }
+
+    // same rules as QUndoStack: never merge into the clean state, unless inside of a macro
+    if (previous && previous->id()!=-1 && previous->id()==command->id() &&
+        (macro || mIndex!=mCleanIndex) && previous->mergeWith (command))
+    {
+        delete command;
+
+        if (!macro)
+        {
+            Entry& entry = mCommands[mIndex-1];
+            mMemory -= entry.mMemory;
+            entry.mMemory = getMemoryUsage (*entry.mCommand);
+            mMemory += entry.mMemory;
+
+            checkMemoryLimit (mIndex-1);
+            setIndex (mIndex, false);
+        }
+
+        return;
+    }
+
+    if (macro)
+        mMacros.back()->add (command);
+    else
+        addCommand (command);
+}
+
+void CSMWorld::UndoStack::beginMacro (const QString& text)
+{
+    Macro *macro = new Macro (text);
+
+    if (mMacros.empty())
+    {
+        discardRedo();
+
+        // The memory of the macro is counted, once it is complete.
+        Entry entry;
+        entry.mCommand = macro;
+        entry.mMemory = 0;
+        mCommands.push_back (entry);
+    }
+    else
+        mMacros.back()->add (macro);
+
+    mMacros.push_back (macro);
+
+    if (mMacros.size()==1)
+    {
+        emit canUndoChanged (false);
+        emit undoTextChanged ("");
+        emit canRedoChanged (false);
+        emit redoTextChanged ("");
+    }
+}
+
+void CSMWorld::UndoStack::endMacro()
+{
+    if (mMacros.empty())
+        throw std::logic_error ("no macro to end on undo stack");
+
+    mMacros.pop_back();
+
+    if (mMacros.empty())
+    {
+        Entry& entry = mCommands.back();
+        entry.mMemory = getMemoryUsage (*entry.mCommand);
+        mMemory += entry.mMemory;
+
+        checkMemoryLimit (mIndex);
+        setIndex (mIndex+1, false);
+    }
+}
+
+bool CSMWorld::UndoStack::canUndo() const
+{
+    return mMacros.empty() && mIndex>0;
+}
+
+bool CSMWorld::UndoStack::canRedo() const
+{
+    return mMacros.empty() && mIndex<count();
+}
+
+QString CSMWorld::UndoStack::undoText() const
+{
+    return canUndo() ? mCommands[mIndex-1].mCommand->text() : QString();
+}
+
+QString CSMWorld::UndoStack::redoText() const
+{
+    return canRedo() ? mCommands[mIndex].mCommand->text() : QString();
+}
+
+int CSMWorld::UndoStack::count() const
+{
+    return static_cast<int> (mCommands.size());
+}
+
+int CSMWorld::UndoStack::index() const
+{
+    return mIndex;
+}
+
+bool CSMWorld::UndoStack::isClean() const
+{
+    return mMacros.empty() && mIndex==mCleanIndex;
+}
+
+void CSMWorld::UndoStack::setMemoryLimit (std::size_t limit)
+{
+    mMemoryLimit = limit;
+
+    // While a macro is open, the limit is applied once the macro is complete.
+    if (mMacros.empty() && mIndex>1)
+    {
+        int index = mIndex;
+
+        checkMemoryLimit (mIndex-1);
+
+        if (mIndex!=index)
+            setIndex (mIndex, false);
+    }
+}
+
+std::size_t CSMWorld::UndoStack::getMemoryLimit() const
+{
+    return mMemoryLimit;
+}
+
+std::size_t CSMWorld::UndoStack::getMemoryUsage() const
+{
+    return mMemory;
+}
+
+QAction *CSMWorld::UndoStack::createUndoAction (QObject *parent, const QString& prefix)
+{
+    UndoAction *action = new UndoAction (prefix, parent);
+    action->setEnabled (canUndo());
+    action->setPrefixedText (undoText());
+
+    connect (this, SIGNAL (canUndoChanged (bool)), action, SLOT (setEnabled (bool)));
+    connect (this, SIGNAL (undoTextChanged (const QString&)), action, SLOT (setPrefixedText (const QString&)));
+    connect (action, SIGNAL (triggered()), this, SLOT (undo()));
+
+    return action;
+}
+
+QAction *CSMWorld::UndoStack::createRedoAction (QObject *parent, const QString& prefix)
+{
+    UndoAction *action = new UndoAction (prefix, parent);
+    action->setEnabled (canRedo());
+    action->setPrefixedText (redoText());
+
+    connect (this, SIGNAL (canRedoChanged (bool)), action, SLOT (setEnabled (bool)));
+    connect (this, SIGNAL (redoTextChanged (const QString&)), action, SLOT (setPrefixedText (const QString&)));
+    connect (action, SIGNAL (triggered()), this, SLOT (redo()));
+
+    return action;
+}
+
+std::size_t CSMWorld::UndoStack::getMemoryUsage (const QUndoCommand& command)
+{
+    std::size_t memory = sizeof (QUndoCommand) + command.text().size() * sizeof (QChar);
+
+    if (const CommandMemory *commandMemory = dynamic_cast<const CommandMemory *> (&command))
+        memory += commandMemory->getMemoryUsage();
+
+    for (int i=0; i<command.childCount(); ++i)
+        memory += getMemoryUsage (*command.child (i));
+
+    return memory;
+}
+
+void CSMWorld::UndoStack::undo()
+{
+    if (!canUndo())
+        return;
+
+    mCommands[mIndex-1].mCommand->undo();
+    setIndex (mIndex-1, false);
+}
+
+void CSMWorld::UndoStack::redo()
+{
+    if (!canRedo())
+        return;
+
+    mCommands[mIndex].mCommand->redo();
+    setIndex (mIndex+1, false);
+}
+
+void CSMWorld::UndoStack::setClean()
+{
+    if (mMacros.empty())
+        setIndex (mIndex, true);
+}
+
+
+CSMWorld::UndoAction::UndoAction (const QString& prefix, QObject *parent)
+: QAction (parent), mPrefix (prefix)
+{}
+
+void CSMWorld::UndoAction::setPrefixedText (const QString& text)
+{
+    QString prefixed = mPrefix;
+
+    if (!mPrefix.isEmpty() && !text.isEmpty())
+        prefixed += " ";
+
+    prefixed += text;
+
+    setText (prefixed);
+}
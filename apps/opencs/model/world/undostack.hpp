@@ -0,0 +1,152 @@
+#ifndef CSM_WOLRD_UNDOSTACK_H
+#define CSM_WOLRD_UNDOSTACK_H
+
+#include <cstddef>
+#include <deque>
+#include <vector>
+
+#include <QAction>
+#include <QObject>
+#include <QString>
+
+class QUndoCommand;
+
+namespace CSMWorld
+{
+    /// \brief Interface for commands that can report how much memory they keep for undo
+    class CommandMemory
+    {
+        public:
+
+            virtual ~CommandMemory();
+
+            virtual std::size_t getMemoryUsage() const = 0;
+            ///< Estimated number of bytes used by the command, not including its text and its
+            /// child commands.
+    };
+
+    /// \brief Undo stack with a limit on the memory used by the commands
+    ///
+    /// Behaves like QUndoStack (including merging of commands and macros), but instead of a
+    /// maximum number of commands it discards the oldest commands, once the commands on the stack
+    /// use more memory than allowed. A macro is kept and discarded as a single command. The most
+    /// recent command is never discarded.
+    class UndoStack : public QObject
+    {
+            Q_OBJECT
+
+            class Macro;
+
+            struct Entry
+            {
+                QUndoCommand *mCommand;
+                std::size_t mMemory;
+            };
+
+            std::deque<Entry> mCommands;
+            std::vector<Macro *> mMacros; // open macros, innermost last
+            int mIndex;
+            int mCleanIndex; // -1, if the clean state has been discarded
+            std::size_t mMemory;
+            std::size_t mMemoryLimit;
+
+            // not implemented
+            UndoStack (const UndoStack&);
+            UndoStack& operator= (const UndoStack&);
+
+            void setIndex (int index, bool clean);
+
+            void discardRedo();
+
+            void addCommand (QUndoCommand *command);
+
+            void checkMemoryLimit (int discardable);
+            ///< Discard commands from the bottom of the stack while the limit is exceeded.
+            ///
+            /// \param discardable Number of commands at the bottom of the stack that may be discarded
+
+        public:
+
+            UndoStack (QObject *parent = 0);
+
+            ~UndoStack();
+
+            void push (QUndoCommand *command);
+            ///< Execute \a command and put it on the stack (or merge it with the previous
+            /// command). Ownership of \a command is transferred to the stack.
+
+            void beginMacro (const QString& text);
+
+            void endMacro();
+
+            bool canUndo() const;
+
+            bool canRedo() const;
+
+            QString undoText() const;
+
+            QString redoText() const;
+
+            int count() const;
+
+            int index() const;
+
+            bool isClean() const;
+
+            void setMemoryLimit (std::size_t limit);
+            ///< \param limit Maximum number of bytes used by the commands (0: no limit)
+
+            std::size_t getMemoryLimit() const;
+
+            std::size_t getMemoryUsage() const;
+            ///< Estimated number of bytes used by the commands on the stack (not including open
+            /// macros).
+
+            QAction *createUndoAction (QObject *parent, const QString& prefix);
+
+            QAction *createRedoAction (QObject *parent, const QString& prefix);
+
+            static std::size_t getMemoryUsage (const QUndoCommand& command);
+            ///< Estimated number of bytes used by \a command, including its child commands.
+
+        public slots:
+
+            void undo();
+
+            void redo();
+
+            void setClean();
+
+        signals:
+
+            void indexChanged (int index);
+
+            void cleanChanged (bool clean);
+
+            void canUndoChanged (bool canUndo);
+
+            void canRedoChanged (bool canRedo);
+
+            void undoTextChanged (const QString& undoText);
+
+            void redoTextChanged (const QString& redoText);
+    };
+
+    /// \brief Action for UndoStack::createUndoAction and UndoStack::createRedoAction
+    class UndoAction : public QAction
+    {
+            Q_OBJECT
+
+            QString mPrefix;
+
+        public:
+
+            UndoAction (const QString& prefix, QObject *parent);
+
+        public slots:
+
+            void setPrefixedText (const QString& text);
+    };
+}
+
+#endif
@@ -9,8 +9,6 @@
 
 #include <QDockWidget>
 
-class QUndoStack;
-
 namespace CSMWorld
 {
     class Data;
@@ -79,15 +79,16 @@ bool CSVRender::Cell::addObjects (int start, int end)
 
     const CSMWorld::RefCollection& collection = mData.getReferences();
 
-    for (int i=start; i<=end; ++i)
-    {
-        std::string cell = Misc::StringUtils::lowerCase (collection.getRecord (i).get().mCell);
+    const std::set<int>& rows = collection.getRefsInCell (mId);
 
-        CSMWorld::RecordBase::State state = collection.getRecord (i).mState;
+    for (std::set<int>::const_iterator iter (rows.lower_bound (start));
+        iter!=rows.end() && *iter<=end; ++iter)
+    {
+        const CSMWorld::Record<CSMWorld::CellRef>& record = collection.getRecord (*iter);
 
-        if (cell==mId && state!=CSMWorld::RecordBase::State_Deleted)
+        if (record.mState!=CSMWorld::RecordBase::State_Deleted)
         {
-            std::string id = Misc::StringUtils::lowerCase (collection.getRecord (i).get().mId);
+            std::string id = Misc::StringUtils::lowerCase (record.get().mId);
 
             std::unique_ptr<Object> object (new Object (mData, mCellNode, id, false));
 
@@ -180,12 +181,7 @@ CSVRender::Cell::Cell (CSMWorld::Data& data, osg::Group* rootNode, const std::st
 
     if (!mDeleted)
     {
-        CSMWorld::IdTable& references = dynamic_cast<CSMWorld::IdTable&> (
-            *mData.getTableModel (CSMWorld::UniversalId::Type_References));
-
-        int rows = references.rowCount();
-
-        addObjects (0, rows-1);
+        addObjects (0, mData.getReferences().getSize()-1);
 
         updateLand();
 
@@ -243,30 +239,20 @@ bool CSVRender::Cell::referenceDataChanged (const QModelIndex& topLeft,
     if (mDeleted)
         return false;
 
-    CSMWorld::IdTable& references = dynamic_cast<CSMWorld::IdTable&> (
-        *mData.getTableModel (CSMWorld::UniversalId::Type_References));
+    const CSMWorld::RefCollection& collection = mData.getReferences();
 
-    int idColumn = references.findColumnIndex (CSMWorld::Columns::ColumnId_Id);
-    int cellColumn = references.findColumnIndex (CSMWorld::Columns::ColumnId_Cell);
-    int stateColumn = references.findColumnIndex (CSMWorld::Columns::ColumnId_Modification);
+    const std::set<int>& rows = collection.getRefsInCell (mId);
 
     // list IDs in cell
     std::map<std::string, bool> ids; // id, deleted state
 
-    for (int i=topLeft.row(); i<=bottomRight.row(); ++i)
+    for (std::set<int>::const_iterator iter (rows.lower_bound (topLeft.row()));
+        iter!=rows.end() && *iter<=bottomRight.row(); ++iter)
     {
-        std::string cell = Misc::StringUtils::lowerCase (references.data (
-            references.index (i, cellColumn)).toString().toUtf8().constData());
-
-        if (cell==mId)
-        {
-            std::string id = Misc::StringUtils::lowerCase (references.data (
-                references.index (i, idColumn)).toString().toUtf8().constData());
-
-            int state = references.data (references.index (i, stateColumn)).toInt();
+        const CSMWorld::Record<CSMWorld::CellRef>& record = collection.getRecord (*iter);
 
-            ids.insert (std::make_pair (id, state==CSMWorld::RecordBase::State_Deleted));
-        }
+        ids.insert (std::make_pair (Misc::StringUtils::lowerCase (record.get().mId),
+            record.mState==CSMWorld::RecordBase::State_Deleted));
     }
 
     // perform update and remove where needed
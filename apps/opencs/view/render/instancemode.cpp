@@ -454,7 +454,7 @@ void CSVRender::InstanceMode::dragCompleted(const QPoint& pos)
     std::vector<osg::ref_ptr<TagBase> > selection =
         getWorldspaceWidget().getEdited (Mask_Reference);
 
-    QUndoStack& undoStack = getWorldspaceWidget().getDocument().getUndoStack();
+    CSMWorld::UndoStack& undoStack = getWorldspaceWidget().getDocument().getUndoStack();
 
     QString description;
 
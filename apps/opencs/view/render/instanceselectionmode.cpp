@@ -5,6 +5,7 @@
 
 #include "../../model/world/idtable.hpp"
 #include "../../model/world/commands.hpp"
+#include "../../model/world/commandmacro.hpp"
 
 #include "worldspacewidget.hpp"
 #include "object.hpp"
@@ -46,12 +47,15 @@ namespace CSVRender
         CSMWorld::IdTable& referencesTable = dynamic_cast<CSMWorld::IdTable&>(
             *getWorldspaceWidget().getDocument().getData().getTableModel(CSMWorld::UniversalId::Type_References));
 
+        CSMWorld::CommandMacro macro(getWorldspaceWidget().getDocument().getUndoStack(),
+            selection.size() > 1 ? "Delete multiple instances" : "");
+
         for (std::vector<osg::ref_ptr<TagBase> >::iterator iter = selection.begin(); iter != selection.end(); ++iter)
         {
             CSMWorld::DeleteCommand* command = new CSMWorld::DeleteCommand(referencesTable,
                 static_cast<ObjectTag*>(iter->get())->mObject->getReferenceId());
 
-            getWorldspaceWidget().getDocument().getUndoStack().push(command);
+            macro.push(command);
         }
     }
 }
@@ -12,7 +12,6 @@
 #include "tagbase.hpp"
 
 class QModelIndex;
-class QUndoStack;
 
 namespace osg
 {
@@ -75,7 +75,7 @@ namespace CSVRender
             if (cell->getPathgrid())
             {
                 // Add node
-                QUndoStack& undoStack = getWorldspaceWidget().getDocument().getUndoStack();
+                CSMWorld::UndoStack& undoStack = getWorldspaceWidget().getDocument().getUndoStack();
                 QString description = "Add node";
 
                 CSMWorld::CommandMacro macro(undoStack, description);
@@ -94,7 +94,7 @@ namespace CSVRender
                 {
                     unsigned short node = SceneUtil::getPathgridNode(static_cast<unsigned short>(hit.index0));
 
-                    QUndoStack& undoStack = getWorldspaceWidget().getDocument().getUndoStack();
+                    CSMWorld::UndoStack& undoStack = getWorldspaceWidget().getDocument().getUndoStack();
                     QString description = "Connect node to selected nodes";
 
                     CSMWorld::CommandMacro macro(undoStack, description);
@@ -234,7 +234,7 @@ namespace CSVRender
             {
                 if (PathgridTag* tag = dynamic_cast<PathgridTag*>(it->get()))
                 {
-                    QUndoStack& undoStack = getWorldspaceWidget().getDocument().getUndoStack();
+                    CSMWorld::UndoStack& undoStack = getWorldspaceWidget().getDocument().getUndoStack();
                     QString description = "Move pathgrid node(s)";
 
                     CSMWorld::CommandMacro macro(undoStack, description);
@@ -254,7 +254,7 @@ namespace CSVRender
                     {
                         unsigned short toNode = SceneUtil::getPathgridNode(static_cast<unsigned short>(hit.index0));
 
-                        QUndoStack& undoStack = getWorldspaceWidget().getDocument().getUndoStack();
+                        CSMWorld::UndoStack& undoStack = getWorldspaceWidget().getDocument().getUndoStack();
                         QString description = "Add edge between nodes";
 
                         CSMWorld::CommandMacro macro(undoStack, description);
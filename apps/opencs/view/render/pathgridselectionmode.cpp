@@ -43,7 +43,7 @@ namespace CSVRender
         {
             if (PathgridTag* tag = dynamic_cast<PathgridTag*>(it->get()))
             {
-                QUndoStack& undoStack = getWorldspaceWidget().getDocument().getUndoStack();
+                CSMWorld::UndoStack& undoStack = getWorldspaceWidget().getDocument().getUndoStack();
                 QString description = "Remove selected nodes";
 
                 CSMWorld::CommandMacro macro(undoStack, description);
@@ -60,7 +60,7 @@ namespace CSVRender
         {
             if (PathgridTag* tag = dynamic_cast<PathgridTag*>(it->get()))
             {
-                QUndoStack& undoStack = getWorldspaceWidget().getDocument().getUndoStack();
+                CSMWorld::UndoStack& undoStack = getWorldspaceWidget().getDocument().getUndoStack();
                 QString description = "Remove edges between selected nodes";
 
                 CSMWorld::CommandMacro macro(undoStack, description);
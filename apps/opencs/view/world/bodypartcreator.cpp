@@ -19,7 +19,7 @@ std::string CSVWorld::BodyPartCreator::getId() const
 
 CSVWorld::BodyPartCreator::BodyPartCreator(
     CSMWorld::Data& data,
-    QUndoStack& undoStack,
+    CSMWorld::UndoStack& undoStack,
     const CSMWorld::UniversalId& id
 ) : GenericCreator(data, undoStack, id)
 {
@@ -29,7 +29,7 @@ namespace CSVWorld
 
             BodyPartCreator(
                 CSMWorld::Data& data,
-                QUndoStack& undoStack,
+                CSMWorld::UndoStack& undoStack,
                 const CSMWorld::UniversalId& id);
 
             /// \return Error description for current user input.
@@ -31,7 +31,7 @@ void CSVWorld::CellCreator::configureCreateCommand(CSMWorld::CreateCommand& comm
     command.addNestedValue(parentIndex, index, mType->currentIndex() == 0);
 }
 
-CSVWorld::CellCreator::CellCreator (CSMWorld::Data& data, QUndoStack& undoStack,
+CSVWorld::CellCreator::CellCreator (CSMWorld::Data& data, CSMWorld::UndoStack& undoStack,
     const CSMWorld::UniversalId& id)
 : GenericCreator (data, undoStack, id)
 {
@@ -28,7 +28,7 @@ namespace CSVWorld
 
         public:
 
-            CellCreator (CSMWorld::Data& data, QUndoStack& undoStack, const CSMWorld::UniversalId& id);
+            CellCreator (CSMWorld::Data& data, CSMWorld::UndoStack& undoStack, const CSMWorld::UniversalId& id);
 
             virtual void reset();
 
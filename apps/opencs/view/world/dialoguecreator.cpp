@@ -18,7 +18,7 @@ void CSVWorld::DialogueCreator::configureCreateCommand (CSMWorld::CreateCommand&
     command.addValue (index, mType);
 }
 
-CSVWorld::DialogueCreator::DialogueCreator (CSMWorld::Data& data, QUndoStack& undoStack,
+CSVWorld::DialogueCreator::DialogueCreator (CSMWorld::Data& data, CSMWorld::UndoStack& undoStack,
     const CSMWorld::UniversalId& id, int type)
 : GenericCreator (data, undoStack, id, true), mType (type)
 {}
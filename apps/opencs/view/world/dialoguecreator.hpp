@@ -15,7 +15,7 @@ namespace CSVWorld
 
         public:
 
-            DialogueCreator (CSMWorld::Data& data, QUndoStack& undoStack,
+            DialogueCreator (CSMWorld::Data& data, CSMWorld::UndoStack& undoStack,
                 const CSMWorld::UniversalId& id, int type);
     };
 
@@ -5,9 +5,9 @@
 
 #include <QComboBox>
 #include <QApplication>
-#include <QUndoStack>
 
 #include "../../model/world/commands.hpp"
+#include "../../model/world/undostack.hpp"
 
 int CSVWorld::EnumDelegate::getValueIndex(const QModelIndex &index, int role) const
 {
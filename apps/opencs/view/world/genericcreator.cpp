@@ -5,7 +5,6 @@
 #include <QHBoxLayout>
 #include <QPushButton>
 #include <QLineEdit>
-#include <QUndoStack>
 #include <QLabel>
 #include <QComboBox>
 
@@ -14,6 +13,7 @@
 #include "../../model/world/commands.hpp"
 #include "../../model/world/data.hpp"
 #include "../../model/world/idtable.hpp"
+#include "../../model/world/undostack.hpp"
 
 #include "idvalidator.hpp"
 
@@ -79,7 +79,7 @@ CSMWorld::Data& CSVWorld::GenericCreator::getData() const
     return mData;
 }
 
-QUndoStack& CSVWorld::GenericCreator::getUndoStack()
+CSMWorld::UndoStack& CSVWorld::GenericCreator::getUndoStack()
 {
     return mUndoStack;
 }
@@ -145,7 +145,7 @@ void CSVWorld::GenericCreator::addScope (const QString& name, CSMWorld::Scope sc
     mScope->setItemData (mScope->count()-1, tooltip, Qt::ToolTipRole);
 }
 
-CSVWorld::GenericCreator::GenericCreator (CSMWorld::Data& data, QUndoStack& undoStack,
+CSVWorld::GenericCreator::GenericCreator (CSMWorld::Data& data, CSMWorld::UndoStack& undoStack,
     const CSMWorld::UniversalId& id, bool relaxedIdRules)
 : mData (data), mUndoStack (undoStack), mListId (id), mLocked (false),
   mClonedType (CSMWorld::UniversalId::Type_None), mScopes (CSMWorld::Scope_Content), mScope (0),
@@ -13,12 +13,12 @@ class QLineEdit;
 class QHBoxLayout;
 class QComboBox;
 class QLabel;
-class QUndoStack;
 
 namespace CSMWorld
 {
     class CreateCommand;
     class Data;
+    class UndoStack;
 }
 
 namespace CSVWorld
@@ -30,7 +30,7 @@ namespace CSVWorld
             Q_OBJECT
 
             CSMWorld::Data& mData;
-            QUndoStack& mUndoStack;
+            CSMWorld::UndoStack& mUndoStack;
             CSMWorld::UniversalId mListId;
             QPushButton *mCreate;
             QPushButton *mCancel;
@@ -78,7 +78,7 @@ namespace CSVWorld
 
             CSMWorld::Data& getData() const;
 
-            QUndoStack& getUndoStack();
+            CSMWorld::UndoStack& getUndoStack();
 
             const CSMWorld::UniversalId& getCollectionId() const;
 
@@ -93,7 +93,7 @@ namespace CSVWorld
 
         public:
 
-            GenericCreator (CSMWorld::Data& data, QUndoStack& undoStack,
+            GenericCreator (CSMWorld::Data& data, CSMWorld::UndoStack& undoStack,
                 const CSMWorld::UniversalId& id, bool relaxedIdRules = false);
 
             virtual void setEditLock (bool locked);
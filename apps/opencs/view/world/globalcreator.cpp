@@ -19,7 +19,7 @@ namespace CSVWorld
         command.addValue(index, type);
     }
 
-    GlobalCreator::GlobalCreator(CSMWorld::Data& data, QUndoStack& undoStack, const CSMWorld::UniversalId& id)
+    GlobalCreator::GlobalCreator(CSMWorld::Data& data, CSMWorld::UndoStack& undoStack, const CSMWorld::UniversalId& id)
         : GenericCreator (data, undoStack, id, true)
     {
     }
@@ -11,7 +11,7 @@ namespace CSVWorld
 
         public:
 
-            GlobalCreator(CSMWorld::Data& data, QUndoStack& undoStack, const CSMWorld::UniversalId& id);
+            GlobalCreator(CSMWorld::Data& data, CSMWorld::UndoStack& undoStack, const CSMWorld::UniversalId& id);
 
         protected:
 
@@ -47,7 +47,7 @@ void CSVWorld::InfoCreator::configureCreateCommand (CSMWorld::CreateCommand& com
     }
 }
 
-CSVWorld::InfoCreator::InfoCreator (CSMWorld::Data& data, QUndoStack& undoStack,
+CSVWorld::InfoCreator::InfoCreator (CSMWorld::Data& data, CSMWorld::UndoStack& undoStack,
     const CSMWorld::UniversalId& id, CSMWorld::IdCompletionManager& completionManager)
 : GenericCreator (data, undoStack, id)
 {
@@ -28,7 +28,7 @@ namespace CSVWorld
 
         public:
 
-            InfoCreator (CSMWorld::Data& data, QUndoStack& undoStack,
+            InfoCreator (CSMWorld::Data& data, CSMWorld::UndoStack& undoStack,
                 const CSMWorld::UniversalId& id, CSMWorld::IdCompletionManager& completionManager);
 
             virtual void cloneMode (const std::string& originId,
@@ -11,7 +11,7 @@
 
 namespace CSVWorld
 {
-    LandCreator::LandCreator(CSMWorld::Data& data, QUndoStack& undoStack, const CSMWorld::UniversalId& id)
+    LandCreator::LandCreator(CSMWorld::Data& data, CSMWorld::UndoStack& undoStack, const CSMWorld::UniversalId& id)
         : GenericCreator(data, undoStack, id)
         , mXLabel(nullptr)
         , mYLabel(nullptr)
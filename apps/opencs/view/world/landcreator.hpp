@@ -19,7 +19,7 @@ namespace CSVWorld
 
         public:
 
-            LandCreator(CSMWorld::Data& data, QUndoStack& undoStack, const CSMWorld::UniversalId& id);
+            LandCreator(CSMWorld::Data& data, CSMWorld::UndoStack& undoStack, const CSMWorld::UniversalId& id);
 
             void cloneMode(const std::string& originId, const CSMWorld::UniversalId::Type type) override;
 
@@ -13,7 +13,7 @@
 
 namespace CSVWorld
 {
-    LandTextureCreator::LandTextureCreator(CSMWorld::Data& data, QUndoStack& undoStack, const CSMWorld::UniversalId& id)
+    LandTextureCreator::LandTextureCreator(CSMWorld::Data& data, CSMWorld::UndoStack& undoStack, const CSMWorld::UniversalId& id)
         : GenericCreator(data, undoStack, id)
     {
         // One index is reserved for a default texture
@@ -16,7 +16,7 @@ namespace CSVWorld
 
         public:
 
-            LandTextureCreator(CSMWorld::Data& data, QUndoStack& undoStack, const CSMWorld::UniversalId& id);
+            LandTextureCreator(CSMWorld::Data& data, CSMWorld::UndoStack& undoStack, const CSMWorld::UniversalId& id);
 
             void cloneMode(const std::string& originId, const CSMWorld::UniversalId::Type type) override;
 
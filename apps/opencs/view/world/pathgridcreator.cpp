@@ -25,7 +25,7 @@ CSMWorld::IdTable& CSVWorld::PathgridCreator::getPathgridsTable() const
 
 CSVWorld::PathgridCreator::PathgridCreator(
     CSMWorld::Data& data,
-    QUndoStack& undoStack,
+    CSMWorld::UndoStack& undoStack,
     const CSMWorld::UniversalId& id,
     CSMWorld::IdCompletionManager& completionManager
 ) : GenericCreator(data, undoStack, id)
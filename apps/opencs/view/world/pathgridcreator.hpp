@@ -42,7 +42,7 @@ namespace CSVWorld
 
             PathgridCreator(
                 CSMWorld::Data& data,
-                QUndoStack& undoStack,
+                CSMWorld::UndoStack& undoStack,
                 const CSMWorld::UniversalId& id,
                 CSMWorld::IdCompletionManager& completionManager);
 
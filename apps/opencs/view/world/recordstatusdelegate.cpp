@@ -2,9 +2,9 @@
 
 #include <QPainter>
 #include <QApplication>
-#include <QUndoStack>
 
 #include "../../model/world/columns.hpp"
+#include "../../model/world/undostack.hpp"
 
 CSVWorld::RecordStatusDelegate::RecordStatusDelegate(const ValueList& values,
                                                      const IconList & icons,
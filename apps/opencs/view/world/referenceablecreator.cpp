@@ -12,7 +12,7 @@ void CSVWorld::ReferenceableCreator::configureCreateCommand (CSMWorld::CreateCom
         static_cast<CSMWorld::UniversalId::Type> (mType->itemData (mType->currentIndex()).toInt()));
 }
 
-CSVWorld::ReferenceableCreator::ReferenceableCreator (CSMWorld::Data& data, QUndoStack& undoStack,
+CSVWorld::ReferenceableCreator::ReferenceableCreator (CSMWorld::Data& data, CSMWorld::UndoStack& undoStack,
     const CSMWorld::UniversalId& id)
 : GenericCreator (data, undoStack, id)
 {
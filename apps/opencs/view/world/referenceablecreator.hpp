@@ -19,7 +19,7 @@ namespace CSVWorld
 
         public:
 
-            ReferenceableCreator (CSMWorld::Data& data, QUndoStack& undoStack,
+            ReferenceableCreator (CSMWorld::Data& data, CSMWorld::UndoStack& undoStack,
                 const CSMWorld::UniversalId& id);
 
             virtual void reset();
@@ -31,7 +31,7 @@ namespace CSVWorld
 
         public:
 
-            ReferenceCreator (CSMWorld::Data& data, QUndoStack& undoStack,
+            ReferenceCreator (CSMWorld::Data& data, CSMWorld::UndoStack& undoStack,
                 const CSMWorld::UniversalId& id, CSMWorld::IdCompletionManager &completionManager);
 
             virtual void cloneMode(const std::string& originId,
@@ -26,7 +26,7 @@ CSMWorld::IdTable& CSVWorld::StartScriptCreator::getStartScriptsTable() const
 
 CSVWorld::StartScriptCreator::StartScriptCreator(
     CSMWorld::Data &data,
-    QUndoStack &undoStack,
+    CSMWorld::UndoStack &undoStack,
     const CSMWorld::UniversalId &id,
     CSMWorld::IdCompletionManager& completionManager
 ) : GenericCreator(data, undoStack, id)
@@ -35,7 +35,7 @@ namespace CSVWorld
 
             StartScriptCreator(
                 CSMWorld::Data& data,
-                QUndoStack& undoStack,
+                CSMWorld::UndoStack& undoStack,
                 const CSMWorld::UniversalId& id,
                 CSMWorld::IdCompletionManager& completionManager);
 
@@ -4,7 +4,6 @@
 #include <climits>
 #include <cfloat>
 
-#include <QUndoStack>
 #include <QMetaProperty>
 #include <QStyledItemDelegate>
 #include <QLineEdit>
@@ -17,6 +16,7 @@
 #include "../../model/world/commands.hpp"
 #include "../../model/world/tablemimedata.hpp"
 #include "../../model/world/commanddispatcher.hpp"
+#include "../../model/world/undostack.hpp"
 
 #include "../widget/coloreditor.hpp"
 #include "../widget/droplineedit.hpp"
@@ -105,7 +105,7 @@ const CSVWorld::CommandDelegateFactoryCollection& CSVWorld::CommandDelegateFacto
 }
 
 
-QUndoStack& CSVWorld::CommandDelegate::getUndoStack() const
+CSMWorld::UndoStack& CSVWorld::CommandDelegate::getUndoStack() const
 {
     return mDocument.getUndoStack();
 }
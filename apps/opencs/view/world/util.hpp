@@ -9,13 +9,12 @@
 #include "../../model/world/columnbase.hpp"
 #include "../../model/doc/document.hpp"
 
-class QUndoStack;
-
 namespace CSMWorld
 {
     class TableMimeData;
     class UniversalId;
     class CommandDispatcher;
+    class UndoStack;
 }
 
 namespace CSMPrefs
@@ -106,7 +105,7 @@ namespace CSVWorld
 
         protected:
 
-            QUndoStack& getUndoStack() const;
+            CSMWorld::UndoStack& getUndoStack() const;
 
             CSMDoc::Document& getDocument() const;
 
@@ -1,10 +1,9 @@
 #include "vartypedelegate.hpp"
 
-#include <QUndoStack>
-
 #include "../../model/world/commands.hpp"
 #include "../../model/world/columns.hpp"
 #include "../../model/world/commandmacro.hpp"
+#include "../../model/world/undostack.hpp"
 
 void CSVWorld::VarTypeDelegate::addCommands (QAbstractItemModel *model, const QModelIndex& index, int type)
     const
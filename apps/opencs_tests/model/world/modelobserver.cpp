@@ -0,0 +1,209 @@
+#include "modelobserver.hpp"
+
+#include <sstream>
+
+#include <QAbstractItemModel>
+
+QString CSMTests::ModelObserver::getData (int row, int column) const
+{
+    return mModel.data (mModel.index (row, column), mRole).toString();
+}
+
+void CSMTests::ModelObserver::addError (const std::string& error)
+{
+    mErrors.push_back (error);
+}
+
+void CSMTests::ModelObserver::checkSnapshot (const std::string& signal)
+{
+    if (!matchesModel())
+        addError ("model changed before " + signal);
+}
+
+void CSMTests::ModelObserver::takeSnapshot()
+{
+    mColumns = mModel.columnCount();
+    mSnapshot.clear();
+
+    for (int row=0; row<mModel.rowCount(); ++row)
+    {
+        mSnapshot.push_back (std::vector<QString>());
+
+        for (int column=0; column<mColumns; ++column)
+            mSnapshot.back().push_back (getData (row, column));
+    }
+}
+
+CSMTests::ModelObserver::ModelObserver (QAbstractItemModel& model, int role)
+: mModel (model), mRole (role), mColumns (0)
+{
+    takeSnapshot();
+
+    connect (&model, SIGNAL (rowsAboutToBeInserted (const QModelIndex&, int, int)),
+        this, SLOT (rowsAboutToBeInserted (const QModelIndex&, int, int)));
+    connect (&model, SIGNAL (rowsInserted (const QModelIndex&, int, int)),
+        this, SLOT (rowsInserted (const QModelIndex&, int, int)));
+    connect (&model, SIGNAL (rowsAboutToBeRemoved (const QModelIndex&, int, int)),
+        this, SLOT (rowsAboutToBeRemoved (const QModelIndex&, int, int)));
+    connect (&model, SIGNAL (rowsRemoved (const QModelIndex&, int, int)),
+        this, SLOT (rowsRemoved (const QModelIndex&, int, int)));
+    connect (&model, SIGNAL (columnsAboutToBeInserted (const QModelIndex&, int, int)),
+        this, SLOT (columnsAboutToBeInserted (const QModelIndex&, int, int)));
+    connect (&model, SIGNAL (columnsInserted (const QModelIndex&, int, int)),
+        this, SLOT (columnsInserted (const QModelIndex&, int, int)));
+    connect (&model, SIGNAL (columnsAboutToBeRemoved (const QModelIndex&, int, int)),
+        this, SLOT (columnsAboutToBeRemoved (const QModelIndex&, int, int)));
+    connect (&model, SIGNAL (columnsRemoved (const QModelIndex&, int, int)),
+        this, SLOT (columnsRemoved (const QModelIndex&, int, int)));
+    connect (&model, SIGNAL (dataChanged (const QModelIndex&, const QModelIndex&)),
+        this, SLOT (dataChanged (const QModelIndex&, const QModelIndex&)));
+}
+
+bool CSMTests::ModelObserver::matchesModel() const
+{
+    if (mModel.rowCount()!=static_cast<int> (mSnapshot.size()) || mModel.columnCount()!=mColumns)
+        return false;
+
+    for (int row=0; row<static_cast<int> (mSnapshot.size()); ++row)
+        for (int column=0; column<mColumns; ++column)
+            if (getData (row, column)!=mSnapshot[row][column])
+                return false;
+
+    return true;
+}
+
+const std::vector<std::string>& CSMTests::ModelObserver::getErrors() const
+{
+    return mErrors;
+}
+
+void CSMTests::ModelObserver::rowsAboutToBeInserted (const QModelIndex& parent, int start, int end)
+{
+    checkSnapshot ("inserting rows");
+
+    if (start<0 || start>static_cast<int> (mSnapshot.size()) || end<start)
+        addError ("invalid range of inserted rows");
+}
+
+void CSMTests::ModelObserver::rowsInserted (const QModelIndex& parent, int start, int end)
+{
+    int count = end-start+1;
+
+    if (mModel.rowCount()!=static_cast<int> (mSnapshot.size())+count)
+    {
+        addError ("wrong number of rows after inserting rows");
+        takeSnapshot();
+        return;
+    }
+
+    mSnapshot.insert (mSnapshot.begin()+start, count, std::vector<QString> (mColumns));
+
+    for (int row=0; row<static_cast<int> (mSnapshot.size()); ++row)
+        for (int column=0; column<mColumns; ++column)
+        {
+            if (row>=start && row<=end)
+                mSnapshot[row][column] = getData (row, column);
+            else if (getData (row, column)!=mSnapshot[row][column])
+            {
+                std::ostringstream stream;
+                stream << "row " << row << ", column " << column << " changed by inserting rows";
+                addError (stream.str());
+                mSnapshot[row][column] = getData (row, column);
+            }
+        }
+}
+
+void CSMTests::ModelObserver::rowsAboutToBeRemoved (const QModelIndex& parent, int start, int end)
+{
+    checkSnapshot ("removing rows");
+
+    if (start<0 || end>=static_cast<int> (mSnapshot.size()) || end<start)
+        addError ("invalid range of removed rows");
+}
+
+void CSMTests::ModelObserver::rowsRemoved (const QModelIndex& parent, int start, int end)
+{
+    mSnapshot.erase (mSnapshot.begin()+start, mSnapshot.begin()+end+1);
+
+    if (!matchesModel())
+    {
+        addError ("model changed by removing rows");
+        takeSnapshot();
+    }
+}
+
+void CSMTests::ModelObserver::columnsAboutToBeInserted (const QModelIndex& parent, int start, int end)
+{
+    checkSnapshot ("inserting columns");
+
+    if (start<0 || start>mColumns || end<start)
+        addError ("invalid range of inserted columns");
+}
+
+void CSMTests::ModelObserver::columnsInserted (const QModelIndex& parent, int start, int end)
+{
+    int count = end-start+1;
+
+    if (mModel.columnCount()!=mColumns+count)
+    {
+        addError ("wrong number of columns after inserting columns");
+        takeSnapshot();
+        return;
+    }
+
+    mColumns += count;
+
+    for (int row=0; row<static_cast<int> (mSnapshot.size()); ++row)
+    {
+        mSnapshot[row].insert (mSnapshot[row].begin()+start, count, QString());
+
+        for (int column=0; column<mColumns; ++column)
+        {
+            if (column>=start && column<=end)
+                mSnapshot[row][column] = getData (row, column);
+            else if (getData (row, column)!=mSnapshot[row][column])
+            {
+                std::ostringstream stream;
+                stream << "row " << row << ", column " << column << " changed by inserting columns";
+                addError (stream.str());
+                mSnapshot[row][column] = getData (row, column);
+            }
+        }
+    }
+}
+
+void CSMTests::ModelObserver::columnsAboutToBeRemoved (const QModelIndex& parent, int start, int end)
+{
+    checkSnapshot ("removing columns");
+
+    if (start<0 || end>=mColumns || end<start)
+        addError ("invalid range of removed columns");
+}
+
+void CSMTests::ModelObserver::columnsRemoved (const QModelIndex& parent, int start, int end)
+{
+    mColumns -= end-start+1;
+
+    for (int row=0; row<static_cast<int> (mSnapshot.size()); ++row)
+        mSnapshot[row].erase (mSnapshot[row].begin()+start, mSnapshot[row].begin()+end+1);
+
+    if (!matchesModel())
+    {
+        addError ("model changed by removing columns");
+        takeSnapshot();
+    }
+}
+
+void CSMTests::ModelObserver::dataChanged (const QModelIndex& topLeft, const QModelIndex& bottomRight)
+{
+    if (topLeft.row()<0 || topLeft.column()<0 || bottomRight.row()>=static_cast<int> (mSnapshot.size()) ||
+        bottomRight.column()>=mColumns || bottomRight.row()<topLeft.row() || bottomRight.column()<topLeft.column())
+    {
+        addError ("invalid range of changed cells");
+        return;
+    }
+
+    for (int row=topLeft.row(); row<=bottomRight.row(); ++row)
+        for (int column=topLeft.column(); column<=bottomRight.column(); ++column)
+            mSnapshot[row][column] = getData (row, column);
+}
@@ -0,0 +1,70 @@
+#ifndef CSM_TESTS_MODELOBSERVER_H
+#define CSM_TESTS_MODELOBSERVER_H
+
+#include <string>
+#include <vector>
+
+#include <QObject>
+#include <QString>
+
+class QAbstractItemModel;
+class QModelIndex;
+
+namespace CSMTests
+{
+    /// \brief Checks that a table model announces all its changes to views
+    ///
+    /// Keeps the contents of the model as a view would know them from the signals of the model.
+    /// The model must not change before it announces a change of its size, and must not change
+    /// any cell without a dataChanged signal.
+    class ModelObserver : public QObject
+    {
+            Q_OBJECT
+
+            QAbstractItemModel& mModel;
+            int mRole;
+            std::vector<std::vector<QString> > mSnapshot; // row, column
+            int mColumns;
+            std::vector<std::string> mErrors;
+
+            QString getData (int row, int column) const;
+
+            void takeSnapshot();
+
+            void addError (const std::string& error);
+
+            void checkSnapshot (const std::string& signal);
+            ///< Check that the model still has the contents of the snapshot.
+
+        public:
+
+            ModelObserver (QAbstractItemModel& model, int role);
+
+            bool matchesModel() const;
+            ///< Does the model have the contents announced to views?
+
+            const std::vector<std::string>& getErrors() const;
+
+        private slots:
+
+            void rowsAboutToBeInserted (const QModelIndex& parent, int start, int end);
+
+            void rowsInserted (const QModelIndex& parent, int start, int end);
+
+            void rowsAboutToBeRemoved (const QModelIndex& parent, int start, int end);
+
+            void rowsRemoved (const QModelIndex& parent, int start, int end);
+
+            void columnsAboutToBeInserted (const QModelIndex& parent, int start, int end);
+
+            void columnsInserted (const QModelIndex& parent, int start, int end);
+
+            void columnsAboutToBeRemoved (const QModelIndex& parent, int start, int end);
+
+            void columnsRemoved (const QModelIndex& parent, int start, int end);
+
+            void dataChanged (const QModelIndex& topLeft, const QModelIndex& bottomRight);
+    };
+}
+
+#endif
@@ -0,0 +1,412 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <components/esm/loadglob.hpp>
+#include <components/esm/loadnpc.hpp>
+#include <components/esm/loadregn.hpp>
+#include <components/esm/loadscpt.hpp>
+
+#include "apps/opencs/model/world/cell.hpp"
+#include "apps/opencs/model/world/columns.hpp"
+#include "apps/opencs/model/world/commandmacro.hpp"
+#include "apps/opencs/model/world/commands.hpp"
+#include "apps/opencs/model/world/data.hpp"
+#include "apps/opencs/model/world/idtable.hpp"
+#include "apps/opencs/model/world/idtree.hpp"
+#include "apps/opencs/model/world/undostack.hpp"
+#include "apps/opencs/model/world/universalid.hpp"
+
+namespace
+{
+    typedef std::vector<std::vector<QString> > Snapshot;
+
+    /// Add the contents of the rows below \a parent, including nested tables, to \a snapshot
+    void addRows (Snapshot& snapshot, const QAbstractItemModel& model, const QModelIndex& parent)
+    {
+        for (int row = 0; row < model.rowCount (parent); ++row)
+        {
+            std::vector<QString> values;
+
+            for (int column = 0; column < model.columnCount (parent); ++column)
+            {
+                QModelIndex index = model.index (row, column, parent);
+                values.push_back (model.data (index).toString());
+
+                if (model.hasChildren (index))
+                {
+                    Snapshot nested;
+                    addRows (nested, model, index);
+
+                    for (Snapshot::const_iterator iter (nested.begin()); iter != nested.end(); ++iter)
+                    {
+                        values.push_back ("nested row");
+                        values.insert (values.end(), iter->begin(), iter->end());
+                    }
+                }
+            }
+
+            snapshot.push_back (values);
+        }
+    }
+
+    /// Contents of all records in \a model (the order of the records is ignored)
+    Snapshot takeSnapshot (const QAbstractItemModel& model)
+    {
+        Snapshot snapshot;
+        addRows (snapshot, model, QModelIndex());
+        std::sort (snapshot.begin(), snapshot.end());
+        return snapshot;
+    }
+
+    ESM::Global makeGlobal (const std::string& id, int value)
+    {
+        ESM::Global global;
+        global.blank();
+        global.mId = id;
+        global.mValue.setType (ESM::VT_Int);
+        global.mValue.setInteger (value);
+        return global;
+    }
+
+    /// Region with \a value sounds
+    ESM::Region makeRegion (const std::string& id, int value)
+    {
+        ESM::Region region;
+        region.blank();
+        region.mId = id;
+
+        std::ostringstream stream;
+        stream << "Region " << value;
+        region.mName = stream.str();
+
+        for (int i = 0; i < value; ++i)
+        {
+            std::ostringstream sound;
+            sound << "sound " << i;
+
+            ESM::Region::SoundRef soundRef;
+            soundRef.mSound.assign (sound.str());
+            soundRef.mChance = static_cast<unsigned char> (i % 100);
+            region.mSoundList.push_back (soundRef);
+        }
+
+        return region;
+    }
+
+    ESM::NPC makeNpc (const std::string& id, int value)
+    {
+        ESM::NPC npc;
+        npc.blank();
+        npc.mId = id;
+
+        std::ostringstream stream;
+        stream << "NPC " << value;
+        npc.mName = stream.str();
+
+        return npc;
+    }
+
+    ESM::Script makeScript (const std::string& id, int value)
+    {
+        ESM::Script script;
+        script.mId = id;
+        script.blank();
+
+        std::ostringstream stream;
+        stream << "Begin " << id << "\nset x to " << value << "\nEnd\n";
+        script.mScriptText = stream.str();
+
+        return script;
+    }
+
+    CSMWorld::Cell makeCell (const std::string& id, int value)
+    {
+        CSMWorld::Cell cell;
+        cell.blank();
+        cell.mId = id;
+        cell.mName = id;
+        cell.mData.mFlags = ESM::Cell::Interior;
+        cell.mWater = static_cast<float> (value);
+        return cell;
+    }
+
+    struct CommandsTest : public ::testing::Test
+    {
+        CSMWorld::Data mData;
+        CSMWorld::UndoStack mUndoStack;
+
+        CommandsTest()
+        : mData (ToUTF8::WINDOWS_1252, false, Files::PathContainer(), std::vector<std::string>(), 0,
+            boost::filesystem::path())
+        {}
+
+        CSMWorld::IdTable& getTable (CSMWorld::UniversalId::Type type)
+        {
+            return dynamic_cast<CSMWorld::IdTable&> (*mData.getTableModel (CSMWorld::UniversalId (type)));
+        }
+
+        /// \param modified Only used in the states that have modified data
+        template<typename ESXRecordT>
+        void setRecord (CSMWorld::IdTable& table, CSMWorld::RecordBase::State state,
+            const ESXRecordT& base, const ESXRecordT& modified,
+            CSMWorld::UniversalId::Type type = CSMWorld::UniversalId::Type_None)
+        {
+            bool hasBase = state != CSMWorld::RecordBase::State_ModifiedOnly;
+            bool hasModified = state == CSMWorld::RecordBase::State_Modified ||
+                state == CSMWorld::RecordBase::State_ModifiedOnly;
+
+            table.setRecord (base.mId, CSMWorld::Record<ESXRecordT> (state, hasBase ? &base : 0,
+                hasModified ? &modified : 0), type);
+        }
+
+        void undo (int steps)
+        {
+            for (int i = 0; i < steps; ++i)
+                mUndoStack.undo();
+        }
+
+        void redo (int steps)
+        {
+            for (int i = 0; i < steps; ++i)
+                mUndoStack.redo();
+        }
+
+        /// Delete and revert a record in each state, one by one and in a macro, and check that
+        /// undo and redo restore the table each time.
+        template<typename ESXRecordT>
+        void expectRestoredRecordStates (CSMWorld::UniversalId::Type tableType,
+            ESXRecordT (*make) (const std::string&, int),
+            CSMWorld::UniversalId::Type type = CSMWorld::UniversalId::Type_None)
+        {
+            static const CSMWorld::RecordBase::State states[] =
+            {
+                CSMWorld::RecordBase::State_BaseOnly,
+                CSMWorld::RecordBase::State_Modified,
+                CSMWorld::RecordBase::State_ModifiedOnly,
+                CSMWorld::RecordBase::State_Deleted
+            };
+
+            CSMWorld::IdTable& table = getTable (tableType);
+
+            std::vector<std::string> ids;
+
+            for (int i = 0; i < 4; ++i)
+            {
+                std::ostringstream stream;
+                stream << "record" << i;
+                ids.push_back (stream.str());
+
+                setRecord (table, states[i], make (ids.back(), 1), make (ids.back(), 2), type);
+            }
+
+            Snapshot before = takeSnapshot (table);
+
+            for (int revert = 0; revert < 2; ++revert)
+                for (int macro = 0; macro < 2; ++macro)
+                {
+                    std::string step = std::string (revert ? "revert" : "delete") + (macro ? " in macro" : "");
+
+                    {
+                        CSMWorld::CommandMacro commands (mUndoStack);
+
+                        for (std::vector<std::string>::const_iterator iter (ids.begin()); iter != ids.end(); ++iter)
+                        {
+                            QUndoCommand *command = revert ?
+                                static_cast<QUndoCommand *> (new CSMWorld::RevertCommand (table, *iter)) :
+                                new CSMWorld::DeleteCommand (table, *iter);
+
+                            if (macro)
+                                commands.push (command);
+                            else
+                                mUndoStack.push (command);
+                        }
+                    }
+
+                    int steps = macro ? 1 : static_cast<int> (ids.size());
+
+                    Snapshot after = takeSnapshot (table);
+                    EXPECT_FALSE(before == after) << step;
+
+                    undo (steps);
+                    EXPECT_TRUE(before == takeSnapshot (table)) << step;
+                    EXPECT_FALSE(mUndoStack.canUndo()) << step;
+
+                    redo (steps);
+                    EXPECT_TRUE(after == takeSnapshot (table)) << step;
+
+                    undo (steps);
+                    EXPECT_TRUE(before == takeSnapshot (table)) << step;
+
+                    for (int i = 0; i < 4; ++i)
+                        EXPECT_EQ(states[i], table.getRecord (ids[i]).mState) << step << ": " << ids[i];
+                }
+        }
+    };
+}
+
+TEST_F(CommandsTest, undo_restores_every_record_state_of_globals)
+{
+    expectRestoredRecordStates (CSMWorld::UniversalId::Type_Globals, makeGlobal);
+}
+
+TEST_F(CommandsTest, undo_restores_every_record_state_of_regions)
+{
+    expectRestoredRecordStates (CSMWorld::UniversalId::Type_Regions, makeRegion);
+}
+
+TEST_F(CommandsTest, undo_restores_every_record_state_of_scripts)
+{
+    expectRestoredRecordStates (CSMWorld::UniversalId::Type_Scripts, makeScript);
+}
+
+TEST_F(CommandsTest, undo_restores_every_record_state_of_cells)
+{
+    expectRestoredRecordStates (CSMWorld::UniversalId::Type_Cells, makeCell);
+}
+
+TEST_F(CommandsTest, undo_restores_every_record_state_of_referenceables)
+{
+    expectRestoredRecordStates (CSMWorld::UniversalId::Type_Referenceables, makeNpc,
+        CSMWorld::UniversalId::Type_Npc);
+}
+
+TEST_F(CommandsTest, bulk_deletion_keeps_only_record_states)
+{
+    CSMWorld::IdTable& referenceables = getTable (CSMWorld::UniversalId::Type_Referenceables);
+
+    std::vector<std::string> ids;
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        std::ostringstream stream;
+        stream << "npc" << i;
+        ids.push_back (stream.str());
+
+        ESM::NPC npc = makeNpc (ids.back(), i);
+        setRecord (referenceables, CSMWorld::RecordBase::State_BaseOnly, npc, npc, CSMWorld::UniversalId::Type_Npc);
+    }
+
+    {
+        CSMWorld::CommandMacro macro (mUndoStack);
+
+        for (std::vector<std::string>::const_iterator iter (ids.begin()); iter != ids.end(); ++iter)
+            macro.push (new CSMWorld::DeleteCommand (referenceables, *iter, CSMWorld::UniversalId::Type_Npc));
+    }
+
+    EXPECT_EQ(1, mUndoStack.count());
+
+    // per record less than a copy of the record
+    EXPECT_LT(mUndoStack.getMemoryUsage() / ids.size(), sizeof (CSMWorld::Record<ESM::NPC>));
+
+    for (std::vector<std::string>::const_iterator iter (ids.begin()); iter != ids.end(); ++iter)
+        ASSERT_EQ(CSMWorld::RecordBase::State_Deleted, referenceables.getRecord (*iter).mState) << *iter;
+
+    mUndoStack.undo();
+
+    for (std::vector<std::string>::const_iterator iter (ids.begin()); iter != ids.end(); ++iter)
+        ASSERT_EQ(CSMWorld::RecordBase::State_BaseOnly, referenceables.getRecord (*iter).mState) << *iter;
+}
+
+TEST_F(CommandsTest, long_text_modification_keeps_only_the_changed_part)
+{
+    CSMWorld::IdTable& scripts = getTable (CSMWorld::UniversalId::Type_Scripts);
+
+    ESM::Script script = makeScript ("script", 0);
+
+    std::string text = "Begin script\n";
+    for (int i = 0; i < 10000; ++i)
+        text += "set x to 1\n";
+    text += "End\n";
+    script.mScriptText = text;
+
+    setRecord (scripts, CSMWorld::RecordBase::State_BaseOnly, script, script);
+
+    std::string newText = text;
+    newText.replace (newText.size() / 2, 1, "set y to 2\n");
+
+    QModelIndex index = scripts.getModelIndex ("script", scripts.findColumnIndex (CSMWorld::Columns::ColumnId_ScriptText));
+
+    mUndoStack.push (new CSMWorld::ModifyCommand (scripts, index, QString::fromUtf8 (newText.c_str())));
+
+    EXPECT_EQ(newText, scripts.data (index).toString().toUtf8().constData());
+    EXPECT_LT(mUndoStack.getMemoryUsage(), text.size() / 100);
+
+    mUndoStack.undo();
+    EXPECT_EQ(text, scripts.data (index).toString().toUtf8().constData());
+    EXPECT_EQ(CSMWorld::RecordBase::State_BaseOnly, scripts.getRecord ("script").mState);
+
+    mUndoStack.redo();
+    EXPECT_EQ(newText, scripts.data (index).toString().toUtf8().constData());
+
+    mUndoStack.undo();
+    EXPECT_EQ(text, scripts.data (index).toString().toUtf8().constData());
+}
+
+TEST_F(CommandsTest, nested_row_changes_keep_only_the_changed_row)
+{
+    CSMWorld::IdTree& regions = dynamic_cast<CSMWorld::IdTree&> (getTable (CSMWorld::UniversalId::Type_Regions));
+
+    const int size = 1000;
+    ESM::Region region = makeRegion ("region", size);
+    setRecord (regions, CSMWorld::RecordBase::State_BaseOnly, region, region);
+
+    int column = regions.findColumnIndex (CSMWorld::Columns::ColumnId_RegionSounds);
+
+    Snapshot before = takeSnapshot (regions);
+
+    mUndoStack.push (new CSMWorld::DeleteNestedCommand (regions, "region", 10, column));
+    mUndoStack.push (new CSMWorld::AddNestedCommand (regions, "region", 5, column));
+    mUndoStack.push (new CSMWorld::AddNestedCommand (regions, "region", size, column));
+
+    EXPECT_EQ(size + 1, regions.rowCount (regions.getModelIndex ("region", column)));
+
+    // a copy of the sound list per command would take three times the size of the list
+    EXPECT_LT(mUndoStack.getMemoryUsage(), size * sizeof (ESM::Region::SoundRef) / 10);
+
+    Snapshot after = takeSnapshot (regions);
+
+    undo (3);
+    EXPECT_TRUE(before == takeSnapshot (regions));
+    EXPECT_EQ(CSMWorld::RecordBase::State_BaseOnly, regions.getRecord ("region").mState);
+
+    redo (3);
+    EXPECT_TRUE(after == takeSnapshot (regions));
+
+    undo (3);
+    EXPECT_TRUE(before == takeSnapshot (regions));
+}
+
+TEST_F(CommandsTest, memory_limit_evicts_the_oldest_commands)
+{
+    CSMWorld::IdTable& regions = getTable (CSMWorld::UniversalId::Type_Regions);
+
+    ESM::Region region = makeRegion ("region", 0);
+    region.mName = "name x";
+    setRecord (regions, CSMWorld::RecordBase::State_ModifiedOnly, region, region);
+
+    QModelIndex index = regions.getModelIndex ("region", regions.findColumnIndex (CSMWorld::Columns::ColumnId_Name));
+
+    mUndoStack.push (new CSMWorld::ModifyCommand (regions, index, "name 0"));
+
+    std::size_t memory = mUndoStack.getMemoryUsage();
+    mUndoStack.setMemoryLimit (3 * memory);
+
+    for (int i = 1; i < 10; ++i)
+    {
+        std::ostringstream stream;
+        stream << "name " << i;
+        mUndoStack.push (new CSMWorld::ModifyCommand (regions, index, QString::fromUtf8 (stream.str().c_str())));
+    }
+
+    EXPECT_EQ(3, mUndoStack.count());
+    EXPECT_LE(mUndoStack.getMemoryUsage(), 3 * memory);
+
+    while (mUndoStack.canUndo())
+        mUndoStack.undo();
+
+    EXPECT_EQ("name 6", regions.data (index).toString().toStdString());
+}
@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <sstream>
+
+#include "apps/opencs/model/world/refcellindex.hpp"
+
+namespace
+{
+    struct RefCellIndexTest : public ::testing::Test
+    {
+        static const int sNumCells = 10;
+
+        CSMWorld::RefCellIndex mIndex;
+
+        // The cell of each row, scanned for every check
+        std::vector<std::string> mRowCells;
+
+        std::mt19937 mRandom;
+
+        int random (int max)
+        {
+            return std::uniform_int_distribution<int>(0, max - 1)(mRandom);
+        }
+
+        /// Cell key of cell \a index, or the empty key of erased records for sNumCells
+        static std::string getCell (int index)
+        {
+            if (index == sNumCells)
+                return "";
+
+            std::ostringstream stream;
+            stream << "#" << index << " 0";
+            return stream.str();
+        }
+
+        void insertRow (int row, const std::string& cell)
+        {
+            mIndex.insertRow (row, cell);
+            mRowCells.insert (mRowCells.begin() + row, cell);
+        }
+
+        void removeRows (int row, int count)
+        {
+            mIndex.removeRows (row, count);
+            mRowCells.erase (mRowCells.begin() + row, mRowCells.begin() + row + count);
+        }
+
+        void setCell (int row, const std::string& cell)
+        {
+            mIndex.setCell (row, cell);
+            mRowCells[row] = cell;
+        }
+
+        void expectSameRows() const
+        {
+            ASSERT_EQ(static_cast<int>(mRowCells.size()), mIndex.getSize());
+
+            for (int i = 0; i <= sNumCells; ++i)
+            {
+                std::set<int> expected;
+                for (int row = 0; row < static_cast<int>(mRowCells.size()); ++row)
+                    if (mRowCells[row] == getCell (i))
+                        expected.insert (row);
+
+                ASSERT_EQ(expected, mIndex.getRows (getCell (i))) << "cell '" << getCell (i) << "'";
+            }
+        }
+    };
+}
+
+TEST_F(RefCellIndexTest, unknown_cell_has_no_rows)
+{
+    insertRow (0, getCell (0));
+
+    EXPECT_TRUE(mIndex.getRows (getCell (1)).empty());
+}
+
+TEST_F(RefCellIndexTest, inserting_moves_the_following_rows)
+{
+    insertRow (0, "a");
+    insertRow (1, "b");
+    insertRow (2, "a");
+    insertRow (1, "a");
+
+    std::set<int> expected;
+    expected.insert (0);
+    expected.insert (1);
+    expected.insert (3);
+    EXPECT_EQ(expected, mIndex.getRows ("a"));
+
+    ASSERT_EQ(1u, mIndex.getRows ("b").size());
+    EXPECT_EQ(2, *mIndex.getRows ("b").begin());
+}
+
+TEST_F(RefCellIndexTest, removing_the_last_row_of_a_cell_forgets_the_cell)
+{
+    insertRow (0, "a");
+    insertRow (1, "b");
+    insertRow (2, "a");
+
+    removeRows (1, 1);
+
+    EXPECT_TRUE(mIndex.getRows ("b").empty());
+    expectSameRows();
+}
+
+TEST_F(RefCellIndexTest, matches_a_scan_of_all_rows)
+{
+    for (int i = 0; i < 500; ++i)
+        insertRow (i, getCell (random (sNumCells + 1)));
+
+    for (int step = 0; step < 2000; ++step)
+    {
+        int size = static_cast<int>(mRowCells.size());
+
+        switch (random (4))
+        {
+            case 0:
+
+                insertRow (random (size + 1), getCell (random (sNumCells + 1)));
+                break;
+
+            case 1:
+
+                if (size > 0)
+                {
+                    int row = random (size);
+                    removeRows (row, 1 + random (std::min (size - row, 5)));
+                }
+                break;
+
+            case 2:
+
+                if (size > 0)
+                    setCell (random (size), getCell (random (sNumCells + 1)));
+                break;
+
+            case 3:
+
+                // appending and removing at the end, as done when loading
+                insertRow (size, getCell (random (sNumCells + 1)));
+                removeRows (size, 1);
+                break;
+        }
+
+        ASSERT_NO_FATAL_FAILURE(expectSameRows()) << "step " << step;
+    }
+}
@@ -0,0 +1,234 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <sstream>
+
+#include <components/misc/stringops.hpp>
+
+#include "apps/opencs/model/world/data.hpp"
+#include "apps/opencs/model/world/idtable.hpp"
+#include "apps/opencs/model/world/regionmap.hpp"
+#include "apps/opencs/model/world/universalid.hpp"
+
+#include "modelobserver.hpp"
+
+namespace
+{
+    struct RegionMapTest : public ::testing::Test
+    {
+        static const int sRange = 10; ///< cells are placed at -sRange to sRange in both directions
+
+        CSMWorld::Data mData;
+        CSMWorld::IdTable& mRegions;
+        CSMWorld::IdTable& mCells;
+
+        std::mt19937 mRandom;
+
+        RegionMapTest()
+        : mData (ToUTF8::WINDOWS_1252, false, Files::PathContainer(), std::vector<std::string>(), 0,
+            boost::filesystem::path()),
+          mRegions (dynamic_cast<CSMWorld::IdTable&> (
+            *mData.getTableModel (CSMWorld::UniversalId (CSMWorld::UniversalId::Type_Regions)))),
+          mCells (dynamic_cast<CSMWorld::IdTable&> (
+            *mData.getTableModel (CSMWorld::UniversalId (CSMWorld::UniversalId::Type_Cells))))
+        {
+            ESM::Region region;
+            region.blank();
+            region.mId = "Ascadian Isles";
+            region.mMapColor = 0x00ff00;
+
+            mRegions.setRecord (region.mId,
+                CSMWorld::Record<ESM::Region> (CSMWorld::RecordBase::State_ModifiedOnly, 0, &region));
+        }
+
+        QAbstractItemModel& getRegionMap()
+        {
+            return *mData.getTableModel (CSMWorld::UniversalId (CSMWorld::UniversalId::Type_RegionMap));
+        }
+
+        int random (int max)
+        {
+            return std::uniform_int_distribution<int>(0, max - 1)(mRandom);
+        }
+
+        static std::string getCellId (int x, int y)
+        {
+            std::ostringstream stream;
+            stream << "#" << x << " " << y;
+            return stream.str();
+        }
+
+        std::string getRandomRegion()
+        {
+            switch (random (3))
+            {
+                case 0: return "";
+                case 1: return "ascadian isles";
+                default: return "Bitter Coast"; // not a region record
+            }
+        }
+
+        /// Add the cell \a id or replace it, if it already exists
+        void setCell (const std::string& id, const std::string& region, bool deleted)
+        {
+            CSMWorld::Cell cell;
+            cell.blank();
+            cell.mId = id;
+            cell.mRegion = region;
+
+            if (!CSMWorld::CellCoordinates::isExteriorCell (id))
+                cell.mData.mFlags = ESM::Cell::Interior;
+
+            mCells.setRecord (id, CSMWorld::Record<CSMWorld::Cell> (
+                deleted ? CSMWorld::RecordBase::State_Deleted : CSMWorld::RecordBase::State_ModifiedOnly,
+                &cell, &cell));
+        }
+
+        /// Check the region map against a scan of all cell records
+        void expectMatchingCells()
+        {
+            const CSMWorld::IdCollection<CSMWorld::Cell>& cells = mData.getCells();
+
+            std::map<CSMWorld::CellCoordinates, const CSMWorld::Record<CSMWorld::Cell> *> exterior;
+
+            for (int i = 0; i < cells.getSize(); ++i)
+            {
+                const CSMWorld::Record<CSMWorld::Cell>& record = cells.getRecord (i);
+
+                if (record.get().isExterior())
+                    exterior[CSMWorld::CellCoordinates::fromId (record.get().mId).first] = &record;
+            }
+
+            QAbstractItemModel& regionMap = getRegionMap();
+
+            if (exterior.empty())
+            {
+                EXPECT_EQ(0, regionMap.rowCount());
+                EXPECT_EQ(0, regionMap.columnCount());
+                return;
+            }
+
+            int minX = exterior.begin()->first.getX();
+            int maxX = minX;
+            int minY = exterior.begin()->first.getY();
+            int maxY = minY;
+
+            for (std::map<CSMWorld::CellCoordinates, const CSMWorld::Record<CSMWorld::Cell> *>::const_iterator
+                iter (exterior.begin()); iter != exterior.end(); ++iter)
+            {
+                minX = std::min (minX, iter->first.getX());
+                maxX = std::max (maxX, iter->first.getX());
+                minY = std::min (minY, iter->first.getY());
+                maxY = std::max (maxY, iter->first.getY());
+            }
+
+            ASSERT_EQ(maxX - minX + 1, regionMap.columnCount());
+            ASSERT_EQ(maxY - minY + 1, regionMap.rowCount());
+
+            for (int row = 0; row < regionMap.rowCount(); ++row)
+                for (int column = 0; column < regionMap.columnCount(); ++column)
+                {
+                    QModelIndex index = regionMap.index (row, column);
+
+                    // rows are ordered by descending Y coordinate
+                    CSMWorld::CellCoordinates coordinates (minX + column, maxY - row);
+
+                    ASSERT_EQ(getCellId (coordinates.getX(), coordinates.getY()),
+                        regionMap.data (index, CSMWorld::RegionMap::Role_CellId).toString().toUtf8().constData());
+
+                    std::string toolTip = regionMap.data (index, Qt::ToolTipRole).toString().toUtf8().constData();
+                    std::string region = regionMap.data (index, CSMWorld::RegionMap::Role_Region).toString().toUtf8().constData();
+
+                    std::map<CSMWorld::CellCoordinates, const CSMWorld::Record<CSMWorld::Cell> *>::const_iterator
+                        iter = exterior.find (coordinates);
+
+                    if (iter == exterior.end())
+                    {
+                        EXPECT_NE(std::string::npos, toolTip.find ("(no cell)")) << toolTip;
+                        EXPECT_EQ("", region);
+                    }
+                    else
+                    {
+                        EXPECT_EQ(std::string::npos, toolTip.find ("(no cell)")) << toolTip;
+                        EXPECT_EQ(iter->second->isDeleted(), toolTip.find ("(deleted)") != std::string::npos) << toolTip;
+                        EXPECT_EQ(Misc::StringUtils::lowerCase (iter->second->get().mRegion), region);
+                    }
+                }
+        }
+    };
+}
+
+TEST_F(RegionMapTest, cells_added_later_are_shown)
+{
+    setCell (getCellId (0, 0), "Ascadian Isles", false);
+
+    QAbstractItemModel& regionMap = getRegionMap();
+    CSMTests::ModelObserver observer (regionMap, Qt::ToolTipRole);
+
+    setCell (getCellId (-2, 3), "", false);
+    setCell ("Balmora", "Ascadian Isles", false);
+    setCell (getCellId (0, 0), "Bitter Coast", true);
+
+    EXPECT_EQ(3, regionMap.columnCount());
+    EXPECT_EQ(4, regionMap.rowCount());
+    expectMatchingCells();
+
+    EXPECT_TRUE(observer.matchesModel());
+    EXPECT_TRUE(observer.getErrors().empty()) << observer.getErrors().front();
+}
+
+TEST_F(RegionMapTest, matches_cells_after_random_changes)
+{
+    for (int i = 0; i < 5; ++i)
+        setCell (getCellId (random (2*sRange + 1) - sRange, random (2*sRange + 1) - sRange), getRandomRegion(), false);
+
+    QAbstractItemModel& regionMap = getRegionMap();
+    CSMTests::ModelObserver observer (regionMap, Qt::ToolTipRole);
+
+    for (int step = 0; step < 500; ++step)
+    {
+        int size = mData.getCells().getSize();
+
+        switch (random (4))
+        {
+            case 0:
+
+                // adding or changing cells, which may grow the map in any direction
+                for (int i = random (4); i >= 0; --i)
+                    setCell (getCellId (random (2*sRange + 1) - sRange, random (2*sRange + 1) - sRange),
+                        getRandomRegion(), random (5) == 0);
+                break;
+
+            case 1:
+
+                // removing a block of cells, which may shrink the map or empty it
+                if (size > 0)
+                {
+                    int row = random (size);
+                    mCells.removeRows (row, 1 + random (std::min (size - row, 8)));
+                }
+                break;
+
+            case 2:
+
+                if (size > 0)
+                {
+                    const CSMWorld::Record<CSMWorld::Cell>& record = mData.getCells().getRecord (random (size));
+                    setCell (record.get().mId, getRandomRegion(), random (5) == 0);
+                }
+                break;
+
+            case 3:
+
+                setCell ("Balmora", getRandomRegion(), false);
+                break;
+        }
+
+        ASSERT_NO_FATAL_FAILURE(expectMatchingCells()) << "step " << step;
+
+        ASSERT_TRUE(observer.matchesModel()) << "step " << step;
+        ASSERT_TRUE(observer.getErrors().empty()) << "step " << step << ": " << observer.getErrors().front();
+    }
+}
@@ -0,0 +1,221 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include <QUndoCommand>
+
+#include "apps/opencs/model/world/undostack.hpp"
+
+namespace
+{
+    /// Appends characters to a string
+    class AppendCommand : public QUndoCommand, public CSMWorld::CommandMemory
+    {
+            std::string& mText;
+            std::string mAppended;
+            int mId;
+
+        public:
+
+            AppendCommand (std::string& text, const std::string& appended, int id = -1)
+            : QUndoCommand (QString::fromUtf8 (appended.c_str())), mText (text), mAppended (appended), mId (id)
+            {}
+
+            virtual void redo()
+            {
+                mText += mAppended;
+            }
+
+            virtual void undo()
+            {
+                mText.erase (mText.size()-mAppended.size());
+            }
+
+            virtual int id() const
+            {
+                return mId;
+            }
+
+            virtual bool mergeWith (const QUndoCommand *other)
+            {
+                mAppended += static_cast<const AppendCommand *> (other)->mAppended;
+                return true;
+            }
+
+            virtual std::size_t getMemoryUsage() const
+            {
+                return 100 * mAppended.size();
+            }
+    };
+
+    struct UndoStackTest : public ::testing::Test
+    {
+        CSMWorld::UndoStack mStack;
+        std::string mText;
+
+        void push (const std::string& appended, int id = -1)
+        {
+            mStack.push (new AppendCommand (mText, appended, id));
+        }
+
+        /// Memory used by a command that appends a single character
+        std::size_t getCommandMemory()
+        {
+            std::string text;
+            return CSMWorld::UndoStack::getMemoryUsage (AppendCommand (text, "a"));
+        }
+
+        void undoAll()
+        {
+            while (mStack.canUndo())
+                mStack.undo();
+        }
+    };
+}
+
+TEST_F(UndoStackTest, undo_and_redo_follow_the_stack_order)
+{
+    push ("a");
+    push ("b");
+    push ("c");
+    EXPECT_EQ("abc", mText);
+    EXPECT_EQ("c", mStack.undoText().toStdString());
+
+    mStack.undo();
+    mStack.undo();
+    EXPECT_EQ("a", mText);
+    EXPECT_TRUE(mStack.canRedo());
+
+    mStack.redo();
+    EXPECT_EQ("ab", mText);
+
+    // pushing discards the commands that could be redone
+    push ("d");
+    EXPECT_EQ("abd", mText);
+    EXPECT_EQ(3, mStack.count());
+    EXPECT_FALSE(mStack.canRedo());
+
+    undoAll();
+    EXPECT_EQ("", mText);
+    EXPECT_EQ(0, mStack.index());
+}
+
+TEST_F(UndoStackTest, macro_is_a_single_step)
+{
+    push ("a");
+
+    mStack.beginMacro ("macro");
+    push ("b");
+    EXPECT_FALSE(mStack.canUndo());
+    push ("c");
+    mStack.endMacro();
+
+    EXPECT_EQ("abc", mText);
+    EXPECT_EQ(2, mStack.count());
+    EXPECT_EQ("macro", mStack.undoText().toStdString());
+
+    mStack.undo();
+    EXPECT_EQ("a", mText);
+
+    mStack.redo();
+    EXPECT_EQ("abc", mText);
+}
+
+TEST_F(UndoStackTest, commands_are_merged_except_into_the_clean_state)
+{
+    push ("a", 1);
+    push ("b", 1);
+    EXPECT_EQ(1, mStack.count());
+
+    mStack.setClean();
+    push ("c", 1);
+    EXPECT_EQ(2, mStack.count());
+    EXPECT_FALSE(mStack.isClean());
+
+    mStack.undo();
+    EXPECT_EQ("ab", mText);
+    EXPECT_TRUE(mStack.isClean());
+
+    mStack.undo();
+    EXPECT_EQ("", mText);
+}
+
+TEST_F(UndoStackTest, memory_limit_discards_the_oldest_commands)
+{
+    std::size_t memory = getCommandMemory();
+    mStack.setMemoryLimit (3 * memory);
+
+    push ("a");
+    push ("b");
+    push ("c");
+    push ("d");
+    push ("e");
+
+    EXPECT_EQ("abcde", mText);
+    EXPECT_EQ(3, mStack.count());
+    EXPECT_EQ(3 * memory, mStack.getMemoryUsage());
+
+    undoAll();
+    EXPECT_EQ("ab", mText);
+
+    // the initial clean state has been discarded
+    EXPECT_FALSE(mStack.isClean());
+}
+
+TEST_F(UndoStackTest, lowering_the_limit_applies_to_the_existing_commands)
+{
+    push ("a");
+    push ("b");
+    push ("c");
+    push ("d");
+    mStack.setClean();
+    mStack.undo();
+
+    mStack.setMemoryLimit (getCommandMemory());
+
+    // the command that can be redone and the latest undo step are kept
+    EXPECT_EQ(2, mStack.count());
+    EXPECT_EQ(1, mStack.index());
+    EXPECT_EQ("abc", mText);
+
+    mStack.redo();
+    EXPECT_EQ("abcd", mText);
+    EXPECT_TRUE(mStack.isClean());
+
+    undoAll();
+    EXPECT_EQ("ab", mText);
+}
+
+TEST_F(UndoStackTest, latest_command_is_never_discarded)
+{
+    mStack.setMemoryLimit (1);
+
+    push ("a");
+    push ("b");
+    EXPECT_EQ(1, mStack.count());
+
+    mStack.beginMacro ("macro");
+    push ("c");
+    push ("d");
+    mStack.endMacro();
+    EXPECT_EQ(1, mStack.count());
+
+    mStack.undo();
+    EXPECT_EQ("ab", mText);
+    EXPECT_FALSE(mStack.canUndo());
+}
+
+TEST_F(UndoStackTest, memory_of_merged_commands_is_updated)
+{
+    push ("a", 1);
+    std::size_t memory = mStack.getMemoryUsage();
+
+    push ("bcdefgh", 1);
+    EXPECT_EQ(1, mStack.count());
+    EXPECT_EQ(memory + 700, mStack.getMemoryUsage());
+
+    mStack.setMemoryLimit (memory + 700);
+    push ("i");
+    EXPECT_EQ(1, mStack.count());
+    EXPECT_EQ("abcdefghi", mText);
+}
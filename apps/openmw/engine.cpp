@@ -261,7 +261,8 @@ void OMW::Engine::enableFSStrict(bool fsStrict)
 void OMW::Engine::setDataDirs (const Files::PathContainer& dataDirs)
 {
     mDataDirs = dataDirs;
-    mFileCollections = Files::Collections (dataDirs, !mFSStrict);
+    mFileCollections = Files::Collections (dataDirs, !mFSStrict,
+        mCfgMgr.getCachePath() / Files::DirectoryIndex::sCacheFileName);
 }
 
 // Add BSA archive
@@ -89,6 +89,9 @@ namespace MWBase
             virtual TTopicIter topicEnd() const = 0;
             ///< Iterator pointing past the last topic.
 
+            virtual uint64_t getRevision() const = 0;
+            ///< Changes whenever main journal entries or topic entries are added or removed.
+
             virtual int countSavedGameRecords() const = 0;
 
             virtual void write (ESM::ESMWriter& writer, Loading::Listener& progress) const = 0;
@@ -42,6 +42,7 @@ namespace MWMechanics
     template<typename T>
     class DynamicStat;
     class SkillValue;
+    class StatChannel;
 }
 
 namespace MWWorld
@@ -152,12 +153,8 @@ namespace MWBase
 
             virtual void setConsoleSelectedObject(const MWWorld::Ptr& object) = 0;
 
-            /// Set value for the given ID.
-            virtual void setValue (const std::string& id, const MWMechanics::AttributeValue& value) = 0;
-            virtual void setValue (int parSkill, const MWMechanics::SkillValue& value) = 0;
-            virtual void setValue (const std::string& id, const MWMechanics::DynamicStat<float>& value) = 0;
-            virtual void setValue (const std::string& id, const std::string& value) = 0;
-            virtual void setValue (const std::string& id, int value) = 0;
+            /// Changes of the player's stats are published here. They are delivered to the GUI once per frame.
+            virtual MWMechanics::StatChannel& getStatChannel() = 0;
 
             /// Set time left for the player to start drowning (update the drowning bar)
             /// @param time time left to start drowning
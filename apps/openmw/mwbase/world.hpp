@@ -162,6 +162,12 @@ namespace MWBase
             virtual char getGlobalVariableType (const std::string& name) const = 0;
             ///< Return ' ', if there is no global variable with this name.
 
+            virtual float getGlobalFloat (int slot) const = 0;
+            ///< Get value independently from real type.
+            ///
+            /// \note Dialogue conditions get their slots when the content files are loaded, see
+            /// MWWorld::ESMStore::resolveGlobalSlots.
+
             virtual std::string getCellName (const MWWorld::CellStore *cell = 0) const = 0;
             ///< Return name of the cell.
             ///
@@ -376,8 +382,6 @@ namespace MWBase
             virtual bool canPlaceObject (float cursorX, float cursorY) = 0;
             ///< @return true if it is possible to place on object at specified cursor location
 
-            virtual void processChangedSettings (const std::set< std::pair<std::string, std::string> >& settings) = 0;
-
             virtual bool isFlying(const MWWorld::Ptr &ptr) const = 0;
             virtual bool isSlowFalling(const MWWorld::Ptr &ptr) const = 0;
             virtual bool isSwimming(const MWWorld::ConstPtr &object) const = 0;
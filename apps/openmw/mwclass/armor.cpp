@@ -24,6 +24,14 @@
 
 #include "../mwgui/tooltips.hpp"
 
+namespace
+{
+    namespace Gmst
+    {
+        const MWWorld::GmstInt iBaseArmorSkill("iBaseArmorSkill");
+    }
+}
+
 namespace MWClass
 {
 
@@ -285,7 +293,7 @@ namespace MWClass
         int armorSkill = actor.getClass().getSkill(actor, armorSkillType);
 
         const MWBase::World *world = MWBase::Environment::get().getWorld();
-        int iBaseArmorSkill = world->getStore().get<ESM::GameSetting>().find("iBaseArmorSkill")->getInt();
+        int iBaseArmorSkill = Gmst::iBaseArmorSkill.get(world->getStore().getGameSettings());
 
         if(ref->mBase->mData.mWeight == 0)
             return ref->mBase->mData.mArmor;
@@ -41,6 +41,12 @@
 
 namespace
 {
+    namespace Gmst
+    {
+        const MWWorld::GmstFloat fCombatDistance("fCombatDistance");
+        const MWWorld::GmstFloat fCorpseClearDelay("fCorpseClearDelay");
+        const MWWorld::GmstFloat fCorpseRespawnDelay("fCorpseRespawnDelay");
+    }
     bool isFlagBitSet(const MWWorld::ConstPtr &ptr, ESM::Creature::Flags bitMask)
     {
         return (ptr.get<ESM::Creature>()->mBase->mFlags & bitMask) != 0;
@@ -228,7 +234,7 @@ namespace MWClass
     {
         MWWorld::LiveCellRef<ESM::Creature> *ref =
             ptr.get<ESM::Creature>();
-        const MWWorld::Store<ESM::GameSetting> &gmst = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
+        const MWWorld::GameSettingsCache& gmst = MWBase::Environment::get().getWorld()->getStore().getGameSettings();
         MWMechanics::CreatureStats &stats = getCreatureStats(ptr);
 
         if (stats.getDrawState() != MWMechanics::DrawState_Weapon)
@@ -246,7 +252,7 @@ namespace MWClass
 
         MWMechanics::applyFatigueLoss(ptr, weapon, attackStrength);
 
-        float dist = gmst.find("fCombatDistance")->getFloat();
+        float dist = Gmst::fCombatDistance.get(gmst);
         if (!weapon.isEmpty())
             dist *= weapon.get<ESM::Weapon>()->mBase->mData.mReach;
 
@@ -453,7 +459,8 @@ namespace MWClass
 
         if(stats.isDead())
         {
-            bool canLoot = Settings::Manager::getBool ("can loot during death animation", "Game");
+            static const Settings::Handle<bool> canLootDuringDeathAnimation("can loot during death animation", "Game");
+            bool canLoot = canLootDuringDeathAnimation.get();
 
             // by default user can loot friendly actors during death animation
             if (canLoot && !stats.getAiSequence().isInCombat())
@@ -814,9 +821,9 @@ namespace MWClass
         if (ptr.getRefData().getCount() > 0 && !creatureStats.isDead())
             return;
 
-        const MWWorld::Store<ESM::GameSetting>& gmst = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
-        static const float fCorpseRespawnDelay = gmst.find("fCorpseRespawnDelay")->getFloat();
-        static const float fCorpseClearDelay = gmst.find("fCorpseClearDelay")->getFloat();
+        const MWWorld::GameSettingsCache& gmst = MWBase::Environment::get().getWorld()->getStore().getGameSettings();
+        const float fCorpseRespawnDelay = Gmst::fCorpseRespawnDelay.get(gmst);
+        const float fCorpseClearDelay = Gmst::fCorpseClearDelay.get(gmst);
 
         float delay = ptr.getRefData().getCount() == 0 ? fCorpseClearDelay : std::min(fCorpseRespawnDelay, fCorpseClearDelay);
 
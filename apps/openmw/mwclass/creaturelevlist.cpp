@@ -8,6 +8,15 @@
 #include "../mwworld/customdata.hpp"
 #include "../mwmechanics/creaturestats.hpp"
 
+namespace
+{
+    namespace Gmst
+    {
+        const MWWorld::GmstFloat fCorpseClearDelay("fCorpseClearDelay");
+        const MWWorld::GmstFloat fCorpseRespawnDelay("fCorpseRespawnDelay");
+    }
+}
+
 namespace MWClass
 {
     class CreatureLevListCustomData : public MWWorld::CustomData
@@ -55,9 +64,9 @@ namespace MWClass
                 customData.mSpawn = true;
             else if (creatureStats.isDead())
             {
-                const MWWorld::Store<ESM::GameSetting>& gmst = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
-                static const float fCorpseRespawnDelay = gmst.find("fCorpseRespawnDelay")->getFloat();
-                static const float fCorpseClearDelay = gmst.find("fCorpseClearDelay")->getFloat();
+                const MWWorld::GameSettingsCache& gmst = MWBase::Environment::get().getWorld()->getStore().getGameSettings();
+                const float fCorpseRespawnDelay = Gmst::fCorpseRespawnDelay.get(gmst);
+                const float fCorpseClearDelay = Gmst::fCorpseClearDelay.get(gmst);
 
                 float delay = std::min(fCorpseRespawnDelay, fCorpseClearDelay);
                 if (creatureStats.getTimeOfDeath() + delay <= MWBase::Environment::get().getWorld()->getTimeStamp())
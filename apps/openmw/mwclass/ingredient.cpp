@@ -21,6 +21,14 @@
 #include "../mwrender/objects.hpp"
 #include "../mwrender/renderinginterface.hpp"
 
+namespace
+{
+    namespace Gmst
+    {
+        const MWWorld::GmstFloat fWortChanceValue("fWortChanceValue");
+    }
+}
+
 namespace MWClass
 {
 
@@ -137,8 +145,8 @@ namespace MWClass
         MWMechanics::NpcStats& npcStats = player.getClass().getNpcStats (player);
         int alchemySkill = npcStats.getSkill (ESM::Skill::Alchemy).getBase();
 
-        static const float fWortChanceValue =
-                MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fWortChanceValue")->getFloat();
+        const float fWortChanceValue =
+                Gmst::fWortChanceValue.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
 
         MWGui::Widgets::SpellEffectList list;
         for (int i=0; i<4; ++i)
@@ -160,7 +160,8 @@ namespace MWClass
 
         std::string text;
 
-        if (Settings::Manager::getBool("show effect duration","Game"))
+        static const Settings::Handle<bool> showEffectDuration("show effect duration", "Game");
+        if (showEffectDuration.get())
             text += "\n#{sDuration}: " + MWGui::ToolTips::toString(ptr.getClass().getRemainingUsageTime(ptr));
 
         text += MWGui::ToolTips::getWeightString(ref->mBase->mData.mWeight, "#{sWeight}");
@@ -44,6 +44,22 @@
 
 namespace
 {
+    namespace Gmst
+    {
+        const MWWorld::GmstFloat fCombatCriticalStrikeMult("fCombatCriticalStrikeMult");
+        const MWWorld::GmstFloat fCombatDistance("fCombatDistance");
+        const MWWorld::GmstFloat fCombatKODamageMult("fCombatKODamageMult");
+        const MWWorld::GmstFloat fCorpseClearDelay("fCorpseClearDelay");
+        const MWWorld::GmstFloat fCorpseRespawnDelay("fCorpseRespawnDelay");
+        const MWWorld::GmstFloat fEncumbranceStrMult("fEncumbranceStrMult");
+        const MWWorld::GmstFloat fHandToHandReach("fHandToHandReach");
+        const MWWorld::GmstFloat fUnarmoredBase1("fUnarmoredBase1");
+        const MWWorld::GmstFloat fUnarmoredBase2("fUnarmoredBase2");
+        const MWWorld::GmstInt iAutoRepFacMod("iAutoRepFacMod");
+        const MWWorld::GmstInt iAutoRepLevMod("iAutoRepLevMod");
+        const MWWorld::GmstInt iVoiceHitOdds("iVoiceHitOdds");
+        const MWWorld::GmstString sWerewolfPopup("sWerewolfPopup");
+    }
 
     int is_even(double d) {
         double int_part;
@@ -368,10 +384,8 @@ namespace MWClass
 
             if (!ref->mBase->mFaction.empty())
             {
-                static const int iAutoRepFacMod = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>()
-                        .find("iAutoRepFacMod")->getInt();
-                static const int iAutoRepLevMod = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>()
-                        .find("iAutoRepLevMod")->getInt();
+                const int iAutoRepFacMod = Gmst::iAutoRepFacMod.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
+                const int iAutoRepLevMod = Gmst::iAutoRepLevMod.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
                 int rank = ref->mBase->getFactionRank();
 
                 data->mNpcStats.setReputation(iAutoRepFacMod * (rank+1) + iAutoRepLevMod * (data->mNpcStats.getLevel()-1));
@@ -523,9 +537,9 @@ namespace MWClass
         if(ptr.getRefData().getCustomData() && ptr.getRefData().getCustomData()->asNpcCustomData().mNpcStats.isWerewolf())
         {
             const MWBase::World *world = MWBase::Environment::get().getWorld();
-            const MWWorld::Store<ESM::GameSetting> &store = world->getStore().get<ESM::GameSetting>();
+            const MWWorld::GameSettingsCache& store = world->getStore().getGameSettings();
 
-            return store.find("sWerewolfPopup")->getString();
+            return Gmst::sWerewolfPopup.get(store);
         }
 
         const MWWorld::LiveCellRef<ESM::NPC> *ref = ptr.get<ESM::NPC>();
@@ -551,7 +565,7 @@ namespace MWClass
     {
         MWBase::World *world = MWBase::Environment::get().getWorld();
 
-        const MWWorld::Store<ESM::GameSetting> &store = world->getStore().get<ESM::GameSetting>();
+        const MWWorld::GameSettingsCache& store = world->getStore().getGameSettings();
 
         // Get the weapon used (if hand-to-hand, weapon = inv.end())
         MWWorld::InventoryStore &inv = getInventoryStore(ptr);
@@ -562,10 +576,10 @@ namespace MWClass
 
         MWMechanics::applyFatigueLoss(ptr, weapon, attackStrength);
 
-        const float fCombatDistance = store.find("fCombatDistance")->getFloat();
+        const float fCombatDistance = Gmst::fCombatDistance.get(store);
         float dist = fCombatDistance * (!weapon.isEmpty() ?
                                weapon.get<ESM::Weapon>()->mBase->mData.mReach :
-                               store.find("fHandToHandReach")->getFloat());
+                               Gmst::fHandToHandReach.get(store));
 
         // For AI actors, get combat targets to use in the ray cast. Only those targets will return a positive hit result.
         std::vector<MWWorld::Ptr> targetActors;
@@ -635,14 +649,14 @@ namespace MWClass
                     && !MWBase::Environment::get().getMechanicsManager()->awarenessCheck(ptr, victim);
             if(unaware)
             {
-                damage *= store.find("fCombatCriticalStrikeMult")->getFloat();
+                damage *= Gmst::fCombatCriticalStrikeMult.get(store);
                 MWBase::Environment::get().getWindowManager()->messageBox("#{sTargetCriticalStrike}");
                 MWBase::Environment::get().getSoundManager()->playSound3D(victim, "critical damage", 1.0f, 1.0f);
             }
         }
 
         if (othercls.getCreatureStats(victim).getKnockedDown())
-            damage *= store.find("fCombatKODamageMult")->getFloat();
+            damage *= Gmst::fCombatKODamageMult.get(store);
 
         // Apply "On hit" enchanted weapons
         MWMechanics::applyOnStrikeEnchantment(ptr, victim, weapon, hitPosition);
@@ -734,7 +748,7 @@ namespace MWClass
             const MWWorld::ESMStore &store = MWBase::Environment::get().getWorld()->getStore();
             const GMST& gmst = getGmst();
 
-            int chance = store.get<ESM::GameSetting>().find("iVoiceHitOdds")->getInt();
+            int chance = Gmst::iVoiceHitOdds.get(store.getGameSettings());
             if (Misc::Rng::roll0to99() < chance)
                 MWBase::Environment::get().getDialogueManager()->say(ptr, "hit");
 
@@ -868,7 +882,8 @@ namespace MWClass
 
         if(stats.isDead())
         {
-            bool canLoot = Settings::Manager::getBool ("can loot during death animation", "Game");
+            static const Settings::Handle<bool> canLootDuringDeathAnimation("can loot during death animation", "Game");
+            bool canLoot = canLootDuringDeathAnimation.get();
 
             // by default user can loot friendly actors during death animation
             if (canLoot && !stats.getAiSequence().isInCombat())
@@ -1070,7 +1085,7 @@ namespace MWClass
     float Npc::getCapacity (const MWWorld::Ptr& ptr) const
     {
         const MWMechanics::CreatureStats& stats = getCreatureStats (ptr);
-        static const float fEncumbranceStrMult = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fEncumbranceStrMult")->getFloat();
+        const float fEncumbranceStrMult = Gmst::fEncumbranceStrMult.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
         return stats.getAttribute(0).getModified()*fEncumbranceStrMult;
     }
 
@@ -1108,13 +1123,13 @@ namespace MWClass
     float Npc::getArmorRating (const MWWorld::Ptr& ptr) const
     {
         const MWBase::World *world = MWBase::Environment::get().getWorld();
-        const MWWorld::Store<ESM::GameSetting> &store = world->getStore().get<ESM::GameSetting>();
+        const MWWorld::GameSettingsCache& store = world->getStore().getGameSettings();
 
         MWMechanics::NpcStats &stats = getNpcStats(ptr);
         const MWWorld::InventoryStore &invStore = getInventoryStore(ptr);
 
-        float fUnarmoredBase1 = store.find("fUnarmoredBase1")->getFloat();
-        float fUnarmoredBase2 = store.find("fUnarmoredBase2")->getFloat();
+        float fUnarmoredBase1 = Gmst::fUnarmoredBase1.get(store);
+        float fUnarmoredBase2 = Gmst::fUnarmoredBase2.get(store);
         int unarmoredSkill = stats.getSkill(ESM::Skill::Unarmored).getModified();
 
         float ratings[MWWorld::InventoryStore::Slots];
@@ -1354,9 +1369,9 @@ namespace MWClass
         if (ptr.getRefData().getCount() > 0 && !creatureStats.isDead())
             return;
 
-        const MWWorld::Store<ESM::GameSetting>& gmst = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
-        static const float fCorpseRespawnDelay = gmst.find("fCorpseRespawnDelay")->getFloat();
-        static const float fCorpseClearDelay = gmst.find("fCorpseClearDelay")->getFloat();
+        const MWWorld::GameSettingsCache& gmst = MWBase::Environment::get().getWorld()->getStore().getGameSettings();
+        const float fCorpseRespawnDelay = Gmst::fCorpseRespawnDelay.get(gmst);
+        const float fCorpseClearDelay = Gmst::fCorpseClearDelay.get(gmst);
 
         float delay = ptr.getRefData().getCount() == 0 ? fCorpseClearDelay : std::min(fCorpseRespawnDelay, fCorpseClearDelay);
 
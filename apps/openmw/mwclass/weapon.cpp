@@ -264,7 +264,8 @@ namespace MWClass
         std::string text;
 
         // weapon type & damage
-        if ((ref->mBase->mData.mType < 12 || Settings::Manager::getBool("show projectile damage", "Game")) && ref->mBase->mData.mType < 14)
+        static const Settings::Handle<bool> showProjectileDamage("show projectile damage", "Game");
+        if ((ref->mBase->mData.mType < 12 || showProjectileDamage.get()) && ref->mBase->mData.mType < 14)
         {
             text += "\n#{sType} ";
 
@@ -323,7 +324,8 @@ namespace MWClass
         }
 
         // add reach and attack speed for melee weapon
-        if (ref->mBase->mData.mType < 9 && Settings::Manager::getBool("show melee info", "Game"))
+        static const Settings::Handle<bool> showMeleeInfo("show melee info", "Game");
+        if (ref->mBase->mData.mType < 9 && showMeleeInfo.get())
         {
             text += MWGui::ToolTips::getPercentString(ref->mBase->mData.mReach, "#{sRange}");
 
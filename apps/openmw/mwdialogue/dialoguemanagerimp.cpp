@@ -45,6 +45,35 @@
 #include "filter.hpp"
 #include "hypertextparser.hpp"
 
+namespace
+{
+    class ActorTopicEvaluator : public MWDialogue::TopicEvaluator
+    {
+            MWDialogue::Filter mFilter;
+
+        public:
+
+            ActorTopicEvaluator (const MWWorld::Ptr& actor, bool talkedToPlayer)
+            : mFilter (actor, -1, talkedToPlayer)
+            {}
+
+            virtual bool hasActorResponses (const ESM::Dialogue& topic)
+            {
+                return !mFilter.listAll (topic).empty();
+            }
+
+            virtual bool isAvailable (const ESM::Dialogue& topic)
+            {
+                return mFilter.responseAvailable (topic);
+            }
+
+            virtual double readInput (const MWDialogue::FilterInput& input)
+            {
+                return mFilter.readInput (input);
+            }
+    };
+}
+
 namespace MWDialogue
 {
     DialogueManager::DialogueManager (const Compiler::Extensions& extensions, Translation::Storage& translationDataStorage) :
@@ -65,6 +94,7 @@ namespace MWDialogue
     void DialogueManager::clear()
     {
         mKnownTopics.clear();
+        mTopicAvailability.clearActors();
         mTalkedTo = false;
         mTemporaryDispositionChange = 0;
         mPermanentDispositionChange = 0;
@@ -307,22 +337,23 @@ namespace MWDialogue
 
         mActorKnownTopics.clear();
 
-        const MWWorld::Store<ESM::Dialogue> &dialogs =
-            MWBase::Environment::get().getWorld()->getStore().get<ESM::Dialogue>();
-
-        Filter filter (mActor, -1, mTalkedTo);
-
-        for (MWWorld::Store<ESM::Dialogue>::iterator iter = dialogs.begin(); iter != dialogs.end(); ++iter)
+        if (mTopicAvailability.empty())
         {
-            if (iter->mType == ESM::Dialogue::Topic)
-            {
-                if (filter.responseAvailable (*iter))
-                {
-                    mActorKnownTopics.insert (iter->mId);
-                }
-            }
+            const MWWorld::Store<ESM::Dialogue> &dialogs =
+                MWBase::Environment::get().getWorld()->getStore().get<ESM::Dialogue>();
+
+            for (MWWorld::Store<ESM::Dialogue>::iterator iter = dialogs.begin(); iter != dialogs.end(); ++iter)
+                if (iter->mType == ESM::Dialogue::Topic)
+                    mTopicAvailability.addTopic (*iter);
         }
 
+        ActorTopicEvaluator evaluator (mActor, mTalkedTo);
+
+        std::vector<const ESM::Dialogue*> topics;
+        mTopicAvailability.update (mActor.getCellRef().getRefId(), evaluator, topics);
+
+        for (std::vector<const ESM::Dialogue*>::const_iterator iter (topics.begin()); iter != topics.end(); ++iter)
+            mActorKnownTopics.insert ((*iter)->mId);
     }
 
     std::list<std::string> DialogueManager::getAvailableTopics()
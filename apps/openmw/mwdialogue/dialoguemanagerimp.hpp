@@ -14,6 +14,8 @@
 
 #include "../mwscript/compilercontext.hpp"
 
+#include "topicavailability.hpp"
+
 namespace ESM
 {
     struct Dialogue;
@@ -30,6 +32,7 @@ namespace MWDialogue
             ModFactionReactionMap mChangedFactionReaction;
 
             std::set<std::string, Misc::StringUtils::CiComp> mActorKnownTopics;
+            TopicAvailability mTopicAvailability;
 
             Translation::Storage& mTranslationDataStorage;
             MWScript::CompilerContext mCompilerContext;
@@ -1,5 +1,8 @@
 #include "filter.hpp"
 
+#include <limits>
+#include <stdexcept>
+
 #include <components/compiler/locals.hpp>
 
 #include "../mwbase/environment.hpp"
@@ -20,6 +23,7 @@
 #include "../mwmechanics/actorutil.hpp"
 
 #include "selectwrapper.hpp"
+#include "topicavailability.hpp"
 
 bool MWDialogue::Filter::testActor (const ESM::DialInfo& info) const
 {
@@ -239,10 +243,16 @@ bool MWDialogue::Filter::testSelectStructNumeric (const SelectWrapper& select) c
     switch (select.getFunction())
     {
         case SelectWrapper::Function_Global:
+        {
+            // resolved when the content files were loaded, see MWWorld::ESMStore::resolveGlobalSlots
+            int slot = select.getSelect().mGlobalSlot;
+
+            if (slot==-1)
+                throw std::runtime_error ("unknown global variable: " + select.getName());
 
             // internally all globals are float :(
-            return select.selectCompare (
-                MWBase::Environment::get().getWorld()->getGlobalFloat (select.getName()));
+            return select.selectCompare (MWBase::Environment::get().getWorld()->getGlobalFloat (slot));
+        }
 
         case SelectWrapper::Function_Local:
         {
@@ -692,3 +702,95 @@ bool MWDialogue::Filter::responseAvailable (const ESM::Dialogue& dialogue) const
 
     return false;
 }
+
+double MWDialogue::Filter::readInput (const FilterInput& input) const
+{
+    MWWorld::Ptr player = MWMechanics::getPlayer();
+
+    switch (input.mType)
+    {
+        case FilterInput::Type_Journal:
+
+            return MWBase::Environment::get().getJournal()->getJournalIndex (input.mName);
+
+        case FilterInput::Type_Global:
+
+            if (input.mSlot==-1)
+                return std::numeric_limits<double>::quiet_NaN();
+
+            return MWBase::Environment::get().getWorld()->getGlobalFloat (input.mSlot);
+
+        case FilterInput::Type_Local:
+        {
+            std::string scriptName = mActor.getClass().getScript (mActor);
+
+            // Neither the script of an actor nor its variables change, so a missing variable stays missing.
+            if (scriptName.empty())
+                return std::numeric_limits<double>::max();
+
+            const Compiler::Locals& localDefs =
+                MWBase::Environment::get().getScriptManager()->getLocals (scriptName);
+
+            char type = localDefs.getType (input.mName);
+            int index = localDefs.getIndex (input.mName);
+
+            if (type==' ' || index<0)
+                return std::numeric_limits<double>::max();
+
+            const MWScript::Locals& locals = mActor.getRefData().getLocals();
+            if (locals.isEmpty())
+                return 0;
+
+            switch (type)
+            {
+                case 's': return locals.mShorts[index];
+                case 'l': return locals.mLongs[index];
+                case 'f': return locals.mFloats[index];
+            }
+
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+
+        case FilterInput::Type_Item:
+
+            return player.getClass().getContainerStore (player).count (input.mName);
+
+        case FilterInput::Type_Dead:
+
+            return MWBase::Environment::get().getMechanicsManager()->countDeaths (input.mName);
+
+        case FilterInput::Type_PcFaction:
+
+            return getFactionRank (player,
+                input.mName.empty() ? mActor.getClass().getPrimaryFaction (mActor) : input.mName);
+
+        case FilterInput::Type_PcExpelled:
+        {
+            std::string faction = mActor.getClass().getPrimaryFaction (mActor);
+
+            if (faction.empty())
+                return 0;
+
+            return player.getClass().getNpcStats (player).getExpelled (faction);
+        }
+
+        case FilterInput::Type_PcCell:
+        {
+            const std::string& playerCell = MWBase::Environment::get().getWorld()->getCellName (player.getCell());
+
+            return playerCell.length()>=input.mName.length() &&
+                Misc::StringUtils::ciEqual (playerCell.substr (0, input.mName.length()), input.mName);
+        }
+
+        case FilterInput::Type_ActorCell:
+
+            return Misc::StringUtils::ciEqual (MWBase::Environment::get().getWorld()->getCellName (mActor.getCell()),
+                input.mName);
+
+        case FilterInput::Type_TalkedToPc:
+
+            return mTalkedToPlayer;
+    }
+
+    return std::numeric_limits<double>::quiet_NaN();
+}
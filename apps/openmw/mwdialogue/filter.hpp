@@ -14,6 +14,7 @@ namespace ESM
 namespace MWDialogue
 {
     class SelectWrapper;
+    struct FilterInput;
 
     class Filter
     {
@@ -69,6 +70,9 @@ namespace MWDialogue
 
             bool responseAvailable (const ESM::Dialogue& dialogue) const;
             ///< Does a matching response exist? (disposition is ignored for this check)
+
+            double readInput (const FilterInput& input) const;
+            ///< Current value of a runtime input read by the filter, NaN if it can not be read.
     };
 }
 
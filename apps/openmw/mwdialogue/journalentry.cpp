@@ -14,48 +14,64 @@
 #include "../mwscript/interpretercontext.hpp"
 
 
-namespace MWDialogue
+namespace
 {
-    Entry::Entry() {}
-
-    Entry::Entry (const std::string& topic, const std::string& infoId, const MWWorld::Ptr& actor)
-    : mInfoId (infoId)
+    const ESM::DialInfo *findInfo (const std::string& topic, const std::string& infoId)
     {
         const ESM::Dialogue *dialogue =
             MWBase::Environment::get().getWorld()->getStore().get<ESM::Dialogue>().find (topic);
 
         for (ESM::Dialogue::InfoContainer::const_iterator iter (dialogue->mInfo.begin());
             iter!=dialogue->mInfo.end(); ++iter)
-            if (iter->mId == mInfoId)
-            {
-                if (actor.isEmpty())
-                {
-                    MWScript::InterpreterContext interpreterContext(NULL,MWWorld::Ptr());
-                    mText = Interpreter::fixDefinesDialog(iter->mResponse, interpreterContext);
-                }
-                else
-                {
-                    MWScript::InterpreterContext interpreterContext(&actor.getRefData().getLocals(),actor);
-                    mText = Interpreter::fixDefinesDialog(iter->mResponse, interpreterContext);
-                }
-
-                return;
-            }
+            if (iter->mId == infoId)
+                return &*iter;
+
+        throw std::runtime_error ("unknown info ID " + infoId + " for topic " + topic);
+    }
+}
+
+namespace MWDialogue
+{
+    Entry::Entry() {}
+
+    Entry::Entry (const std::string& topic, const std::string& infoId, const MWWorld::Ptr& actor)
+    {
+        const ESM::DialInfo *info = findInfo (topic, infoId);
+
+        if (actor.isEmpty())
+        {
+            MWScript::InterpreterContext interpreterContext(NULL,MWWorld::Ptr());
+            mText = EntryText (info, Interpreter::fixDefinesDialog(info->mResponse, interpreterContext));
+        }
+        else
+        {
+            MWScript::InterpreterContext interpreterContext(&actor.getRefData().getLocals(),actor);
+            mText = EntryText (info, Interpreter::fixDefinesDialog(info->mResponse, interpreterContext));
+        }
+    }
+
+    Entry::Entry (const ESM::JournalEntry& record)
+    : mText (findInfo (record.mTopic, record.mInfo), record.mText), mActorName(record.mActorName) {}
 
-        throw std::runtime_error ("unknown info ID " + mInfoId + " for topic " + topic);
+    const ESM::DialInfo *Entry::getInfo() const
+    {
+        return mText.getInfo();
     }
 
-    Entry::Entry (const ESM::JournalEntry& record) : mInfoId (record.mInfo), mText (record.mText), mActorName(record.mActorName) {}
+    const std::string& Entry::getInfoId() const
+    {
+        return mText.getInfoId();
+    }
 
-    std::string Entry::getText() const
+    const std::string& Entry::getText() const
     {
-        return mText;
+        return mText.get();
     }
 
     void Entry::write (ESM::JournalEntry& entry) const
     {
-        entry.mInfo = mInfoId;
-        entry.mText = mText;
+        entry.mInfo = getInfoId();
+        entry.mText = getText();
         entry.mActorName = mActorName;
     }
 
@@ -82,6 +98,11 @@ namespace MWDialogue
     }
 
     std::string JournalEntry::idFromIndex (const std::string& topic, int index)
+    {
+        return infoFromIndex (topic, index)->mId;
+    }
+
+    const ESM::DialInfo *JournalEntry::infoFromIndex (const std::string& topic, int index)
     {
         const ESM::Dialogue *dialogue =
             MWBase::Environment::get().getWorld()->getStore().get<ESM::Dialogue>().find (topic);
@@ -90,7 +111,7 @@ namespace MWDialogue
             iter!=dialogue->mInfo.end(); ++iter)
             if (iter->mData.mJournalIndex==index)
             {
-                return iter->mId;
+                return &*iter;
             }
 
         throw std::runtime_error ("unknown journal index for topic " + topic);
@@ -3,9 +3,12 @@
 
 #include <string>
 
+#include "journaltext.hpp"
+
 namespace ESM
 {
     struct JournalEntry;
+    struct DialInfo;
 }
 
 namespace MWWorld
@@ -18,8 +21,7 @@ namespace MWDialogue
     /// \brief Basic quest/dialogue/topic entry
     struct Entry
     {
-        std::string mInfoId;
-        std::string mText;
+        EntryText mText;
         std::string mActorName; // optional
 
         Entry();
@@ -27,9 +29,14 @@ namespace MWDialogue
         /// actor is optional
         Entry (const std::string& topic, const std::string& infoId, const MWWorld::Ptr& actor);
 
+        /// \note The info record of the entry must exist.
         Entry (const ESM::JournalEntry& record);
 
-        std::string getText() const;
+        const ESM::DialInfo *getInfo() const;
+
+        const std::string& getInfoId() const;
+
+        const std::string& getText() const;
 
         void write (ESM::JournalEntry& entry) const;
     };
@@ -52,6 +59,8 @@ namespace MWDialogue
         static JournalEntry makeFromQuest (const std::string& topic, int index);
 
         static std::string idFromIndex (const std::string& topic, int index);
+
+        static const ESM::DialInfo *infoFromIndex (const std::string& topic, int index);
     };
 
     /// \brief A quest entry with a timestamp.
@@ -65,30 +65,31 @@ namespace MWDialogue
         return false;
     }
 
-    Journal::Journal()
+    Journal::Journal() : mRevision (0)
     {}
 
     void Journal::clear()
     {
         mJournal.clear();
+        mJournalInfos.clear();
         mQuests.clear();
         mTopics.clear();
+        ++mRevision;
     }
 
     void Journal::addEntry (const std::string& id, int index, const MWWorld::Ptr& actor)
     {
         // bail out if we already have heard this...
-        std::string infoId = JournalEntry::idFromIndex (id, index);
-        for (TEntryIter i = mJournal.begin (); i != mJournal.end (); ++i)
-            if (i->mTopic == id && i->mInfoId == infoId)
+        const ESM::DialInfo *info = JournalEntry::infoFromIndex (id, index);
+        if (mJournalInfos.find (info)!=mJournalInfos.end())
+        {
+            if (getJournalIndex(id) < index)
             {
-                if (getJournalIndex(id) < index)
-                {
-                    setJournalIndex(id, index);
-                    MWBase::Environment::get().getWindowManager()->messageBox ("#{sJournalEntry}");
-                }
-                return;
+                setJournalIndex(id, index);
+                MWBase::Environment::get().getWindowManager()->messageBox ("#{sJournalEntry}");
             }
+            return;
+        }
 
         StampedJournalEntry entry = StampedJournalEntry::makeFromQuest (id, index, actor);
 
@@ -99,6 +100,8 @@ namespace MWDialogue
         if (!entry.getText().empty())
         {
             mJournal.push_back (entry);
+            mJournalInfos.insert (entry.getInfo());
+            ++mRevision;
             MWBase::Environment::get().getWindowManager()->messageBox ("#{sJournalEntry}");
         }
     }
@@ -117,6 +120,7 @@ namespace MWDialogue
         JournalEntry entry(topicId, infoId, actor);
         entry.mActorName = actor.getClass().getName(actor);
         topic.addEntry (entry);
+        ++mRevision;
     }
 
     void Journal::removeLastAddedTopicResponse(const std::string &topicId, const std::string &actorName)
@@ -127,6 +131,8 @@ namespace MWDialogue
 
         if (topic.begin() == topic.end())
             mTopics.erase(mTopics.find(topicId)); // All responses removed -> remove topic
+
+        ++mRevision;
     }
 
     int Journal::getJournalIndex (const std::string& id) const
@@ -169,6 +175,11 @@ namespace MWDialogue
         return mTopics.end();
     }
 
+    uint64_t Journal::getRevision() const
+    {
+        return mRevision;
+    }
+
     int Journal::countSavedGameRecords() const
     {
         int count = static_cast<int> (mQuests.size());
@@ -253,11 +264,14 @@ namespace MWDialogue
                     case ESM::JournalEntry::Type_Journal:
 
                         mJournal.push_back (record);
+                        mJournalInfos.insert (mJournal.back().getInfo());
+                        ++mRevision;
                         break;
 
                     case ESM::JournalEntry::Type_Topic:
 
                         getTopic (record.mTopic).insertEntry (record);
+                        ++mRevision;
                         break;
                 }
         }
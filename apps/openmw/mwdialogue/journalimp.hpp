@@ -1,6 +1,8 @@
 #ifndef GAME_MWDIALOG_JOURNAL_H
 #define GAME_MWDIALOG_JOURNAL_H
 
+#include <unordered_set>
+
 #include "../mwbase/journal.hpp"
 
 #include "journalentry.hpp"
@@ -15,6 +17,11 @@ namespace MWDialogue
             TQuestContainer mQuests;
             TTopicContainer mTopics;
 
+            // Info records of the entries in mJournal, to skip entries that are already there
+            std::unordered_set<const ESM::DialInfo *> mJournalInfos;
+
+            uint64_t mRevision;
+
         private:
 
             Quest& getQuest (const std::string& id);
@@ -68,6 +75,9 @@ namespace MWDialogue
             virtual TTopicIter topicEnd() const;
             ///< Iterator pointing past the last topic.
 
+            virtual uint64_t getRevision() const;
+            ///< Changes whenever main journal entries or topic entries are added or removed.
+
             virtual int countSavedGameRecords() const;
 
             virtual void write (ESM::ESMWriter& writer, Loading::Listener& progress) const;
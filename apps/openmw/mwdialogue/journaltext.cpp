@@ -0,0 +1,81 @@
+#include "journaltext.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <components/esm/loadinfo.hpp>
+
+namespace MWDialogue
+{
+    EntryText::EntryText() : mInfo (0), mOwnText (true) {}
+
+    EntryText::EntryText (const ESM::DialInfo *info, const std::string& text)
+    : mInfo (info), mOwnText (false)
+    {
+        if (!mInfo)
+            throw std::runtime_error ("journal entry without info record");
+
+        if (text!=mInfo->mResponse)
+        {
+            mText = text;
+            mOwnText = true;
+        }
+    }
+
+    const ESM::DialInfo *EntryText::getInfo() const
+    {
+        return mInfo;
+    }
+
+    const std::string& EntryText::getInfoId() const
+    {
+        static const std::string empty;
+        return mInfo ? mInfo->mId : empty;
+    }
+
+    const std::string& EntryText::get() const
+    {
+        return mOwnText ? mText : mInfo->mResponse;
+    }
+
+    bool EntryText::hasOwnText() const
+    {
+        return mOwnText;
+    }
+
+    void extractHyperlinks (const std::string& text, std::string& displayText, std::vector<Hyperlink>& links)
+    {
+        displayText = text;
+
+        size_t searchPos = 0;
+        for (;;)
+        {
+            // Display names may contain '@' themselves, so searching continues from the start of
+            // the replaced link.
+            size_t posBegin = displayText.find ('@', searchPos);
+            if (posBegin==std::string::npos)
+                break;
+
+            size_t posEnd = displayText.find ('#', posBegin);
+            if (posEnd==std::string::npos)
+                break;
+
+            Hyperlink link;
+            link.mTopic = displayText.substr (posBegin + 1, posEnd - posBegin - 1);
+            const char specialPseudoAsteriskCharacter = 127;
+            std::replace (link.mTopic.begin(), link.mTopic.end(), specialPseudoAsteriskCharacter, '*');
+
+            std::string displayName = link.mTopic;
+            while (!displayName.empty() && displayName[displayName.size()-1]=='*')
+                displayName.erase (displayName.size()-1, 1);
+
+            displayText.replace (posBegin, posEnd+1-posBegin, displayName);
+
+            link.mBegin = posBegin;
+            link.mEnd = posBegin + displayName.size();
+            links.push_back (link);
+
+            searchPos = posBegin;
+        }
+    }
+}
@@ -0,0 +1,54 @@
+#ifndef GAME_MWDIALOGUE_JOURNALTEXT_H
+#define GAME_MWDIALOGUE_JOURNALTEXT_H
+
+#include <string>
+#include <vector>
+
+namespace ESM
+{
+    struct DialInfo;
+}
+
+namespace MWDialogue
+{
+    /// \brief Text of a journal or topic entry
+    ///
+    /// Most responses don't contain escape sequences (%name, etc.), so their text is identical to
+    /// the response of the info record. The text is only copied if it differs.
+    class EntryText
+    {
+            const ESM::DialInfo *mInfo;
+            std::string mText;
+            bool mOwnText;
+
+        public:
+
+            EntryText();
+
+            /// \param info Must outlive this object (info records are never removed from the store).
+            EntryText (const ESM::DialInfo *info, const std::string& text);
+
+            const ESM::DialInfo *getInfo() const;
+
+            const std::string& getInfoId() const;
+
+            const std::string& get() const;
+
+            bool hasOwnText() const;
+            ///< Has the text been copied, because it differs from the response?
+    };
+
+    /// \brief A link in \@link# notation, as used by translated content
+    struct Hyperlink
+    {
+        size_t mBegin;
+        size_t mEnd;
+        std::string mTopic; ///< with pseudo asterisks replaced by '*'
+    };
+
+    void extractHyperlinks (const std::string& text, std::string& displayText, std::vector<Hyperlink>& links);
+    ///< Replace all links in \a text by their display names (without the trailing asterisks) and
+    /// write the result to \a displayText.
+}
+
+#endif
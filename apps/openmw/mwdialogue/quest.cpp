@@ -65,27 +65,16 @@ namespace MWDialogue
 
     void Quest::addEntry (const JournalEntry& entry)
     {
-        int index = -1;
-
-        const ESM::Dialogue *dialogue =
-            MWBase::Environment::get().getWorld()->getStore().get<ESM::Dialogue>().find (entry.mTopic);
-
-        for (ESM::Dialogue::InfoContainer::const_iterator iter (dialogue->mInfo.begin());
-            iter!=dialogue->mInfo.end(); ++iter)
-            if (iter->mId == entry.mInfoId)
-            {
-                index = iter->mData.mJournalIndex;
-                break;
-            }
-
-        if (index==-1)
+        if (!entry.getInfo())
             throw std::runtime_error ("unknown journal entry for topic " + mTopic);
 
+        int index = entry.getInfo()->mData.mJournalIndex;
+
         if (index > mIndex)
             setIndex (index);
 
         for (TEntryIter iter (mEntries.begin()); iter!=mEntries.end(); ++iter)
-            if (iter->mInfoId==entry.mInfoId)
+            if (iter->getInfo()==entry.getInfo())
                 return;
 
         mEntries.push_back (entry); // we want slicing here
@@ -80,6 +80,8 @@ namespace MWDialogue
 
             std::string getName() const;
             ///< Return case-smashed name.
+
+            const ESM::DialInfo::SelectStruct& getSelect() const;
     };
 }
 
@@ -26,7 +26,7 @@ namespace MWDialogue
         // bail out if we already have heard this
         for (Topic::TEntryIter it = mEntries.begin(); it != mEntries.end(); ++it)
         {
-            if (it->mInfoId == entry.mInfoId)
+            if (it->getInfo() == entry.getInfo())
                 return;
         }
 
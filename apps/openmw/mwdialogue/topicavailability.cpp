@@ -0,0 +1,267 @@
+#include "topicavailability.hpp"
+
+#include <algorithm>
+
+#include <components/esm/loaddial.hpp>
+#include <components/esm/loadinfo.hpp>
+#include <components/misc/stringops.hpp>
+
+#include "selectwrapper.hpp"
+
+MWDialogue::FilterInput::FilterInput (Type type, const std::string& name, int slot)
+: mType (type), mName (name), mSlot (slot)
+{}
+
+bool MWDialogue::FilterInput::operator< (const FilterInput& other) const
+{
+    if (mType!=other.mType)
+        return mType<other.mType;
+
+    return mName<other.mName;
+}
+
+MWDialogue::TopicAvailability::TopicAvailability() : mLastEvaluationCount (0) {}
+
+void MWDialogue::TopicAvailability::collectInputs (const ESM::DialInfo& info, std::vector<FilterInput>& inputs,
+    bool& isVolatile)
+{
+    // player faction and cell filters, see Filter::testPlayer
+    if (!info.mPcFaction.empty())
+        inputs.push_back (FilterInput (FilterInput::Type_PcFaction, Misc::StringUtils::lowerCase (info.mPcFaction)));
+    else if (info.mData.mPCrank!=-1)
+        inputs.push_back (FilterInput (FilterInput::Type_PcFaction, ""));
+
+    if (!info.mCell.empty())
+        inputs.push_back (FilterInput (FilterInput::Type_PcCell, Misc::StringUtils::lowerCase (info.mCell)));
+
+    for (std::vector<ESM::DialInfo::SelectStruct>::const_iterator iter (info.mSelects.begin());
+        iter!=info.mSelects.end(); ++iter)
+    {
+        SelectWrapper select (*iter);
+
+        switch (select.getFunction())
+        {
+            case SelectWrapper::Function_None:
+            case SelectWrapper::Function_False:
+            case SelectWrapper::Function_NotId:
+            case SelectWrapper::Function_NotFaction:
+            case SelectWrapper::Function_NotClass:
+            case SelectWrapper::Function_NotRace:
+            case SelectWrapper::Function_Choice:
+
+                // only depends on the actor record
+                break;
+
+            case SelectWrapper::Function_Journal:
+
+                inputs.push_back (FilterInput (FilterInput::Type_Journal, select.getName()));
+                break;
+
+            case SelectWrapper::Function_Global:
+
+                inputs.push_back (FilterInput (FilterInput::Type_Global, select.getName(), iter->mGlobalSlot));
+                break;
+
+            case SelectWrapper::Function_Local:
+            case SelectWrapper::Function_NotLocal:
+
+                inputs.push_back (FilterInput (FilterInput::Type_Local, select.getName()));
+                break;
+
+            case SelectWrapper::Function_Item:
+
+                inputs.push_back (FilterInput (FilterInput::Type_Item, select.getName()));
+                break;
+
+            case SelectWrapper::Function_Dead:
+
+                inputs.push_back (FilterInput (FilterInput::Type_Dead, select.getName()));
+                break;
+
+            case SelectWrapper::Function_SameFaction:
+            case SelectWrapper::Function_FactionRankDiff:
+
+                inputs.push_back (FilterInput (FilterInput::Type_PcFaction, ""));
+                break;
+
+            case SelectWrapper::Function_PcExpelled:
+
+                inputs.push_back (FilterInput (FilterInput::Type_PcExpelled, ""));
+                break;
+
+            case SelectWrapper::Function_NotCell:
+
+                inputs.push_back (FilterInput (FilterInput::Type_ActorCell, select.getName()));
+                break;
+
+            case SelectWrapper::Function_TalkedToPc:
+
+                inputs.push_back (FilterInput (FilterInput::Type_TalkedToPc, ""));
+                break;
+
+            default:
+
+                isVolatile = true;
+                break;
+        }
+    }
+}
+
+void MWDialogue::TopicAvailability::addTopic (const ESM::Dialogue& topic)
+{
+    mActors.clear();
+
+    std::vector<FilterInput> inputs;
+    bool isVolatile = false;
+
+    for (ESM::Dialogue::InfoContainer::const_iterator iter = topic.mInfo.begin(); iter!=topic.mInfo.end(); ++iter)
+        collectInputs (*iter, inputs, isVolatile);
+
+    Topic entry;
+    entry.mDialogue = &topic;
+    entry.mVolatile = isVolatile;
+
+    for (std::vector<FilterInput>::const_iterator iter (inputs.begin()); iter!=inputs.end(); ++iter)
+    {
+        std::map<FilterInput, size_t>::const_iterator found = mInputIndices.find (*iter);
+
+        size_t index = 0;
+
+        if (found==mInputIndices.end())
+        {
+            index = mInputs.size();
+            mInputs.push_back (*iter);
+            mInputIndices.insert (std::make_pair (*iter, index));
+        }
+        else
+            index = found->second;
+
+        if (std::find (entry.mInputs.begin(), entry.mInputs.end(), index)==entry.mInputs.end())
+            entry.mInputs.push_back (index);
+    }
+
+    mTopics.push_back (entry);
+}
+
+bool MWDialogue::TopicAvailability::empty() const
+{
+    return mTopics.empty();
+}
+
+void MWDialogue::TopicAvailability::clear()
+{
+    mTopics.clear();
+    mInputs.clear();
+    mInputIndices.clear();
+    mActors.clear();
+}
+
+void MWDialogue::TopicAvailability::clearActors()
+{
+    mActors.clear();
+}
+
+void MWDialogue::TopicAvailability::setUpActor (ActorCache& cache, TopicEvaluator& evaluator)
+{
+    // input index -> index into cache.mInputs
+    std::map<size_t, size_t> inputs;
+
+    for (size_t i=0; i<mTopics.size(); ++i)
+    {
+        if (!evaluator.hasActorResponses (*mTopics[i].mDialogue))
+            continue;
+
+        size_t topic = cache.mTopics.size();
+        cache.mTopics.push_back (i);
+
+        if (mTopics[i].mVolatile)
+            cache.mVolatileTopics.push_back (topic);
+
+        for (std::vector<size_t>::const_iterator iter (mTopics[i].mInputs.begin());
+            iter!=mTopics[i].mInputs.end(); ++iter)
+        {
+            std::map<size_t, size_t>::const_iterator found = inputs.find (*iter);
+
+            if (found==inputs.end())
+            {
+                found = inputs.insert (std::make_pair (*iter, cache.mInputs.size())).first;
+                cache.mInputs.push_back (*iter);
+                cache.mDependentTopics.push_back (std::vector<size_t>());
+            }
+
+            cache.mDependentTopics[found->second].push_back (topic);
+        }
+    }
+
+    cache.mAvailable.resize (cache.mTopics.size());
+    cache.mValues.resize (cache.mInputs.size());
+
+    for (size_t i=0; i<cache.mTopics.size(); ++i)
+        cache.mAvailable[i] = evaluator.isAvailable (*mTopics[cache.mTopics[i]].mDialogue);
+
+    for (size_t i=0; i<cache.mInputs.size(); ++i)
+        cache.mValues[i] = evaluator.readInput (mInputs[cache.mInputs[i]]);
+
+    mLastEvaluationCount = cache.mTopics.size();
+}
+
+void MWDialogue::TopicAvailability::update (const std::string& actorId, TopicEvaluator& evaluator,
+    std::vector<const ESM::Dialogue*>& available)
+{
+    available.clear();
+
+    std::string key = Misc::StringUtils::lowerCase (actorId);
+
+    std::map<std::string, ActorCache>::iterator found = mActors.find (key);
+
+    if (found==mActors.end())
+    {
+        found = mActors.insert (std::make_pair (key, ActorCache())).first;
+        setUpActor (found->second, evaluator);
+    }
+    else
+    {
+        ActorCache& cache = found->second;
+
+        mDirty.assign (cache.mTopics.size(), false);
+
+        for (std::vector<size_t>::const_iterator iter (cache.mVolatileTopics.begin());
+            iter!=cache.mVolatileTopics.end(); ++iter)
+            mDirty[*iter] = true;
+
+        for (size_t i=0; i<cache.mInputs.size(); ++i)
+        {
+            double value = evaluator.readInput (mInputs[cache.mInputs[i]]);
+
+            // NaN compares unequal to everything, so unreadable inputs always count as changed
+            if (!(value==cache.mValues[i]))
+            {
+                cache.mValues[i] = value;
+
+                for (std::vector<size_t>::const_iterator iter (cache.mDependentTopics[i].begin());
+                    iter!=cache.mDependentTopics[i].end(); ++iter)
+                    mDirty[*iter] = true;
+            }
+        }
+
+        mLastEvaluationCount = 0;
+
+        for (size_t i=0; i<cache.mTopics.size(); ++i)
+            if (mDirty[i])
+            {
+                cache.mAvailable[i] = evaluator.isAvailable (*mTopics[cache.mTopics[i]].mDialogue);
+                ++mLastEvaluationCount;
+            }
+    }
+
+    const ActorCache& cache = found->second;
+
+    for (size_t i=0; i<cache.mTopics.size(); ++i)
+        if (cache.mAvailable[i])
+            available.push_back (mTopics[cache.mTopics[i]].mDialogue);
+}
+
+size_t MWDialogue::TopicAvailability::getLastEvaluationCount() const
+{
+    return mLastEvaluationCount;
+}
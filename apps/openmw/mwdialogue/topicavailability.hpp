@@ -0,0 +1,130 @@
+#ifndef GAME_MWDIALOGUE_TOPICAVAILABILITY_H
+#define GAME_MWDIALOGUE_TOPICAVAILABILITY_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace ESM
+{
+    struct DialInfo;
+    struct Dialogue;
+}
+
+namespace MWDialogue
+{
+    /// \brief Runtime value read by the dialogue filter, besides the static data of the actor and of the info itself
+    struct FilterInput
+    {
+        enum Type
+        {
+            Type_Journal,       ///< Journal index of quest mName
+            Type_Global,        ///< Global variable mName
+            Type_Local,         ///< Local variable mName of the actor's script
+            Type_Item,          ///< Number of items mName in the player's inventory
+            Type_Dead,          ///< Death count of mName
+            Type_PcFaction,     ///< Player rank in faction mName (the actor's faction if empty), -1 for non-members
+            Type_PcExpelled,    ///< Is the player expelled from the actor's faction?
+            Type_PcCell,        ///< Does the player cell name start with mName?
+            Type_ActorCell,     ///< Is the actor cell name mName?
+            Type_TalkedToPc     ///< Has the actor talked to the player before?
+        };
+
+        Type mType;
+        std::string mName; ///< lower case
+        int mSlot; ///< Slot of global mName (see ESM::DialInfo::SelectStruct::mGlobalSlot), -1 for other inputs
+
+        FilterInput (Type type, const std::string& name, int slot = -1);
+
+        bool operator< (const FilterInput& other) const;
+    };
+
+    /// \brief Evaluates topics for one actor on behalf of TopicAvailability
+    class TopicEvaluator
+    {
+        public:
+
+            virtual ~TopicEvaluator() {}
+
+            virtual bool hasActorResponses (const ESM::Dialogue& topic) = 0;
+            ///< Is there any response for the actor, looking only at actor filters that do not change at runtime?
+
+            virtual bool isAvailable (const ESM::Dialogue& topic) = 0;
+            ///< Does a matching response exist? (disposition is ignored for this check)
+
+            virtual double readInput (const FilterInput& input) = 0;
+            ///< Return NaN if the input can not be read (e.g. unknown global). Such inputs count as changed on every
+            /// update.
+    };
+
+    /// \brief Caches topic availability per actor and re-evaluates only topics whose inputs changed
+    ///
+    /// Each topic is tagged with the filter inputs its infos read (journal indices, globals, locals, item counts,
+    /// death counts, player faction ranks, cells). On an update every input relevant for the actor is read once and
+    /// compared against the values seen by the last update; only topics depending on a changed input are evaluated
+    /// again. Topics with conditions on fast changing state (health, skills, weather, AI state, ...) are evaluated
+    /// on every update.
+    ///
+    /// \note Choice conditions are treated as static, since topic availability is always evaluated outside of a
+    /// choice.
+    class TopicAvailability
+    {
+            struct Topic
+            {
+                const ESM::Dialogue* mDialogue;
+                std::vector<size_t> mInputs; // indices into mInputs
+                bool mVolatile;
+            };
+
+            struct ActorCache
+            {
+                std::vector<size_t> mTopics; // topics with any response for this actor
+                std::vector<bool> mAvailable; // per entry in mTopics
+                std::vector<size_t> mVolatileTopics; // indices into mTopics
+
+                std::vector<size_t> mInputs; // inputs read by mTopics
+                std::vector<double> mValues; // per entry in mInputs
+                std::vector<std::vector<size_t> > mDependentTopics; // per entry in mInputs, indices into mTopics
+            };
+
+            std::vector<Topic> mTopics;
+            std::vector<FilterInput> mInputs;
+            std::map<FilterInput, size_t> mInputIndices;
+            std::map<std::string, ActorCache> mActors;
+
+            std::vector<bool> mDirty;
+            size_t mLastEvaluationCount;
+
+            void setUpActor (ActorCache& cache, TopicEvaluator& evaluator);
+
+        public:
+
+            TopicAvailability();
+
+            static void collectInputs (const ESM::DialInfo& info, std::vector<FilterInput>& inputs, bool& isVolatile);
+            ///< Add the runtime inputs read by \a info to \a inputs and set \a isVolatile if some of them are not
+            /// tracked.
+
+            void addTopic (const ESM::Dialogue& topic);
+            ///< \note Drops all cached actors.
+
+            bool empty() const;
+
+            void clear();
+            ///< Forget all topics and cached actors.
+
+            void clearActors();
+
+            void update (const std::string& actorId, TopicEvaluator& evaluator,
+                std::vector<const ESM::Dialogue*>& available);
+            ///< Replace the content of \a available with the topics available for the actor.
+            ///
+            /// \param actorId Case-insensitive key for the cached state; any actor state that differs between actors
+            /// sharing the key must be reported through TopicEvaluator::readInput.
+
+            size_t getLastEvaluationCount() const;
+            ///< Number of topics evaluated by the last update.
+    };
+}
+
+#endif
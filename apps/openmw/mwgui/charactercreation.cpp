@@ -83,48 +83,37 @@ namespace MWGui
         mGenerateClassSpecializations[2] = 0;
     }
 
-    void CharacterCreation::setValue (const std::string& id, const MWMechanics::AttributeValue& value)
+    void CharacterCreation::statChanged (const MWMechanics::StatEvent& event)
     {
-        if (mReviewDialog)
+        if (!mReviewDialog)
+            return;
+
+        switch (event.mType)
         {
-           static const char *ids[] =
-            {
-                "AttribVal1", "AttribVal2", "AttribVal3", "AttribVal4", "AttribVal5",
-                "AttribVal6", "AttribVal7", "AttribVal8",
-                0
-            };
+            case MWMechanics::StatEvent::Type_Attribute:
 
-            for (int i=0; ids[i]; ++i)
-            {
-                if (ids[i]==id)
-                    mReviewDialog->setAttribute(ESM::Attribute::AttributeID(i), value);
-            }
-        }
-    }
+                mReviewDialog->setAttribute (static_cast<ESM::Attribute::AttributeID> (event.mIndex), event.mAttribute);
+                break;
 
-    void CharacterCreation::setValue (const std::string& id, const MWMechanics::DynamicStat<float>& value)
-    {
-        if (mReviewDialog)
-        {
-            if (id == "HBar")
-            {
-                mReviewDialog->setHealth (value);
-            }
-            else if (id == "MBar")
-            {
-                mReviewDialog->setMagicka (value);
-            }
-            else if (id == "FBar")
-            {
-                mReviewDialog->setFatigue (value);
-            }
-        }
-    }
+            case MWMechanics::StatEvent::Type_Skill:
 
-    void CharacterCreation::setValue(const ESM::Skill::SkillEnum parSkill, const MWMechanics::SkillValue& value)
-    {
-        if (mReviewDialog)
-            mReviewDialog->setSkillValue(parSkill, value);
+                mReviewDialog->setSkillValue (static_cast<ESM::Skill::SkillEnum> (event.mIndex), event.mSkill);
+                break;
+
+            case MWMechanics::StatEvent::Type_Dynamic:
+
+                if (event.mIndex == 0)
+                    mReviewDialog->setHealth (event.mDynamic);
+                else if (event.mIndex == 1)
+                    mReviewDialog->setMagicka (event.mDynamic);
+                else if (event.mIndex == 2)
+                    mReviewDialog->setFatigue (event.mDynamic);
+                break;
+
+            default:
+
+                break;
+        }
     }
 
     void CharacterCreation::configureSkills (const SkillList& major, const SkillList& minor)
@@ -397,7 +386,8 @@ namespace MWGui
         if (mNameDialog)
         {
             mPlayerName = mNameDialog->getTextInput();
-            MWBase::Environment::get().getWindowManager()->setValue("name", mPlayerName);
+            MWBase::Environment::get().getWindowManager()->getStatChannel().publish(
+                MWMechanics::StatEvent::makeText(MWMechanics::StatEvent::Type_Name, mPlayerName));
             MWBase::Environment::get().getMechanicsManager()->setPlayerName(mPlayerName);
             MWBase::Environment::get().getWindowManager()->removeDialog(mNameDialog);
             mNameDialog = 0;
@@ -6,7 +6,7 @@
 
 #include <vector>
 
-#include "../mwmechanics/stat.hpp"
+#include "../mwmechanics/statchannel.hpp"
 
 namespace osg
 {
@@ -34,7 +34,7 @@ namespace MWGui
     class ReviewDialog;
     class MessageBoxManager;
 
-    class CharacterCreation
+    class CharacterCreation : public MWMechanics::StatListener
     {
     public:
     typedef std::vector<int> SkillList;
@@ -45,9 +45,7 @@ namespace MWGui
     //Show a dialog
     void spawnDialog(const char id);
 
-    void setValue (const std::string& id, const MWMechanics::AttributeValue& value);
-    void setValue (const std::string& id, const MWMechanics::DynamicStat<float>& value);
-    void setValue(const ESM::Skill::SkillEnum parSkill, const MWMechanics::SkillValue& value);
+    virtual void statChanged (const MWMechanics::StatEvent& event);
     void configureSkills (const SkillList& major, const SkillList& minor);
 
     void onFrame(float duration);
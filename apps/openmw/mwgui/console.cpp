@@ -88,12 +88,14 @@ namespace MWGui
     {
         if (mNames.empty())
         {
+            std::vector<std::string> names;
+
             // keywords
             std::istringstream input ("");
 
             Compiler::Scanner scanner (*this, input, mCompilerContext.getExtensions());
 
-            scanner.listKeywords (mNames);
+            scanner.listKeywords (names);
 
             // identifier
             const MWWorld::ESMStore& store =
@@ -101,7 +103,7 @@ namespace MWGui
 
             for (MWWorld::ESMStore::iterator it = store.begin(); it != store.end(); ++it)
             {
-                it->second->listIdentifier (mNames);
+                it->second->listIdentifier (names);
             }
 
             // exterior cell names aren't technically identifiers, but since the COC function accepts them,
@@ -110,14 +112,11 @@ namespace MWGui
                  it != store.get<ESM::Cell>().extEnd(); ++it)
             {
                 if (!it->mName.empty())
-                    mNames.push_back(it->mName);
+                    names.push_back(it->mName);
             }
 
-            // sort
-            std::sort (mNames.begin(), mNames.end());
-
-            // remove duplicates
-            mNames.erase( std::unique( mNames.begin(), mNames.end() ), mNames.end() );
+            // sorted and without duplicates
+            mNames.insert (names);
         }
     }
 
@@ -344,32 +343,12 @@ namespace MWGui
 
         /* Is there still something in the input string? If not just display all commands and return the unchanged input. */
         if( tmp.length() == 0 ) {
-                matches=mNames;
+            mNames.getAll(matches);
             return input;
         }
 
-        /* Iterate through the vector. */
-        for(std::vector<std::string>::iterator it=mNames.begin(); it < mNames.end();++it) {
-            bool string_different=false;
-
-            /* Is the string shorter than the input string? If yes skip it. */
-            if( (*it).length() < tmp.length() )
-                continue;
-
-            /* Is the beginning of the string different from the input string? If yes skip it. */
-            for( std::string::iterator iter=tmp.begin(), iter2=(*it).begin(); iter < tmp.end();++iter, ++iter2) {
-                if( Misc::StringUtils::toLower(*iter) != Misc::StringUtils::toLower(*iter2) ) {
-                    string_different=true;
-                    break;
-                }
-            }
-
-            if( string_different )
-                continue;
-
-            /* The beginning of the string matches the input string, save it for the next test. */
-            matches.push_back(*it);
-        }
+        /* Find all strings starting with the input string. */
+        mNames.findPrefix(tmp, matches);
 
         /* There are no matches. Return the unchanged input. */
         if( matches.empty() )
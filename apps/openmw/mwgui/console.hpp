@@ -12,6 +12,7 @@
 #include <components/compiler/output.hpp>
 #include <components/compiler/extensions.hpp>
 #include <components/interpreter/interpreter.hpp>
+#include <components/misc/prefixindex.hpp>
 
 #include "../mwscript/compilercontext.hpp"
 #include "../mwscript/interpretercontext.hpp"
@@ -80,7 +81,7 @@ namespace MWGui
 
             Compiler::Extensions mExtensions;
             MWScript::CompilerContext mCompilerContext;
-            std::vector<std::string> mNames;
+            Misc::PrefixIndex mNames;
             bool mConsoleOnlyScripts;
 
             bool compile (const std::string& cmd, Compiler::Output& output);
@@ -91,10 +92,8 @@ namespace MWGui
             /// Report a file related error
             virtual void report (const std::string& message, Type type);
 
-            /// Write all valid identifiers and keywords into mNames and sort them.
+            /// Write all valid identifiers and keywords into mNames.
             /// \note If mNames is not empty, this function is a no-op.
-            /// \note The list may contain duplicates (if a name is a keyword and an identifier at the same
-            /// time).
             void listNames();
   };
 }
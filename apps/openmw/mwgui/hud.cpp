@@ -176,38 +176,29 @@ namespace MWGui
         delete mSpellIcons;
     }
 
-    void HUD::setValue(const std::string& id, const MWMechanics::DynamicStat<float>& value)
+    void HUD::statChanged (const MWMechanics::StatEvent& event)
     {
-        int current = static_cast<int>(value.getCurrent());
-        int modified = static_cast<int>(value.getModified());
+        if (event.mType != MWMechanics::StatEvent::Type_Dynamic)
+            return;
+
+        static const std::string frames[] = { "HealthFrame", "MagickaFrame", "FatigueFrame" };
+        static const std::string descriptions[] = { "#{sHealthDesc}\n", "#{sMagDesc}\n", "#{sFatDesc}\n" };
+
+        MyGUI::ProgressBar* bars[] = { mHealth, mMagicka, mStamina };
+
+        int current = static_cast<int>(event.mDynamic.getCurrent());
+        int modified = static_cast<int>(event.mDynamic.getModified());
 
         // Fatigue can be negative
-        if (id != "FBar")
+        if (event.mIndex != 2)
             current = std::max(0, current);
 
         MyGUI::Widget* w;
         std::string valStr = MyGUI::utility::toString(current) + " / " + MyGUI::utility::toString(modified);
-        if (id == "HBar")
-        {
-            mHealth->setProgressRange(std::max(0, modified));
-            mHealth->setProgressPosition(std::max(0, current));
-            getWidget(w, "HealthFrame");
-            w->setUserString("Caption_HealthDescription", "#{sHealthDesc}\n" + valStr);
-        }
-        else if (id == "MBar")
-        {
-            mMagicka->setProgressRange(std::max(0, modified));
-            mMagicka->setProgressPosition(std::max(0, current));
-            getWidget(w, "MagickaFrame");
-            w->setUserString("Caption_HealthDescription", "#{sMagDesc}\n" + valStr);
-        }
-        else if (id == "FBar")
-        {
-            mStamina->setProgressRange(std::max(0, modified));
-            mStamina->setProgressPosition(std::max(0, current));
-            getWidget(w, "FatigueFrame");
-            w->setUserString("Caption_HealthDescription", "#{sFatDesc}\n" + valStr);
-        }
+        bars[event.mIndex]->setProgressRange(std::max(0, modified));
+        bars[event.mIndex]->setProgressPosition(std::max(0, current));
+        getWidget(w, frames[event.mIndex]);
+        w->setUserString("Caption_HealthDescription", descriptions[event.mIndex] + valStr);
     }
 
     void HUD::setDrowningTimeLeft(float time, float maxTime)
@@ -3,7 +3,7 @@
 
 #include "mapwindow.hpp"
 
-#include "../mwmechanics/stat.hpp"
+#include "../mwmechanics/statchannel.hpp"
 
 namespace MWWorld
 {
@@ -16,12 +16,13 @@ namespace MWGui
     class SpellIcons;
     class ItemWidget;
 
-    class HUD : public WindowBase, public LocalMapBase
+    class HUD : public WindowBase, public LocalMapBase, public MWMechanics::StatListener
     {
     public:
         HUD(CustomMarkerCollection& customMarkers, DragAndDrop* dragAndDrop, MWRender::LocalMap* localMapRender);
         virtual ~HUD();
-        void setValue (const std::string& id, const MWMechanics::DynamicStat<float>& value);
+        /// Update the health, magicka and fatigue bars
+        virtual void statChanged (const MWMechanics::StatEvent& event);
 
         /// Set time left for the player to start drowning
         /// @param time time left to start drowning
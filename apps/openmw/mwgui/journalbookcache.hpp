@@ -0,0 +1,43 @@
+#ifndef MWGUI_JOURNALBOOKCACHE_HPP
+#define MWGUI_JOURNALBOOKCACHE_HPP
+
+#include <stdint.h>
+
+namespace MWGui
+{
+    /// \brief A laid out book of the journal, kept across openings of the journal
+    ///
+    /// Typesetting the whole journal takes longer the more entries it has, so the book is only
+    /// typeset again after the journal changed, i.e. after its revision changed.
+    template <typename Book>
+    class JournalBookCache
+    {
+        Book mBook;
+        uint64_t mRevision;
+
+    public:
+
+        JournalBookCache () : mBook (), mRevision (0) {}
+
+        /// returns the cached book if it was typeset at \a revision, otherwise the book
+        /// returned by \a typeset (), which is cached in its place
+        template <typename Typeset>
+        Book get (uint64_t revision, Typeset typeset)
+        {
+            if (!mBook || mRevision != revision)
+            {
+                mBook = typeset ();
+                mRevision = revision;
+            }
+
+            return mBook;
+        }
+
+        void clear ()
+        {
+            mBook = Book ();
+        }
+    };
+}
+
+#endif // MWGUI_JOURNALBOOKCACHE_HPP
@@ -187,6 +187,11 @@ book JournalBooks::createJournalBook ()
     return typesetter->complete ();
 }
 
+book JournalBooks::getJournalBook ()
+{
+    return mJournalBook.get (mModel->getRevision (), std::bind (&JournalBooks::createJournalBook, this));
+}
+
 book JournalBooks::createTopicBook (uintptr_t topicId)
 {
     BookTypesetter::Ptr typesetter = createTypesetter ();
@@ -2,6 +2,7 @@
 #define MWGUI_JOURNALBOOKS_HPP
 
 #include "bookpage.hpp"
+#include "journalbookcache.hpp"
 #include "journalviewmodel.hpp"
 
 #include <components/to_utf8/to_utf8.hpp>
@@ -19,6 +20,8 @@ namespace MWGui
 
         Book createEmptyJournalBook ();
         Book createJournalBook ();
+        Book getJournalBook ();
+        ///< the journal book, only typeset again if the journal changed since the last call
         Book createTopicBook (uintptr_t topicId);
         Book createTopicBook (const std::string& topicId);
         Book createQuestBook (const std::string& questName);
@@ -30,6 +33,8 @@ namespace MWGui
         BookTypesetter::Ptr createTypesetter ();
         BookTypesetter::Ptr createLatinJournalIndex ();
         BookTypesetter::Ptr createCyrillicJournalIndex ();
+
+        JournalBookCache <Book> mJournalBook;
     };
 }
 
@@ -2,6 +2,8 @@
 
 #include <map>
 #include <sstream>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <MyGUI_LanguageManager.h>
 
@@ -15,6 +17,7 @@
 #include "../mwbase/windowmanager.hpp"
 
 #include "../mwdialogue/keywordsearch.hpp"
+#include "../mwdialogue/journaltext.hpp"
 
 namespace MWGui {
 
@@ -27,6 +30,19 @@ struct JournalViewModelImpl : JournalViewModel
     mutable bool             mKeywordSearchLoaded;
     mutable KeywordSearchT mKeywordSearch;
 
+    typedef std::pair<size_t, size_t> Range;
+
+    struct FormattedText
+    {
+        std::string mText;
+
+        // hyperlinks in @link# notation
+        std::map<Range, intptr_t> mHyperLinks;
+    };
+
+    // Entries are formatted once while the journal is open, not every time a page is laid out
+    mutable std::unordered_map<const MWDialogue::Entry *, FormattedText> mFormattedTexts;
+
     JournalViewModelImpl ()
     {
         mKeywordSearchLoaded = false;
@@ -55,6 +71,7 @@ struct JournalViewModelImpl : JournalViewModel
     {
         mKeywordSearch.clear ();
         mKeywordSearchLoaded = false;
+        mFormattedTexts.clear ();
     }
 
     void ensureKeyWordSearchLoaded () const
@@ -70,6 +87,32 @@ struct JournalViewModelImpl : JournalViewModel
         }
     }
 
+    const FormattedText& getFormattedText (const MWDialogue::Entry& entry) const
+    {
+        std::unordered_map<const MWDialogue::Entry *, FormattedText>::iterator found = mFormattedTexts.find (&entry);
+        if (found != mFormattedTexts.end ())
+            return found->second;
+
+        ensureKeyWordSearchLoaded ();
+
+        FormattedText& formatted = mFormattedTexts[&entry];
+
+        std::vector<MWDialogue::Hyperlink> links;
+        MWDialogue::extractHyperlinks (entry.getText (), formatted.mText, links);
+
+        for (std::vector<MWDialogue::Hyperlink>::const_iterator it = links.begin(); it != links.end(); ++it)
+        {
+            std::string topicName = MWBase::Environment::get().getWindowManager()->
+                    getTranslationDataStorage().topicStandardForm(it->mTopic);
+
+            intptr_t value;
+            if (mKeywordSearch.containsKeyword(topicName, value))
+                formatted.mHyperLinks[std::make_pair(it->mBegin, it->mEnd)] = value;
+        }
+
+        return formatted;
+    }
+
     bool isEmpty () const
     {
         MWBase::Journal * journal = MWBase::Environment::get().getJournal();
@@ -77,6 +120,11 @@ struct JournalViewModelImpl : JournalViewModel
         return journal->begin () == journal->end ();
     }
 
+    uint64_t getRevision () const
+    {
+        return MWBase::Environment::get().getJournal()->getRevision ();
+    }
+
     template <typename t_iterator, typename Interface>
     struct BaseEntry : Interface
     {
@@ -86,67 +134,26 @@ struct JournalViewModelImpl : JournalViewModel
         JournalViewModelImpl const *    mModel;
 
         BaseEntry (JournalViewModelImpl const * model, iterator_t itr) :
-            itr (itr), mModel (model), loaded (false)
+            itr (itr), mModel (model), mFormatted (NULL)
         {}
 
         virtual ~BaseEntry () {}
 
-        mutable bool loaded;
-        mutable std::string utf8text;
+        mutable const FormattedText * mFormatted;
 
-        typedef std::pair<size_t, size_t> Range;
-
-        // hyperlinks in @link# notation
-        mutable std::map<Range, intptr_t> mHyperLinks;
-
-        virtual std::string getText () const = 0;
+        virtual const MWDialogue::Entry& getEntry () const = 0;
 
         void ensureLoaded () const
         {
-            if (!loaded)
-            {
-                mModel->ensureKeyWordSearchLoaded ();
-
-                utf8text = getText ();
-
-                size_t pos_end = 0;
-                for(;;)
-                {
-                    size_t pos_begin = utf8text.find('@');
-                    if (pos_begin != std::string::npos)
-                        pos_end = utf8text.find('#', pos_begin);
-
-                    if (pos_begin != std::string::npos && pos_end != std::string::npos)
-                    {
-                        std::string link = utf8text.substr(pos_begin + 1, pos_end - pos_begin - 1);
-                        const char specialPseudoAsteriskCharacter = 127;
-                        std::replace(link.begin(), link.end(), specialPseudoAsteriskCharacter, '*');
-                        std::string topicName = MWBase::Environment::get().getWindowManager()->
-                                getTranslationDataStorage().topicStandardForm(link);
-
-                        std::string displayName = link;
-                        while (displayName[displayName.size()-1] == '*')
-                            displayName.erase(displayName.size()-1, 1);
-
-                        utf8text.replace(pos_begin, pos_end+1-pos_begin, displayName);
-
-                        intptr_t value;
-                        if (mModel->mKeywordSearch.containsKeyword(topicName, value))
-                            mHyperLinks[std::make_pair(pos_begin, pos_begin+displayName.size())] = value;
-                    }
-                    else
-                        break;
-                }
-
-                loaded = true;
-            }
+            if (!mFormatted)
+                mFormatted = &mModel->getFormattedText (getEntry ());
         }
 
         Utf8Span body () const
         {
             ensureLoaded ();
 
-            return toUtf8Span (utf8text);
+            return toUtf8Span (mFormatted->mText);
         }
 
         void visitSpans (std::function < void (TopicId, size_t, size_t)> visitor) const
@@ -154,10 +161,13 @@ struct JournalViewModelImpl : JournalViewModel
             ensureLoaded ();
             mModel->ensureKeyWordSearchLoaded ();
 
-            if (mHyperLinks.size() && MWBase::Environment::get().getWindowManager()->getTranslationDataStorage().hasTranslation())
+            const std::string& utf8text = mFormatted->mText;
+            const std::map<Range, intptr_t>& hyperLinks = mFormatted->mHyperLinks;
+
+            if (hyperLinks.size() && MWBase::Environment::get().getWindowManager()->getTranslationDataStorage().hasTranslation())
             {
                 size_t formatted = 0; // points to the first character that is not laid out yet
-                for (std::map<Range, intptr_t>::const_iterator it = mHyperLinks.begin(); it != mHyperLinks.end(); ++it)
+                for (std::map<Range, intptr_t>::const_iterator it = hyperLinks.begin(); it != hyperLinks.end(); ++it)
                 {
                     intptr_t topicId = it->second;
                     if (formatted < it->first.first)
@@ -243,9 +253,9 @@ struct JournalViewModelImpl : JournalViewModel
             BaseEntry <iterator_t, JournalEntry> (model, itr)
         {}
 
-        std::string getText () const
+        const MWDialogue::Entry& getEntry () const
         {
-            return itr->getText();
+            return *itr;
         }
 
         Utf8Span timestamp () const
@@ -274,24 +284,20 @@ struct JournalViewModelImpl : JournalViewModel
 
         if (!questName.empty())
         {
-            std::vector<MWDialogue::Quest const*> quests;
+            std::unordered_set<const ESM::DialInfo *> questInfos;
             for (MWBase::Journal::TQuestIter questIt = journal->questBegin(); questIt != journal->questEnd(); ++questIt)
             {
                 if (Misc::StringUtils::ciEqual(questIt->second.getName(), questName))
-                    quests.push_back(&questIt->second);
+                {
+                    for (MWDialogue::Topic::TEntryIter j = questIt->second.begin (); j != questIt->second.end (); ++j)
+                        questInfos.insert (j->getInfo ());
+                }
             }
 
             for(MWBase::Journal::TEntryIter i = journal->begin(); i != journal->end (); ++i)
             {
-                for (std::vector<MWDialogue::Quest const*>::iterator questIt = quests.begin(); questIt != quests.end(); ++questIt)
-                {
-                    MWDialogue::Quest const* quest = *questIt;
-                    for (MWDialogue::Topic::TEntryIter j = quest->begin (); j != quest->end (); ++j)
-                    {
-                        if (i->mInfoId == j->mInfoId)
-                            visitor (JournalEntryImpl <MWBase::Journal::TEntryIter> (this, i));
-                    }
-                }
+                if (questInfos.find (i->getInfo ()) != questInfos.end ())
+                    visitor (JournalEntryImpl <MWBase::Journal::TEntryIter> (this, i));
             }
         }
         else
@@ -348,9 +354,9 @@ struct JournalViewModelImpl : JournalViewModel
             BaseEntry (model, itr), mTopic (topic)
         {}
 
-        std::string getText () const
+        const MWDialogue::Entry& getEntry () const
         {
-            return  itr->getText();
+            return *itr;
         }
 
         Utf8Span source () const
@@ -65,6 +65,10 @@ namespace MWGui
         /// returns true if their are no journal entries to display
         virtual bool isEmpty () const = 0;
 
+        /// returns a value that changes whenever the journal entries or topics change,
+        /// so that books laid out from them can be kept until then
+        virtual uint64_t getRevision () const = 0;
+
         /// walks the active and optionally completed, quests providing the name and completed status
         virtual void visitQuestNames (bool active_only, std::function <void (const std::string&, bool)> visitor) const = 0;
 
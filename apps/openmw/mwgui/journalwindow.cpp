@@ -250,7 +250,7 @@ namespace
             if (mModel->isEmpty ())
                 journalBook = createEmptyJournalBook ();
             else
-                journalBook = createJournalBook ();
+                journalBook = getJournalBook ();
 
             pushBook (journalBook, 0);
 
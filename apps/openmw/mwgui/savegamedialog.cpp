@@ -432,7 +432,14 @@ namespace MWGui
 
 
         // Decode screenshot
-        const std::vector<char>& data = mCurrentSlot->mProfile.mScreenshot;
+        std::vector<char> data;
+        MWState::readScreenshot(*mCurrentSlot, data);
+        if (data.empty())
+        {
+            mScreenshot->setImageTexture("");
+            return;
+        }
+
         Files::IMemStream instream (&data[0], data.size());
 
         osgDB::ReaderWriter* readerwriter = osgDB::Registry::instance()->getReaderWriterForExtension("jpg");
@@ -431,7 +431,6 @@ namespace MWGui
     void SettingsWindow::apply()
     {
         const Settings::CategorySettingVector changed = Settings::Manager::apply();
-        MWBase::Environment::get().getWorld()->processChangedSettings(changed);
         MWBase::Environment::get().getSoundManager()->processChangedSettings(changed);
         MWBase::Environment::get().getWindowManager()->processChangedSettings(changed);
         MWBase::Environment::get().getInputManager()->processChangedSettings(changed);
@@ -116,85 +116,95 @@ namespace MWGui
         mMainWidget->castType<MyGUI::Window>()->setCaption(playerName);
     }
 
-    void StatsWindow::setValue (const std::string& id, const MWMechanics::AttributeValue& value)
+    void StatsWindow::statChanged (const MWMechanics::StatEvent& event)
     {
-        static const char *ids[] =
+        switch (event.mType)
+        {
+            case MWMechanics::StatEvent::Type_Attribute:
+
+                setAttribute (event.mIndex, event.mAttribute);
+                break;
+
+            case MWMechanics::StatEvent::Type_Skill:
+
+                setValue (static_cast<ESM::Skill::SkillEnum> (event.mIndex), event.mSkill);
+                break;
+
+            case MWMechanics::StatEvent::Type_Dynamic:
+
+                setDynamicStat (event.mIndex, event.mDynamic);
+                break;
+
+            case MWMechanics::StatEvent::Type_Level:
+
+                setText ("LevelText", MyGUI::utility::toString (event.mInt));
+                break;
+
+            case MWMechanics::StatEvent::Type_Name:
+
+                setPlayerName (event.mString);
+                break;
+
+            case MWMechanics::StatEvent::Type_Race:
+
+                setText ("RaceText", event.mString);
+                break;
+
+            case MWMechanics::StatEvent::Type_Class:
+
+                setText ("ClassText", event.mString);
+                break;
+
+            default:
+
+                break;
+        }
+    }
+
+    void StatsWindow::setAttribute (int attribute, const MWMechanics::AttributeValue& value)
+    {
+        static const std::string ids[] =
         {
             "AttribVal1", "AttribVal2", "AttribVal3", "AttribVal4", "AttribVal5",
-            "AttribVal6", "AttribVal7", "AttribVal8",
-            0
+            "AttribVal6", "AttribVal7", "AttribVal8"
         };
 
-        for (int i=0; ids[i]; ++i)
-            if (ids[i]==id)
-            {
-                std::ostringstream valueString;
-                valueString << value.getModified();
-                setText (id, valueString.str());
+        const std::string& id = ids[attribute];
 
-                MyGUI::TextBox* box;
-                getWidget(box, id);
+        setText (id, MyGUI::utility::toString (value.getModified()));
 
-                if (value.getModified()>value.getBase())
-                    box->_setWidgetState("increased");
-                else if (value.getModified()<value.getBase())
-                    box->_setWidgetState("decreased");
-                else
-                    box->_setWidgetState("normal");
+        MyGUI::TextBox* box;
+        getWidget(box, id);
 
-                break;
-            }
+        if (value.getModified()>value.getBase())
+            box->_setWidgetState("increased");
+        else if (value.getModified()<value.getBase())
+            box->_setWidgetState("decreased");
+        else
+            box->_setWidgetState("normal");
     }
 
-    void StatsWindow::setValue (const std::string& id, const MWMechanics::DynamicStat<float>& value)
+    void StatsWindow::setDynamicStat (int index, const MWMechanics::DynamicStat<float>& value)
     {
+        static const std::string bars[] = { "HBar", "MBar", "FBar" };
+        static const std::string texts[] = { "HBarT", "MBarT", "FBarT" };
+        static const std::string frames[] = { "Health", "Magicka", "Fatigue" };
+        static const std::string descriptions[] = { "#{sHealthDesc}\n", "#{sMagDesc}\n", "#{sFatDesc}\n" };
+
         int current = static_cast<int>(value.getCurrent());
         int modified = static_cast<int>(value.getModified());
 
         // Fatigue can be negative
-        if (id != "FBar")
+        if (index != 2)
             current = std::max(0, current);
 
-        setBar (id, id + "T", current, modified);
+        setBar (bars[index], texts[index], current, modified);
 
         // health, magicka, fatigue tooltip
         MyGUI::Widget* w;
         std::string valStr =  MyGUI::utility::toString(current) + " / " + MyGUI::utility::toString(modified);
-        if (id == "HBar")
-        {
-            getWidget(w, "Health");
-            w->setUserString("Caption_HealthDescription", "#{sHealthDesc}\n" + valStr);
-        }
-        else if (id == "MBar")
-        {
-            getWidget(w, "Magicka");
-            w->setUserString("Caption_HealthDescription", "#{sMagDesc}\n" + valStr);
-        }
-        else if (id == "FBar")
-        {
-            getWidget(w, "Fatigue");
-            w->setUserString("Caption_HealthDescription", "#{sFatDesc}\n" + valStr);
-        }
-    }
-
-    void StatsWindow::setValue (const std::string& id, const std::string& value)
-    {
-        if (id=="name")
-            setPlayerName (value);
-        else if (id=="race")
-            setText ("RaceText", value);
-        else if (id=="class")
-            setText ("ClassText", value);
-    }
-
-    void StatsWindow::setValue (const std::string& id, int value)
-    {
-        if (id=="level")
-        {
-            std::ostringstream text;
-            text << value;
-            setText("LevelText", text.str());
-        }
+        getWidget(w, frames[index]);
+        w->setUserString("Caption_HealthDescription", descriptions[index] + valStr);
     }
 
     void setSkillProgress(MyGUI::Widget* w, float progress, int skillId)
@@ -2,6 +2,7 @@
 #define MWGUI_STATS_WINDOW_H
 
 #include "../mwmechanics/stat.hpp"
+#include "../mwmechanics/statchannel.hpp"
 #include "windowpinnablebase.hpp"
 
 #include <components/esm/loadskil.hpp>
@@ -10,7 +11,7 @@ namespace MWGui
 {
     class WindowManager;
 
-    class StatsWindow : public WindowPinnableBase, public NoDrop
+    class StatsWindow : public WindowPinnableBase, public NoDrop, public MWMechanics::StatListener
     {
         public:
             typedef std::map<std::string, int> FactionList;
@@ -25,11 +26,13 @@ namespace MWGui
             void setBar(const std::string& name, const std::string& tname, int val, int max);
             void setPlayerName(const std::string& playerName);
 
-            /// Set value for the given ID.
-            void setValue (const std::string& id, const MWMechanics::AttributeValue& value);
-            void setValue (const std::string& id, const MWMechanics::DynamicStat<float>& value);
-            void setValue (const std::string& id, const std::string& value);
-            void setValue (const std::string& id, int value);
+            virtual void statChanged (const MWMechanics::StatEvent& event);
+
+            void setAttribute (int attribute, const MWMechanics::AttributeValue& value);
+
+            /// \param index 0 health, 1 magicka, 2 fatigue
+            void setDynamicStat (int index, const MWMechanics::DynamicStat<float>& value);
+
             void setValue(const ESM::Skill::SkillEnum parSkill, const MWMechanics::SkillValue& value);
 
             void configureSkills (const SkillList& major, const SkillList& minor);
@@ -18,18 +18,55 @@
 #include "../mwworld/esmstore.hpp"
 #include "../mwmechanics/spellcasting.hpp"
 #include "../mwmechanics/actorutil.hpp"
+#include "../mwmechanics/npcstats.hpp"
 
 #include "mapwindow.hpp"
 #include "inventorywindow.hpp"
 
 #include "itemmodel.hpp"
 
+namespace
+{
+    /// Upper bound for the tooltip infos kept, e.g. for the items of a large container
+    const std::size_t sMaxCachedToolTipInfos = 256;
+
+    bool equalEffects(const MWGui::Widgets::SpellEffectList& list, const MWGui::Widgets::SpellEffectList& other)
+    {
+        if (list.size() != other.size())
+            return false;
+
+        // SpellEffectParams::operator== only tells if two effects can be merged
+        for (std::size_t i = 0; i < list.size(); ++i)
+        {
+            const MWGui::Widgets::SpellEffectParams& a = list[i];
+            const MWGui::Widgets::SpellEffectParams& b = other[i];
+            if (a.mNoTarget != b.mNoTarget || a.mIsConstant != b.mIsConstant || a.mKnown != b.mKnown
+                || a.mEffectID != b.mEffectID || a.mSkill != b.mSkill || a.mAttribute != b.mAttribute
+                || a.mMagnMin != b.mMagnMin || a.mMagnMax != b.mMagnMax || a.mRange != b.mRange
+                || a.mDuration != b.mDuration || a.mArea != b.mArea)
+                return false;
+        }
+        return true;
+    }
+
+    bool equalToolTips(const MWGui::ToolTipInfo& info, const MWGui::ToolTipInfo& other)
+    {
+        return info.caption == other.caption && info.text == other.text && info.icon == other.icon
+            && info.imageSize == other.imageSize && info.enchant == other.enchant
+            && info.remainingEnchantCharge == other.remainingEnchantCharge && info.isPotion == other.isPotion
+            && info.wordWrap == other.wordWrap && info.notes == other.notes && equalEffects(info.effects, other.effects);
+    }
+}
+
 namespace MWGui
 {
     std::string ToolTips::sSchoolNames[] = {"#{sSchoolAlteration}", "#{sSchoolConjuration}", "#{sSchoolDestruction}", "#{sSchoolIllusion}", "#{sSchoolMysticism}", "#{sSchoolRestoration}"};
 
     ToolTips::ToolTips() :
         Layout("openmw_tooltips.layout")
+        , mLayoutMaximumWidth(0)
+        , mLayoutValid(false)
+        , mLayoutShown(false)
         , mFocusToolTipX(0.0)
         , mFocusToolTipY(0.0)
         , mHorizontalScrollIndex(0)
@@ -74,11 +111,10 @@ namespace MWGui
 
     void ToolTips::update(float frameDuration)
     {
-
-        while (mDynamicToolTipBox->getChildCount())
-        {
-            MyGUI::Gui::getInstance().destroyWidget(mDynamicToolTipBox->getChildAt(0));
-        }
+        // Only the tooltip shown last time is still in place, any other use of the layout changes its size
+        if (!mLayoutShown)
+            mLayoutValid = false;
+        mLayoutShown = false;
 
         // start by hiding everything
         for (unsigned int i=0; i < mMainWidget->getChildCount(); ++i)
@@ -113,8 +149,6 @@ namespace MWGui
                 MyGUI::IntSize tooltipSize;
                 if ((!objectclass.hasToolTip(mFocusObject))&&(MWBase::Environment::get().getWindowManager()->getMode() == GM_Console))
                 {
-                    setCoord(0, 0, 300, 300);
-                    mDynamicToolTipBox->setVisible(true);
                     ToolTipInfo info;
                     info.caption = mFocusObject.getClass().getName(mFocusObject);
                     if (info.caption.empty())
@@ -335,9 +369,6 @@ namespace MWGui
 
     MyGUI::IntSize ToolTips::getToolTipViaPtr (int count, bool image, bool isOwned)
     {
-        // this the maximum width of the tooltip before it starts word-wrapping
-        setCoord(0, 0, 300, 300);
-
         MyGUI::IntSize tooltipSize;
 
         const MWWorld::Class& object = mFocusObject.getClass();
@@ -347,16 +378,70 @@ namespace MWGui
         }
         else
         {
-            mDynamicToolTipBox->setVisible(true);
-
-            ToolTipInfo info = object.getToolTipInfo(mFocusObject, count);
-            if (!image)
-                info.icon = "";
-            tooltipSize = createToolTip(info, isOwned);
+            const ToolTipInfo& info = getFocusToolTipInfo(count);
+            if (image || info.icon.empty())
+                tooltipSize = createToolTip(info, isOwned);
+            else
+            {
+                ToolTipInfo withoutImage = info;
+                withoutImage.icon = "";
+                tooltipSize = createToolTip(withoutImage, isOwned);
+            }
         }
 
         return tooltipSize;
     }
+
+    ToolTipState ToolTips::getFocusState(int count) const
+    {
+        const MWWorld::CellRef& cellRef = mFocusObject.getCellRef();
+
+        ToolTipState state(mFocusObject.getBase(), cellRef.getRefId(), mFocusObject.getTypeName(), count);
+
+        // the remaining time of lights is stored in the charge as well
+        state.set(ToolTipState::Field_Charge, cellRef.getCharge());
+        state.set(ToolTipState::Field_EnchantmentCharge, cellRef.getEnchantmentCharge());
+        if (state.has(ToolTipState::Field_ArmorRating))
+            state.set(ToolTipState::Field_ArmorRating,
+                mFocusObject.getClass().getEffectiveArmorRating(mFocusObject, MWMechanics::getPlayer()));
+        if (state.has(ToolTipState::Field_Soul))
+            state.setSoul(cellRef.getSoul());
+        state.set(ToolTipState::Field_LockLevel, cellRef.getLockLevel());
+        if (state.has(ToolTipState::Field_Trapped))
+            state.set(ToolTipState::Field_Trapped, !cellRef.getTrap().empty());
+        if (state.has(ToolTipState::Field_AlchemySkill))
+        {
+            MWWorld::Ptr player = MWMechanics::getPlayer();
+            state.set(ToolTipState::Field_AlchemySkill,
+                player.getClass().getNpcStats(player).getSkill(ESM::Skill::Alchemy).getBase());
+        }
+        if (state.has(ToolTipState::Field_Werewolf))
+            state.set(ToolTipState::Field_Werewolf, mFocusObject.getRefData().getCustomData()
+                && mFocusObject.getClass().getNpcStats(mFocusObject).isWerewolf());
+
+        return state;
+    }
+
+    const ToolTipInfo& ToolTips::getFocusToolTipInfo(int count)
+    {
+        ToolTipState state = getFocusState(count);
+
+        ToolTipInfoCache::iterator found = mToolTipInfoCache.find(state.getObject());
+        if (found == mToolTipInfoCache.end())
+        {
+            if (mToolTipInfoCache.size() >= sMaxCachedToolTipInfos)
+                mToolTipInfoCache.clear();
+
+            found = mToolTipInfoCache.insert(std::make_pair(state.getObject(), CachedToolTipInfo(state))).first;
+        }
+        // full help lists the owners of stolen items, which are not part of the state
+        else if (found->second.mState == state && !mFullHelp)
+            return found->second.mInfo;
+
+        found->second.mState = state;
+        found->second.mInfo = mFocusObject.getClass().getToolTipInfo(mFocusObject, count);
+        return found->second.mInfo;
+    }
     
     bool ToolTips::checkOwned()
     {
@@ -373,11 +458,29 @@ namespace MWGui
     MyGUI::IntSize ToolTips::createToolTip(const MWGui::ToolTipInfo& info, bool isOwned)
     {
         mDynamicToolTipBox->setVisible(true);
-        
+
+        std::string skin;
         if((mShowOwned == 1 || mShowOwned == 3) && isOwned)
-            mDynamicToolTipBox->changeWidgetSkin(MWBase::Environment::get().getWindowManager()->isGuiMode() ? "HUD_Box_NoTransp_Owned" : "HUD_Box_Owned");
+            skin = MWBase::Environment::get().getWindowManager()->isGuiMode() ? "HUD_Box_NoTransp_Owned" : "HUD_Box_Owned";
         else
-            mDynamicToolTipBox->changeWidgetSkin(MWBase::Environment::get().getWindowManager()->isGuiMode() ? "HUD_Box_NoTransp" : "HUD_Box");
+            skin = MWBase::Environment::get().getWindowManager()->isGuiMode() ? "HUD_Box_NoTransp" : "HUD_Box";
+
+        const int imageCaptionHPadding = (info.caption != "" ? 8 : 0);
+        const int imageCaptionVPadding = (info.caption != "" ? 4 : 0);
+
+        const int maximumWidth = MyGUI::RenderManager::getInstance().getViewSize().width - imageCaptionHPadding * 2;
+
+        mLayoutShown = true;
+
+        if (mLayoutValid && skin == mLayoutSkin && maximumWidth == mLayoutMaximumWidth && equalToolTips(info, mLayoutInfo))
+            return mLayoutSize;
+
+        while (mDynamicToolTipBox->getChildCount())
+        {
+            MyGUI::Gui::getInstance().destroyWidget(mDynamicToolTipBox->getChildAt(0));
+        }
+
+        mDynamicToolTipBox->changeWidgetSkin(skin);
 
         std::string caption = info.caption;
         std::string image = info.icon;
@@ -411,11 +514,6 @@ namespace MWGui
 
         const MyGUI::IntPoint padding(8, 8);
 
-        const int imageCaptionHPadding = (caption != "" ? 8 : 0);
-        const int imageCaptionVPadding = (caption != "" ? 4 : 0);
-
-        const int maximumWidth = MyGUI::RenderManager::getInstance().getViewSize().width - imageCaptionHPadding * 2;
-
         std::string realImage = MWBase::Environment::get().getWindowManager()->correctIconPath(image);
 
         MyGUI::EditBox* captionWidget = mDynamicToolTipBox->createWidget<MyGUI::EditBox>("NormalText", MyGUI::IntCoord(0, 0, 300, 300), MyGUI::Align::Left | MyGUI::Align::Top, "ToolTipCaption");
@@ -564,6 +662,13 @@ namespace MWGui
 
         totalSize += MyGUI::IntSize(padding.left*2, padding.top*2);
 
+        // a scrolling caption has to be moved every frame
+        mLayoutValid = captionSize.width <= maximumWidth;
+        mLayoutInfo = info;
+        mLayoutSkin = skin;
+        mLayoutMaximumWidth = maximumWidth;
+        mLayoutSize = totalSize;
+
         return totalSize;
     }
 
@@ -651,6 +756,7 @@ namespace MWGui
     bool ToolTips::toggleFullHelp()
     {
         mFullHelp = !mFullHelp;
+        mToolTipInfoCache.clear();
         return mFullHelp;
     }
 
@@ -1,10 +1,13 @@
 #ifndef MWGUI_TOOLTIPS_H
 #define MWGUI_TOOLTIPS_H
 
+#include <unordered_map>
+
 #include "layout.hpp"
 #include "../mwworld/ptr.hpp"
 
 #include "widgets.hpp"
+#include "tooltipstate.hpp"
 
 namespace ESM
 {
@@ -98,12 +101,37 @@ namespace MWGui
 
         MWWorld::Ptr mFocusObject;
 
+        struct CachedToolTipInfo
+        {
+            ToolTipState mState;
+            ToolTipInfo mInfo;
+
+            CachedToolTipInfo(const ToolTipState& state) : mState(state) {}
+        };
+
+        /// Tooltip infos of objects by their LiveCellRefBase, valid while the state of the object stays the same
+        typedef std::unordered_map<const void*, CachedToolTipInfo> ToolTipInfoCache;
+        ToolTipInfoCache mToolTipInfoCache;
+
+        // What the widgets in mDynamicToolTipBox were created for
+        ToolTipInfo mLayoutInfo;
+        std::string mLayoutSkin;
+        int mLayoutMaximumWidth;
+        MyGUI::IntSize mLayoutSize;
+        bool mLayoutValid; ///< The widgets can be shown again for the same info
+        bool mLayoutShown; ///< The widgets were shown in the current update
+
         MyGUI::IntSize getToolTipViaPtr (int count, bool image = true, bool isOwned = false);
         ///< @return requested tooltip size
 
+        ToolTipState getFocusState(int count) const;
+
+        const ToolTipInfo& getFocusToolTipInfo(int count);
+        ///< @return the tooltip info of mFocusObject, made again only if its state changed
+
         MyGUI::IntSize createToolTip(const ToolTipInfo& info, bool isOwned = false);
         ///< @return requested tooltip size
-        /// @param isFocusObject Is the object this tooltips originates from mFocusObject?
+        /// @note The widgets of the previous call are kept if they show the same info.
 
         float mFocusToolTipX;
         float mFocusToolTipY;
@@ -0,0 +1,126 @@
+#include "tooltipstate.hpp"
+
+#include <map>
+#include <typeinfo>
+
+#include <components/esm/loadacti.hpp>
+#include <components/esm/loadalch.hpp>
+#include <components/esm/loadappa.hpp>
+#include <components/esm/loadarmo.hpp>
+#include <components/esm/loadbook.hpp>
+#include <components/esm/loadclot.hpp>
+#include <components/esm/loadcont.hpp>
+#include <components/esm/loadcrea.hpp>
+#include <components/esm/loaddoor.hpp>
+#include <components/esm/loadingr.hpp>
+#include <components/esm/loadligh.hpp>
+#include <components/esm/loadlock.hpp>
+#include <components/esm/loadmisc.hpp>
+#include <components/esm/loadnpc.hpp>
+#include <components/esm/loadprob.hpp>
+#include <components/esm/loadrepa.hpp>
+#include <components/esm/loadweap.hpp>
+
+namespace
+{
+    int bit(MWGui::ToolTipState::Field field)
+    {
+        return 1 << field;
+    }
+
+    std::map<std::string, int> makeFields()
+    {
+        using MWGui::ToolTipState;
+
+        std::map<std::string, int> fields;
+
+        fields[typeid(ESM::Weapon).name()] = bit(ToolTipState::Field_Charge) | bit(ToolTipState::Field_EnchantmentCharge);
+        fields[typeid(ESM::Armor).name()] = bit(ToolTipState::Field_Charge) | bit(ToolTipState::Field_EnchantmentCharge)
+                | bit(ToolTipState::Field_ArmorRating);
+        fields[typeid(ESM::Clothing).name()] = bit(ToolTipState::Field_EnchantmentCharge);
+        fields[typeid(ESM::Lockpick).name()] = bit(ToolTipState::Field_Charge);
+        fields[typeid(ESM::Probe).name()] = bit(ToolTipState::Field_Charge);
+        fields[typeid(ESM::Repair).name()] = bit(ToolTipState::Field_Charge);
+        fields[typeid(ESM::Light).name()] = bit(ToolTipState::Field_Charge);
+        fields[typeid(ESM::Miscellaneous).name()] = bit(ToolTipState::Field_Soul);
+        fields[typeid(ESM::Ingredient).name()] = bit(ToolTipState::Field_AlchemySkill);
+        fields[typeid(ESM::Potion).name()] = bit(ToolTipState::Field_AlchemySkill);
+        fields[typeid(ESM::Door).name()] = bit(ToolTipState::Field_LockLevel) | bit(ToolTipState::Field_Trapped);
+        fields[typeid(ESM::Container).name()] = bit(ToolTipState::Field_LockLevel) | bit(ToolTipState::Field_Trapped);
+        fields[typeid(ESM::NPC).name()] = bit(ToolTipState::Field_Werewolf);
+
+        // only show their base record
+        fields[typeid(ESM::Book).name()] = 0;
+        fields[typeid(ESM::Apparatus).name()] = 0;
+        fields[typeid(ESM::Creature).name()] = 0;
+        fields[typeid(ESM::Activator).name()] = 0;
+
+        return fields;
+    }
+}
+
+namespace MWGui
+{
+    int ToolTipState::getFields(const std::string& typeName)
+    {
+        static const std::map<std::string, int> fields = makeFields();
+
+        std::map<std::string, int>::const_iterator found = fields.find(typeName);
+        if (found == fields.end())
+            return 0;
+        return found->second;
+    }
+
+    ToolTipState::ToolTipState(const void* object, const std::string& refId, const std::string& typeName, int count)
+        : mObject(object)
+        , mRefId(refId)
+        , mCount(count)
+        , mFields(getFields(typeName))
+    {
+        for (int i = 0; i < NumFields; ++i)
+            mValues[i] = 0;
+    }
+
+    bool ToolTipState::has(Field field) const
+    {
+        return (mFields & bit(field)) != 0;
+    }
+
+    void ToolTipState::set(Field field, double value)
+    {
+        if (!has(field))
+            return;
+
+        mValues[field] = value;
+    }
+
+    void ToolTipState::setSoul(const std::string& soul)
+    {
+        if (!has(Field_Soul))
+            return;
+
+        mSoul = soul;
+    }
+
+    const void* ToolTipState::getObject() const
+    {
+        return mObject;
+    }
+
+    bool ToolTipState::operator==(const ToolTipState& other) const
+    {
+        if (mObject != other.mObject || mCount != other.mCount || mFields != other.mFields)
+            return false;
+
+        for (int i = 0; i < NumFields; ++i)
+            if (mValues[i] != other.mValues[i])
+                return false;
+
+        return mSoul == other.mSoul && mRefId == other.mRefId;
+    }
+
+    bool ToolTipState::operator!=(const ToolTipState& other) const
+    {
+        return !(*this == other);
+    }
+}
@@ -0,0 +1,59 @@
+#ifndef MWGUI_TOOLTIPSTATE_H
+#define MWGUI_TOOLTIPSTATE_H
+
+#include <string>
+
+namespace MWGui
+{
+    /// @brief The state of an object that its tooltip depends on, besides its base record.
+    ///
+    /// Which parts of the state are used depends on the class of the object; the others are ignored.
+    /// The tooltip of an object only has to be made again when its state changes.
+    class ToolTipState
+    {
+    public:
+        enum Field
+        {
+            Field_Charge, ///< Condition or uses left, and the remaining time of lights
+            Field_EnchantmentCharge,
+            Field_ArmorRating, ///< Depends on the armor skill of the player
+            Field_Soul,
+            Field_LockLevel,
+            Field_Trapped,
+            Field_AlchemySkill, ///< Of the player, decides which effects of ingredients and potions are known
+            Field_Werewolf,
+
+            NumFields
+        };
+
+        /// @param typeName Type name of the object's class, i.e. typeid(ESM::Weapon).name()
+        /// @return bit mask of the fields used by tooltips of this class
+        static int getFields(const std::string& typeName);
+
+        /// @param object The object the tooltip is for
+        /// @param count Number of items shown in the caption
+        ToolTipState(const void* object, const std::string& refId, const std::string& typeName, int count);
+
+        /// @return Are the tooltips of objects of this class affected by \a field?
+        bool has(Field field) const;
+
+        /// Set \a field to \a value, if it is used by tooltips of this class.
+        void set(Field field, double value);
+        void setSoul(const std::string& soul);
+
+        const void* getObject() const;
+
+        bool operator==(const ToolTipState& other) const;
+        bool operator!=(const ToolTipState& other) const;
+
+    private:
+        const void* mObject;
+        std::string mRefId;
+        int mCount;
+        int mFields;
+        double mValues[NumFields];
+        std::string mSoul;
+    };
+}
+
+#endif
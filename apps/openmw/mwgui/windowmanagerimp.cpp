@@ -496,6 +496,18 @@ namespace MWGui
             mPlayerSkillValues.insert(std::make_pair(ESM::Skill::sSkillIds[i], MWMechanics::SkillValue()));
         }
 
+        for (int i = 0; i < MWMechanics::StatEvent::Type_Length; ++i)
+            mStatChannel.subscribe(static_cast<MWMechanics::StatEvent::Type>(i), mStatsWindow);
+
+        mStatChannel.subscribe(MWMechanics::StatEvent::Type_Dynamic, mHud);
+
+        mStatChannel.subscribe(MWMechanics::StatEvent::Type_Attribute, this);
+        mStatChannel.subscribe(MWMechanics::StatEvent::Type_Skill, this);
+        mStatChannel.subscribe(MWMechanics::StatEvent::Type_Name, this);
+        mStatChannel.subscribe(MWMechanics::StatEvent::Type_Race, this);
+
+        subscribeCharGen();
+
         updatePinnedWindows();
 
         // Set up visibility
@@ -507,8 +519,10 @@ namespace MWGui
         if (newgame)
         {
             disallowAll();
+            mStatChannel.unsubscribe(mCharGen);
             delete mCharGen;
             mCharGen = new CharacterCreation(mViewer->getSceneData()->asGroup(), mResourceSystem);
+            subscribeCharGen();
         }
         else
             allow(GW_ALL);
@@ -649,65 +663,46 @@ namespace MWGui
         }
     }
 
-    void WindowManager::setValue (const std::string& id, const MWMechanics::AttributeValue& value)
+    MWMechanics::StatChannel& WindowManager::getStatChannel()
     {
-        mStatsWindow->setValue (id, value);
-        mCharGen->setValue(id, value);
+        return mStatChannel;
+    }
 
-        static const char *ids[] =
-        {
-            "AttribVal1", "AttribVal2", "AttribVal3", "AttribVal4", "AttribVal5",
-            "AttribVal6", "AttribVal7", "AttribVal8"
-        };
-        static ESM::Attribute::AttributeID attributes[] =
-        {
-            ESM::Attribute::Strength,
-            ESM::Attribute::Intelligence,
-            ESM::Attribute::Willpower,
-            ESM::Attribute::Agility,
-            ESM::Attribute::Speed,
-            ESM::Attribute::Endurance,
-            ESM::Attribute::Personality,
-            ESM::Attribute::Luck
-        };
-        for (size_t i = 0; i < sizeof(ids)/sizeof(ids[0]); ++i)
+    void WindowManager::statChanged (const MWMechanics::StatEvent& event)
+    {
+        switch (event.mType)
         {
-            if (id != ids[i])
-                continue;
-            mPlayerAttributes[attributes[i]] = value;
-            break;
-        }
-    }
+            case MWMechanics::StatEvent::Type_Attribute:
 
+                mPlayerAttributes[event.mIndex] = event.mAttribute;
+                break;
 
-    void WindowManager::setValue (int parSkill, const MWMechanics::SkillValue& value)
-    {
-        /// \todo Don't use the skill enum as a parameter type (we will have to drop it anyway, once we
-        /// allow custom skills.
-        mStatsWindow->setValue(static_cast<ESM::Skill::SkillEnum> (parSkill), value);
-        mCharGen->setValue(static_cast<ESM::Skill::SkillEnum> (parSkill), value);
-        mPlayerSkillValues[parSkill] = value;
-    }
+            case MWMechanics::StatEvent::Type_Skill:
 
-    void WindowManager::setValue (const std::string& id, const MWMechanics::DynamicStat<float>& value)
-    {
-        mStatsWindow->setValue (id, value);
-        mHud->setValue (id, value);
-        mCharGen->setValue(id, value);
-    }
+                mPlayerSkillValues[event.mIndex] = event.mSkill;
+                break;
 
-    void WindowManager::setValue (const std::string& id, const std::string& value)
-    {
-        mStatsWindow->setValue (id, value);
-        if (id=="name")
-            mPlayerName = value;
-        else if (id=="race")
-            mPlayerRaceId = value;
+            case MWMechanics::StatEvent::Type_Name:
+
+                mPlayerName = event.mString;
+                break;
+
+            case MWMechanics::StatEvent::Type_Race:
+
+                mPlayerRaceId = event.mString;
+                break;
+
+            default:
+
+                break;
+        }
     }
 
-    void WindowManager::setValue (const std::string& id, int value)
+    void WindowManager::subscribeCharGen()
     {
-        mStatsWindow->setValue (id, value);
+        mStatChannel.subscribe (MWMechanics::StatEvent::Type_Attribute, mCharGen);
+        mStatChannel.subscribe (MWMechanics::StatEvent::Type_Skill, mCharGen);
+        mStatChannel.subscribe (MWMechanics::StatEvent::Type_Dynamic, mCharGen);
     }
 
     void WindowManager::setDrowningTimeLeft (float time, float maxTime)
@@ -717,7 +712,7 @@ namespace MWGui
 
     void WindowManager::setPlayerClass (const ESM::Class &class_)
     {
-        mStatsWindow->setValue("class", class_.mName);
+        mStatChannel.publish (MWMechanics::StatEvent::makeText (MWMechanics::StatEvent::Type_Class, class_.mName));
     }
 
     void WindowManager::configureSkills (const SkillList& major, const SkillList& minor)
@@ -863,6 +858,8 @@ namespace MWGui
 
     void WindowManager::onFrame (float frameDuration)
     {
+        mStatChannel.dispatch();
+
         if (!mGuiModes.empty())
         {
             GuiModeState& state = mGuiModeStates[mGuiModes.back()];
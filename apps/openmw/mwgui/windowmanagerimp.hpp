@@ -15,6 +15,8 @@
 
 #include "../mwworld/ptr.hpp"
 
+#include "../mwmechanics/statchannel.hpp"
+
 #include <components/settings/settings.hpp>
 #include <components/to_utf8/to_utf8.hpp>
 
@@ -124,7 +126,7 @@ namespace MWGui
   class JailScreen;
   class KeyboardNavigation;
 
-  class WindowManager : public MWBase::WindowManager
+  class WindowManager : public MWBase::WindowManager, public MWMechanics::StatListener
   {
   public:
     typedef std::pair<std::string, int> Faction;
@@ -191,12 +193,9 @@ namespace MWGui
 
     virtual void setConsoleSelectedObject(const MWWorld::Ptr& object);
 
-    ///< Set value for the given ID.
-    virtual void setValue (const std::string& id, const MWMechanics::AttributeValue& value);
-    virtual void setValue (int parSkill, const MWMechanics::SkillValue& value);
-    virtual void setValue (const std::string& id, const MWMechanics::DynamicStat<float>& value);
-    virtual void setValue (const std::string& id, const std::string& value);
-    virtual void setValue (const std::string& id, int value);
+    virtual MWMechanics::StatChannel& getStatChannel();
+
+    virtual void statChanged (const MWMechanics::StatEvent& event);
 
     /// Set time left for the player to start drowning (update the drowning bar)
     /// @param time time left to start drowning
@@ -454,6 +453,8 @@ namespace MWGui
 
     void setCursorVisible(bool visible);
 
+    void subscribeCharGen();
+
     /// \todo get rid of this stuff. Move it to the respective UI element classes, if needed.
     // Various stats about player as needed by window manager
     std::string mPlayerName;
@@ -462,6 +463,8 @@ namespace MWGui
     SkillList mPlayerMajorSkills, mPlayerMinorSkills;
     std::map<int, MWMechanics::SkillValue > mPlayerSkillValues;
 
+    MWMechanics::StatChannel mStatChannel;
+
     MyGUI::Gui *mGui; // Gui
 
     struct GuiModeState
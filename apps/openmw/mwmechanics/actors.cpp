@@ -43,6 +43,23 @@
 
 namespace
 {
+    namespace Gmst
+    {
+        const MWWorld::GmstFloat fAlarmRadius("fAlarmRadius");
+        const MWWorld::GmstFloat fHoldBreathTime("fHoldBreathTime");
+        const MWWorld::GmstFloat fInteriorHeadTrackMult("fInteriorHeadTrackMult");
+        const MWWorld::GmstFloat fMaxHeadTrackDistance("fMaxHeadTrackDistance");
+        const MWWorld::GmstFloat fNPCbaseMagickaMult("fNPCbaseMagickaMult");
+        const MWWorld::GmstFloat fPCbaseMagickaMult("fPCbaseMagickaMult");
+        const MWWorld::GmstFloat fSneakUseDelay("fSneakUseDelay");
+        const MWWorld::GmstInt fSneakUseDist("fSneakUseDist");
+        const MWWorld::GmstFloat fSoulgemMult("fSoulgemMult");
+        const MWWorld::GmstFloat fSuffocationDamage("fSuffocationDamage");
+        const MWWorld::GmstInt iCrimeThreshold("iCrimeThreshold");
+        const MWWorld::GmstInt iCrimeThresholdMultiplier("iCrimeThresholdMultiplier");
+        const MWWorld::GmstString sMagicBoundLeftGauntletID("sMagicBoundLeftGauntletID");
+        const MWWorld::GmstString sMagicBoundRightGauntletID("sMagicBoundRightGauntletID");
+    }
 
 bool isConscious(const MWWorld::Ptr& ptr)
 {
@@ -172,7 +189,7 @@ namespace MWMechanics
             if (caster.isEmpty() || !caster.getClass().isActor())
                 return;
 
-            static const float fSoulgemMult = world->getStore().get<ESM::GameSetting>().find("fSoulgemMult")->getFloat();
+            const float fSoulgemMult = Gmst::fSoulgemMult.get(world->getStore().getGameSettings());
 
             int creatureSoulValue = mCreature.get<ESM::Creature>()->mBase->mData.mSoul;
             if (creatureSoulValue == 0)
@@ -242,10 +259,8 @@ namespace MWMechanics
     void Actors::updateHeadTracking(const MWWorld::Ptr& actor, const MWWorld::Ptr& targetActor,
                                     MWWorld::Ptr& headTrackTarget, float& sqrHeadTrackDistance)
     {
-        static const float fMaxHeadTrackDistance = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>()
-                .find("fMaxHeadTrackDistance")->getFloat();
-        static const float fInteriorHeadTrackMult = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>()
-                .find("fInteriorHeadTrackMult")->getFloat();
+        const float fMaxHeadTrackDistance = Gmst::fMaxHeadTrackDistance.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
+        const float fInteriorHeadTrackMult = Gmst::fInteriorHeadTrackMult.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
         float maxDistance = fMaxHeadTrackDistance;
         const ESM::Cell* currentCell = actor.getCell()->getCell();
         if (!currentCell->isExterior() && !(currentCell->mData.mFlags & ESM::Cell::QuasiEx))
@@ -362,8 +377,8 @@ namespace MWMechanics
         }
 
         // If set in the settings file, player followers and escorters will become aggressive toward enemies in combat with them or the player
-        static const bool followersAttackOnSight = Settings::Manager::getBool("followers attack on sight", "Game");
-        if (!aggressive && isPlayerFollowerOrEscorter && followersAttackOnSight)
+        static const Settings::Handle<bool> followersAttackOnSight("followers attack on sight", "Game");
+        if (!aggressive && isPlayerFollowerOrEscorter && followersAttackOnSight.get())
         {
             if (actor2.getClass().getCreatureStats(actor2).getAiSequence().isInCombat(actor1))
                 aggressive = true;
@@ -400,7 +415,7 @@ namespace MWMechanics
         if (actor1.getClass().isClass(actor1, "Guard") && !actor2.getClass().isNpc())
         {
             // Check if the creature is too far
-            static const float fAlarmRadius = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fAlarmRadius")->getFloat();
+            const float fAlarmRadius = Gmst::fAlarmRadius.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
             if (sqrDist > fAlarmRadius * fAlarmRadius)
                 return;
 
@@ -464,9 +479,9 @@ namespace MWMechanics
 
         float base = 1.f;
         if (ptr == getPlayer())
-            base = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fPCbaseMagickaMult")->getFloat();
+            base = Gmst::fPCbaseMagickaMult.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
         else
-            base = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fNPCbaseMagickaMult")->getFloat();
+            base = Gmst::fNPCbaseMagickaMult.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
 
         double magickaFactor = base +
             creatureStats.getMagicEffects().get (EffectKey (ESM::MagicEffect::FortifyMaximumMagicka)).getMagnitude() * 0.1;
@@ -761,11 +776,9 @@ namespace MWMechanics
                             itemGmst)->getString();
                 if (it->first == ESM::MagicEffect::BoundGloves)
                 {
-                    item = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find(
-                                "sMagicBoundLeftGauntletID")->getString();
+                    item = Gmst::sMagicBoundLeftGauntletID.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
                     adjustBoundItem(item, magnitude > 0, ptr);
-                    item = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find(
-                                "sMagicBoundRightGauntletID")->getString();
+                    item = Gmst::sMagicBoundRightGauntletID.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
                     adjustBoundItem(item, magnitude > 0, ptr);
                 }
                 else
@@ -848,7 +861,7 @@ namespace MWMechanics
         NpcStats &stats = ptr.getClass().getNpcStats(ptr);
 
         // When npc stats are just initialized, mTimeToStartDrowning == -1 and we should get value from GMST
-        static const float fHoldBreathTime = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fHoldBreathTime")->getFloat();
+        const float fHoldBreathTime = Gmst::fHoldBreathTime.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
         if (stats.getTimeToStartDrowning() == -1.f)
             stats.setTimeToStartDrowning(fHoldBreathTime);
 
@@ -882,7 +895,7 @@ namespace MWMechanics
             if(timeLeft == 0.0f && !godmode)
             {
                 // If drowning, apply 3 points of damage per second
-                static const float fSuffocationDamage = world->getStore().get<ESM::GameSetting>().find("fSuffocationDamage")->getFloat();
+                const float fSuffocationDamage = Gmst::fSuffocationDamage.get(world->getStore().getGameSettings());
                 DynamicStat<float> health = stats.getHealth();
                 health.setCurrent(health.getCurrent() - fSuffocationDamage*duration);
                 stats.setHealth(health);
@@ -1008,7 +1021,7 @@ namespace MWMechanics
                 && creatureStats.getMagicEffects().get(ESM::MagicEffect::CalmHumanoid).getMagnitude() == 0)
             {
                 const MWWorld::ESMStore& esmStore = MWBase::Environment::get().getWorld()->getStore();
-                static const int cutoff = esmStore.get<ESM::GameSetting>().find("iCrimeThreshold")->getInt();
+                const int cutoff = Gmst::iCrimeThreshold.get(esmStore.getGameSettings());
                 // Force dialogue on sight if bounty is greater than the cutoff
                 // In vanilla morrowind, the greeting dialogue is scripted to either arrest the player (< 5000 bounty) or attack (>= 5000 bounty)
                 if (   player.getClass().getNpcStats(player).getBounty() >= cutoff
@@ -1016,7 +1029,7 @@ namespace MWMechanics
                     && MWBase::Environment::get().getWorld()->getLOS(ptr, player)
                     && MWBase::Environment::get().getMechanicsManager()->awarenessCheck(player, ptr))
                 {
-                    static const int iCrimeThresholdMultiplier = esmStore.get<ESM::GameSetting>().find("iCrimeThresholdMultiplier")->getInt();
+                    const int iCrimeThresholdMultiplier = Gmst::iCrimeThresholdMultiplier.get(esmStore.getGameSettings());
                     if (player.getClass().getNpcStats(player).getBounty() >= cutoff * iCrimeThresholdMultiplier)
                     {
                         MWBase::Environment::get().getMechanicsManager()->startCombat(ptr, player);
@@ -1387,9 +1400,9 @@ namespace MWMechanics
                 static float sneakSkillTimer = 0.f; // times sneak skill progress from "avoid notice"
 
                 const MWWorld::ESMStore& esmStore = MWBase::Environment::get().getWorld()->getStore();
-                const int radius = esmStore.get<ESM::GameSetting>().find("fSneakUseDist")->getInt();
+                const int radius = Gmst::fSneakUseDist.get(esmStore.getGameSettings());
 
-                static float fSneakUseDelay = esmStore.get<ESM::GameSetting>().find("fSneakUseDelay")->getFloat();
+                const float fSneakUseDelay = Gmst::fSneakUseDelay.get(esmStore.getGameSettings());
 
                 if (sneakTimer >= fSneakUseDelay)
                     sneakTimer = 0.f;
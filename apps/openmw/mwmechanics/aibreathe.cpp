@@ -11,6 +11,14 @@
 #include "movement.hpp"
 #include "steering.hpp"
 
+namespace
+{
+    namespace Gmst
+    {
+        const MWWorld::GmstFloat fHoldBreathTime("fHoldBreathTime");
+    }
+}
+
 MWMechanics::AiBreathe::AiBreathe()
 : AiPackage()
 {
@@ -19,7 +27,7 @@ MWMechanics::AiBreathe::AiBreathe()
 
 bool MWMechanics::AiBreathe::execute (const MWWorld::Ptr& actor, CharacterController& characterController, AiState& state, float duration)
 {
-    static const float fHoldBreathTime = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fHoldBreathTime")->getFloat();
+    const float fHoldBreathTime = Gmst::fHoldBreathTime.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
 
     const MWWorld::Class& actorClass = actor.getClass();
     if (actorClass.isNpc())
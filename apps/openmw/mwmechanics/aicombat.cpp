@@ -25,6 +25,17 @@
 
 namespace
 {
+    namespace Gmst
+    {
+        const MWWorld::GmstFloat fCombatDelayCreature("fCombatDelayCreature");
+        const MWWorld::GmstFloat fCombatDelayNPC("fCombatDelayNPC");
+        const MWWorld::GmstFloat fFleeDistance("fFleeDistance");
+        const MWWorld::GmstFloat fProjectileMaxSpeed("fProjectileMaxSpeed");
+        const MWWorld::GmstFloat fProjectileMinSpeed("fProjectileMinSpeed");
+        const MWWorld::GmstFloat fThrownWeaponMaxSpeed("fThrownWeaponMaxSpeed");
+        const MWWorld::GmstFloat fThrownWeaponMinSpeed("fThrownWeaponMinSpeed");
+        const MWWorld::GmstInt iVoiceAttackOdds("iVoiceAttackOdds");
+    }
 
     //chooses an attack depending on probability to avoid uniformity
     std::string chooseBestAttack(const ESM::Weapon* weapon);
@@ -418,7 +429,7 @@ namespace MWMechanics
 
             case AiCombatStorage::FleeState_RunToDestination:
                 {
-                    static const float fFleeDistance = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fFleeDistance")->getFloat();
+                    const float fFleeDistance = Gmst::fFleeDistance.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
 
                     float dist = (actor.getRefData().getPosition().asVec3() - target.getRefData().getPosition().asVec3()).length();
                     if ((dist > fFleeDistance && !storage.mLOS)
@@ -576,13 +587,13 @@ namespace MWMechanics
 
                 const MWWorld::ESMStore &store = MWBase::Environment::get().getWorld()->getStore();
 
-                float baseDelay = store.get<ESM::GameSetting>().find("fCombatDelayCreature")->getFloat();
+                float baseDelay = Gmst::fCombatDelayCreature.get(store.getGameSettings());
                 if (actor.getClass().isNpc())
                 {
-                    baseDelay = store.get<ESM::GameSetting>().find("fCombatDelayNPC")->getFloat();
+                    baseDelay = Gmst::fCombatDelayNPC.get(store.getGameSettings());
 
                     //say a provoking combat phrase
-                    int chance = store.get<ESM::GameSetting>().find("iVoiceAttackOdds")->getInt();
+                    int chance = Gmst::iVoiceAttackOdds.get(store.getGameSettings());
                     if (Misc::Rng::roll0to99() < chance)
                     {
                         MWBase::Environment::get().getDialogueManager()->say(actor, "attack");
@@ -671,20 +682,20 @@ osg::Vec3f AimDirToMovingTarget(const MWWorld::Ptr& actor, const MWWorld::Ptr& t
     // get projectile speed (depending on weapon type)
     if (weapType == ESM::Weapon::MarksmanThrown)
     {
-        static float fThrownWeaponMinSpeed = 
-            MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fThrownWeaponMinSpeed")->getFloat();
-        static float fThrownWeaponMaxSpeed = 
-            MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fThrownWeaponMaxSpeed")->getFloat();
+        const float fThrownWeaponMinSpeed = 
+            Gmst::fThrownWeaponMinSpeed.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
+        const float fThrownWeaponMaxSpeed = 
+            Gmst::fThrownWeaponMaxSpeed.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
 
         projSpeed = 
             fThrownWeaponMinSpeed + (fThrownWeaponMaxSpeed - fThrownWeaponMinSpeed) * strength;
     }
     else
     {
-        static float fProjectileMinSpeed = 
-            MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fProjectileMinSpeed")->getFloat();
-        static float fProjectileMaxSpeed = 
-            MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fProjectileMaxSpeed")->getFloat();
+        const float fProjectileMinSpeed = 
+            Gmst::fProjectileMinSpeed.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
+        const float fProjectileMaxSpeed = 
+            Gmst::fProjectileMaxSpeed.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
 
         projSpeed = 
             fProjectileMinSpeed + (fProjectileMaxSpeed - fProjectileMinSpeed) * strength;
@@ -19,12 +19,28 @@
 #include "weaponpriority.hpp"
 #include "spellpriority.hpp"
 
+namespace
+{
+    namespace Gmst
+    {
+        const MWWorld::GmstFloat fAIFleeFleeMult("fAIFleeFleeMult");
+        const MWWorld::GmstFloat fAIFleeHealthMult("fAIFleeHealthMult");
+        const MWWorld::GmstFloat fCombatDistance("fCombatDistance");
+        const MWWorld::GmstFloat fCombatDistanceWerewolfMod("fCombatDistanceWerewolfMod");
+        const MWWorld::GmstFloat fHandToHandReach("fHandToHandReach");
+        const MWWorld::GmstFloat fProjectileMaxSpeed("fProjectileMaxSpeed");
+        const MWWorld::GmstFloat fTargetSpellMaxSpeed("fTargetSpellMaxSpeed");
+        const MWWorld::GmstInt iWereWolfFleeMod("iWereWolfFleeMod");
+        const MWWorld::GmstInt iWereWolfLevelToAttack("iWereWolfLevelToAttack");
+    }
+}
+
 namespace MWMechanics
 {
     float suggestCombatRange(int rangeTypes)
     {
-        static const float fCombatDistance = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fCombatDistance")->getFloat();
-        static float fHandToHandReach = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fHandToHandReach")->getFloat();
+        const float fCombatDistance = Gmst::fCombatDistance.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
+        const float fHandToHandReach = Gmst::fHandToHandReach.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
 
         // This distance is a possible distance of melee attack
         static float distance = fCombatDistance * std::max(2.f, fHandToHandReach);
@@ -114,13 +130,13 @@ namespace MWMechanics
     {
         isRanged = false;
 
-        static const float fCombatDistance = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fCombatDistance")->getFloat();
-        static const float fProjectileMaxSpeed = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fProjectileMaxSpeed")->getFloat();
+        const float fCombatDistance = Gmst::fCombatDistance.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
+        const float fProjectileMaxSpeed = Gmst::fProjectileMaxSpeed.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
 
         if (mWeapon.isEmpty())
         {
-            static float fHandToHandReach =
-                MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fHandToHandReach")->getFloat();
+            const float fHandToHandReach =
+                Gmst::fHandToHandReach.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
             return fHandToHandReach * fCombatDistance;
         }
 
@@ -311,7 +327,7 @@ namespace MWMechanics
     float getMaxAttackDistance(const MWWorld::Ptr& actor)
     {
         const CreatureStats& stats = actor.getClass().getCreatureStats(actor);
-        const MWWorld::Store<ESM::GameSetting>& gmst = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
+        const MWWorld::GameSettingsCache& gmst = MWBase::Environment::get().getWorld()->getStore().getGameSettings();
 
         std::string selectedSpellId = stats.getSpells().getSelectedSpell();
         MWWorld::Ptr selectedEnchItem;
@@ -336,7 +352,7 @@ namespace MWMechanics
         float dist = 1.0f;
         if (activeWeapon.isEmpty() && !selectedSpellId.empty() && !selectedEnchItem.isEmpty())
         {
-            static const float fHandToHandReach = gmst.find("fHandToHandReach")->getFloat();
+            const float fHandToHandReach = Gmst::fHandToHandReach.get(gmst);
             dist = fHandToHandReach;
         }
         else if (stats.getDrawState() == MWMechanics::DrawState_Spell)
@@ -375,7 +391,7 @@ namespace MWMechanics
                 }
             }
 
-            static const float fTargetSpellMaxSpeed = gmst.find("fTargetSpellMaxSpeed")->getFloat();
+            const float fTargetSpellMaxSpeed = Gmst::fTargetSpellMaxSpeed.get(gmst);
             dist *= std::max(1000.0f, fTargetSpellMaxSpeed);
         }
         else if (!activeWeapon.isEmpty())
@@ -383,7 +399,7 @@ namespace MWMechanics
             const ESM::Weapon* esmWeap = activeWeapon.get<ESM::Weapon>()->mBase;
             if (esmWeap->mData.mType >= ESM::Weapon::MarksmanBow)
             {
-                static const float fTargetSpellMaxSpeed = gmst.find("fProjectileMaxSpeed")->getFloat();
+                const float fTargetSpellMaxSpeed = Gmst::fProjectileMaxSpeed.get(gmst);
                 dist = fTargetSpellMaxSpeed;
                 if (!activeAmmo.isEmpty())
                 {
@@ -399,8 +415,8 @@ namespace MWMechanics
 
         dist = (dist > 0.f) ? dist : 1.0f;
 
-        static const float fCombatDistance = gmst.find("fCombatDistance")->getFloat();
-        static const float fCombatDistanceWerewolfMod = gmst.find("fCombatDistanceWerewolfMod")->getFloat();
+        const float fCombatDistance = Gmst::fCombatDistance.get(gmst);
+        const float fCombatDistanceWerewolfMod = Gmst::fCombatDistanceWerewolfMod.get(gmst);
 
         float combatDistance = fCombatDistance;
         if (actor.getClass().isNpc() && actor.getClass().getNpcStats(actor).isWerewolf())
@@ -479,24 +495,24 @@ namespace MWMechanics
     float vanillaRateFlee(const MWWorld::Ptr& actor, const MWWorld::Ptr& enemy)
     {
         const CreatureStats& stats = actor.getClass().getCreatureStats(actor);
-        const MWWorld::Store<ESM::GameSetting>& gmst = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
+        const MWWorld::GameSettingsCache& gmst = MWBase::Environment::get().getWorld()->getStore().getGameSettings();
 
         int flee = stats.getAiSetting(CreatureStats::AI_Flee).getModified();
         if (flee >= 100)
             return flee;
 
-        static const float fAIFleeHealthMult = gmst.find("fAIFleeHealthMult")->getFloat();
-        static const float fAIFleeFleeMult = gmst.find("fAIFleeFleeMult")->getFloat();
+        const float fAIFleeHealthMult = Gmst::fAIFleeHealthMult.get(gmst);
+        const float fAIFleeFleeMult = Gmst::fAIFleeFleeMult.get(gmst);
 
         float healthPercentage = (stats.getHealth().getModified() == 0.0f)
                                     ? 1.0f : stats.getHealth().getCurrent() / stats.getHealth().getModified();
         float rating = (1.0f - healthPercentage) * fAIFleeHealthMult + flee * fAIFleeFleeMult;
 
-        static const int iWereWolfLevelToAttack = gmst.find("iWereWolfLevelToAttack")->getInt();
+        const int iWereWolfLevelToAttack = Gmst::iWereWolfLevelToAttack.get(gmst);
 
         if (enemy.getClass().isNpc() && enemy.getClass().getNpcStats(enemy).isWerewolf() && stats.getLevel() < iWereWolfLevelToAttack)
         {
-            static const int iWereWolfFleeMod = gmst.find("iWereWolfFleeMod")->getInt();
+            const int iWereWolfFleeMod = Gmst::iWereWolfFleeMod.get(gmst);
             rating = iWereWolfFleeMod;
         }
 
@@ -24,6 +24,16 @@
 #include "coordinateconverter.hpp"
 #include "actorutil.hpp"
 
+namespace
+{
+    namespace Gmst
+    {
+        const MWWorld::GmstFloat fIdleChanceMultiplier("fIdleChanceMultiplier");
+        const MWWorld::GmstFloat fVoiceIdleOdds("fVoiceIdleOdds");
+        const MWWorld::GmstInt iGreetDistanceMultiplier("iGreetDistanceMultiplier");
+    }
+}
+
 
 
 namespace MWMechanics
@@ -577,8 +587,7 @@ namespace MWMechanics
         {
             MWWorld::Ptr player = getPlayer();
 
-            static float fVoiceIdleOdds = MWBase::Environment::get().getWorld()->getStore()
-                .get<ESM::GameSetting>().find("fVoiceIdleOdds")->getFloat();
+            const float fVoiceIdleOdds = Gmst::fVoiceIdleOdds.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
 
             float roll = Misc::Rng::rollProbability() * 10000.0f;
 
@@ -604,8 +613,7 @@ namespace MWMechanics
         // Play a random voice greeting if the player gets too close
         int hello = actor.getClass().getCreatureStats(actor).getAiSetting(CreatureStats::AI_Hello).getModified();
         float helloDistance = static_cast<float>(hello);
-        static int iGreetDistanceMultiplier = MWBase::Environment::get().getWorld()->getStore()
-            .get<ESM::GameSetting>().find("iGreetDistanceMultiplier")->getInt();
+        const int iGreetDistanceMultiplier = Gmst::iGreetDistanceMultiplier.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
 
         helloDistance *= iGreetDistanceMultiplier;
 
@@ -782,8 +790,7 @@ namespace MWMechanics
 
         for(unsigned int counter = 0; counter < mIdle.size(); counter++)
         {
-            static float fIdleChanceMultiplier = MWBase::Environment::get().getWorld()->getStore()
-                .get<ESM::GameSetting>().find("fIdleChanceMultiplier")->getFloat();
+            const float fIdleChanceMultiplier = Gmst::fIdleChanceMultiplier.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
 
             unsigned short idleChance = static_cast<unsigned short>(fIdleChanceMultiplier * mIdle[counter]);
             unsigned short randSelect = (int)(Misc::Rng::rollProbability() * int(100 / fIdleChanceMultiplier));
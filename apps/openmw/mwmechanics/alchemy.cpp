@@ -28,6 +28,18 @@
 #include "creaturestats.hpp"
 #include "npcstats.hpp"
 
+namespace
+{
+    namespace Gmst
+    {
+        const MWWorld::GmstFloat fPotionStrengthMult("fPotionStrengthMult");
+        const MWWorld::GmstFloat fPotionT1DurMult("fPotionT1DurMult");
+        const MWWorld::GmstFloat fPotionT1MagMult("fPotionT1MagMult");
+        const MWWorld::GmstFloat fWortChanceValue("fWortChanceValue");
+        const MWWorld::GmstFloat iAlchemyMod("iAlchemyMod");
+    }
+}
+
 MWMechanics::Alchemy::Alchemy()
     : mValue(0)
 {
@@ -140,11 +152,11 @@ void MWMechanics::Alchemy::updateEffects()
     float x = getAlchemyFactor();
 
     x *= mTools[ESM::Apparatus::MortarPestle].get<ESM::Apparatus>()->mBase->mData.mQuality;
-    x *= MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find ("fPotionStrengthMult")->getFloat();
+    x *= Gmst::fPotionStrengthMult.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
 
     // value
     mValue = static_cast<int> (
-        x * MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find ("iAlchemyMod")->getFloat());
+        x * Gmst::iAlchemyMod.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings()));
 
     // build quantified effect list
     for (std::set<EffectKey>::const_iterator iter (effects.begin()); iter!=effects.end(); ++iter)
@@ -160,13 +172,13 @@ void MWMechanics::Alchemy::updateEffects()
         }
 
         float fPotionT1MagMul =
-            MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find ("fPotionT1MagMult")->getFloat();
+            Gmst::fPotionT1MagMult.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
 
         if (fPotionT1MagMul<=0)
             throw std::runtime_error ("invalid gmst: fPotionT1MagMul");
 
         float fPotionT1DurMult =
-            MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find ("fPotionT1DurMult")->getFloat();
+            Gmst::fPotionT1DurMult.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
 
         if (fPotionT1DurMult<=0)
             throw std::runtime_error ("invalid gmst: fPotionT1DurMult");
@@ -448,8 +460,8 @@ bool MWMechanics::Alchemy::knownEffect(unsigned int potionEffectIndex, const MWW
 {
     MWMechanics::NpcStats& npcStats = npc.getClass().getNpcStats(npc);
     int alchemySkill = npcStats.getSkill (ESM::Skill::Alchemy).getBase();
-    static const float fWortChanceValue =
-            MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fWortChanceValue")->getFloat();
+    const float fWortChanceValue =
+            Gmst::fWortChanceValue.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
     return (potionEffectIndex <= 1 && alchemySkill >= fWortChanceValue)
             || (potionEffectIndex <= 3 && alchemySkill >= fWortChanceValue*2)
             || (potionEffectIndex <= 5 && alchemySkill >= fWortChanceValue*3)
@@ -9,6 +9,18 @@
 #include "../mwbase/world.hpp"
 #include "../mwbase/environment.hpp"
 
+namespace
+{
+    namespace Gmst
+    {
+        const MWWorld::GmstFloat fAutoPCSpellChance("fAutoPCSpellChance");
+        const MWWorld::GmstFloat fEffectCostMult("fEffectCostMult");
+        const MWWorld::GmstFloat fPCbaseMagickaMult("fPCbaseMagickaMult");
+        const MWWorld::GmstInt iAutoPCSpellMax("iAutoPCSpellMax");
+        const MWWorld::GmstInt iAutoSpellAttSkillMin("iAutoSpellAttSkillMin");
+    }
+}
+
 
 namespace MWMechanics
 {
@@ -146,7 +158,7 @@ namespace MWMechanics
     {
         const MWWorld::ESMStore& esmStore = MWBase::Environment::get().getWorld()->getStore();
 
-        static const float fPCbaseMagickaMult = esmStore.get<ESM::GameSetting>().find("fPCbaseMagickaMult")->getFloat();
+        const float fPCbaseMagickaMult = Gmst::fPCbaseMagickaMult.get(esmStore.getGameSettings());
 
         float baseMagicka = fPCbaseMagickaMult * actorAttributes[ESM::Attribute::Intelligence];
         bool reachedLimit = false;
@@ -173,7 +185,7 @@ namespace MWMechanics
             if (baseMagicka < spell->mData.mCost)
                 continue;
 
-            static const float fAutoPCSpellChance = esmStore.get<ESM::GameSetting>().find("fAutoPCSpellChance")->getFloat();
+            const float fAutoPCSpellChance = Gmst::fAutoPCSpellChance.get(esmStore.getGameSettings());
             if (calcAutoCastChance(spell, actorSkills, actorAttributes, -1) < fAutoPCSpellChance)
                 continue;
 
@@ -206,7 +218,7 @@ namespace MWMechanics
                     weakestSpell = spell;
                     minCost = weakestSpell->mData.mCost;
                 }
-                static const unsigned int iAutoPCSpellMax = esmStore.get<ESM::GameSetting>().find("iAutoPCSpellMax")->getInt();
+                const unsigned int iAutoPCSpellMax = Gmst::iAutoPCSpellMax.get(esmStore.getGameSettings());
                 if (selectedSpells.size() == iAutoPCSpellMax)
                     reachedLimit = true;
             }
@@ -221,7 +233,7 @@ namespace MWMechanics
         for (std::vector<ESM::ENAMstruct>::const_iterator effectIt = effects.begin(); effectIt != effects.end(); ++effectIt)
         {
             const ESM::MagicEffect* magicEffect = MWBase::Environment::get().getWorld()->getStore().get<ESM::MagicEffect>().find(effectIt->mEffectID);
-            static const int iAutoSpellAttSkillMin = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("iAutoSpellAttSkillMin")->getInt();
+            const int iAutoSpellAttSkillMin = Gmst::iAutoSpellAttSkillMin.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
 
             if ((magicEffect->mData.mFlags & ESM::MagicEffect::TargetSkill))
             {
@@ -277,8 +289,7 @@ namespace MWMechanics
             if (!(magicEffect->mData.mFlags & ESM::MagicEffect::NoDuration))
                 duration = effect.mDuration;
 
-            static const float fEffectCostMult = MWBase::Environment::get().getWorld()->getStore()
-                .get<ESM::GameSetting>().find("fEffectCostMult")->getFloat();
+            const float fEffectCostMult = Gmst::fEffectCostMult.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
 
             float x = 0.5 * (std::max(1, minMagn) + std::max(1, maxMagn));
             x *= 0.1 * magicEffect->mData.mBaseCost;
@@ -48,6 +48,26 @@
 
 namespace
 {
+    namespace Gmst
+    {
+        const MWWorld::GmstFloat fFallAcroBase("fFallAcroBase");
+        const MWWorld::GmstFloat fFallAcroMult("fFallAcroMult");
+        const MWWorld::GmstFloat fFallDamageDistanceMin("fFallDamageDistanceMin");
+        const MWWorld::GmstFloat fFallDistanceBase("fFallDistanceBase");
+        const MWWorld::GmstFloat fFallDistanceMult("fFallDistanceMult");
+        const MWWorld::GmstFloat fFatigueJumpBase("fFatigueJumpBase");
+        const MWWorld::GmstFloat fFatigueJumpMult("fFatigueJumpMult");
+        const MWWorld::GmstFloat fFatigueRunBase("fFatigueRunBase");
+        const MWWorld::GmstFloat fFatigueRunMult("fFatigueRunMult");
+        const MWWorld::GmstFloat fFatigueSneakBase("fFatigueSneakBase");
+        const MWWorld::GmstFloat fFatigueSneakMult("fFatigueSneakMult");
+        const MWWorld::GmstFloat fFatigueSwimRunBase("fFatigueSwimRunBase");
+        const MWWorld::GmstFloat fFatigueSwimRunMult("fFatigueSwimRunMult");
+        const MWWorld::GmstFloat fFatigueSwimWalkBase("fFatigueSwimWalkBase");
+        const MWWorld::GmstFloat fFatigueSwimWalkMult("fFatigueSwimWalkMult");
+        const MWWorld::GmstFloat fJumpMoveBase("fJumpMoveBase");
+        const MWWorld::GmstFloat fJumpMoveMult("fJumpMoveMult");
+    }
 
 // Wraps a value to (-PI, PI]
 void wrap(float& rad)
@@ -120,18 +140,18 @@ MWMechanics::CharacterState runStateToWalkState (MWMechanics::CharacterState sta
 float getFallDamage(const MWWorld::Ptr& ptr, float fallHeight)
 {
     MWBase::World *world = MWBase::Environment::get().getWorld();
-    const MWWorld::Store<ESM::GameSetting> &store = world->getStore().get<ESM::GameSetting>();
+    const MWWorld::GameSettingsCache& store = world->getStore().getGameSettings();
 
-    const float fallDistanceMin = store.find("fFallDamageDistanceMin")->getFloat();
+    const float fallDistanceMin = Gmst::fFallDamageDistanceMin.get(store);
 
     if (fallHeight >= fallDistanceMin)
     {
         const float acrobaticsSkill = static_cast<float>(ptr.getClass().getSkill(ptr, ESM::Skill::Acrobatics));
         const float jumpSpellBonus = ptr.getClass().getCreatureStats(ptr).getMagicEffects().get(ESM::MagicEffect::Jump).getMagnitude();
-        const float fallAcroBase = store.find("fFallAcroBase")->getFloat();
-        const float fallAcroMult = store.find("fFallAcroMult")->getFloat();
-        const float fallDistanceBase = store.find("fFallDistanceBase")->getFloat();
-        const float fallDistanceMult = store.find("fFallDistanceMult")->getFloat();
+        const float fallAcroBase = Gmst::fFallAcroBase.get(store);
+        const float fallAcroMult = Gmst::fFallAcroMult.get(store);
+        const float fallDistanceBase = Gmst::fFallDistanceBase.get(store);
+        const float fallDistanceMult = Gmst::fFallDistanceMult.get(store);
 
         float x = fallHeight - fallDistanceMin;
         x -= (1.5f * acrobaticsSkill) + jumpSpellBonus;
@@ -1399,7 +1419,8 @@ bool CharacterController::updateWeaponState()
                     {
                         if (isWeapon)
                         {
-                            if (Settings::Manager::getBool("best attack", "Game"))        
+                            static const Settings::Handle<bool> bestAttack("best attack", "Game");
+                            if (bestAttack.get())
                             {
                                 MWWorld::ConstContainerStoreIterator weapon = mPtr.getClass().getInventoryStore(mPtr).getSlot(MWWorld::InventoryStore::Slot_CarriedRight);
                                 mAttackType = getBestAttack(weapon->get<ESM::Weapon>()->mBase);
@@ -1739,16 +1760,16 @@ void CharacterController::update(float duration)
         }
 
         // reduce fatigue
-        const MWWorld::Store<ESM::GameSetting> &gmst = world->getStore().get<ESM::GameSetting>();
+        const MWWorld::GameSettingsCache& gmst = world->getStore().getGameSettings();
         float fatigueLoss = 0;
-        static const float fFatigueRunBase = gmst.find("fFatigueRunBase")->getFloat();
-        static const float fFatigueRunMult = gmst.find("fFatigueRunMult")->getFloat();
-        static const float fFatigueSwimWalkBase = gmst.find("fFatigueSwimWalkBase")->getFloat();
-        static const float fFatigueSwimRunBase = gmst.find("fFatigueSwimRunBase")->getFloat();
-        static const float fFatigueSwimWalkMult = gmst.find("fFatigueSwimWalkMult")->getFloat();
-        static const float fFatigueSwimRunMult = gmst.find("fFatigueSwimRunMult")->getFloat();
-        static const float fFatigueSneakBase = gmst.find("fFatigueSneakBase")->getFloat();
-        static const float fFatigueSneakMult = gmst.find("fFatigueSneakMult")->getFloat();
+        const float fFatigueRunBase = Gmst::fFatigueRunBase.get(gmst);
+        const float fFatigueRunMult = Gmst::fFatigueRunMult.get(gmst);
+        const float fFatigueSwimWalkBase = Gmst::fFatigueSwimWalkBase.get(gmst);
+        const float fFatigueSwimRunBase = Gmst::fFatigueSwimRunBase.get(gmst);
+        const float fFatigueSwimWalkMult = Gmst::fFatigueSwimWalkMult.get(gmst);
+        const float fFatigueSwimRunMult = Gmst::fFatigueSwimRunMult.get(gmst);
+        const float fFatigueSneakBase = Gmst::fFatigueSneakBase.get(gmst);
+        const float fFatigueSneakMult = Gmst::fFatigueSneakMult.get(gmst);
 
         if (cls.getEncumbrance(mPtr) <= cls.getCapacity(mPtr))
         {
@@ -1789,8 +1810,8 @@ void CharacterController::update(float duration)
             forcestateupdate = (mJumpState != JumpState_InAir);
             jumpstate = JumpState_InAir;
 
-            static const float fJumpMoveBase = gmst.find("fJumpMoveBase")->getFloat();
-            static const float fJumpMoveMult = gmst.find("fJumpMoveMult")->getFloat();
+            const float fJumpMoveBase = Gmst::fJumpMoveBase.get(gmst);
+            const float fJumpMoveMult = Gmst::fJumpMoveMult.get(gmst);
             float factor = fJumpMoveBase + fJumpMoveMult * mPtr.getClass().getSkill(mPtr, ESM::Skill::Acrobatics)/100.f;
             factor = std::min(1.f, factor);
             vec.x() *= factor;
@@ -1817,8 +1838,8 @@ void CharacterController::update(float duration)
                     cls.skillUsageSucceeded(mPtr, ESM::Skill::Acrobatics, 0);
 
                 // decrease fatigue
-                const float fatigueJumpBase = gmst.find("fFatigueJumpBase")->getFloat();
-                const float fatigueJumpMult = gmst.find("fFatigueJumpMult")->getFloat();
+                const float fatigueJumpBase = Gmst::fFatigueJumpBase.get(gmst);
+                const float fatigueJumpMult = Gmst::fFatigueJumpMult.get(gmst);
                 float normalizedEncumbrance = mPtr.getClass().getNormalizedEncumbrance(mPtr);
                 if (normalizedEncumbrance > 1)
                     normalizedEncumbrance = 1;
@@ -23,6 +23,35 @@
 
 namespace
 {
+    namespace Gmst
+    {
+        const MWWorld::GmstFloat fBlockStillBonus("fBlockStillBonus");
+        const MWWorld::GmstFloat fCombatBlockLeftAngle("fCombatBlockLeftAngle");
+        const MWWorld::GmstFloat fCombatBlockRightAngle("fCombatBlockRightAngle");
+        const MWWorld::GmstFloat fCombatInvisoMult("fCombatInvisoMult");
+        const MWWorld::GmstFloat fCombatKODamageMult("fCombatKODamageMult");
+        const MWWorld::GmstFloat fDamageStrengthBase("fDamageStrengthBase");
+        const MWWorld::GmstFloat fDamageStrengthMult("fDamageStrengthMult");
+        const MWWorld::GmstFloat fElementalShieldMult("fElementalShieldMult");
+        const MWWorld::GmstFloat fFatigueAttackBase("fFatigueAttackBase");
+        const MWWorld::GmstFloat fFatigueAttackMult("fFatigueAttackMult");
+        const MWWorld::GmstFloat fFatigueBlockBase("fFatigueBlockBase");
+        const MWWorld::GmstFloat fFatigueBlockMult("fFatigueBlockMult");
+        const MWWorld::GmstFloat fFightDistanceMultiplier("fFightDistanceMultiplier");
+        const MWWorld::GmstFloat fHandtoHandHealthPer("fHandtoHandHealthPer");
+        const MWWorld::GmstFloat fMaxHandToHandMult("fMaxHandToHandMult");
+        const MWWorld::GmstFloat fMinHandToHandMult("fMinHandToHandMult");
+        const MWWorld::GmstFloat fProjectileThrownStoreChance("fProjectileThrownStoreChance");
+        const MWWorld::GmstFloat fSwingBlockBase("fSwingBlockBase");
+        const MWWorld::GmstFloat fSwingBlockMult("fSwingBlockMult");
+        const MWWorld::GmstFloat fWeaponDamageMult("fWeaponDamageMult");
+        const MWWorld::GmstFloat fWeaponFatigueBlockMult("fWeaponFatigueBlockMult");
+        const MWWorld::GmstFloat fWeaponFatigueMult("fWeaponFatigueMult");
+        const MWWorld::GmstFloat fWereWolfSilverWeaponDamageMult("fWereWolfSilverWeaponDamageMult");
+        const MWWorld::GmstInt iBlockMaxChance("iBlockMaxChance");
+        const MWWorld::GmstInt iBlockMinChance("iBlockMinChance");
+        const MWWorld::GmstInt iFightDistanceBase("iFightDistanceBase");
+    }
 
 float signedAngleRadians (const osg::Vec3f& v1, const osg::Vec3f& v2, const osg::Vec3f& normal)
 {
@@ -81,10 +110,10 @@ namespace MWMechanics
                     blocker.getRefData().getBaseNode()->getAttitude() * osg::Vec3f(0,1,0),
                     osg::Vec3f(0,0,1)));
 
-        const MWWorld::Store<ESM::GameSetting>& gmst = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
-        if (angleDegrees < gmst.find("fCombatBlockLeftAngle")->getFloat())
+        const MWWorld::GameSettingsCache& gmst = MWBase::Environment::get().getWorld()->getStore().getGameSettings();
+        if (angleDegrees < Gmst::fCombatBlockLeftAngle.get(gmst))
             return false;
-        if (angleDegrees > gmst.find("fCombatBlockRightAngle")->getFloat())
+        if (angleDegrees > Gmst::fCombatBlockRightAngle.get(gmst))
             return false;
 
         MWMechanics::CreatureStats& attackerStats = attacker.getClass().getCreatureStats(attacker);
@@ -92,11 +121,11 @@ namespace MWMechanics
         float blockTerm = blocker.getClass().getSkill(blocker, ESM::Skill::Block) + 0.2f * blockerStats.getAttribute(ESM::Attribute::Agility).getModified()
             + 0.1f * blockerStats.getAttribute(ESM::Attribute::Luck).getModified();
         float enemySwing = attackStrength;
-        float swingTerm = enemySwing * gmst.find("fSwingBlockMult")->getFloat() + gmst.find("fSwingBlockBase")->getFloat();
+        float swingTerm = enemySwing * Gmst::fSwingBlockMult.get(gmst) + Gmst::fSwingBlockBase.get(gmst);
 
         float blockerTerm = blockTerm * swingTerm;
         if (blocker.getClass().getMovementSettings(blocker).mPosition[1] <= 0)
-            blockerTerm *= gmst.find("fBlockStillBonus")->getFloat();
+            blockerTerm *= Gmst::fBlockStillBonus.get(gmst);
         blockerTerm *= blockerStats.getFatigueTerm();
 
         int attackerSkill = 0;
@@ -109,8 +138,8 @@ namespace MWMechanics
         attackerTerm *= attackerStats.getFatigueTerm();
 
         int x = int(blockerTerm - attackerTerm);
-        int iBlockMaxChance = gmst.find("iBlockMaxChance")->getInt();
-        int iBlockMinChance = gmst.find("iBlockMinChance")->getInt();
+        int iBlockMaxChance = Gmst::iBlockMaxChance.get(gmst);
+        int iBlockMinChance = Gmst::iBlockMinChance.get(gmst);
         x = std::min(iBlockMaxChance, std::max(iBlockMinChance, x));
 
         if (Misc::Rng::roll0to99() < x)
@@ -124,9 +153,9 @@ namespace MWMechanics
                 inv.unequipItem(*shield, blocker);
 
             // Reduce blocker fatigue
-            const float fFatigueBlockBase = gmst.find("fFatigueBlockBase")->getFloat();
-            const float fFatigueBlockMult = gmst.find("fFatigueBlockMult")->getFloat();
-            const float fWeaponFatigueBlockMult = gmst.find("fWeaponFatigueBlockMult")->getFloat();
+            const float fFatigueBlockBase = Gmst::fFatigueBlockBase.get(gmst);
+            const float fFatigueBlockMult = Gmst::fFatigueBlockMult.get(gmst);
+            const float fWeaponFatigueBlockMult = Gmst::fWeaponFatigueBlockMult.get(gmst);
             MWMechanics::DynamicStat<float> fatigue = blockerStats.getFatigue();
             float normalizedEncumbrance = blocker.getClass().getNormalizedEncumbrance(blocker);
             normalizedEncumbrance = std::min(1.f, normalizedEncumbrance);
@@ -157,14 +186,15 @@ namespace MWMechanics
         if (!(weapon.get<ESM::Weapon>()->mBase->mData.mFlags & ESM::Weapon::Silver
               || weapon.get<ESM::Weapon>()->mBase->mData.mFlags & ESM::Weapon::Magical))
         {
+            static const Settings::Handle<bool> enchantedWeaponsMagical("enchanted weapons are magical", "Game");
             if (weapon.getClass().getEnchantment(weapon).empty()
-              || !Settings::Manager::getBool("enchanted weapons are magical", "Game"))
+              || !enchantedWeaponsMagical.get())
                 damage *= multiplier;
         }
 
         if ((weapon.get<ESM::Weapon>()->mBase->mData.mFlags & ESM::Weapon::Silver)
                 && actor.getClass().isNpc() && actor.getClass().getNpcStats(actor).isWerewolf())
-            damage *= MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fWereWolfSilverWeaponDamageMult")->getFloat();
+            damage *= Gmst::fWereWolfSilverWeaponDamageMult.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
 
         if (damage == 0 && attacker == getPlayer())
             MWBase::Environment::get().getWindowManager()->messageBox("#{sMagicTargetResistsWeapons}");
@@ -174,7 +204,7 @@ namespace MWMechanics
                        const osg::Vec3f& hitPosition, float attackStrength)
     {
         MWBase::World *world = MWBase::Environment::get().getWorld();
-        const MWWorld::Store<ESM::GameSetting> &gmst = world->getStore().get<ESM::GameSetting>();
+        const MWWorld::GameSettingsCache& gmst = world->getStore().getGameSettings();
 
         bool validVictim = !victim.isEmpty() && victim.getClass().isActor();
 
@@ -211,7 +241,7 @@ namespace MWMechanics
                 attacker.getClass().skillUsageSucceeded(attacker, weaponSkill, 0);
 
             if (victim.getClass().getCreatureStats(victim).getKnockedDown())
-                damage *= gmst.find("fCombatKODamageMult")->getFloat();
+                damage *= Gmst::fCombatKODamageMult.get(gmst);
         }
 
         reduceWeaponCondition(damage, validVictim, weapon, attacker);
@@ -226,7 +256,7 @@ namespace MWMechanics
             // Non-enchanted arrows shot at enemies have a chance to turn up in their inventory
             if (victim != getPlayer() && !appliedEnchantment)
             {
-                float fProjectileThrownStoreChance = gmst.find("fProjectileThrownStoreChance")->getFloat();
+                float fProjectileThrownStoreChance = Gmst::fProjectileThrownStoreChance.get(gmst);
                 if (Misc::Rng::rollProbability() < fProjectileThrownStoreChance / 100.f)
                     victim.getClass().getContainerStore(victim).add(projectile, 1, victim);
             }
@@ -241,7 +271,7 @@ namespace MWMechanics
         const MWMechanics::MagicEffects &mageffects = stats.getMagicEffects();
 
         MWBase::World *world = MWBase::Environment::get().getWorld();
-        const MWWorld::Store<ESM::GameSetting> &gmst = world->getStore().get<ESM::GameSetting>();
+        const MWWorld::GameSettingsCache& gmst = world->getStore().getGameSettings();
 
         float defenseTerm = 0;
         MWMechanics::CreatureStats& victimStats = victim.getClass().getCreatureStats(victim);
@@ -258,10 +288,10 @@ namespace MWMechanics
                 defenseTerm = victimStats.getEvasion();
             }
             defenseTerm += std::min(100.f,
-                                    gmst.find("fCombatInvisoMult")->getFloat() *
+                                    Gmst::fCombatInvisoMult.get(gmst) *
                                     victimStats.getMagicEffects().get(ESM::MagicEffect::Chameleon).getMagnitude());
             defenseTerm += std::min(100.f,
-                                    gmst.find("fCombatInvisoMult")->getFloat() *
+                                    Gmst::fCombatInvisoMult.get(gmst) *
                                     victimStats.getMagicEffects().get(ESM::MagicEffect::Invisibility).getMagnitude());
         }
         float attackTerm = skillValue +
@@ -307,7 +337,7 @@ namespace MWMechanics
 
             x = std::min(100.f, x + elementResistance);
 
-            static const float fElementalShieldMult = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fElementalShieldMult")->getFloat();
+            const float fElementalShieldMult = Gmst::fElementalShieldMult.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
             x = fElementalShieldMult * magnitude * (1.f - 0.01f * x);
 
             // Note swapped victim and attacker, since the attacker takes the damage here.
@@ -337,7 +367,7 @@ namespace MWMechanics
             // weapon condition does not degrade when godmode is on
             if (!godmode)
             {
-                const float fWeaponDamageMult = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fWeaponDamageMult")->getFloat();
+                const float fWeaponDamageMult = Gmst::fWeaponDamageMult.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
                 float x = std::max(1.f, fWeaponDamageMult * damage);
 
                 weaphealth -= std::min(int(x), weaphealth);
@@ -363,10 +393,8 @@ namespace MWMechanics
             damage *= (float(weaphealth) / weapmaxhealth);
         }
 
-        static const float fDamageStrengthBase = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>()
-                .find("fDamageStrengthBase")->getFloat();
-        static const float fDamageStrengthMult = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>()
-                .find("fDamageStrengthMult")->getFloat();
+        const float fDamageStrengthBase = Gmst::fDamageStrengthBase.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
+        const float fDamageStrengthMult = Gmst::fDamageStrengthMult.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
         damage *= fDamageStrengthBase +
                 (attacker.getClass().getCreatureStats(attacker).getAttribute(ESM::Attribute::Strength).getModified() * fDamageStrengthMult * 0.1f);
     }
@@ -377,8 +405,8 @@ namespace MWMechanics
         // calculations. Some mods recommend using it, so we may want to include an
         // option for it.
         const MWWorld::ESMStore& store = MWBase::Environment::get().getWorld()->getStore();
-        float minstrike = store.get<ESM::GameSetting>().find("fMinHandToHandMult")->getFloat();
-        float maxstrike = store.get<ESM::GameSetting>().find("fMaxHandToHandMult")->getFloat();
+        float minstrike = Gmst::fMinHandToHandMult.get(store.getGameSettings());
+        float maxstrike = Gmst::fMaxHandToHandMult.get(store.getGameSettings());
         damage  = static_cast<float>(attacker.getClass().getSkill(attacker, ESM::Skill::HandToHand));
         damage *= minstrike + ((maxstrike-minstrike)*attackStrength);
 
@@ -393,7 +421,7 @@ namespace MWMechanics
             damage *= MWBase::Environment::get().getWorld()->getGlobalFloat("werewolfclawmult");
         }
         if(healthdmg)
-            damage *= store.get<ESM::GameSetting>().find("fHandtoHandHealthPer")->getFloat();
+            damage *= Gmst::fHandtoHandHealthPer.get(store.getGameSettings());
 
         MWBase::SoundManager *sndMgr = MWBase::Environment::get().getSoundManager();
         if(isWerewolf)
@@ -409,10 +437,10 @@ namespace MWMechanics
     void applyFatigueLoss(const MWWorld::Ptr &attacker, const MWWorld::Ptr &weapon, float attackStrength)
     {
         // somewhat of a guess, but using the weapon weight makes sense
-        const MWWorld::Store<ESM::GameSetting>& store = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
-        const float fFatigueAttackBase = store.find("fFatigueAttackBase")->getFloat();
-        const float fFatigueAttackMult = store.find("fFatigueAttackMult")->getFloat();
-        const float fWeaponFatigueMult = store.find("fWeaponFatigueMult")->getFloat();
+        const MWWorld::GameSettingsCache& store = MWBase::Environment::get().getWorld()->getStore().getGameSettings();
+        const float fFatigueAttackBase = Gmst::fFatigueAttackBase.get(store);
+        const float fFatigueAttackMult = Gmst::fFatigueAttackMult.get(store);
+        const float fWeaponFatigueMult = Gmst::fWeaponFatigueMult.get(store);
         CreatureStats& stats = attacker.getClass().getCreatureStats(attacker);
         MWMechanics::DynamicStat<float> fatigue = stats.getFatigue();
         const float normalizedEncumbrance = attacker.getClass().getNormalizedEncumbrance(attacker);
@@ -436,10 +464,8 @@ namespace MWMechanics
 
         float d = (pos1 - pos2).length();
 
-        static const int iFightDistanceBase = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find(
-                    "iFightDistanceBase")->getInt();
-        static const float fFightDistanceMultiplier = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find(
-                    "fFightDistanceMultiplier")->getFloat();
+        const int iFightDistanceBase = Gmst::iFightDistanceBase.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
+        const float fFightDistanceMultiplier = Gmst::fFightDistanceMultiplier.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
 
         return (iFightDistanceBase - fFightDistanceMultiplier * d);
     }
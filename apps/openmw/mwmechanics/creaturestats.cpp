@@ -12,6 +12,15 @@
 #include "../mwbase/world.hpp"
 #include "../mwbase/mechanicsmanager.hpp"
 
+namespace
+{
+    namespace Gmst
+    {
+        const MWWorld::GmstFloat fFatigueBase("fFatigueBase");
+        const MWWorld::GmstFloat fFatigueMult("fFatigueMult");
+    }
+}
+
 namespace MWMechanics
 {
     int CreatureStats::sActorId = 0;
@@ -45,11 +54,10 @@ namespace MWMechanics
 
         float normalised = floor(max) == 0 ? 1 : std::max (0.0f, current / max);
 
-        const MWWorld::Store<ESM::GameSetting> &gmst =
-            MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
+        const MWWorld::GameSettingsCache& gmst = MWBase::Environment::get().getWorld()->getStore().getGameSettings();
 
-        static const float fFatigueBase = gmst.find("fFatigueBase")->getFloat();
-        static const float fFatigueMult = gmst.find("fFatigueMult")->getFloat();
+        const float fFatigueBase = Gmst::fFatigueBase.get(gmst);
+        const float fFatigueMult = Gmst::fFatigueMult.get(gmst);
 
         return fFatigueBase - fFatigueMult * (1-normalised);
     }
@@ -8,14 +8,23 @@
 
 #include "actorutil.hpp"
 
+namespace
+{
+    namespace Gmst
+    {
+        const MWWorld::GmstFloat fDifficultyMult("fDifficultyMult");
+    }
+}
+
 float scaleDamage(float damage, const MWWorld::Ptr& attacker, const MWWorld::Ptr& victim)
 {
     const MWWorld::Ptr& player = MWMechanics::getPlayer();
 
     // [-100, 100]
-    int difficultySetting = Settings::Manager::getInt("difficulty", "Game");
+    static const Settings::Handle<int> difficulty("difficulty", "Game");
+    int difficultySetting = difficulty.get();
 
-    static const float fDifficultyMult = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fDifficultyMult")->getFloat();
+    const float fDifficultyMult = Gmst::fDifficultyMult.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
 
     float difficultyTerm = 0.01f * difficultySetting;
 
@@ -14,6 +14,20 @@
 #include "spellcasting.hpp"
 #include "actorutil.hpp"
 
+namespace
+{
+    namespace Gmst
+    {
+        const MWWorld::GmstFloat fEffectCostMult("fEffectCostMult");
+        const MWWorld::GmstFloat fEnchantmentChanceMult("fEnchantmentChanceMult");
+        const MWWorld::GmstFloat fEnchantmentConstantChanceMult("fEnchantmentConstantChanceMult");
+        const MWWorld::GmstFloat fEnchantmentConstantDurationMult("fEnchantmentConstantDurationMult");
+        const MWWorld::GmstFloat fEnchantmentMult("fEnchantmentMult");
+        const MWWorld::GmstFloat fEnchantmentValueMult("fEnchantmentValueMult");
+        const MWWorld::GmstInt iSoulAmountForConstantEffect("iSoulAmountForConstantEffect");
+    }
+}
+
 namespace MWMechanics
 {
     Enchanting::Enchanting()
@@ -107,7 +121,7 @@ namespace MWMechanics
         }
 
         const bool powerfulSoul = getGemCharge() >= \
-                MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find ("iSoulAmountForConstantEffect")->getInt();
+                Gmst::iSoulAmountForConstantEffect.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
         if ((mObjectType == typeid(ESM::Armor).name()) || (mObjectType == typeid(ESM::Clothing).name()))
         { // Armor or Clothing
             switch(mCastStyle)
@@ -184,7 +198,7 @@ namespace MWMechanics
             float magnitudeCost = (magMin + magMax) * baseCost * 0.05f;
             if (mCastStyle == ESM::Enchantment::ConstantEffect)
             {
-                magnitudeCost *= store.get<ESM::GameSetting>().find("fEnchantmentConstantDurationMult")->getFloat();
+                magnitudeCost *= Gmst::fEnchantmentConstantDurationMult.get(store.getGameSettings());
             }
             else
             {
@@ -193,7 +207,7 @@ namespace MWMechanics
 
             float areaCost = area * 0.05f * baseCost;
 
-            const float fEffectCostMult = store.get<ESM::GameSetting>().find("fEffectCostMult")->getFloat();
+            const float fEffectCostMult = Gmst::fEffectCostMult.get(store.getGameSettings());
 
             cost += (magnitudeCost + areaCost) * fEffectCostMult;
 
@@ -230,7 +244,7 @@ namespace MWMechanics
         if(mEnchanter.isEmpty())
             return 0;
 
-        float priceMultipler = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find ("fEnchantmentValueMult")->getFloat();
+        float priceMultipler = Gmst::fEnchantmentValueMult.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
         int price = MWBase::Environment::get().getMechanicsManager()->getBarterOffer(mEnchanter, static_cast<int>(getEnchantPoints() * priceMultipler), true);
         return price;
     }
@@ -256,7 +270,7 @@ namespace MWMechanics
 
         const MWWorld::ESMStore &store = MWBase::Environment::get().getWorld()->getStore();
 
-        return static_cast<int>(mOldItemPtr.getClass().getEnchantmentPoints(mOldItemPtr) * store.get<ESM::GameSetting>().find("fEnchantmentMult")->getFloat());
+        return static_cast<int>(mOldItemPtr.getClass().getEnchantmentPoints(mOldItemPtr) * Gmst::fEnchantmentMult.get(store.getGameSettings()));
     }
     bool Enchanting::soulEmpty() const
     {
@@ -286,10 +300,10 @@ namespace MWMechanics
         (0.25f * npcStats.getAttribute (ESM::Attribute::Intelligence).getModified())
         + (0.125f * npcStats.getAttribute (ESM::Attribute::Luck).getModified()));
 
-        const MWWorld::Store<ESM::GameSetting>& gmst = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
+        const MWWorld::GameSettingsCache& gmst = MWBase::Environment::get().getWorld()->getStore().getGameSettings();
 
-        float chance2 = 7.5f / (gmst.find("fEnchantmentChanceMult")->getFloat() * ((mCastStyle == ESM::Enchantment::ConstantEffect) ?
-                                                                          gmst.find("fEnchantmentConstantChanceMult")->getFloat() : 1.0f ))
+        float chance2 = 7.5f / (Gmst::fEnchantmentChanceMult.get(gmst) * ((mCastStyle == ESM::Enchantment::ConstantEffect) ?
+                                                                          Gmst::fEnchantmentConstantChanceMult.get(gmst) : 1.0f ))
                 * getEnchantPoints();
 
         return (chance1-chance2);
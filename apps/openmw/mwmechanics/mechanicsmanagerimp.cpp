@@ -25,29 +25,79 @@
 #include "spellcasting.hpp"
 #include "autocalcspell.hpp"
 #include "npcstats.hpp"
+#include "statchannel.hpp"
 #include "actorutil.hpp"
 #include "combat.hpp"
 
 namespace
 {
+    namespace Gmst
+    {
+        const MWWorld::GmstFloat fAlarmRadius("fAlarmRadius");
+        const MWWorld::GmstFloat fBribe1000Mod("fBribe1000Mod");
+        const MWWorld::GmstFloat fBribe100Mod("fBribe100Mod");
+        const MWWorld::GmstFloat fBribe10Mod("fBribe10Mod");
+        const MWWorld::GmstFloat fCrimeStealing("fCrimeStealing");
+        const MWWorld::GmstFloat fDispAttacking("fDispAttacking");
+        const MWWorld::GmstFloat fDispCrimeMod("fDispCrimeMod");
+        const MWWorld::GmstFloat fDispDiseaseMod("fDispDiseaseMod");
+        const MWWorld::GmstFloat fDispFactionMod("fDispFactionMod");
+        const MWWorld::GmstFloat fDispFactionRankBase("fDispFactionRankBase");
+        const MWWorld::GmstFloat fDispFactionRankMult("fDispFactionRankMult");
+        const MWWorld::GmstFloat fDispPersonalityBase("fDispPersonalityBase");
+        const MWWorld::GmstFloat fDispPersonalityMult("fDispPersonalityMult");
+        const MWWorld::GmstFloat fDispPickPocketMod("fDispPickPocketMod");
+        const MWWorld::GmstFloat fDispRaceMod("fDispRaceMod");
+        const MWWorld::GmstFloat fDispStealing("fDispStealing");
+        const MWWorld::GmstFloat fDispWeaponDrawn("fDispWeaponDrawn");
+        const MWWorld::GmstFloat fFightDispMult("fFightDispMult");
+        const MWWorld::GmstInt fFightStealing("fFightStealing");
+        const MWWorld::GmstFloat fHoldBreathTime("fHoldBreathTime");
+        const MWWorld::GmstFloat fLevelMod("fLevelMod");
+        const MWWorld::GmstFloat fLuckMod("fLuckMod");
+        const MWWorld::GmstFloat fPerDieRollMult("fPerDieRollMult");
+        const MWWorld::GmstFloat fPerTempMult("fPerTempMult");
+        const MWWorld::GmstFloat fPersonalityMod("fPersonalityMod");
+        const MWWorld::GmstFloat fReputationMod("fReputationMod");
+        const MWWorld::GmstFloat fSneakBootMult("fSneakBootMult");
+        const MWWorld::GmstFloat fSneakDistanceBase("fSneakDistanceBase");
+        const MWWorld::GmstFloat fSneakDistanceMultiplier("fSneakDistanceMultiplier");
+        const MWWorld::GmstFloat fSneakNoViewMult("fSneakNoViewMult");
+        const MWWorld::GmstFloat fSneakSkillMult("fSneakSkillMult");
+        const MWWorld::GmstFloat fSneakViewMult("fSneakViewMult");
+        const MWWorld::GmstInt fWerewolfAcrobatics("fWerewolfAcrobatics");
+        const MWWorld::GmstInt iCrimeAttack("iCrimeAttack");
+        const MWWorld::GmstInt iCrimeKilling("iCrimeKilling");
+        const MWWorld::GmstInt iCrimePickPocket("iCrimePickPocket");
+        const MWWorld::GmstInt iCrimeTresspass("iCrimeTresspass");
+        const MWWorld::GmstFloat iDispAttackMod("iDispAttackMod");
+        const MWWorld::GmstFloat iDispKilling("iDispKilling");
+        const MWWorld::GmstFloat iDispTresspass("iDispTresspass");
+        const MWWorld::GmstInt iFightAttack("iFightAttack");
+        const MWWorld::GmstInt iFightAttacking("iFightAttacking");
+        const MWWorld::GmstInt iFightKilling("iFightKilling");
+        const MWWorld::GmstInt iFightPickpocket("iFightPickpocket");
+        const MWWorld::GmstInt iFightTrespass("iFightTrespass");
+        const MWWorld::GmstFloat iPerMinChance("iPerMinChance");
+        const MWWorld::GmstFloat iPerMinChange("iPerMinChange");
+        const MWWorld::GmstInt iWereWolfBounty("iWereWolfBounty");
+    }
 
     float getFightDispositionBias(float disposition)
     {
-        static const float fFightDispMult = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find(
-                    "fFightDispMult")->getFloat();
+        const float fFightDispMult = Gmst::fFightDispMult.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
         return ((50.f - disposition)  * fFightDispMult);
     }
 
     void getPersuasionRatings(const MWMechanics::NpcStats& stats, float& rating1, float& rating2, float& rating3, bool player)
     {
-        const MWWorld::Store<ESM::GameSetting> &gmst =
-            MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
+        const MWWorld::GameSettingsCache& gmst = MWBase::Environment::get().getWorld()->getStore().getGameSettings();
 
-        float persTerm = stats.getAttribute(ESM::Attribute::Personality).getModified() / gmst.find("fPersonalityMod")->getFloat();
-        float luckTerm = stats.getAttribute(ESM::Attribute::Luck).getModified() / gmst.find("fLuckMod")->getFloat();
-        float repTerm = stats.getReputation() * gmst.find("fReputationMod")->getFloat();
+        float persTerm = stats.getAttribute(ESM::Attribute::Personality).getModified() / Gmst::fPersonalityMod.get(gmst);
+        float luckTerm = stats.getAttribute(ESM::Attribute::Luck).getModified() / Gmst::fLuckMod.get(gmst);
+        float repTerm = stats.getReputation() * Gmst::fReputationMod.get(gmst);
         float fatigueTerm = stats.getFatigueTerm();
-        float levelTerm = stats.getLevel() * gmst.find("fLevelMod")->getFloat();
+        float levelTerm = stats.getLevel() * Gmst::fLevelMod.get(gmst);
 
         rating1 = (repTerm + luckTerm + persTerm + stats.getSkill(ESM::Skill::Speechcraft).getModified()) * fatigueTerm;
 
@@ -238,7 +288,7 @@ namespace MWMechanics
     // mWatchedTimeToStartDrowning = -1 for correct drowning state check,
     // if stats.getTimeToStartDrowning() == 0 already on game start
     MechanicsManager::MechanicsManager()
-    : mWatchedTimeToStartDrowning(-1), mWatchedStatsEmpty (true), mUpdatePlayer (true), mClassSelected (false),
+    : mWatchedLevel(0), mWatchedTimeToStartDrowning(-1), mWatchedStatsEmpty (true), mUpdatePlayer (true), mClassSelected (false),
       mRaceSelected (false), mAI(true)
     {
         //buildPlayer no longer here, needs to be done explicitly after all subsystems are up and running
@@ -297,44 +347,38 @@ namespace MWMechanics
         if(!mWatched.isEmpty())
         {
             MWBase::WindowManager *winMgr = MWBase::Environment::get().getWindowManager();
+            MWMechanics::StatChannel& channel = winMgr->getStatChannel();
             const MWMechanics::NpcStats &stats = mWatched.getClass().getNpcStats(mWatched);
             for(int i = 0;i < ESM::Attribute::Length;++i)
             {
                 if(stats.getAttribute(i) != mWatchedAttributes[i] || mWatchedStatsEmpty)
                 {
-                    std::stringstream attrname;
-                    attrname << "AttribVal"<<(i+1);
-
                     mWatchedAttributes[i] = stats.getAttribute(i);
-                    winMgr->setValue(attrname.str(), stats.getAttribute(i));
+                    channel.publish(StatEvent::makeAttribute(i, stats.getAttribute(i)));
                 }
             }
 
             if(stats.getHealth() != mWatchedHealth || mWatchedStatsEmpty)
             {
-                static const std::string hbar("HBar");
                 mWatchedHealth = stats.getHealth();
-                winMgr->setValue(hbar, stats.getHealth());
+                channel.publish(StatEvent::makeDynamic(0, stats.getHealth()));
             }
             if(stats.getMagicka() != mWatchedMagicka || mWatchedStatsEmpty)
             {
-                static const std::string mbar("MBar");
                 mWatchedMagicka = stats.getMagicka();
-                winMgr->setValue(mbar, stats.getMagicka());
+                channel.publish(StatEvent::makeDynamic(1, stats.getMagicka()));
             }
             if(stats.getFatigue() != mWatchedFatigue || mWatchedStatsEmpty)
             {
-                static const std::string fbar("FBar");
                 mWatchedFatigue = stats.getFatigue();
-                winMgr->setValue(fbar, stats.getFatigue());
+                channel.publish(StatEvent::makeDynamic(2, stats.getFatigue()));
             }
 
             float timeToDrown = stats.getTimeToStartDrowning();
 
             if(timeToDrown != mWatchedTimeToStartDrowning)
             {
-                static const float fHoldBreathTime = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>()
-                        .find("fHoldBreathTime")->getFloat();
+                const float fHoldBreathTime = Gmst::fHoldBreathTime.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
 
                 mWatchedTimeToStartDrowning = timeToDrown;
 
@@ -353,11 +397,15 @@ namespace MWMechanics
                 if(stats.getSkill(i) != mWatchedSkills[i] || mWatchedStatsEmpty)
                 {
                     mWatchedSkills[i] = stats.getSkill(i);
-                    winMgr->setValue((ESM::Skill::SkillEnum)i, stats.getSkill(i));
+                    channel.publish(StatEvent::makeSkill(i, stats.getSkill(i)));
                 }
             }
 
-            winMgr->setValue("level", stats.getLevel());
+            if(stats.getLevel() != mWatchedLevel || mWatchedStatsEmpty)
+            {
+                mWatchedLevel = stats.getLevel();
+                channel.publish(StatEvent::makeLevel(stats.getLevel()));
+            }
 
             mWatchedStatsEmpty = false;
 
@@ -395,9 +443,10 @@ namespace MWMechanics
             const ESM::Class *cls =
                 world->getStore().get<ESM::Class>().find(player->mClass);
 
-            winMgr->setValue ("name", player->mName);
-            winMgr->setValue ("race", race->mName);
-            winMgr->setValue ("class", cls->mName);
+            MWMechanics::StatChannel& channel = winMgr->getStatChannel();
+            channel.publish(StatEvent::makeText(StatEvent::Type_Name, player->mName));
+            channel.publish(StatEvent::makeText(StatEvent::Type_Race, race->mName));
+            channel.publish(StatEvent::makeText(StatEvent::Type_Class, cls->mName));
 
             mUpdatePlayer = false;
 
@@ -534,13 +583,13 @@ namespace MWMechanics
         MWWorld::LiveCellRef<ESM::NPC>* player = playerPtr.get<ESM::NPC>();
         const MWMechanics::NpcStats &playerStats = playerPtr.getClass().getNpcStats(playerPtr);
 
-        const MWWorld::Store<ESM::GameSetting>& gmst = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
-        static const float fDispRaceMod = gmst.find("fDispRaceMod")->getFloat();
+        const MWWorld::GameSettingsCache& gmst = MWBase::Environment::get().getWorld()->getStore().getGameSettings();
+        const float fDispRaceMod = Gmst::fDispRaceMod.get(gmst);
         if (Misc::StringUtils::ciEqual(npc->mBase->mRace, player->mBase->mRace))
             x += fDispRaceMod;
 
-        static const float fDispPersonalityMult = gmst.find("fDispPersonalityMult")->getFloat();
-        static const float fDispPersonalityBase = gmst.find("fDispPersonalityBase")->getFloat();
+        const float fDispPersonalityMult = Gmst::fDispPersonalityMult.get(gmst);
+        const float fDispPersonalityBase = Gmst::fDispPersonalityBase.get(gmst);
         x += fDispPersonalityMult * (playerStats.getAttribute(ESM::Attribute::Personality).getModified() - fDispPersonalityBase);
 
         float reaction = 0;
@@ -584,20 +633,20 @@ namespace MWMechanics
             rank = 0;
         }
 
-        static const float fDispFactionRankMult = gmst.find("fDispFactionRankMult")->getFloat();
-        static const float fDispFactionRankBase = gmst.find("fDispFactionRankBase")->getFloat();
-        static const float fDispFactionMod = gmst.find("fDispFactionMod")->getFloat();
+        const float fDispFactionRankMult = Gmst::fDispFactionRankMult.get(gmst);
+        const float fDispFactionRankBase = Gmst::fDispFactionRankBase.get(gmst);
+        const float fDispFactionMod = Gmst::fDispFactionMod.get(gmst);
         x += (fDispFactionRankMult * rank
             + fDispFactionRankBase)
             * fDispFactionMod * reaction;
 
-        static const float fDispCrimeMod = gmst.find("fDispCrimeMod")->getFloat();
-        static const float fDispDiseaseMod = gmst.find("fDispDiseaseMod")->getFloat();
+        const float fDispCrimeMod = Gmst::fDispCrimeMod.get(gmst);
+        const float fDispDiseaseMod = Gmst::fDispDiseaseMod.get(gmst);
         x -= fDispCrimeMod * playerStats.getBounty();
         if (playerStats.hasCommonDisease() || playerStats.hasBlightDisease())
             x += fDispDiseaseMod;
 
-        static const float fDispWeaponDrawn = gmst.find("fDispWeaponDrawn")->getFloat();
+        const float fDispWeaponDrawn = Gmst::fDispWeaponDrawn.get(gmst);
         if (playerStats.getDrawState() == MWMechanics::DrawState_Weapon)
             x += fDispWeaponDrawn;
 
@@ -654,8 +703,7 @@ namespace MWMechanics
 
     void MechanicsManager::getPersuasionDispositionChange (const MWWorld::Ptr& npc, PersuasionType type, bool& success, float& tempChange, float& permChange)
     {
-        const MWWorld::Store<ESM::GameSetting> &gmst =
-            MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
+        const MWWorld::GameSettingsCache& gmst = MWBase::Environment::get().getWorld()->getStore().getGameSettings();
 
         MWMechanics::NpcStats& npcStats = npc.getClass().getNpcStats(npc);
 
@@ -675,16 +723,16 @@ namespace MWMechanics
         float target2 = d * (playerRating2 - npcRating2 + 50);
 
         float bribeMod;
-        if (type == PT_Bribe10) bribeMod = gmst.find("fBribe10Mod")->getFloat();
-        else if (type == PT_Bribe100) bribeMod = gmst.find("fBribe100Mod")->getFloat();
-        else bribeMod = gmst.find("fBribe1000Mod")->getFloat();
+        if (type == PT_Bribe10) bribeMod = Gmst::fBribe10Mod.get(gmst);
+        else if (type == PT_Bribe100) bribeMod = Gmst::fBribe100Mod.get(gmst);
+        else bribeMod = Gmst::fBribe1000Mod.get(gmst);
 
         float target3 = d * (playerRating3 - npcRating3 + 50) + bribeMod;
 
-        float iPerMinChance = floor(gmst.find("iPerMinChance")->getFloat());
-        float iPerMinChange = floor(gmst.find("iPerMinChange")->getFloat());
-        float fPerDieRollMult = gmst.find("fPerDieRollMult")->getFloat();
-        float fPerTempMult = gmst.find("fPerTempMult")->getFloat();
+        float iPerMinChance = floor(Gmst::iPerMinChance.get(gmst));
+        float iPerMinChange = floor(Gmst::iPerMinChange.get(gmst));
+        float fPerDieRollMult = Gmst::fPerDieRollMult.get(gmst);
+        float fPerTempMult = Gmst::fPerTempMult.get(gmst);
 
         float x = 0;
         float y = 0;
@@ -1141,7 +1189,7 @@ namespace MWMechanics
 
         osg::Vec3f from (player.getRefData().getPosition().asVec3());
         const MWWorld::ESMStore& esmStore = MWBase::Environment::get().getWorld()->getStore();
-        float radius = esmStore.get<ESM::GameSetting>().find("fAlarmRadius")->getFloat();
+        float radius = Gmst::fAlarmRadius.get(esmStore.getGameSettings());
 
         mActors.getObjectsInRange(from, radius, neighbors);
 
@@ -1205,7 +1253,7 @@ namespace MWMechanics
 
     void MechanicsManager::reportCrime(const MWWorld::Ptr &player, const MWWorld::Ptr &victim, OffenseType type, int arg)
     {
-        const MWWorld::Store<ESM::GameSetting>& store = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
+        const MWWorld::GameSettingsCache& store = MWBase::Environment::get().getWorld()->getStore().getGameSettings();
 
         if (type == OT_Murder && !victim.isEmpty())
             victim.getClass().getCreatureStats(victim).notifyMurder();
@@ -1214,29 +1262,29 @@ namespace MWMechanics
         float disp = 0.f, dispVictim = 0.f;
         if (type == OT_Trespassing || type == OT_SleepingInOwnedBed)
         {
-            arg = store.find("iCrimeTresspass")->getInt();
-            disp = dispVictim = store.find("iDispTresspass")->getFloat();
+            arg = Gmst::iCrimeTresspass.get(store);
+            disp = dispVictim = Gmst::iDispTresspass.get(store);
         }
         else if (type == OT_Pickpocket)
         {
-            arg = store.find("iCrimePickPocket")->getInt();
-            disp = dispVictim = store.find("fDispPickPocketMod")->getFloat();
+            arg = Gmst::iCrimePickPocket.get(store);
+            disp = dispVictim = Gmst::fDispPickPocketMod.get(store);
         }
         else if (type == OT_Assault)
         {
-            arg = store.find("iCrimeAttack")->getInt();
-            disp = store.find("iDispAttackMod")->getFloat();
-            dispVictim = store.find("fDispAttacking")->getFloat();
+            arg = Gmst::iCrimeAttack.get(store);
+            disp = Gmst::iDispAttackMod.get(store);
+            dispVictim = Gmst::fDispAttacking.get(store);
         }
         else if (type == OT_Murder)
         {
-            arg = store.find("iCrimeKilling")->getInt();
-            disp = dispVictim = store.find("iDispKilling")->getFloat();
+            arg = Gmst::iCrimeKilling.get(store);
+            disp = dispVictim = Gmst::iDispKilling.get(store);
         }
         else if (type == OT_Theft)
         {
-            disp = dispVictim = store.find("fDispStealing")->getFloat() * arg;
-            arg = static_cast<int>(arg * store.find("fCrimeStealing")->getFloat());
+            disp = dispVictim = Gmst::fDispStealing.get(store) * arg;
+            arg = static_cast<int>(arg * Gmst::fCrimeStealing.get(store));
             arg = std::max(1, arg); // Minimum bounty of 1, in case items with zero value are stolen
         }
 
@@ -1246,7 +1294,7 @@ namespace MWMechanics
         const MWWorld::ESMStore& esmStore = MWBase::Environment::get().getWorld()->getStore();
 
         osg::Vec3f from (player.getRefData().getPosition().asVec3());
-        float radius = esmStore.get<ESM::GameSetting>().find("fAlarmRadius")->getFloat();
+        float radius = Gmst::fAlarmRadius.get(esmStore.getGameSettings());
 
         mActors.getObjectsInRange(from, radius, neighbors);
 
@@ -1260,21 +1308,21 @@ namespace MWMechanics
         // Controls whether witnesses will engage combat with the criminal.
         int fight = 0, fightVictim = 0;
         if (type == OT_Trespassing || type == OT_SleepingInOwnedBed)
-            fight = fightVictim = esmStore.get<ESM::GameSetting>().find("iFightTrespass")->getInt();
+            fight = fightVictim = Gmst::iFightTrespass.get(esmStore.getGameSettings());
         else if (type == OT_Pickpocket)
         {
-            fight = esmStore.get<ESM::GameSetting>().find("iFightPickpocket")->getInt();
-            fightVictim = esmStore.get<ESM::GameSetting>().find("iFightPickpocket")->getInt() * 4; // *4 according to research wiki
+            fight = Gmst::iFightPickpocket.get(esmStore.getGameSettings());
+            fightVictim = Gmst::iFightPickpocket.get(esmStore.getGameSettings()) * 4; // *4 according to research wiki
         }
         else if (type == OT_Assault)
         {
-            fight = esmStore.get<ESM::GameSetting>().find("iFightAttacking")->getInt();
-            fightVictim = esmStore.get<ESM::GameSetting>().find("iFightAttack")->getInt();
+            fight = Gmst::iFightAttacking.get(esmStore.getGameSettings());
+            fightVictim = Gmst::iFightAttack.get(esmStore.getGameSettings());
         }
         else if (type == OT_Murder)
-            fight = fightVictim = esmStore.get<ESM::GameSetting>().find("iFightKilling")->getInt();
+            fight = fightVictim = Gmst::iFightKilling.get(esmStore.getGameSettings());
         else if (type == OT_Theft)
-            fight = fightVictim = esmStore.get<ESM::GameSetting>().find("fFightStealing")->getInt();
+            fight = fightVictim = Gmst::fFightStealing.get(esmStore.getGameSettings());
 
         bool reported = false;
 
@@ -1490,7 +1538,7 @@ namespace MWMechanics
         if (observer.getClass().getCreatureStats(observer).isDead() || !observer.getRefData().isEnabled())
             return false;
 
-        const MWWorld::Store<ESM::GameSetting>& store = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
+        const MWWorld::GameSettingsCache& store = MWBase::Environment::get().getWorld()->getStore().getGameSettings();
 
         CreatureStats& stats = ptr.getClass().getCreatureStats(ptr);
 
@@ -1503,8 +1551,8 @@ namespace MWMechanics
                 && !MWBase::Environment::get().getWorld()->isSwimming(ptr)
                 && MWBase::Environment::get().getWorld()->isOnGround(ptr))
         {
-            static float fSneakSkillMult = store.find("fSneakSkillMult")->getFloat();
-            static float fSneakBootMult = store.find("fSneakBootMult")->getFloat();
+            const float fSneakSkillMult = Gmst::fSneakSkillMult.get(store);
+            const float fSneakBootMult = Gmst::fSneakBootMult.get(store);
             float sneak = static_cast<float>(ptr.getClass().getSkill(ptr, ESM::Skill::Sneak));
             int agility = stats.getAttribute(ESM::Attribute::Agility).getModified();
             int luck = stats.getAttribute(ESM::Attribute::Luck).getModified();
@@ -1519,8 +1567,8 @@ namespace MWMechanics
             sneakTerm = fSneakSkillMult * sneak + 0.2f * agility + 0.1f * luck + bootWeight * fSneakBootMult;
         }
 
-        static float fSneakDistBase = store.find("fSneakDistanceBase")->getFloat();
-        static float fSneakDistMult = store.find("fSneakDistanceMultiplier")->getFloat();
+        const float fSneakDistBase = Gmst::fSneakDistanceBase.get(store);
+        const float fSneakDistMult = Gmst::fSneakDistanceMultiplier.get(store);
 
         osg::Vec3f pos1 (ptr.getRefData().getPosition().asVec3());
         osg::Vec3f pos2 (observer.getRefData().getPosition().asVec3());
@@ -1538,8 +1586,8 @@ namespace MWMechanics
         float obsTerm = obsSneak + 0.2f * obsAgility + 0.1f * obsLuck - obsBlind;
 
         // is ptr behind the observer?
-        static float fSneakNoViewMult = store.find("fSneakNoViewMult")->getFloat();
-        static float fSneakViewMult = store.find("fSneakViewMult")->getFloat();
+        const float fSneakNoViewMult = Gmst::fSneakNoViewMult.get(store);
+        const float fSneakViewMult = Gmst::fSneakViewMult.get(store);
         float y = 0;
         osg::Vec3f vec = pos1 - pos2;
         if (observer.getRefData().getBaseNode())
@@ -1783,8 +1831,8 @@ namespace MWMechanics
 
             // Witnesses of the player's transformation will make them a globally known werewolf
             std::vector<MWWorld::Ptr> closeActors;
-            const MWWorld::Store<ESM::GameSetting>& gmst = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
-            getActorsInRange(actor.getRefData().getPosition().asVec3(), gmst.find("fAlarmRadius")->getFloat(), closeActors);
+            const MWWorld::GameSettingsCache& gmst = MWBase::Environment::get().getWorld()->getStore().getGameSettings();
+            getActorsInRange(actor.getRefData().getPosition().asVec3(), Gmst::fAlarmRadius.get(gmst), closeActors);
 
             bool detected = false, reported = false;
             for (std::vector<MWWorld::Ptr>::const_iterator it = closeActors.begin(); it != closeActors.end(); ++it)
@@ -1809,7 +1857,7 @@ namespace MWMechanics
                 if (reported)
                 {
                     npcStats.setBounty(npcStats.getBounty()+
-                                       gmst.find("iWereWolfBounty")->getInt());
+                                       Gmst::iWereWolfBounty.get(gmst));
                     windowManager->messageBox("#{sCrimeMessage}");
                 }
             }
@@ -1818,10 +1866,10 @@ namespace MWMechanics
 
     void MechanicsManager::applyWerewolfAcrobatics(const MWWorld::Ptr &actor)
     {
-        const MWWorld::Store<ESM::GameSetting>& gmst = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
+        const MWWorld::GameSettingsCache& gmst = MWBase::Environment::get().getWorld()->getStore().getGameSettings();
         MWMechanics::NpcStats &stats = actor.getClass().getNpcStats(actor);
 
-        stats.getSkill(ESM::Skill::Acrobatics).setBase(gmst.find("fWerewolfAcrobatics")->getInt());
+        stats.getSkill(ESM::Skill::Acrobatics).setBase(Gmst::fWerewolfAcrobatics.get(gmst));
     }
 
     void MechanicsManager::cleanupSummonedCreature(const MWWorld::Ptr &caster, int creatureActorId)
@@ -28,6 +28,8 @@ namespace MWMechanics
             DynamicStat<float> mWatchedMagicka;
             DynamicStat<float> mWatchedFatigue;
 
+            int mWatchedLevel;
+
             float mWatchedTimeToStartDrowning;
 
             bool mWatchedStatsEmpty;
@@ -16,6 +16,25 @@
 #include "../mwbase/world.hpp"
 #include "../mwbase/windowmanager.hpp"
 
+namespace
+{
+    namespace Gmst
+    {
+        const MWWorld::GmstFloat fLevelUpHealthEndMult("fLevelUpHealthEndMult");
+        const MWWorld::GmstFloat fMajorSkillBonus("fMajorSkillBonus");
+        const MWWorld::GmstFloat fMinorSkillBonus("fMinorSkillBonus");
+        const MWWorld::GmstFloat fMiscSkillBonus("fMiscSkillBonus");
+        const MWWorld::GmstFloat fSpecialSkillBonus("fSpecialSkillBonus");
+        const MWWorld::GmstInt iLevelUpMajorMult("iLevelUpMajorMult");
+        const MWWorld::GmstInt iLevelUpMajorMultAttribute("iLevelUpMajorMultAttribute");
+        const MWWorld::GmstInt iLevelUpMinorMult("iLevelUpMinorMult");
+        const MWWorld::GmstInt iLevelUpMinorMultAttribute("iLevelUpMinorMultAttribute");
+        const MWWorld::GmstInt iLevelUpTotal("iLevelUpTotal");
+        const MWWorld::GmstInt iLevelupMiscMultAttriubte("iLevelupMiscMultAttriubte");
+        const MWWorld::GmstInt iLevelupSpecialization("iLevelupSpecialization");
+    }
+}
+
 MWMechanics::NpcStats::NpcStats()
     : mDisposition (0)
 , mReputation(0)
@@ -146,15 +165,14 @@ float MWMechanics::NpcStats::getSkillProgressRequirement (int skillIndex, const
 {
     float progressRequirement = static_cast<float>(1 + getSkill(skillIndex).getBase());
 
-    const MWWorld::Store<ESM::GameSetting> &gmst =
-        MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
+    const MWWorld::GameSettingsCache& gmst = MWBase::Environment::get().getWorld()->getStore().getGameSettings();
 
-    float typeFactor = gmst.find ("fMiscSkillBonus")->getFloat();
+    float typeFactor = Gmst::fMiscSkillBonus.get(gmst);
 
     for (int i=0; i<5; ++i)
         if (class_.mData.mSkills[i][0]==skillIndex)
         {
-            typeFactor = gmst.find ("fMinorSkillBonus")->getFloat();
+            typeFactor = Gmst::fMinorSkillBonus.get(gmst);
 
             break;
         }
@@ -162,7 +180,7 @@ float MWMechanics::NpcStats::getSkillProgressRequirement (int skillIndex, const
     for (int i=0; i<5; ++i)
         if (class_.mData.mSkills[i][1]==skillIndex)
         {
-            typeFactor = gmst.find ("fMajorSkillBonus")->getFloat();
+            typeFactor = Gmst::fMajorSkillBonus.get(gmst);
 
             break;
         }
@@ -178,7 +196,7 @@ float MWMechanics::NpcStats::getSkillProgressRequirement (int skillIndex, const
         MWBase::Environment::get().getWorld()->getStore().get<ESM::Skill>().find (skillIndex);
     if (skill->mData.mSpecialization==class_.mData.mSpecialization)
     {
-        specialisationFactor = gmst.find ("fSpecialSkillBonus")->getFloat();
+        specialisationFactor = Gmst::fSpecialSkillBonus.get(gmst);
 
         if (specialisationFactor<=0)
             throw std::runtime_error ("invalid skill specialisation factor");
@@ -223,25 +241,24 @@ void MWMechanics::NpcStats::increaseSkill(int skillIndex, const ESM::Class &clas
 
     base += 1;
 
-    const MWWorld::Store<ESM::GameSetting> &gmst =
-        MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
+    const MWWorld::GameSettingsCache& gmst = MWBase::Environment::get().getWorld()->getStore().getGameSettings();
 
     // is this a minor or major skill?
-    int increase = gmst.find("iLevelupMiscMultAttriubte")->getInt(); // Note: GMST has a typo
+    int increase = Gmst::iLevelupMiscMultAttriubte.get(gmst); // Note: GMST has a typo
     for (int k=0; k<5; ++k)
     {
         if (class_.mData.mSkills[k][0] == skillIndex)
         {
-            mLevelProgress += gmst.find("iLevelUpMinorMult")->getInt();
-            increase = gmst.find("iLevelUpMajorMultAttribute")->getInt();
+            mLevelProgress += Gmst::iLevelUpMinorMult.get(gmst);
+            increase = Gmst::iLevelUpMajorMultAttribute.get(gmst);
         }
     }
     for (int k=0; k<5; ++k)
     {
         if (class_.mData.mSkills[k][1] == skillIndex)
         {
-            mLevelProgress += gmst.find("iLevelUpMajorMult")->getInt();
-            increase = gmst.find("iLevelUpMinorMultAttribute")->getInt();
+            mLevelProgress += Gmst::iLevelUpMajorMult.get(gmst);
+            increase = Gmst::iLevelUpMinorMultAttribute.get(gmst);
         }
     }
 
@@ -249,7 +266,7 @@ void MWMechanics::NpcStats::increaseSkill(int skillIndex, const ESM::Class &clas
         MWBase::Environment::get().getWorld ()->getStore ().get<ESM::Skill>().find(skillIndex);
     mSkillIncreases[skill->mData.mAttribute] += increase;
 
-    mSpecIncreases[skill->mData.mSpecialization] += gmst.find("iLevelupSpecialization")->getInt();
+    mSpecIncreases[skill->mData.mSpecialization] += Gmst::iLevelupSpecialization.get(gmst);
 
     // Play sound & skill progress notification
     /// \todo check if character is the player, if levelling is ever implemented for NPCs
@@ -266,7 +283,7 @@ void MWMechanics::NpcStats::increaseSkill(int skillIndex, const ESM::Class &clas
     
     MWBase::Environment::get().getWindowManager ()->messageBox(message.str(), MWGui::ShowInDialogueMode_Never);
 
-    if (mLevelProgress >= gmst.find("iLevelUpTotal")->getInt())
+    if (mLevelProgress >= Gmst::iLevelUpTotal.get(gmst))
     {
         // levelup is possible now
         MWBase::Environment::get().getWindowManager ()->messageBox ("#{sLevelUpMsg}", MWGui::ShowInDialogueMode_Never);
@@ -284,10 +301,9 @@ int MWMechanics::NpcStats::getLevelProgress () const
 
 void MWMechanics::NpcStats::levelUp()
 {
-    const MWWorld::Store<ESM::GameSetting> &gmst =
-        MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
+    const MWWorld::GameSettingsCache& gmst = MWBase::Environment::get().getWorld()->getStore().getGameSettings();
 
-    mLevelProgress -= gmst.find("iLevelUpTotal")->getInt();
+    mLevelProgress -= Gmst::iLevelUpTotal.get(gmst);
     mLevelProgress = std::max(0, mLevelProgress); // might be necessary when levelup was invoked via console
 
     for (int i=0; i<ESM::Attribute::Length; ++i)
@@ -298,7 +314,7 @@ void MWMechanics::NpcStats::levelUp()
     // "When you gain a level, in addition to increasing three primary attributes, your Health
     // will automatically increase by 10% of your Endurance attribute. If you increased Endurance this level,
     // the Health increase is calculated from the increased Endurance"
-    setHealth(getHealth().getBase() + endurance * gmst.find("fLevelUpHealthEndMult")->getFloat());
+    setHealth(getHealth().getBase() + endurance * Gmst::fLevelUpHealthEndMult.get(gmst));
 
     setLevel(getLevel()+1);
 }
@@ -10,6 +10,16 @@
 
 #include "npcstats.hpp"
 
+namespace
+{
+    namespace Gmst
+    {
+        const MWWorld::GmstFloat fPickPocketMod("fPickPocketMod");
+        const MWWorld::GmstInt iPickMaxChance("iPickMaxChance");
+        const MWWorld::GmstInt iPickMinChance("iPickMinChance");
+    }
+}
+
 namespace MWMechanics
 {
 
@@ -36,10 +46,8 @@ namespace MWMechanics
         float t = 2*x - y;
 
         float pcSneak = static_cast<float>(mThief.getClass().getSkill(mThief, ESM::Skill::Sneak));
-        int iPickMinChance = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>()
-                .find("iPickMinChance")->getInt();
-        int iPickMaxChance = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>()
-                .find("iPickMaxChance")->getInt();
+        int iPickMinChance = Gmst::iPickMinChance.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
+        int iPickMaxChance = Gmst::iPickMaxChance.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
 
         int roll = Misc::Rng::roll0to99();
         if (t < pcSneak / iPickMinChance)
@@ -56,8 +64,7 @@ namespace MWMechanics
     bool Pickpocket::pick(MWWorld::Ptr item, int count)
     {
         float stackValue = static_cast<float>(item.getClass().getValue(item) * count);
-        float fPickPocketMod = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>()
-                .find("fPickPocketMod")->getFloat();
+        float fPickPocketMod = Gmst::fPickPocketMod.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
         float valueTerm = 10 * fPickPocketMod * stackValue;
 
         return getDetected(valueTerm);
@@ -17,6 +17,15 @@
 #include "npcstats.hpp"
 #include "actorutil.hpp"
 
+namespace
+{
+    namespace Gmst
+    {
+        const MWWorld::GmstFloat fRepairAmountMult("fRepairAmountMult");
+        const MWWorld::GmstString sNotifyMessage51("sNotifyMessage51");
+    }
+}
+
 namespace MWMechanics
 {
 
@@ -41,8 +50,7 @@ void Repair::repair(const MWWorld::Ptr &itemToRepair)
     int pcLuck = stats.getAttribute(ESM::Attribute::Luck).getModified();
     int armorerSkill = npcStats.getSkill(ESM::Skill::Armorer).getModified();
 
-    float fRepairAmountMult = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>()
-            .find("fRepairAmountMult")->getFloat();
+    float fRepairAmountMult = Gmst::fRepairAmountMult.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
 
     float toolQuality = ref->mBase->mData.mQuality;
 
@@ -86,8 +94,7 @@ void Repair::repair(const MWWorld::Ptr &itemToRepair)
 
         store.remove(mTool, 1, player);
 
-        std::string message = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>()
-                .find("sNotifyMessage51")->getString();
+        std::string message = Gmst::sNotifyMessage51.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
 
         MWBase::Environment::get().getWindowManager()->messageBox((boost::format(message) % mTool.getClass().getName(mTool)).str());
 
@@ -14,6 +14,15 @@
 #include "npcstats.hpp"
 #include "creaturestats.hpp"
 
+namespace
+{
+    namespace Gmst
+    {
+        const MWWorld::GmstFloat fPickLockMult("fPickLockMult");
+        const MWWorld::GmstFloat fTrapCostMult("fTrapCostMult");
+    }
+}
+
 namespace MWMechanics
 {
 
@@ -38,7 +47,7 @@ namespace MWMechanics
 
         float pickQuality = lockpick.get<ESM::Lockpick>()->mBase->mData.mQuality;
 
-        float fPickLockMult = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fPickLockMult")->getFloat();
+        float fPickLockMult = Gmst::fPickLockMult.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
 
         float x = 0.2f * mAgility + 0.1f * mLuck + mSecuritySkill;
         x *= pickQuality * mFatigueTerm;
@@ -79,7 +88,7 @@ namespace MWMechanics
         const ESM::Spell* trapSpell = MWBase::Environment::get().getWorld()->getStore().get<ESM::Spell>().find(trap.getCellRef().getTrap());
         int trapSpellPoints = trapSpell->mData.mCost;
 
-        float fTrapCostMult = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("fTrapCostMult")->getFloat();
+        float fTrapCostMult = Gmst::fTrapCostMult.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
 
         float x = 0.2f * mAgility + 0.1f * mLuck + mSecuritySkill;
         x += fTrapCostMult * trapSpellPoints;
@@ -29,6 +29,18 @@
 #include "actorutil.hpp"
 #include "aifollow.hpp"
 
+namespace
+{
+    namespace Gmst
+    {
+        const MWWorld::GmstFloat fEffectCostMult("fEffectCostMult");
+        const MWWorld::GmstFloat fFatigueSpellBase("fFatigueSpellBase");
+        const MWWorld::GmstFloat fFatigueSpellMult("fFatigueSpellMult");
+        const MWWorld::GmstFloat fMagicSunBlockedMult("fMagicSunBlockedMult");
+        const MWWorld::GmstString sNotifyMessage50("sNotifyMessage50");
+    }
+}
+
 namespace MWMechanics
 {
     ESM::Skill::SkillEnum spellSchoolToSkill(int school)
@@ -60,8 +72,7 @@ namespace MWMechanics
         if (!(magicEffect->mData.mFlags & ESM::MagicEffect::NoDuration))
             duration = effect.mDuration;
 
-        static const float fEffectCostMult = MWBase::Environment::get().getWorld()->getStore()
-            .get<ESM::GameSetting>().find("fEffectCostMult")->getFloat();
+        const float fEffectCostMult = Gmst::fEffectCostMult.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
 
         float x = 0.5 * (std::max(1, minMagn) + std::max(1, maxMagn));
         x *= 0.1 * magicEffect->mData.mBaseCost;
@@ -91,8 +102,7 @@ namespace MWMechanics
             x *= it->mArea * 0.05f * magicEffect->mData.mBaseCost;
             if (it->mRange == ESM::RT_Target)
                 x *= 1.5f;
-            static const float fEffectCostMult = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find(
-                        "fEffectCostMult")->getFloat();
+            const float fEffectCostMult = Gmst::fEffectCostMult.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
             x *= fEffectCostMult;
 
             float s = 2.0f * actor.getClass().getSkill(actor, spellSchoolToSkill(magicEffect->mData.mSchool));
@@ -570,7 +580,8 @@ namespace MWMechanics
                                     ActiveSpells::ActiveEffect effect_ = effect;
                                     effect_.mMagnitude *= -1;
                                     absorbEffects.push_back(effect_);
-                                    if (reflected && Settings::Manager::getBool("classic reflect absorb attribute behavior", "Game"))
+                                    static const Settings::Handle<bool> classicReflectAbsorb("classic reflect absorb attribute behavior", "Game");
+                                    if (reflected && classicReflectAbsorb.get())
                                         target.getClass().getCreatureStats(target).getActiveSpells().addSpell("", true,
                                             absorbEffects, mSourceName, caster.getClass().getCreatureStats(caster).getActorId());
                                     else
@@ -876,8 +887,8 @@ namespace MWMechanics
             if (!godmode)
             {
                 // Reduce fatigue (note that in the vanilla game, both GMSTs are 0, and there's no fatigue loss)
-                static const float fFatigueSpellBase = store.get<ESM::GameSetting>().find("fFatigueSpellBase")->getFloat();
-                static const float fFatigueSpellMult = store.get<ESM::GameSetting>().find("fFatigueSpellMult")->getFloat();
+                const float fFatigueSpellBase = Gmst::fFatigueSpellBase.get(store.getGameSettings());
+                const float fFatigueSpellMult = Gmst::fFatigueSpellMult.get(store.getGameSettings());
                 DynamicStat<float> fatigue = stats.getFatigue();
                 const float normalizedEncumbrance = mCaster.getClass().getNormalizedEncumbrance(mCaster);
 
@@ -961,7 +972,7 @@ namespace MWMechanics
         if (roll > x)
         {
             // "X has no effect on you"
-            std::string message = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find("sNotifyMessage50")->getString();
+            std::string message = Gmst::sNotifyMessage50.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
             message = boost::str(boost::format(message) % ingredient->mName);
             MWBase::Environment::get().getWindowManager()->messageBox(message);
             return false;
@@ -1193,8 +1204,7 @@ namespace MWMechanics
             float timeDiff = std::min(7.f, std::max(0.f, std::abs(time - 13)));
             float damageScale = 1.f - timeDiff / 7.f;
             // When cloudy, the sun damage effect is halved
-            static float fMagicSunBlockedMult = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find(
-                        "fMagicSunBlockedMult")->getFloat();
+            const float fMagicSunBlockedMult = Gmst::fMagicSunBlockedMult.get(MWBase::Environment::get().getWorld()->getStore().getGameSettings());
 
             int weather = MWBase::Environment::get().getWorld()->getCurrentWeather();
             if (weather > 1)
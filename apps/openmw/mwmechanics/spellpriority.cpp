@@ -20,6 +20,11 @@
 
 namespace
 {
+    namespace Gmst
+    {
+        const MWWorld::GmstFloat fAIMagicSpellMult("fAIMagicSpellMult");
+        const MWWorld::GmstFloat fAIRangeMagicSpellMult("fAIRangeMagicSpellMult");
+    }
     int numEffectsToDispel (const MWWorld::Ptr& actor, int effectFilter=-1, bool negative = true)
     {
         int toCure=0;
@@ -588,10 +593,10 @@ namespace MWMechanics
 
     float vanillaRateSpell(const ESM::Spell* spell, const MWWorld::Ptr& actor, const MWWorld::Ptr& enemy)
     {
-        const MWWorld::Store<ESM::GameSetting>& gmst = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
+        const MWWorld::GameSettingsCache& gmst = MWBase::Environment::get().getWorld()->getStore().getGameSettings();
 
-        static const float fAIMagicSpellMult = gmst.find("fAIMagicSpellMult")->getFloat();
-        static const float fAIRangeMagicSpellMult = gmst.find("fAIRangeMagicSpellMult")->getFloat();
+        const float fAIMagicSpellMult = Gmst::fAIMagicSpellMult.get(gmst);
+        const float fAIRangeMagicSpellMult = Gmst::fAIRangeMagicSpellMult.get(gmst);
 
         float mult = fAIMagicSpellMult;
 
@@ -0,0 +1,136 @@
+#include "statchannel.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <components/esm/attr.hpp>
+#include <components/esm/loadskil.hpp>
+
+MWMechanics::StatEvent::StatEvent()
+: mType (Type_Level), mIndex (0), mInt (0)
+{}
+
+MWMechanics::StatEvent MWMechanics::StatEvent::makeAttribute (int attribute, const AttributeValue& value)
+{
+    StatEvent event;
+    event.mType = Type_Attribute;
+    event.mIndex = attribute;
+    event.mAttribute = value;
+    return event;
+}
+
+MWMechanics::StatEvent MWMechanics::StatEvent::makeSkill (int skill, const SkillValue& value)
+{
+    StatEvent event;
+    event.mType = Type_Skill;
+    event.mIndex = skill;
+    event.mSkill = value;
+    return event;
+}
+
+MWMechanics::StatEvent MWMechanics::StatEvent::makeDynamic (int index, const DynamicStat<float>& value)
+{
+    StatEvent event;
+    event.mType = Type_Dynamic;
+    event.mIndex = index;
+    event.mDynamic = value;
+    return event;
+}
+
+MWMechanics::StatEvent MWMechanics::StatEvent::makeLevel (int level)
+{
+    StatEvent event;
+    event.mType = Type_Level;
+    event.mInt = level;
+    return event;
+}
+
+MWMechanics::StatEvent MWMechanics::StatEvent::makeText (Type type, const std::string& value)
+{
+    if (type!=Type_Name && type!=Type_Race && type!=Type_Class)
+        throw std::logic_error ("not a text stat");
+
+    StatEvent event;
+    event.mType = type;
+    event.mString = value;
+    return event;
+}
+
+MWMechanics::StatChannel::StatChannel()
+{
+    int sizes[StatEvent::Type_Length] =
+    {
+        ESM::Attribute::Length, ESM::Skill::Length, 3, 1, 1, 1, 1
+    };
+
+    mKeyOffsets[0] = 0;
+    for (int i=0; i<StatEvent::Type_Length; ++i)
+        mKeyOffsets[i+1] = mKeyOffsets[i] + sizes[i];
+
+    mPendingIndex.resize (mKeyOffsets[StatEvent::Type_Length], -1);
+}
+
+int MWMechanics::StatChannel::getKey (const StatEvent& event) const
+{
+    if (event.mType<0 || event.mType>=StatEvent::Type_Length || event.mIndex<0 ||
+        event.mIndex>=mKeyOffsets[event.mType+1]-mKeyOffsets[event.mType])
+        throw std::runtime_error ("invalid stat");
+
+    return mKeyOffsets[event.mType] + event.mIndex;
+}
+
+void MWMechanics::StatChannel::subscribe (StatEvent::Type type, StatListener *listener)
+{
+    std::vector<StatListener *>& listeners = mListeners[type];
+
+    if (std::find (listeners.begin(), listeners.end(), listener)==listeners.end())
+        listeners.push_back (listener);
+}
+
+void MWMechanics::StatChannel::unsubscribe (StatListener *listener)
+{
+    for (int i=0; i<StatEvent::Type_Length; ++i)
+        mListeners[i].erase (std::remove (mListeners[i].begin(), mListeners[i].end(), listener),
+            mListeners[i].end());
+}
+
+void MWMechanics::StatChannel::publish (const StatEvent& event)
+{
+    int& index = mPendingIndex[getKey (event)];
+
+    if (index==-1)
+    {
+        index = static_cast<int> (mPending.size());
+        mPending.push_back (event);
+    }
+    else
+        mPending[index] = event;
+}
+
+void MWMechanics::StatChannel::dispatch()
+{
+    if (mPending.empty())
+        return;
+
+    // listeners may publish new changes, which are delivered by the next dispatch
+    mDispatching.swap (mPending);
+
+    for (std::vector<StatEvent>::const_iterator iter (mDispatching.begin()); iter!=mDispatching.end(); ++iter)
+        mPendingIndex[getKey (*iter)] = -1;
+
+    for (std::vector<StatEvent>::const_iterator iter (mDispatching.begin()); iter!=mDispatching.end(); ++iter)
+    {
+        const std::vector<StatListener *>& listeners = mListeners[iter->mType];
+
+        for (std::vector<StatListener *>::const_iterator listener (listeners.begin());
+            listener!=listeners.end(); ++listener)
+            (*listener)->statChanged (*iter);
+    }
+
+    mDispatching.clear();
+}
+
+std::size_t MWMechanics::StatChannel::getNumPending() const
+{
+    return mPending.size();
+}
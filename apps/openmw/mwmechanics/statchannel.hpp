@@ -0,0 +1,91 @@
+#ifndef GAME_MWMECHANICS_STATCHANNEL_H
+#define GAME_MWMECHANICS_STATCHANNEL_H
+
+#include <string>
+#include <vector>
+
+#include "stat.hpp"
+
+namespace MWMechanics
+{
+    /// A change of a player stat that is shown in the GUI
+    struct StatEvent
+    {
+        enum Type
+        {
+            Type_Attribute, ///< mIndex is the attribute ID, the value is in mAttribute
+            Type_Skill, ///< mIndex is the skill ID, the value is in mSkill
+            Type_Dynamic, ///< mIndex is 0 (health), 1 (magicka) or 2 (fatigue), the value is in mDynamic
+            Type_Level, ///< Value in mInt
+            Type_Name, ///< Value in mString
+            Type_Race, ///< Race ID in mString
+            Type_Class, ///< Class name in mString
+            Type_Length
+        };
+
+        Type mType;
+        int mIndex;
+
+        AttributeValue mAttribute;
+        SkillValue mSkill;
+        DynamicStat<float> mDynamic;
+        int mInt;
+        std::string mString;
+
+        StatEvent();
+
+        static StatEvent makeAttribute (int attribute, const AttributeValue& value);
+        static StatEvent makeSkill (int skill, const SkillValue& value);
+        static StatEvent makeDynamic (int index, const DynamicStat<float>& value);
+        static StatEvent makeLevel (int level);
+
+        /// \param type Type_Name, Type_Race or Type_Class
+        static StatEvent makeText (Type type, const std::string& value);
+    };
+
+    class StatListener
+    {
+        public:
+
+            virtual ~StatListener() {}
+
+            virtual void statChanged (const StatEvent& event) = 0;
+    };
+
+    /// \brief Delivers stat changes to the listeners that subscribed to their type
+    ///
+    /// Changes are queued until dispatch() is called. If a stat changes more than once in
+    /// between, only its last value is delivered.
+    class StatChannel
+    {
+            std::vector<StatListener *> mListeners[StatEvent::Type_Length];
+
+            std::vector<StatEvent> mPending;
+            std::vector<StatEvent> mDispatching;
+
+            /// Index in mPending for each stat, -1 if the stat has not changed
+            std::vector<int> mPendingIndex;
+
+            /// First key of each type
+            int mKeyOffsets[StatEvent::Type_Length+1];
+
+            int getKey (const StatEvent& event) const;
+
+        public:
+
+            StatChannel();
+
+            void subscribe (StatEvent::Type type, StatListener *listener);
+
+            /// Remove \a listener from all types.
+            void unsubscribe (StatListener *listener);
+
+            void publish (const StatEvent& event);
+
+            void dispatch();
+
+            std::size_t getNumPending() const;
+    };
+}
+
+#endif
@@ -11,6 +11,16 @@
 
 #include "creaturestats.hpp"
 
+namespace
+{
+    namespace Gmst
+    {
+        const MWWorld::GmstFloat fBargainOfferBase("fBargainOfferBase");
+        const MWWorld::GmstFloat fBargainOfferMulti("fBargainOfferMulti");
+        const MWWorld::GmstFloat fDispositionMod("fDispositionMod");
+    }
+}
+
 namespace MWMechanics
 {
     Trading::Trading() {}
@@ -27,8 +37,7 @@ namespace MWMechanics
             return false;
         }
 
-        const MWWorld::Store<ESM::GameSetting> &gmst =
-            MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
+        const MWWorld::GameSettingsCache& gmst = MWBase::Environment::get().getWorld()->getStore().getGameSettings();
 
         // Is the player buying?
         bool buying = (merchantOffer < 0);
@@ -51,11 +60,11 @@ namespace MWMechanics
         float e1 = 0.1f * merchantStats.getAttribute(ESM::Attribute::Luck).getModified();
         float f1 = 0.2f * merchantStats.getAttribute(ESM::Attribute::Personality).getModified();
 
-        float dispositionTerm = gmst.find("fDispositionMod")->getFloat() * (clampedDisposition - 50);
+        float dispositionTerm = Gmst::fDispositionMod.get(gmst) * (clampedDisposition - 50);
         float pcTerm = (dispositionTerm + a1 + b1 + c1) * playerStats.getFatigueTerm();
         float npcTerm = (d1 + e1 + f1) * merchantStats.getFatigueTerm();
-        float x = gmst.find("fBargainOfferMulti")->getFloat() * d
-            + gmst.find("fBargainOfferBase")->getFloat()
+        float x = Gmst::fBargainOfferMulti.get(gmst) * d
+            + Gmst::fBargainOfferBase.get(gmst)
             + std::abs(int(pcTerm - npcTerm));
 
         int roll = Misc::Rng::rollDice(100) + 1;
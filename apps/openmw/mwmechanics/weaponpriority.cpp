@@ -16,6 +16,16 @@
 #include "spellpriority.hpp"
 #include "spellcasting.hpp"
 
+namespace
+{
+    namespace Gmst
+    {
+        const MWWorld::GmstFloat fAIMeleeArmorMult("fAIMeleeArmorMult");
+        const MWWorld::GmstFloat fAIMeleeWeaponMult("fAIMeleeWeaponMult");
+        const MWWorld::GmstFloat fAIRangeMeleeWeaponMult("fAIRangeMeleeWeaponMult");
+    }
+}
+
 namespace MWMechanics
 {
     float rateWeapon (const MWWorld::Ptr &item, const MWWorld::Ptr& actor, const MWWorld::Ptr& enemy, int type,
@@ -141,11 +151,11 @@ namespace MWMechanics
 
     float vanillaRateWeaponAndAmmo(const MWWorld::Ptr& weapon, const MWWorld::Ptr& ammo, const MWWorld::Ptr& actor, const MWWorld::Ptr& enemy)
     {
-        const MWWorld::Store<ESM::GameSetting>& gmst = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
+        const MWWorld::GameSettingsCache& gmst = MWBase::Environment::get().getWorld()->getStore().getGameSettings();
 
-        static const float fAIMeleeWeaponMult = gmst.find("fAIMeleeWeaponMult")->getFloat();
-        static const float fAIMeleeArmorMult = gmst.find("fAIMeleeArmorMult")->getFloat();
-        static const float fAIRangeMeleeWeaponMult = gmst.find("fAIRangeMeleeWeaponMult")->getFloat();
+        const float fAIMeleeWeaponMult = Gmst::fAIMeleeWeaponMult.get(gmst);
+        const float fAIMeleeArmorMult = Gmst::fAIMeleeArmorMult.get(gmst);
+        const float fAIRangeMeleeWeaponMult = Gmst::fAIRangeMeleeWeaponMult.get(gmst);
 
         if (weapon.isEmpty())
             return 0.f;
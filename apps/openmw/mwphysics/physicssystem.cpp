@@ -276,7 +276,7 @@ namespace MWPhysics
 
         static osg::Vec3f move(osg::Vec3f position, const MWWorld::Ptr &ptr, Actor* physicActor, const osg::Vec3f &movement, float time,
                                   bool isFlying, float waterlevel, float slowFall, const btCollisionWorld* collisionWorld,
-                               std::map<MWWorld::Ptr, MWWorld::Ptr>& standingCollisionTracker)
+                               StandingCollisions& standingCollisionTracker)
         {
             const ESM::Position& refpos = ptr.getRefData().getPosition();
             // Early-out for totally static creatures
@@ -448,7 +448,7 @@ namespace MWPhysics
                     const btCollisionObject* standingOn = tracer.mHitObject;
                     PtrHolder* ptrHolder = static_cast<PtrHolder*>(standingOn->getUserPointer());
                     if (ptrHolder)
-                        standingCollisionTracker[ptr] = ptrHolder->getPtr();
+                        standingCollisionTracker.setStandingOn(ptr, ptrHolder->getPtr());
 
                     if (standingOn->getBroadphaseHandle()->m_collisionFilterGroup == CollisionType_Water)
                         physicActor->setWalkingOnWater(true);
@@ -616,37 +616,52 @@ namespace MWPhysics
             return !mShapeInstance->mAnimatedShapes.empty();
         }
 
-        void animateCollisionShapes(btCollisionWorld* collisionWorld)
+        /// Update the transforms of animated collision shapes from the scene graph.
+        /// @return Whether any transform changed, i.e. the AABB of the collision object needs to be updated.
+        bool animateCollisionShapes()
         {
             if (mShapeInstance->mAnimatedShapes.empty())
-                return;
+                return false;
 
             assert (mShapeInstance->getCollisionShape()->isCompound());
 
             btCompoundShape* compound = static_cast<btCompoundShape*>(mShapeInstance->getCollisionShape());
 
+            bool changed = false;
+
             for (std::map<int, int>::const_iterator it = mShapeInstance->mAnimatedShapes.begin(); it != mShapeInstance->mAnimatedShapes.end(); ++it)
             {
                 int recIndex = it->first;
                 int shapeIndex = it->second;
 
-                std::map<int, osg::NodePath>::iterator nodePathFound = mRecIndexToNodePath.find(recIndex);
-                if (nodePathFound == mRecIndexToNodePath.end())
+                std::map<int, AnimatedNode>::iterator nodeFound = mAnimatedNodes.find(recIndex);
+                if (nodeFound == mAnimatedNodes.end())
                 {
                     NifOsg::FindGroupByRecIndex visitor(recIndex);
                     mPtr.getRefData().getBaseNode()->accept(visitor);
                     if (!visitor.mFound)
                     {
                         std::cerr << "Error: animateCollisionShapes can't find node " << recIndex << " for " << mPtr.getCellRef().getRefId() << std::endl;
-                        return;
+                        return changed;
                     }
-                    osg::NodePath nodePath = visitor.mFoundPath;
-                    nodePath.erase(nodePath.begin());
-                    nodePathFound = mRecIndexToNodePath.insert(std::make_pair(recIndex, nodePath)).first;
+                    AnimatedNode node;
+                    node.mNodePath = visitor.mFoundPath;
+                    node.mNodePath.erase(node.mNodePath.begin());
+                    node.mValid = false;
+                    nodeFound = mAnimatedNodes.insert(std::make_pair(recIndex, node)).first;
                 }
 
-                osg::NodePath& nodePath = nodePathFound->second;
-                osg::Matrixf matrix = osg::computeLocalToWorld(nodePath);
+                AnimatedNode& node = nodeFound->second;
+                osg::Matrixf matrix = osg::computeLocalToWorld(node.mNodePath);
+
+                // Most animated collision shapes (e.g. of doors or platforms) are idle most of the time
+                if (node.mValid && matrix == node.mLastMatrix && compound->getLocalScaling() == node.mLastScaling)
+                    continue;
+
+                node.mLastMatrix = matrix;
+                node.mLastScaling = compound->getLocalScaling();
+                node.mValid = true;
+
                 osg::Vec3f scale = matrix.getScale();
                 matrix.orthoNormalize(matrix);
 
@@ -657,18 +672,33 @@ namespace MWPhysics
                         transform.getBasis()[i][j] = matrix(j,i); // NB column/row major difference
 
                 if (compound->getLocalScaling() * toBullet(scale) != compound->getChildShape(shapeIndex)->getLocalScaling())
+                {
                     compound->getChildShape(shapeIndex)->setLocalScaling(compound->getLocalScaling() * toBullet(scale));
+                    changed = true;
+                }
                 if (!(transform == compound->getChildTransform(shapeIndex)))
+                {
                     compound->updateChildTransform(shapeIndex, transform);
+                    changed = true;
+                }
             }
 
-            collisionWorld->updateSingleAabb(mCollisionObject.get());
+            return changed;
         }
 
     private:
         std::unique_ptr<btCollisionObject> mCollisionObject;
         osg::ref_ptr<Resource::BulletShapeInstance> mShapeInstance;
-        std::map<int, osg::NodePath> mRecIndexToNodePath;
+
+        struct AnimatedNode
+        {
+            osg::NodePath mNodePath;
+            osg::Matrixf mLastMatrix;
+            btVector3 mLastScaling;
+            bool mValid;
+        };
+        std::map<int, AnimatedNode> mAnimatedNodes; // by record index
+
         bool mSolid;
     };
 
@@ -779,11 +809,11 @@ namespace MWPhysics
         if (!physactor || !physactor->getOnGround())
             return false;
 
-        CollisionMap::const_iterator found = mStandingCollisions.find(actor);
-        if (found == mStandingCollisions.end())
+        MWWorld::Ptr standingOn = mStandingCollisions.getStandingOn(actor);
+        if (standingOn.isEmpty())
             return true; // assume standing on terrain (which is a non-object, so not collision tracked)
 
-        ObjectMap::const_iterator foundObj = mObjects.find(found->second);
+        ObjectMap::const_iterator foundObj = mObjects.find(standingOn);
         if (foundObj == mObjects.end())
             return false;
 
@@ -1168,7 +1198,7 @@ namespace MWPhysics
         mObjects.insert(std::make_pair(ptr, obj));
 
         if (obj->isAnimated())
-            mAnimatedObjects.insert(obj);
+            mAnimatedObjects.push_back(obj);
 
         mCollisionWorld->addCollisionObject(obj->getCollisionObject(), collisionType,
                                            CollisionType_Actor|CollisionType_HeightMap|CollisionType_Projectile);
@@ -1184,7 +1214,12 @@ namespace MWPhysics
             if (mUnrefQueue.get())
                 mUnrefQueue->push(found->second->getShapeInstance());
 
-            mAnimatedObjects.erase(found->second);
+            std::vector<Object*>::iterator animated = std::find(mAnimatedObjects.begin(), mAnimatedObjects.end(), found->second);
+            if (animated != mAnimatedObjects.end())
+            {
+                *animated = mAnimatedObjects.back();
+                mAnimatedObjects.pop_back();
+            }
 
             delete found->second;
             mObjects.erase(found);
@@ -1196,22 +1231,8 @@ namespace MWPhysics
             delete foundActor->second;
             mActors.erase(foundActor);
         }
-    }
 
-    void PhysicsSystem::updateCollisionMapPtr(CollisionMap& map, const MWWorld::Ptr &old, const MWWorld::Ptr &updated)
-    {
-        CollisionMap::iterator found = map.find(old);
-        if (found != map.end())
-        {
-            map[updated] = found->second;
-            map.erase(found);
-        }
-
-        for (CollisionMap::iterator it = map.begin(); it != map.end(); ++it)
-        {
-            if (it->second == old)
-                it->second = updated;
-        }
+        mStandingCollisions.remove(ptr);
     }
 
     void PhysicsSystem::updatePtr(const MWWorld::Ptr &old, const MWWorld::Ptr &updated)
@@ -1234,7 +1255,7 @@ namespace MWPhysics
             mActors.insert(std::make_pair(updated, actor));
         }
 
-        updateCollisionMapPtr(mStandingCollisions, old, updated);
+        mStandingCollisions.updatePtr(old, updated);
     }
 
     Actor *PhysicsSystem::getActor(const MWWorld::Ptr &ptr)
@@ -1453,8 +1474,11 @@ namespace MWPhysics
 
     void PhysicsSystem::stepSimulation(float dt)
     {
-        for (std::set<Object*>::iterator it = mAnimatedObjects.begin(); it != mAnimatedObjects.end(); ++it)
-            (*it)->animateCollisionShapes(mCollisionWorld);
+        for (std::vector<Object*>::iterator it = mAnimatedObjects.begin(); it != mAnimatedObjects.end(); ++it)
+        {
+            if ((*it)->animateCollisionShapes())
+                mCollisionWorld->updateSingleAabb((*it)->getCollisionObject());
+        }
 
 #ifndef BT_NO_PROFILE
         CProfileManager::Reset();
@@ -1470,21 +1494,12 @@ namespace MWPhysics
 
     bool PhysicsSystem::isActorStandingOn(const MWWorld::Ptr &actor, const MWWorld::ConstPtr &object) const
     {
-        for (CollisionMap::const_iterator it = mStandingCollisions.begin(); it != mStandingCollisions.end(); ++it)
-        {
-            if (it->first == actor && it->second == object)
-                return true;
-        }
-        return false;
+        return mStandingCollisions.isStandingOn(actor, object);
     }
 
     void PhysicsSystem::getActorsStandingOn(const MWWorld::ConstPtr &object, std::vector<MWWorld::Ptr> &out) const
     {
-        for (CollisionMap::const_iterator it = mStandingCollisions.begin(); it != mStandingCollisions.end(); ++it)
-        {
-            if (it->second == object)
-                out.push_back(it->first);
-        }
+        mStandingCollisions.getActorsStandingOn(object, out);
     }
 
     bool PhysicsSystem::isActorCollidingWith(const MWWorld::Ptr &actor, const MWWorld::ConstPtr &object) const
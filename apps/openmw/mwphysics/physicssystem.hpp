@@ -11,6 +11,7 @@
 #include "../mwworld/ptr.hpp"
 
 #include "collisiontype.hpp"
+#include "standingcollisions.hpp"
 
 namespace osg
 {
@@ -187,7 +188,7 @@ namespace MWPhysics
             typedef std::map<MWWorld::ConstPtr, Object*> ObjectMap;
             ObjectMap mObjects;
 
-            std::set<Object*> mAnimatedObjects; // stores pointers to elements in mObjects
+            std::vector<Object*> mAnimatedObjects; // stores pointers to elements in mObjects
 
             typedef std::map<MWWorld::ConstPtr, Actor*> ActorMap;
             ActorMap mActors;
@@ -197,13 +198,9 @@ namespace MWPhysics
 
             bool mDebugDrawEnabled;
 
-            // Tracks standing collisions happening during a single frame. <actor handle, collided handle>
+            // Tracks standing collisions happening during a single frame.
             // This will detect standing on an object, but won't detect running e.g. against a wall.
-            typedef std::map<MWWorld::Ptr, MWWorld::Ptr> CollisionMap;
-            CollisionMap mStandingCollisions;
-
-            // replaces all occurrences of 'old' in the map by 'updated', no matter if it's a key or value
-            void updateCollisionMapPtr(CollisionMap& map, const MWWorld::Ptr &old, const MWWorld::Ptr &updated);
+            StandingCollisions mStandingCollisions;
 
             PtrVelocityList mMovementQueue;
             PtrVelocityList mMovementResults;
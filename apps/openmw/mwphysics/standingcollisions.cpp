@@ -0,0 +1,107 @@
+#include "standingcollisions.hpp"
+
+namespace MWPhysics
+{
+
+    void StandingCollisions::setStandingOn (const MWWorld::Ptr& actor, const MWWorld::Ptr& object)
+    {
+        ActorMap::iterator found = mActors.find(actor);
+        if (found != mActors.end())
+        {
+            if (found->second == object)
+            {
+                found->second = object;
+                return;
+            }
+            removeActor(found);
+        }
+
+        mActors.insert(std::make_pair(actor, object));
+        mObjects[object].insert(actor);
+    }
+
+    MWWorld::Ptr StandingCollisions::getStandingOn (const MWWorld::Ptr& actor) const
+    {
+        ActorMap::const_iterator found = mActors.find(actor);
+        if (found == mActors.end())
+            return MWWorld::Ptr();
+        return found->second;
+    }
+
+    bool StandingCollisions::isStandingOn (const MWWorld::Ptr& actor, const MWWorld::ConstPtr& object) const
+    {
+        ActorMap::const_iterator found = mActors.find(actor);
+        return found != mActors.end() && MWWorld::ConstPtr(found->second) == object;
+    }
+
+    void StandingCollisions::getActorsStandingOn (const MWWorld::ConstPtr& object, std::vector<MWWorld::Ptr>& out) const
+    {
+        ObjectMap::const_iterator found = mObjects.find(object);
+        if (found != mObjects.end())
+            out.insert(out.end(), found->second.begin(), found->second.end());
+    }
+
+    void StandingCollisions::updatePtr (const MWWorld::Ptr& old, const MWWorld::Ptr& updated)
+    {
+        ActorMap::iterator foundActor = mActors.find(old);
+        if (foundActor != mActors.end())
+        {
+            MWWorld::Ptr object = foundActor->second;
+            removeActor(foundActor);
+            setStandingOn(updated, object);
+        }
+
+        ObjectMap::iterator foundObject = mObjects.find(old);
+        if (foundObject != mObjects.end())
+        {
+            ActorSet actors;
+            actors.swap(foundObject->second);
+            mObjects.erase(foundObject);
+
+            for (ActorSet::const_iterator it = actors.begin(); it != actors.end(); ++it)
+                mActors[*it] = updated;
+
+            mObjects[updated].insert(actors.begin(), actors.end());
+        }
+    }
+
+    void StandingCollisions::remove (const MWWorld::Ptr& ptr)
+    {
+        ActorMap::iterator foundActor = mActors.find(ptr);
+        if (foundActor != mActors.end())
+            removeActor(foundActor);
+
+        ObjectMap::iterator foundObject = mObjects.find(ptr);
+        if (foundObject != mObjects.end())
+        {
+            for (ActorSet::const_iterator it = foundObject->second.begin(); it != foundObject->second.end(); ++it)
+                mActors.erase(*it);
+            mObjects.erase(foundObject);
+        }
+    }
+
+    void StandingCollisions::clear()
+    {
+        mActors.clear();
+        mObjects.clear();
+    }
+
+    size_t StandingCollisions::size() const
+    {
+        return mActors.size();
+    }
+
+    void StandingCollisions::removeActor (ActorMap::iterator actor)
+    {
+        ObjectMap::iterator foundObject = mObjects.find(actor->second);
+        if (foundObject != mObjects.end())
+        {
+            foundObject->second.erase(actor->first);
+            if (foundObject->second.empty())
+                mObjects.erase(foundObject);
+        }
+
+        mActors.erase(actor);
+    }
+
+}
@@ -0,0 +1,55 @@
+#ifndef OPENMW_MWPHYSICS_STANDINGCOLLISIONS_H
+#define OPENMW_MWPHYSICS_STANDINGCOLLISIONS_H
+
+#include <map>
+#include <set>
+#include <vector>
+
+#include "../mwworld/ptr.hpp"
+
+namespace MWPhysics
+{
+
+    /// @brief Tracks which object each actor is standing on during a single frame.
+    /// @par Indexed in both directions, so that queries and updates for an object only touch the actors standing on it.
+    class StandingCollisions
+    {
+        public:
+
+            /// Record that \a actor is standing on \a object, replacing the object it was standing on before.
+            void setStandingOn (const MWWorld::Ptr& actor, const MWWorld::Ptr& object);
+
+            /// @return The object \a actor is standing on, or an empty Ptr.
+            MWWorld::Ptr getStandingOn (const MWWorld::Ptr& actor) const;
+
+            bool isStandingOn (const MWWorld::Ptr& actor, const MWWorld::ConstPtr& object) const;
+
+            /// Append all actors standing on \a object to \a out.
+            void getActorsStandingOn (const MWWorld::ConstPtr& object, std::vector<MWWorld::Ptr>& out) const;
+
+            /// Replace \a old by \a updated, no matter if it is an actor or an object.
+            void updatePtr (const MWWorld::Ptr& old, const MWWorld::Ptr& updated);
+
+            /// Remove \a ptr, no matter if it is an actor or an object.
+            void remove (const MWWorld::Ptr& ptr);
+
+            void clear();
+
+            /// Number of actors standing on an object.
+            size_t size() const;
+
+        private:
+
+            typedef std::map<MWWorld::Ptr, MWWorld::Ptr> ActorMap;
+            typedef std::set<MWWorld::Ptr> ActorSet;
+            typedef std::map<MWWorld::ConstPtr, ActorSet> ObjectMap;
+
+            void removeActor (ActorMap::iterator actor);
+
+            ActorMap mActors; ///< actor -> object
+            ObjectMap mObjects; ///< object -> actors
+    };
+
+}
+
+#endif
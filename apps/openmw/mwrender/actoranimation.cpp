@@ -83,18 +83,19 @@ void ActorAnimation::addHiddenItemLight(const MWWorld::ConstPtr& item, const ESM
         return;
 
     const Fallback::Map* fallback = MWBase::Environment::get().getWorld()->getFallback();
-    static bool outQuadInLin = fallback->getFallbackBool("LightAttenuation_OutQuadInLin");
-    static bool useQuadratic = fallback->getFallbackBool("LightAttenuation_UseQuadratic");
-    static float quadraticValue = fallback->getFallbackFloat("LightAttenuation_QuadraticValue");
-    static float quadraticRadiusMult = fallback->getFallbackFloat("LightAttenuation_QuadraticRadiusMult");
-    static bool useLinear = fallback->getFallbackBool("LightAttenuation_UseLinear");
-    static float linearRadiusMult = fallback->getFallbackFloat("LightAttenuation_LinearRadiusMult");
-    static float linearValue = fallback->getFallbackFloat("LightAttenuation_LinearValue");
+    static const Fallback::Handle<bool> outQuadInLin(*fallback, "LightAttenuation_OutQuadInLin");
+    static const Fallback::Handle<bool> useQuadratic(*fallback, "LightAttenuation_UseQuadratic");
+    static const Fallback::Handle<float> quadraticValue(*fallback, "LightAttenuation_QuadraticValue");
+    static const Fallback::Handle<float> quadraticRadiusMult(*fallback, "LightAttenuation_QuadraticRadiusMult");
+    static const Fallback::Handle<bool> useLinear(*fallback, "LightAttenuation_UseLinear");
+    static const Fallback::Handle<float> linearRadiusMult(*fallback, "LightAttenuation_LinearRadiusMult");
+    static const Fallback::Handle<float> linearValue(*fallback, "LightAttenuation_LinearValue");
     bool exterior = mPtr.isInCell() && mPtr.getCell()->getCell()->isExterior();
 
     osg::Vec4f ambient(1,1,1,1);
-    osg::ref_ptr<SceneUtil::LightSource> lightSource = SceneUtil::createLightSource(esmLight, Mask_Lighting, exterior, outQuadInLin,
-                                 useQuadratic, quadraticValue, quadraticRadiusMult, useLinear, linearRadiusMult, linearValue, ambient);
+    osg::ref_ptr<SceneUtil::LightSource> lightSource = SceneUtil::createLightSource(esmLight, Mask_Lighting, exterior, outQuadInLin.get(),
+                                 useQuadratic.get(), quadraticValue.get(), quadraticRadiusMult.get(),
+                                 useLinear.get(), linearRadiusMult.get(), linearValue.get(), ambient);
 
     mInsert->addChild(lightSource);
 
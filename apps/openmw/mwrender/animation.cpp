@@ -1353,17 +1353,18 @@ namespace MWRender
     void Animation::addExtraLight(osg::ref_ptr<osg::Group> parent, const ESM::Light *esmLight)
     {
         const Fallback::Map* fallback = MWBase::Environment::get().getWorld()->getFallback();
-        static bool outQuadInLin = fallback->getFallbackBool("LightAttenuation_OutQuadInLin");
-        static bool useQuadratic = fallback->getFallbackBool("LightAttenuation_UseQuadratic");
-        static float quadraticValue = fallback->getFallbackFloat("LightAttenuation_QuadraticValue");
-        static float quadraticRadiusMult = fallback->getFallbackFloat("LightAttenuation_QuadraticRadiusMult");
-        static bool useLinear = fallback->getFallbackBool("LightAttenuation_UseLinear");
-        static float linearRadiusMult = fallback->getFallbackFloat("LightAttenuation_LinearRadiusMult");
-        static float linearValue = fallback->getFallbackFloat("LightAttenuation_LinearValue");
+        static const Fallback::Handle<bool> outQuadInLin(*fallback, "LightAttenuation_OutQuadInLin");
+        static const Fallback::Handle<bool> useQuadratic(*fallback, "LightAttenuation_UseQuadratic");
+        static const Fallback::Handle<float> quadraticValue(*fallback, "LightAttenuation_QuadraticValue");
+        static const Fallback::Handle<float> quadraticRadiusMult(*fallback, "LightAttenuation_QuadraticRadiusMult");
+        static const Fallback::Handle<bool> useLinear(*fallback, "LightAttenuation_UseLinear");
+        static const Fallback::Handle<float> linearRadiusMult(*fallback, "LightAttenuation_LinearRadiusMult");
+        static const Fallback::Handle<float> linearValue(*fallback, "LightAttenuation_LinearValue");
         bool exterior = mPtr.isInCell() && mPtr.getCell()->getCell()->isExterior();
 
-        SceneUtil::addLight(parent, esmLight, Mask_ParticleSystem, Mask_Lighting, exterior, outQuadInLin,
-                            useQuadratic, quadraticValue, quadraticRadiusMult, useLinear, linearRadiusMult, linearValue);
+        SceneUtil::addLight(parent, esmLight, Mask_ParticleSystem, Mask_Lighting, exterior, outQuadInLin.get(),
+                            useQuadratic.get(), quadraticValue.get(), quadraticRadiusMult.get(),
+                            useLinear.get(), linearRadiusMult.get(), linearValue.get());
     }
 
     void Animation::addEffect (const std::string& model, int effectId, bool loop, const std::string& bonename, const std::string& texture)
@@ -13,6 +13,8 @@
 #include <osgUtil/IntersectionVisitor>
 #include <osgUtil/LineSegmentIntersector>
 
+#include <components/esm/loadmgef.hpp>
+
 #include <components/sceneutil/lightmanager.hpp>
 
 #include "../mwbase/environment.hpp"
@@ -21,6 +23,7 @@
 #include "../mwworld/inventorystore.hpp"
 
 #include "../mwmechanics/actorutil.hpp"
+#include "../mwmechanics/npcstats.hpp"
 
 #include "npcanimation.hpp"
 #include "vismask.hpp"
@@ -224,13 +227,31 @@ namespace MWRender
         return mTexture;
     }
 
+    void CharacterPreview::getBaseSignature(PreviewSignature &signature) const
+    {
+        const MWWorld::LiveCellRef<ESM::NPC>* ref = mCharacter.get<ESM::NPC>();
+        signature.mCharacter = ref;
+        signature.mNpc = ref->mBase;
+        signature.mRace = ref->mBase->mRace;
+        signature.mHead = ref->mBase->mHead;
+        signature.mHair = ref->mBase->mHair;
+        signature.mFemale = !ref->mBase->isMale();
+    }
+
     void CharacterPreview::rebuild()
     {
+        PreviewSignature signature;
+        getBaseSignature(signature);
+        if (mAnimation.get() && !mChanges.needsRebuild(signature))
+            return;
+
         mAnimation = NULL;
 
         mAnimation = new NpcAnimation(mCharacter, mNode, mResourceSystem, true,
                                       (renderHeadOnly() ? NpcAnimation::VM_HeadOnly : NpcAnimation::VM_Normal));
 
+        mChanges.rebuilt(signature);
+
         onSetup();
 
         redraw();
@@ -269,11 +290,8 @@ namespace MWRender
         if (!mAnimation.get())
             return;
 
-        mAnimation->showWeapons(true);
-        mAnimation->updateParts();
-
-        MWWorld::InventoryStore &inv = mCharacter.getClass().getInventoryStore(mCharacter);
-        MWWorld::ContainerStoreIterator iter = inv.getSlot(MWWorld::InventoryStore::Slot_CarriedRight);
+        const MWWorld::InventoryStore &inv = mCharacter.getClass().getInventoryStore(mCharacter);
+        MWWorld::ConstContainerStoreIterator iter = inv.getSlot(MWWorld::InventoryStore::Slot_CarriedRight);
         std::string groupname;
         bool showCarriedLeft = true;
         if(iter == inv.end())
@@ -285,7 +303,7 @@ namespace MWRender
                 groupname = "inventoryweapononehand";
             else if(typeName == typeid(ESM::Weapon).name())
             {
-                MWWorld::LiveCellRef<ESM::Weapon> *ref = iter->get<ESM::Weapon>();
+                const MWWorld::LiveCellRef<ESM::Weapon> *ref = iter->get<ESM::Weapon>();
 
                 int type = ref->mBase->mData.mType;
                 if(type == ESM::Weapon::ShortBladeOneHand ||
@@ -312,13 +330,43 @@ namespace MWRender
                 groupname = "inventoryhandtohand";
         }
 
+        MWWorld::ConstContainerStoreIterator torch = inv.getSlot(MWWorld::InventoryStore::Slot_CarriedLeft);
+        bool showTorch = torch != inv.end() && torch->getTypeName() == typeid(ESM::Light).name() && showCarriedLeft;
+
+        // Inventory sorting, dragging items and hovering over them get here as well, skip those
+        PreviewSignature signature;
+        const MWMechanics::NpcStats& stats = mCharacter.getClass().getNpcStats(mCharacter);
+        if (stats.isWerewolf())
+            signature.mNpcType = 2;
+        else if (stats.getMagicEffects().get(ESM::MagicEffect::Vampirism).getMagnitude() > 0)
+            signature.mNpcType = 1;
+
+        for (int slot = 0; slot < MWWorld::InventoryStore::Slots; ++slot)
+        {
+            MWWorld::ConstContainerStoreIterator equipped = inv.getSlot(slot);
+            signature.mEquipped.push_back(equipped != inv.end() ? equipped->getCellRef().getRefId() : std::string());
+        }
+
+        signature.mAnimGroup = groupname;
+        signature.mShowCarriedLeft = showCarriedLeft;
+        signature.mTorch = showTorch;
+
+        int changes = mChanges.update(signature);
+        if (changes == PreviewChangeTracker::Change_None)
+            return;
+
+        if (changes & PreviewChangeTracker::Change_Parts)
+        {
+            mAnimation->showWeapons(true);
+            mAnimation->updateParts();
+        }
+
         mAnimation->showCarriedLeft(showCarriedLeft);
 
         mCurrentAnimGroup = groupname;
         mAnimation->play(mCurrentAnimGroup, 1, Animation::BlendMask_All, false, 1.0f, "start", "stop", 0.0f, 0);
 
-        MWWorld::ConstContainerStoreIterator torch = inv.getSlot(MWWorld::InventoryStore::Slot_CarriedLeft);
-        if(torch != inv.end() && torch->getTypeName() == typeid(ESM::Light).name() && showCarriedLeft)
+        if(showTorch)
         {
             if(!mAnimation->getInfo("torch"))
                 mAnimation->play("torch", 2, Animation::BlendMask_LeftArm, false,
@@ -329,7 +377,8 @@ namespace MWRender
 
         mAnimation->runAnimation(0.0f);
 
-        setBlendMode();
+        if (changes & PreviewChangeTracker::Change_Parts)
+            setBlendMode();
 
         redraw();
     }
@@ -12,6 +12,8 @@
 
 #include "../mwworld/ptr.hpp"
 
+#include "previewsignature.hpp"
+
 namespace osg
 {
     class Texture2D;
@@ -38,6 +40,7 @@ namespace MWRender
 
         void redraw();
 
+        /// Build the NpcAnimation again, if the character's race, head, hair or gender changed since it was built.
         void rebuild();
 
         osg::ref_ptr<osg::Texture2D> getTexture();
@@ -51,6 +54,8 @@ namespace MWRender
         void setBlendMode();
         virtual void onSetup();
 
+        void getBaseSignature(PreviewSignature& signature) const;
+
         osg::ref_ptr<osg::Group> mParent;
         Resource::ResourceSystem* mResourceSystem;
         osg::ref_ptr<osg::Texture2D> mTexture;
@@ -66,6 +71,8 @@ namespace MWRender
         osg::ref_ptr<osg::PositionAttitudeTransform> mNode;
         std::string mCurrentAnimGroup;
 
+        PreviewChangeTracker mChanges;
+
         int mSizeX;
         int mSizeY;
     };
@@ -78,7 +85,7 @@ namespace MWRender
 
         void updatePtr(const MWWorld::Ptr& ptr);
 
-        void update(); // Render preview again, e.g. after changed equipment
+        void update(); // Render preview again, e.g. after changed equipment. Does nothing if the equipment and pose didn't change.
         void setViewport(int sizeX, int sizeY);
 
         int getSlotSelected(int posX, int posY);
@@ -1,6 +1,8 @@
 #include "effectmanager.hpp"
 
 #include <osg/PositionAttitudeTransform>
+#include <osg/Stats>
+#include <osg/Texture2D>
 
 #include <components/resource/resourcesystem.hpp>
 #include <components/resource/scenemanager.hpp>
@@ -11,11 +13,21 @@
 #include "vismask.hpp"
 #include "util.hpp"
 
+namespace
+{
+    /// Maximum number of finished effects kept for reuse, per model and texture override
+    const unsigned int sMaxPooledPerModel = 16;
+
+    /// Maximum number of finished effects kept for reuse in total
+    const unsigned int sMaxPooled = 128;
+}
+
 namespace MWRender
 {
 
 EffectManager::EffectManager(osg::ref_ptr<osg::Group> parent, Resource::ResourceSystem* resourceSystem)
-    : mParentNode(parent)
+    : mPool(sMaxPooledPerModel, sMaxPooled)
+    , mParentNode(parent)
     , mResourceSystem(resourceSystem)
 {
 }
@@ -25,60 +37,112 @@ EffectManager::~EffectManager()
     clear();
 }
 
-void EffectManager::addEffect(const std::string &model, const std::string& textureOverride, const osg::Vec3f &worldPosition, float scale, bool isMagicVFX)
+EffectPool::Instance EffectManager::createInstance(const std::string &model, const std::string &textureOverride, bool isMagicVFX)
 {
     osg::ref_ptr<osg::Node> node = mResourceSystem->getSceneManager()->getInstance(model);
 
     node->setNodeMask(Mask_Effect);
 
-    Effect effect;
-    effect.mAnimTime.reset(new EffectAnimationTime);
+    EffectPool::Instance instance;
+    instance.mTemplate = mResourceSystem->getSceneManager()->getTemplate(model);
+    instance.mAnimTime.reset(new EffectAnimationTime);
 
     SceneUtil::FindMaxControllerLengthVisitor findMaxLengthVisitor;
     node->accept(findMaxLengthVisitor);
-    effect.mMaxControllerLength = findMaxLengthVisitor.getMaxLength();
+    instance.mMaxControllerLength = findMaxLengthVisitor.getMaxLength();
 
-    osg::ref_ptr<osg::PositionAttitudeTransform> trans = new osg::PositionAttitudeTransform;
-    trans->setPosition(worldPosition);
-    trans->setScale(osg::Vec3f(scale, scale, scale));
-    trans->addChild(node);
+    instance.mTransform = new osg::PositionAttitudeTransform;
+    instance.mTransform->addChild(node);
 
-    SceneUtil::AssignControllerSourcesVisitor assignVisitor(effect.mAnimTime);
+    SceneUtil::AssignControllerSourcesVisitor assignVisitor(instance.mAnimTime);
     node->accept(assignVisitor);
 
     if (isMagicVFX)
-        overrideFirstRootTexture(textureOverride, mResourceSystem, node);
+        overrideFirstRootTexture(getOverrideTexture(textureOverride), node);
+    else
+        overrideTexture(getOverrideTexture(textureOverride), node);
+
+    return instance;
+}
+
+osg::ref_ptr<osg::Texture2D> EffectManager::getOverrideTexture(const std::string &textureOverride)
+{
+    if (textureOverride.empty())
+        return NULL;
+
+    std::map<std::string, osg::ref_ptr<osg::Texture2D> >::iterator found = mOverrideTextures.find(textureOverride);
+    if (found != mOverrideTextures.end())
+        return found->second;
+
+    osg::ref_ptr<osg::Texture2D> texture = createOverrideTexture(textureOverride, mResourceSystem);
+    mOverrideTextures[textureOverride] = texture;
+    return texture;
+}
+
+void EffectManager::addEffect(const std::string &model, const std::string& textureOverride, const osg::Vec3f &worldPosition, float scale, bool isMagicVFX)
+{
+    Effect effect;
+    effect.mPoolKey = model;
+    effect.mPoolKey += '\0';
+    effect.mPoolKey += textureOverride;
+    effect.mPoolKey += isMagicVFX ? '1' : '0';
+
+    if (mPool.take(effect.mPoolKey, effect.mInstance)
+            && recreateParticles(*effect.mInstance.mTransform->getChild(0), *effect.mInstance.mTemplate))
+    {
+        effect.mInstance.mAnimTime->resetTime(0.f);
+
+        SceneUtil::AssignControllerSourcesVisitor assignVisitor(effect.mInstance.mAnimTime);
+        effect.mInstance.mTransform->accept(assignVisitor);
+    }
     else
-        overrideTexture(textureOverride, mResourceSystem, node);
+        effect.mInstance = createInstance(model, textureOverride, isMagicVFX);
+
+    osg::PositionAttitudeTransform* trans = effect.mInstance.mTransform.get();
+    trans->setPosition(worldPosition);
+    trans->setScale(osg::Vec3f(scale, scale, scale));
 
     mParentNode->addChild(trans);
 
-    mEffects[trans] = effect;
+    mEffects.push_back(effect);
 }
 
 void EffectManager::update(float dt)
 {
-    for (EffectMap::iterator it = mEffects.begin(); it != mEffects.end(); )
+    for (size_t i = 0; i < mEffects.size(); )
     {
-        it->second.mAnimTime->addTime(dt);
+        EffectPool::Instance& instance = mEffects[i].mInstance;
+        instance.mAnimTime->addTime(dt);
 
-        if (it->second.mAnimTime->getTime() >= it->second.mMaxControllerLength)
+        if (instance.mAnimTime->getTime() >= instance.mMaxControllerLength)
         {
-            mParentNode->removeChild(it->first);
-            mEffects.erase(it++);
+            mParentNode->removeChild(instance.mTransform);
+            mPool.put(mEffects[i].mPoolKey, instance);
+
+            if (i != mEffects.size()-1)
+                std::swap(mEffects[i], mEffects.back());
+            mEffects.pop_back();
         }
         else
-            ++it;
+            ++i;
     }
 }
 
 void EffectManager::clear()
 {
-    for (EffectMap::iterator it = mEffects.begin(); it != mEffects.end(); ++it)
-    {
-        mParentNode->removeChild(it->first);
-    }
+    for (std::vector<Effect>::iterator it = mEffects.begin(); it != mEffects.end(); ++it)
+        mParentNode->removeChild(it->mInstance.mTransform);
     mEffects.clear();
+
+    mPool.clear();
+    mOverrideTextures.clear();
+}
+
+void EffectManager::reportStats(unsigned int frameNumber, osg::Stats *stats) const
+{
+    stats->setAttribute(frameNumber, "Effect", mEffects.size());
+    stats->setAttribute(frameNumber, "Effect Pooled", mPool.getNumIdle());
+    stats->setAttribute(frameNumber, "Effect Reused", mPool.getNumReused());
 }
 
 }
@@ -2,16 +2,19 @@
 #define OPENMW_MWRENDER_EFFECTMANAGER_H
 
 #include <map>
-#include <memory>
 #include <string>
+#include <vector>
 
 #include <osg/ref_ptr>
 
+#include "effectpool.hpp"
+
 namespace osg
 {
     class Group;
     class Vec3f;
-    class PositionAttitudeTransform;
+    class Stats;
+    class Texture2D;
 }
 
 namespace Resource
@@ -36,18 +39,29 @@ namespace MWRender
 
         void update(float dt);
 
-        /// Remove all effects
+        /// Remove all effects, and release the finished ones kept for reuse
         void clear();
 
+        void reportStats(unsigned int frameNumber, osg::Stats* stats) const;
+
     private:
         struct Effect
         {
-            float mMaxControllerLength;
-            std::shared_ptr<EffectAnimationTime> mAnimTime;
+            EffectPool::Instance mInstance;
+            std::string mPoolKey;
         };
 
-        typedef std::map<osg::ref_ptr<osg::PositionAttitudeTransform>, Effect> EffectMap;
-        EffectMap mEffects;
+        /// Set up a new instance of the model, with the texture override applied.
+        EffectPool::Instance createInstance(const std::string& model, const std::string& textureOverride, bool isMagicVFX);
+
+        osg::ref_ptr<osg::Texture2D> getOverrideTexture(const std::string& textureOverride);
+
+        std::vector<Effect> mEffects;
+
+        /// Instances of effects that finished playing, by model, texture override and override mode
+        EffectPool mPool;
+
+        std::map<std::string, osg::ref_ptr<osg::Texture2D> > mOverrideTextures;
 
         osg::ref_ptr<osg::Group> mParentNode;
         Resource::ResourceSystem* mResourceSystem;
@@ -0,0 +1,135 @@
+#include "effectpool.hpp"
+
+#include <osgParticle/ParticleProcessor>
+#include <osgParticle/ParticleSystem>
+#include <osgParticle/ParticleSystemUpdater>
+
+#include <components/sceneutil/clone.hpp>
+
+namespace
+{
+    /// Collects the particle systems and the nodes processing them, in traversal order.
+    class CollectParticlesVisitor : public osg::NodeVisitor
+    {
+    public:
+        CollectParticlesVisitor()
+            : osg::NodeVisitor(TRAVERSE_ALL_CHILDREN)
+        { }
+
+        virtual void apply(osg::Node& node)
+        {
+            if (dynamic_cast<osgParticle::ParticleProcessor*>(&node) || dynamic_cast<osgParticle::ParticleSystemUpdater*>(&node))
+                mProcessors.push_back(&node);
+
+            traverse(node);
+        }
+
+        virtual void apply(osg::Drawable& drawable)
+        {
+            if (osgParticle::ParticleSystem* partsys = dynamic_cast<osgParticle::ParticleSystem*>(&drawable))
+                mSystems.push_back(partsys);
+        }
+
+        std::vector<osg::Node*> mProcessors;
+        std::vector<osgParticle::ParticleSystem*> mSystems;
+    };
+
+    void replaceNode(osg::Node* node, osg::Node* replacement)
+    {
+        // keep the node alive and copy the list, replaceChild modifies it
+        osg::ref_ptr<osg::Node> keep (node);
+        osg::Node::ParentList parents = node->getParents();
+        for (osg::Node::ParentList::iterator it = parents.begin(); it != parents.end(); ++it)
+            (*it)->replaceChild(node, replacement);
+    }
+}
+
+namespace MWRender
+{
+
+EffectPool::EffectPool(unsigned int maxIdlePerKey, unsigned int maxIdle)
+    : mMaxIdlePerKey(maxIdlePerKey)
+    , mMaxIdle(maxIdle)
+    , mNumIdle(0)
+    , mNumReused(0)
+    , mNumMissed(0)
+    , mNumDiscarded(0)
+{
+}
+
+bool EffectPool::take(const std::string &key, Instance &instance)
+{
+    IdleMap::iterator found = mIdle.find(key);
+    if (found == mIdle.end() || found->second.empty())
+    {
+        ++mNumMissed;
+        return false;
+    }
+
+    instance = found->second.back();
+    found->second.pop_back();
+    --mNumIdle;
+    ++mNumReused;
+    return true;
+}
+
+bool EffectPool::put(const std::string &key, const Instance &instance)
+{
+    if (mNumIdle >= mMaxIdle)
+    {
+        ++mNumDiscarded;
+        return false;
+    }
+
+    std::vector<Instance>& idle = mIdle[key];
+    if (idle.size() >= mMaxIdlePerKey)
+    {
+        ++mNumDiscarded;
+        return false;
+    }
+
+    idle.push_back(instance);
+    ++mNumIdle;
+    return true;
+}
+
+void EffectPool::clear()
+{
+    mIdle.clear();
+    mNumIdle = 0;
+}
+
+bool recreateParticles(osg::Node &instance, const osg::Node &base)
+{
+    CollectParticlesVisitor instanceParticles;
+    instance.accept(instanceParticles);
+
+    CollectParticlesVisitor baseParticles;
+    const_cast<osg::Node&>(base).accept(baseParticles);
+
+    if (instanceParticles.mProcessors.size() != baseParticles.mProcessors.size()
+            || instanceParticles.mSystems.size() != baseParticles.mSystems.size())
+        return false;
+
+    // Copied the same way as by SceneManager::createInstance. The processors have to be copied first,
+    // copying a particle system then connects the copied processors to it.
+    SceneUtil::CopyOp copyOp;
+
+    std::vector<osg::ref_ptr<osg::Node> > processors;
+    for (std::vector<osg::Node*>::const_iterator it = baseParticles.mProcessors.begin(); it != baseParticles.mProcessors.end(); ++it)
+        processors.push_back(copyOp(*it));
+
+    std::vector<osg::ref_ptr<osgParticle::ParticleSystem> > systems;
+    for (std::vector<osgParticle::ParticleSystem*>::const_iterator it = baseParticles.mSystems.begin(); it != baseParticles.mSystems.end(); ++it)
+        systems.push_back(copyOp(static_cast<const osgParticle::ParticleSystem*>(*it)));
+
+    for (size_t i = 0; i < processors.size(); ++i)
+        replaceNode(instanceParticles.mProcessors[i], processors[i]);
+
+    for (size_t i = 0; i < systems.size(); ++i)
+        replaceNode(instanceParticles.mSystems[i], systems[i]);
+
+    return true;
+}
+
+}
@@ -0,0 +1,83 @@
+#ifndef OPENMW_MWRENDER_EFFECTPOOL_H
+#define OPENMW_MWRENDER_EFFECTPOOL_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <osg/ref_ptr>
+#include <osg/PositionAttitudeTransform>
+
+namespace MWRender
+{
+    class EffectAnimationTime;
+
+    /// @brief Keeps instances of effect models that finished playing, so that effects spawned again and again
+    /// don't need to be cloned and set up each time.
+    /// @note The number of idle instances is bounded, both per key and in total. Instances returned to a full
+    /// pool are discarded.
+    class EffectPool
+    {
+    public:
+        struct Instance
+        {
+            osg::ref_ptr<osg::PositionAttitudeTransform> mTransform;
+            osg::ref_ptr<const osg::Node> mTemplate; ///< The scene template the child of mTransform was created from
+            std::shared_ptr<EffectAnimationTime> mAnimTime;
+            float mMaxControllerLength;
+
+            Instance() : mMaxControllerLength(0.f) {}
+        };
+
+        /// @param maxIdlePerKey Maximum number of idle instances with the same key
+        /// @param maxIdle Maximum number of idle instances in total
+        EffectPool(unsigned int maxIdlePerKey, unsigned int maxIdle);
+
+        /// Take an idle instance with the given key out of the pool.
+        /// @return false if there is none, the caller has to create a new instance.
+        bool take(const std::string& key, Instance& instance);
+
+        /// Return an instance that is no longer in use.
+        /// @return false if the pool is full and the instance was discarded.
+        bool put(const std::string& key, const Instance& instance);
+
+        /// Discard all idle instances.
+        void clear();
+
+        unsigned int getNumIdle() const { return mNumIdle; }
+
+        /// Number of instances that were taken from the pool instead of being created
+        unsigned int getNumReused() const { return mNumReused; }
+
+        /// Number of requests the pool could not serve
+        unsigned int getNumMissed() const { return mNumMissed; }
+
+        /// Number of instances that were discarded because the pool was full
+        unsigned int getNumDiscarded() const { return mNumDiscarded; }
+
+    private:
+        typedef std::map<std::string, std::vector<Instance> > IdleMap;
+        IdleMap mIdle;
+
+        unsigned int mMaxIdlePerKey;
+        unsigned int mMaxIdle;
+
+        unsigned int mNumIdle;
+        unsigned int mNumReused;
+        unsigned int mNumMissed;
+        unsigned int mNumDiscarded;
+    };
+
+    /// @brief Replace the particle systems, particle processors and particle system updaters of @a instance by new copies
+    /// of those in @a base, the scene template @a instance was created from, so that it plays again like a new instance.
+    /// @note Particle processors measure the time since they were last traversed. After the instance was idle in the pool,
+    /// they would take all of that time for one frame and emit a burst of particles. The particle systems get the initial
+    /// particles of the model again, instead of the ones left over from the last time the instance played.
+    /// @note The update callbacks are copied from @a base, so controller sources have to be assigned again.
+    /// @return false if the scene graphs don't match, then the instance can't be reused.
+    bool recreateParticles(osg::Node& instance, const osg::Node& base);
+
+}
+
+#endif
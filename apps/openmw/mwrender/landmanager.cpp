@@ -13,9 +13,10 @@
 namespace MWRender
 {
 
-LandManager::LandManager(int loadFlags)
+LandManager::LandManager(int loadFlags, size_t dataCacheBudget)
     : ResourceManager(NULL)
     , mLoadFlags(loadFlags)
+    , mDataCache(new ESMTerrain::LandDataCache(dataCacheBudget))
 {
 }
 
@@ -33,15 +34,22 @@ osg::ref_ptr<ESMTerrain::LandObject> LandManager::getLand(int x, int y)
         const ESM::Land* land = MWBase::Environment::get().getWorld()->getStore().get<ESM::Land>().search(x,y);
         if (!land)
             return NULL;
-        osg::ref_ptr<ESMTerrain::LandObject> landObj (new ESMTerrain::LandObject(land, mLoadFlags));
+        osg::ref_ptr<ESMTerrain::LandObject> landObj (new ESMTerrain::LandObject(land, mLoadFlags, mDataCache.get()));
         mCache->addEntryToObjectCache(idstr, landObj.get());
         return landObj;
     }
 }
 
+void LandManager::clearCache()
+{
+    ResourceManager::clearCache();
+    mDataCache->clear();
+}
+
 void LandManager::reportStats(unsigned int frameNumber, osg::Stats *stats) const
 {
     stats->setAttribute(frameNumber, "Land", mCache->getCacheSize());
+    stats->setAttribute(frameNumber, "Land Data", mDataCache->getNumEntries());
 }
 
 
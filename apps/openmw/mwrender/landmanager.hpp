@@ -5,6 +5,7 @@
 
 #include <components/resource/resourcemanager.hpp>
 #include <components/esmterrain/storage.hpp>
+#include <components/esmterrain/landdatacache.hpp>
 
 namespace ESM
 {
@@ -17,15 +18,20 @@ namespace MWRender
     class LandManager : public Resource::ResourceManager
     {
     public:
-        LandManager(int loadFlags);
+        /// @param dataCacheBudget Maximum number of bytes used for decoded land data
+        LandManager(int loadFlags, size_t dataCacheBudget);
 
         /// @note Will return NULL if not found.
         osg::ref_ptr<ESMTerrain::LandObject> getLand(int x, int y);
 
+        virtual void clearCache();
+
         virtual void reportStats(unsigned int frameNumber, osg::Stats* stats) const;
 
     private:
         int mLoadFlags;
+
+        osg::ref_ptr<ESMTerrain::LandDataCache> mDataCache;
     };
 
 }
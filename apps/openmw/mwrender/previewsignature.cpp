@@ -0,0 +1,89 @@
+#include "previewsignature.hpp"
+
+namespace MWRender
+{
+
+    PreviewSignature::PreviewSignature()
+        : mCharacter(NULL)
+        , mNpc(NULL)
+        , mFemale(false)
+        , mNpcType(0)
+        , mShowCarriedLeft(false)
+        , mTorch(false)
+    {
+    }
+
+    bool PreviewSignature::baseEquals(const PreviewSignature &other) const
+    {
+        return mCharacter == other.mCharacter && mNpc == other.mNpc && mFemale == other.mFemale
+                && mRace == other.mRace && mHead == other.mHead && mHair == other.mHair;
+    }
+
+    bool PreviewSignature::partsEqual(const PreviewSignature &other) const
+    {
+        return mNpcType == other.mNpcType && mEquipped == other.mEquipped;
+    }
+
+    bool PreviewSignature::animationEquals(const PreviewSignature &other) const
+    {
+        return mShowCarriedLeft == other.mShowCarriedLeft && mTorch == other.mTorch && mAnimGroup == other.mAnimGroup;
+    }
+
+    // --------------------------------------------------------------------------------------------------
+
+    PreviewChangeTracker::PreviewChangeTracker()
+        : mBuilt(false)
+        , mSetUp(false)
+        , mNumRebuilds(0)
+        , mNumPartUpdates(0)
+        , mNumAnimationUpdates(0)
+        , mNumSkippedUpdates(0)
+    {
+    }
+
+    bool PreviewChangeTracker::needsRebuild(const PreviewSignature &signature) const
+    {
+        return !mBuilt || !mShown.baseEquals(signature);
+    }
+
+    void PreviewChangeTracker::rebuilt(const PreviewSignature &signature)
+    {
+        mShown = signature;
+        mBuilt = true;
+        mSetUp = false;
+        ++mNumRebuilds;
+    }
+
+    int PreviewChangeTracker::update(const PreviewSignature &signature)
+    {
+        int changes = Change_None;
+        if (!mSetUp || !mShown.partsEqual(signature))
+            changes |= Change_Parts | Change_Animation;
+        else if (!mShown.animationEquals(signature))
+            changes |= Change_Animation;
+
+        if (changes & Change_Parts)
+            ++mNumPartUpdates;
+        if (changes & Change_Animation)
+            ++mNumAnimationUpdates;
+        if (changes == Change_None)
+            ++mNumSkippedUpdates;
+
+        // the base stays what the NpcAnimation was built for
+        mShown.mNpcType = signature.mNpcType;
+        mShown.mEquipped = signature.mEquipped;
+        mShown.mAnimGroup = signature.mAnimGroup;
+        mShown.mShowCarriedLeft = signature.mShowCarriedLeft;
+        mShown.mTorch = signature.mTorch;
+        mSetUp = true;
+        return changes;
+    }
+
+    void PreviewChangeTracker::reset()
+    {
+        mShown = PreviewSignature();
+        mBuilt = false;
+        mSetUp = false;
+    }
+
+}
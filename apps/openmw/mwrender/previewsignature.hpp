@@ -0,0 +1,84 @@
+#ifndef OPENMW_MWRENDER_PREVIEWSIGNATURE_H
+#define OPENMW_MWRENDER_PREVIEWSIGNATURE_H
+
+#include <string>
+#include <vector>
+
+namespace MWRender
+{
+
+    /// @brief What a character preview shows. The preview is only set up again for the parts of this that changed.
+    struct PreviewSignature
+    {
+        // The character the NpcAnimation is built for; changes require a rebuild.
+        const void* mCharacter;
+        const void* mNpc;
+        std::string mRace;
+        std::string mHead;
+        std::string mHair;
+        bool mFemale;
+
+        // Equipped items by inventory slot, and whether the character is a vampire (1) or werewolf (2);
+        // changes require the parts to be updated.
+        int mNpcType;
+        std::vector<std::string> mEquipped;
+
+        // The pose of the inventory preview
+        std::string mAnimGroup;
+        bool mShowCarriedLeft;
+        bool mTorch;
+
+        PreviewSignature();
+
+        bool baseEquals(const PreviewSignature& other) const;
+        bool partsEqual(const PreviewSignature& other) const;
+        bool animationEquals(const PreviewSignature& other) const;
+    };
+
+    /// @brief Tells which parts of a character preview need to be set up again, by comparing what it should show
+    /// with what it showed when it was last set up.
+    class PreviewChangeTracker
+    {
+    public:
+        enum Change
+        {
+            Change_None = 0,
+            Change_Animation = 1<<0,
+            Change_Parts = 1<<1
+        };
+
+        PreviewChangeTracker();
+
+        /// @return true if the NpcAnimation has to be rebuilt to show \a signature
+        bool needsRebuild(const PreviewSignature& signature) const;
+
+        /// The NpcAnimation was rebuilt for \a signature, its parts and animation are not set up yet.
+        void rebuilt(const PreviewSignature& signature);
+
+        /// Remember the equipment and animation of \a signature as shown. Changes of the base are not
+        /// considered, they need a rebuild.
+        /// @return The Change flags of what has to be set up again to show it
+        int update(const PreviewSignature& signature);
+
+        /// Forget what was shown, the next call to needsRebuild returns true.
+        void reset();
+
+        unsigned int getNumRebuilds() const { return mNumRebuilds; }
+        unsigned int getNumPartUpdates() const { return mNumPartUpdates; }
+        unsigned int getNumAnimationUpdates() const { return mNumAnimationUpdates; }
+        unsigned int getNumSkippedUpdates() const { return mNumSkippedUpdates; }
+
+    private:
+        PreviewSignature mShown;
+        bool mBuilt;
+        bool mSetUp;
+
+        unsigned int mNumRebuilds;
+        unsigned int mNumPartUpdates;
+        unsigned int mNumAnimationUpdates;
+        unsigned int mNumSkippedUpdates;
+    };
+
+}
+
+#endif
@@ -316,10 +316,16 @@ namespace MWRender
         mUniformNear = mRootNode->getOrCreateStateSet()->getUniform("near");
         mUniformFar = mRootNode->getOrCreateStateSet()->getUniform("far");
         updateProjectionMatrix();
+
+        Settings::Manager::addListener(this, "Camera");
+        Settings::Manager::addListener(this, "General");
+        Settings::Manager::addListener(this, "Water");
     }
 
     RenderingManager::~RenderingManager()
     {
+        Settings::Manager::removeListener(this);
+
         // let background loading thread finish before we delete anything else
         mWorkQueue = NULL;
     }
@@ -556,7 +562,7 @@ namespace MWRender
         {
             mEffectManager->update(dt);
             mSky->update(dt);
-            mWater->update(dt);
+            mWater->update(dt, mCurrentCameraPos);
         }
 
         mCamera->update(dt, paused);
@@ -989,32 +995,30 @@ namespace MWRender
             stats->setAttribute(frameNumber, "UnrefQueue", mUnrefQueue->getNumItems());
 
             mTerrain->reportStats(frameNumber, stats);
+            mEffectManager->reportStats(frameNumber, stats);
         }
     }
 
-    void RenderingManager::processChangedSettings(const Settings::CategorySettingVector &changed)
+    void RenderingManager::settingChanged(const std::string& setting, const std::string& category)
     {
-        for (Settings::CategorySettingVector::const_iterator it = changed.begin(); it != changed.end(); ++it)
+        if (category == "Camera" && setting == "field of view")
         {
-            if (it->first == "Camera" && it->second == "field of view")
-            {
-                mFieldOfView = Settings::Manager::getFloat("field of view", "Camera");
-                updateProjectionMatrix();
-            }
-            else if (it->first == "Camera" && it->second == "viewing distance")
-            {
-                mViewDistance = Settings::Manager::getFloat("viewing distance", "Camera");
-                if(!mDistantFog)
-                    mStateUpdater->setFogEnd(mViewDistance);
-                updateProjectionMatrix();
-            }
-            else if (it->first == "General" && (it->second == "texture filter" ||
-                                                it->second == "texture mipmap" ||
-                                                it->second == "anisotropy"))
-                updateTextureFiltering();
-            else if (it->first == "Water")
-                mWater->processChangedSettings(changed);
+            mFieldOfView = Settings::Manager::getFloat("field of view", "Camera");
+            updateProjectionMatrix();
+        }
+        else if (category == "Camera" && setting == "viewing distance")
+        {
+            mViewDistance = Settings::Manager::getFloat("viewing distance", "Camera");
+            if(!mDistantFog)
+                mStateUpdater->setFogEnd(mViewDistance);
+            updateProjectionMatrix();
         }
+        else if (category == "General" && (setting == "texture filter" ||
+                                           setting == "texture mipmap" ||
+                                           setting == "anisotropy"))
+            updateTextureFiltering();
+        else if (category == "Water")
+            mWater->processChangedSettings();
     }
 
     float RenderingManager::getNearClipDistance() const
@@ -68,7 +68,7 @@ namespace MWRender
     class TerrainStorage;
     class LandManager;
 
-    class RenderingManager : public MWRender::RenderingInterface
+    class RenderingManager : public MWRender::RenderingInterface, public Settings::Listener
     {
     public:
         RenderingManager(osgViewer::Viewer* viewer, osg::ref_ptr<osg::Group> rootNode, Resource::ResourceSystem* resourceSystem, SceneUtil::WorkQueue* workQueue,
@@ -176,7 +176,8 @@ namespace MWRender
 
         void rebuildPtr(const MWWorld::Ptr& ptr);
 
-        void processChangedSettings(const Settings::CategorySettingVector& settings);
+        /// Applies changes to the camera, texture filtering and water settings as soon as they are made.
+        virtual void settingChanged(const std::string& setting, const std::string& category);
 
         float getNearClipDistance() const;
 
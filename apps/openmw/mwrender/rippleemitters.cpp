@@ -0,0 +1,155 @@
+#include "rippleemitters.hpp"
+
+#include <algorithm>
+
+namespace MWRender
+{
+
+RippleEmitters::RippleEmitters(float maxDistance, float minInterval)
+    : mMaxDistance(maxDistance)
+    , mMinInterval(minInterval)
+    , mNumTested(0)
+{
+}
+
+void RippleEmitters::add(const MWWorld::ConstPtr& ptr, float scale, float force)
+{
+    if (mLocations.count(ptr.mRef))
+        return;
+
+    Emitter emitter;
+    emitter.mPtr = ptr;
+    emitter.mScale = scale;
+    emitter.mForce = force;
+    emitter.mLastEmitPosition = osg::Vec3f(0,0,0);
+    emitter.mTimeSinceEmit = mMinInterval;
+    insert(emitter);
+}
+
+void RippleEmitters::remove(const MWWorld::ConstPtr& ptr)
+{
+    Locations::iterator found = mLocations.find(ptr.mRef);
+    if (found == mLocations.end())
+        return;
+
+    erase(found->second);
+}
+
+void RippleEmitters::updatePtr(const MWWorld::ConstPtr& old, const MWWorld::ConstPtr& ptr)
+{
+    Locations::iterator found = mLocations.find(old.mRef);
+    if (found == mLocations.end())
+        return;
+
+    Location location = found->second;
+    if (old.mRef == ptr.mRef && location.mCell == ptr.mCell)
+    {
+        mBuckets[location.mCell][location.mIndex].mPtr = ptr;
+        return;
+    }
+
+    Emitter emitter = erase(location);
+    emitter.mPtr = ptr;
+    insert(emitter);
+}
+
+void RippleEmitters::removeCell(const MWWorld::CellStore* cell, const MWWorld::ConstPtr& keep)
+{
+    Buckets::iterator found = mBuckets.find(cell);
+    if (found == mBuckets.end())
+        return;
+
+    Bucket bucket;
+    bucket.swap(found->second);
+    mBuckets.erase(found);
+
+    for (Bucket::const_iterator it = bucket.begin(); it != bucket.end(); ++it)
+    {
+        mLocations.erase(it->mPtr.mRef);
+        if (it->mPtr == keep)
+        {
+            Emitter kept = *it;
+            kept.mPtr = keep;
+            insert(kept);
+        }
+    }
+}
+
+void RippleEmitters::clear()
+{
+    mBuckets.clear();
+    mLocations.clear();
+}
+
+std::size_t RippleEmitters::size() const
+{
+    return mLocations.size();
+}
+
+void RippleEmitters::update(float dt, const osg::Vec3f& cameraPos, Actors& actors, std::vector<osg::Vec3f>& ripples)
+{
+    mNumTested = 0;
+
+    const float maxDistance2 = mMaxDistance * mMaxDistance;
+
+    for (Buckets::iterator bucket = mBuckets.begin(); bucket != mBuckets.end(); ++bucket)
+    {
+        for (Bucket::iterator it = bucket->second.begin(); it != bucket->second.end(); ++it)
+        {
+            it->mTimeSinceEmit = std::min(it->mTimeSinceEmit + dt, mMinInterval);
+
+            osg::Vec3f currentPos = actors.getPosition(it->mPtr);
+
+            if ((currentPos - cameraPos).length2() > maxDistance2)
+                continue;
+
+            if ((currentPos - it->mLastEmitPosition).length2() <= 10*10 || it->mTimeSinceEmit < mMinInterval)
+                continue;
+
+            ++mNumTested;
+            if (!actors.isAtWaterSurface(it->mPtr))
+                continue;
+
+            it->mLastEmitPosition = currentPos;
+            it->mTimeSinceEmit = 0.f;
+            ripples.push_back(currentPos);
+        }
+    }
+}
+
+std::size_t RippleEmitters::getNumTested() const
+{
+    return mNumTested;
+}
+
+void RippleEmitters::insert(const Emitter& emitter)
+{
+    Bucket& bucket = mBuckets[emitter.mPtr.mCell];
+
+    Location location;
+    location.mCell = emitter.mPtr.mCell;
+    location.mIndex = bucket.size();
+    mLocations[emitter.mPtr.mRef] = location;
+
+    bucket.push_back(emitter);
+}
+
+Emitter RippleEmitters::erase(Location location)
+{
+    Bucket& bucket = mBuckets[location.mCell];
+    Emitter emitter = bucket[location.mIndex];
+
+    mLocations.erase(emitter.mPtr.mRef);
+
+    // move the last emitter into the gap
+    if (location.mIndex != bucket.size() - 1)
+    {
+        bucket[location.mIndex] = bucket.back();
+        mLocations[bucket[location.mIndex].mPtr.mRef].mIndex = location.mIndex;
+    }
+    bucket.pop_back();
+
+    return emitter;
+}
+
+}
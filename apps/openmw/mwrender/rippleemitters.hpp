@@ -0,0 +1,94 @@
+#ifndef OPENMW_MWRENDER_RIPPLEEMITTERS_H
+#define OPENMW_MWRENDER_RIPPLEEMITTERS_H
+
+#include <unordered_map>
+#include <vector>
+
+#include <osg/Vec3f>
+
+#include "../mwworld/ptr.hpp"
+
+namespace MWRender
+{
+
+    struct Emitter
+    {
+        MWWorld::ConstPtr mPtr;
+        osg::Vec3f mLastEmitPosition;
+        float mScale;
+        float mForce;
+        float mTimeSinceEmit; ///< Time since the last ripple of this emitter
+    };
+
+    /// @brief The actors making ripples on the water, grouped by the cell they are in.
+    class RippleEmitters
+    {
+    public:
+        /// What the emitters need to know about their actors
+        class Actors
+        {
+        public:
+            virtual ~Actors() {}
+
+            virtual osg::Vec3f getPosition(const MWWorld::ConstPtr& ptr) = 0;
+
+            /// @return Is the actor swimming at the water surface or walking on water?
+            virtual bool isAtWaterSurface(const MWWorld::ConstPtr& ptr) = 0;
+        };
+
+        /// @param maxDistance Emitters farther away from the camera don't make ripples
+        /// @param minInterval Minimum time between two ripples of the same emitter
+        RippleEmitters(float maxDistance, float minInterval);
+
+        void add(const MWWorld::ConstPtr& ptr, float scale, float force);
+        void remove(const MWWorld::ConstPtr& ptr);
+
+        /// Replace the ptr of an emitter, e.g. after it moved to another cell
+        void updatePtr(const MWWorld::ConstPtr& old, const MWWorld::ConstPtr& ptr);
+
+        /// Remove the emitters in \a cell, except for \a keep
+        void removeCell(const MWWorld::CellStore* cell, const MWWorld::ConstPtr& keep);
+
+        void clear();
+
+        std::size_t size() const;
+
+        /// Find the emitters that make a ripple in this frame. An emitter has to be close to the camera,
+        /// have moved since its last ripple and be at the water surface. Only the emitters that passed the
+        /// other tests are asked for the latter.
+        /// @param ripples The positions of the new ripples are appended
+        void update(float dt, const osg::Vec3f& cameraPos, Actors& actors, std::vector<osg::Vec3f>& ripples);
+
+        /// @return Number of emitters tested for water contact in the last update
+        std::size_t getNumTested() const;
+
+    private:
+        typedef std::vector<Emitter> Bucket;
+        typedef std::unordered_map<const MWWorld::CellStore*, Bucket> Buckets;
+
+        /// Emitters by cell
+        Buckets mBuckets;
+
+        struct Location
+        {
+            const MWWorld::CellStore* mCell; ///< Key of the bucket
+            std::size_t mIndex; ///< Index in the bucket
+        };
+
+        /// Where each emitter is stored
+        typedef std::unordered_map<const MWWorld::LiveCellRefBase*, Location> Locations;
+        Locations mLocations;
+
+        float mMaxDistance;
+        float mMinInterval;
+        std::size_t mNumTested;
+
+        void insert(const Emitter& emitter);
+
+        /// Remove the emitter at \a location, the bucket is kept even if it becomes empty
+        Emitter erase(Location location);
+    };
+
+}
+
+#endif
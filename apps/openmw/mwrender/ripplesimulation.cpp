@@ -26,6 +26,35 @@
 
 namespace
 {
+    /// Actors farther away from the camera don't make ripples
+    const float sMaxRippleDistance = 8192.f;
+
+    /// Minimum time between two ripples of the same actor
+    const float sMinRippleInterval = 1.f/30.f;
+
+    class WorldActors : public MWRender::RippleEmitters::Actors
+    {
+    public:
+        WorldActors()
+            : mWorld(MWBase::Environment::get().getWorld())
+        {
+        }
+
+        virtual osg::Vec3f getPosition(const MWWorld::ConstPtr& ptr)
+        {
+            return ptr.getRefData().getPosition().asVec3();
+        }
+
+        virtual bool isAtWaterSurface(const MWWorld::ConstPtr& ptr)
+        {
+            return (mWorld->isUnderwater(ptr.getCell(), ptr.getRefData().getPosition().asVec3()) && !mWorld->isSubmerged(ptr))
+                    || mWorld->isWalkingOnWater(ptr);
+        }
+
+    private:
+        const MWBase::World* mWorld;
+    };
+
     void createWaterRippleStateSet(Resource::ResourceSystem* resourceSystem, const Fallback::Map* fallback, osg::Node* node)
     {
         int rippleFrameCount = fallback->getFallbackInt("Water_RippleFrameCount");
@@ -83,6 +112,7 @@ namespace MWRender
 
 RippleSimulation::RippleSimulation(osg::Group *parent, Resource::ResourceSystem* resourceSystem, const Fallback::Map* fallback)
     : mParent(parent)
+    , mEmitters(sMaxRippleDistance, sMinRippleInterval)
 {
     mParticleSystem = new osgParticle::ParticleSystem;
 
@@ -115,81 +145,47 @@ RippleSimulation::~RippleSimulation()
     mParent->removeChild(mParticleNode);
 }
 
-void RippleSimulation::update(float dt)
+void RippleSimulation::update(float dt, const osg::Vec3f& cameraPos)
 {
-    const MWBase::World* world = MWBase::Environment::get().getWorld();
-    for (std::vector<Emitter>::iterator it=mEmitters.begin(); it !=mEmitters.end(); ++it)
-    {
-        if (it->mPtr == MWBase::Environment::get().getWorld ()->getPlayerPtr())
-        {
-            // fetch a new ptr (to handle cell change etc)
-            // for non-player actors this is done in updateObjectCell
-            it->mPtr = MWBase::Environment::get().getWorld ()->getPlayerPtr();
-        }
+    // fetch a new ptr (to handle cell change etc)
+    // for non-player actors this is done in updateObjectCell
+    MWWorld::ConstPtr player = MWMechanics::getPlayer();
+    mEmitters.updatePtr(player, player);
 
-        osg::Vec3f currentPos (it->mPtr.getRefData().getPosition().asVec3());
-
-        bool shouldEmit = ( world->isUnderwater (it->mPtr.getCell(), it->mPtr.getRefData().getPosition().asVec3()) && !world->isSubmerged(it->mPtr) ) || world->isWalkingOnWater(it->mPtr);
-        if ( shouldEmit && (currentPos - it->mLastEmitPosition).length() > 10 )
-        {
-            it->mLastEmitPosition = currentPos;
+    WorldActors actors;
+    mRipples.clear();
+    mEmitters.update(dt, cameraPos, actors, mRipples);
 
-            currentPos.z() = mParticleNode->getPosition().z();
-
-            if (mParticleSystem->numParticles()-mParticleSystem->numDeadParticles() > 500)
-                continue; // TODO: remove the oldest particle to make room?
+    for (std::vector<osg::Vec3f>::iterator it = mRipples.begin(); it != mRipples.end(); ++it)
+    {
+        if (mParticleSystem->numParticles()-mParticleSystem->numDeadParticles() > 500)
+            break; // TODO: remove the oldest particle to make room?
 
-            emitRipple(currentPos);
-        }
+        // dead particles are reused, so this doesn't allocate once the system is warmed up
+        it->z() = mParticleNode->getPosition().z();
+        emitRipple(*it);
     }
 }
 
 
 void RippleSimulation::addEmitter(const MWWorld::ConstPtr& ptr, float scale, float force)
 {
-    Emitter newEmitter;
-    newEmitter.mPtr = ptr;
-    newEmitter.mScale = scale;
-    newEmitter.mForce = force;
-    newEmitter.mLastEmitPosition = osg::Vec3f(0,0,0);
-    mEmitters.push_back (newEmitter);
+    mEmitters.add(ptr, scale, force);
 }
 
 void RippleSimulation::removeEmitter (const MWWorld::ConstPtr& ptr)
 {
-    for (std::vector<Emitter>::iterator it = mEmitters.begin(); it != mEmitters.end(); ++it)
-    {
-        if (it->mPtr == ptr)
-        {
-            mEmitters.erase(it);
-            return;
-        }
-    }
+    mEmitters.remove(ptr);
 }
 
 void RippleSimulation::updateEmitterPtr (const MWWorld::ConstPtr& old, const MWWorld::ConstPtr& ptr)
 {
-    for (std::vector<Emitter>::iterator it = mEmitters.begin(); it != mEmitters.end(); ++it)
-    {
-        if (it->mPtr == old)
-        {
-            it->mPtr = ptr;
-            return;
-        }
-    }
+    mEmitters.updatePtr(old, ptr);
 }
 
 void RippleSimulation::removeCell(const MWWorld::CellStore *store)
 {
-    for (std::vector<Emitter>::iterator it = mEmitters.begin(); it != mEmitters.end();)
-    {
-        if ((it->mPtr.isInCell() && it->mPtr.getCell() == store) && it->mPtr != MWMechanics::getPlayer())
-        {
-            it = mEmitters.erase(it);
-        }
-        else
-            ++it;
-    }
+    mEmitters.removeCell(store, MWMechanics::getPlayer());
 }
 
 void RippleSimulation::emitRipple(const osg::Vec3f &pos)
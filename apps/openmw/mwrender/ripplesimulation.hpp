@@ -5,6 +5,8 @@
 
 #include "../mwworld/ptr.hpp"
 
+#include "rippleemitters.hpp"
+
 namespace osg
 {
     class Group;
@@ -29,14 +31,6 @@ namespace Fallback
 namespace MWRender
 {
 
-    struct Emitter
-    {
-        MWWorld::ConstPtr mPtr;
-        osg::Vec3f mLastEmitPosition;
-        float mScale;
-        float mForce;
-    };
-
     class RippleSimulation
     {
     public:
@@ -44,7 +38,8 @@ namespace MWRender
         ~RippleSimulation();
 
         /// @param dt Time since the last frame
-        void update(float dt);
+        /// @param cameraPos Only emitters close to the camera make ripples
+        void update(float dt, const osg::Vec3f& cameraPos);
 
         /// adds an emitter, position will be tracked automatically
         void addEmitter (const MWWorld::ConstPtr& ptr, float scale = 1.f, float force = 1.f);
@@ -66,7 +61,10 @@ namespace MWRender
         osg::ref_ptr<osgParticle::ParticleSystem> mParticleSystem;
         osg::ref_ptr<osg::PositionAttitudeTransform> mParticleNode;
 
-        std::vector<Emitter> mEmitters;
+        RippleEmitters mEmitters;
+
+        /// Positions of the ripples to emit in the current frame, kept to reuse its memory
+        std::vector<osg::Vec3f> mRipples;
     };
 
 }
@@ -2,6 +2,7 @@
 
 #include <osg/Node>
 #include <osg/ValueObject>
+#include <osg/Texture2D>
 
 #include <components/resource/resourcesystem.hpp>
 #include <components/resource/imagemanager.hpp>
@@ -14,10 +15,9 @@ namespace MWRender
 class TextureOverrideVisitor : public osg::NodeVisitor
     {
     public:
-        TextureOverrideVisitor(const std::string& texture, Resource::ResourceSystem* resourcesystem)
+        TextureOverrideVisitor(osg::ref_ptr<osg::Texture2D> texture)
             : osg::NodeVisitor(TRAVERSE_ALL_CHILDREN)
             , mTexture(texture)
-            , mResourcesystem(resourcesystem)
         {
         }
 
@@ -28,30 +28,48 @@ class TextureOverrideVisitor : public osg::NodeVisitor
             if (node.getUserValue("overrideFx", index))
             {
                 if (index == 1) 
-                    overrideTexture(mTexture, mResourcesystem, nodePtr);
+                    overrideTexture(mTexture, nodePtr);
             }
             traverse(node);
         }
-        std::string mTexture;
-        Resource::ResourceSystem* mResourcesystem;
+        osg::ref_ptr<osg::Texture2D> mTexture;
 };
 
 void overrideFirstRootTexture(const std::string &texture, Resource::ResourceSystem *resourceSystem, osg::ref_ptr<osg::Node> node)
 {
-    TextureOverrideVisitor overrideVisitor(texture, resourceSystem);
-    node->accept(overrideVisitor);
+    overrideFirstRootTexture(createOverrideTexture(texture, resourceSystem), node);
 }
 
 void overrideTexture(const std::string &texture, Resource::ResourceSystem *resourceSystem, osg::ref_ptr<osg::Node> node)
+{
+    overrideTexture(createOverrideTexture(texture, resourceSystem), node);
+}
+
+osg::ref_ptr<osg::Texture2D> createOverrideTexture(const std::string &texture, Resource::ResourceSystem *resourceSystem)
 {
     if (texture.empty())
-        return;
+        return NULL;
     std::string correctedTexture = Misc::ResourceHelpers::correctTexturePath(texture, resourceSystem->getVFS());
     // Not sure if wrap settings should be pulled from the overridden texture?
     osg::ref_ptr<osg::Texture2D> tex = new osg::Texture2D(resourceSystem->getImageManager()->getImage(correctedTexture));
     tex->setWrap(osg::Texture::WRAP_S, osg::Texture::CLAMP_TO_EDGE);
     tex->setWrap(osg::Texture::WRAP_T, osg::Texture::CLAMP_TO_EDGE);
     tex->setName("diffuseMap");
+    return tex;
+}
+
+void overrideFirstRootTexture(osg::ref_ptr<osg::Texture2D> texture, osg::ref_ptr<osg::Node> node)
+{
+    if (!texture)
+        return;
+    TextureOverrideVisitor overrideVisitor(texture);
+    node->accept(overrideVisitor);
+}
+
+void overrideTexture(osg::ref_ptr<osg::Texture2D> texture, osg::ref_ptr<osg::Node> node)
+{
+    if (!texture)
+        return;
 
     osg::ref_ptr<osg::StateSet> stateset;
     if (node->getStateSet())
@@ -59,7 +77,7 @@ void overrideTexture(const std::string &texture, Resource::ResourceSystem *resou
     else
         stateset = new osg::StateSet;
 
-    stateset->setTextureAttribute(0, tex, osg::StateAttribute::OVERRIDE);
+    stateset->setTextureAttribute(0, texture, osg::StateAttribute::OVERRIDE);
 
     node->setStateSet(stateset);
 }
@@ -8,6 +8,7 @@
 namespace osg
 {
     class Node;
+    class Texture2D;
 }
 
 namespace Resource
@@ -23,6 +24,14 @@ namespace MWRender
 
     void overrideTexture(const std::string& texture, Resource::ResourceSystem* resourceSystem, osg::ref_ptr<osg::Node> node);
 
+    // Create the texture used by overrideTexture, so that it can be reused for several nodes. Returns NULL if texture is empty.
+    osg::ref_ptr<osg::Texture2D> createOverrideTexture(const std::string& texture, Resource::ResourceSystem* resourceSystem);
+
+    // Same as the above, with a texture created by createOverrideTexture. A NULL texture leaves the node unchanged.
+    void overrideFirstRootTexture(osg::ref_ptr<osg::Texture2D> texture, osg::ref_ptr<osg::Node> node);
+
+    void overrideTexture(osg::ref_ptr<osg::Texture2D> texture, osg::ref_ptr<osg::Node> node);
+
     // Node callback to entirely skip the traversal.
     class NoTraverseCallback : public osg::NodeCallback
     {
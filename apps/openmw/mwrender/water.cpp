@@ -272,8 +272,8 @@ public:
 
     void setWaterLevel(float waterLevel)
     {
-        const float refractionScale = std::min(1.0f,std::max(0.0f,
-            Settings::Manager::getFloat("refraction scale", "Water")));
+        static const Settings::Handle<float> scale("refraction scale", "Water");
+        const float refractionScale = std::min(1.0f,std::max(0.0f, scale.get()));
 
         setViewMatrix(osg::Matrix::scale(1,1,refractionScale) *
             osg::Matrix::translate(0,0,(1.0 - refractionScale) * waterLevel));
@@ -393,6 +393,12 @@ Water::Water(osg::Group *parent, osg::Group* sceneRoot, Resource::ResourceSystem
     , mSceneRoot(sceneRoot)
     , mResourceSystem(resourceSystem)
     , mFallback(fallback)
+    , mSurfaceFrameCount(*fallback, "Water_SurfaceFrameCount")
+    , mSurfaceTexture(*fallback, "Water_SurfaceTexture")
+    , mSurfaceFPS(*fallback, "Water_SurfaceFPS")
+    , mWorldAlpha(*fallback, "Water_World_Alpha")
+    , mShader("shader", "Water")
+    , mUseRefraction("refraction", "Water")
     , mResourcePath(resourcePath)
     , mEnabled(true)
     , mToggled(true)
@@ -447,14 +453,14 @@ void Water::updateWaterMaterial()
         mRefraction = NULL;
     }
 
-    if (Settings::Manager::getBool("shader", "Water"))
+    if (mShader.get())
     {
         mReflection = new Reflection;
         mReflection->setWaterLevel(mTop);
         mReflection->setScene(mSceneRoot);
         mParent->addChild(mReflection);
 
-        if (Settings::Manager::getBool("refraction", "Water"))
+        if (mUseRefraction.get())
         {
             mRefraction = new Refraction;
             mRefraction->setWaterLevel(mTop);
@@ -465,7 +471,7 @@ void Water::updateWaterMaterial()
         createShaderWaterStateSet(mWaterGeom, mReflection, mRefraction);
     }
     else
-        createSimpleWaterStateSet(mWaterGeom, mFallback->getFallbackFloat("Water_World_Alpha"));
+        createSimpleWaterStateSet(mWaterGeom, mWorldAlpha.get());
 
     updateVisible();
 }
@@ -478,8 +484,8 @@ void Water::createSimpleWaterStateSet(osg::Node* node, float alpha)
 
     // Add animated textures
     std::vector<osg::ref_ptr<osg::Texture2D> > textures;
-    int frameCount = mFallback->getFallbackInt("Water_SurfaceFrameCount");
-    std::string texture = mFallback->getFallbackString("Water_SurfaceTexture");
+    int frameCount = mSurfaceFrameCount.get();
+    const std::string& texture = mSurfaceTexture.get();
     for (int i=0; i<frameCount; ++i)
     {
         std::ostringstream texname;
@@ -493,7 +499,7 @@ void Water::createSimpleWaterStateSet(osg::Node* node, float alpha)
     if (textures.empty())
         return;
 
-    float fps = mFallback->getFallbackFloat("Water_SurfaceFPS");
+    float fps = mSurfaceFPS.get();
 
     osg::ref_ptr<NifOsg::FlipController> controller (new NifOsg::FlipController(0, 1.f/fps, textures));
     controller->setSource(std::shared_ptr<SceneUtil::ControllerSource>(new SceneUtil::FrameTimeSource));
@@ -569,7 +575,7 @@ void Water::createShaderWaterStateSet(osg::Node* node, Reflection* reflection, R
     node->setUpdateCallback(NULL);
 }
 
-void Water::processChangedSettings(const Settings::CategorySettingVector& settings)
+void Water::processChangedSettings()
 {
     updateWaterMaterial();
 }
@@ -594,8 +600,8 @@ Water::~Water()
 
 void Water::listAssetsToPreload(std::vector<std::string> &textures)
 {
-    int frameCount = mFallback->getFallbackInt("Water_SurfaceFrameCount");
-    std::string texture = mFallback->getFallbackString("Water_SurfaceTexture");
+    int frameCount = mSurfaceFrameCount.get();
+    const std::string& texture = mSurfaceTexture.get();
     for (int i=0; i<frameCount; ++i)
     {
         std::ostringstream texname;
@@ -639,9 +645,9 @@ void Water::setHeight(const float height)
         mRefraction->setWaterLevel(mTop);
 }
 
-void Water::update(float dt)
+void Water::update(float dt, const osg::Vec3f& cameraPos)
 {
-    mSimulation->update(dt);
+    mSimulation->update(dt, cameraPos);
 }
 
 void Water::updateVisible()
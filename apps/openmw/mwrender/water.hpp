@@ -9,6 +9,7 @@
 #include <osg/Uniform>
 
 #include <components/settings/settings.hpp>
+#include <components/fallback/fallback.hpp>
 
 namespace osg
 {
@@ -34,11 +35,6 @@ namespace MWWorld
     class Ptr;
 }
 
-namespace Fallback
-{
-    class Map;
-}
-
 namespace MWRender
 {
 
@@ -59,6 +55,12 @@ namespace MWRender
         osg::ref_ptr<osg::Geometry> mWaterGeom;
         Resource::ResourceSystem* mResourceSystem;
         const Fallback::Map* mFallback;
+        Fallback::Handle<int> mSurfaceFrameCount;
+        Fallback::Handle<std::string> mSurfaceTexture;
+        Fallback::Handle<float> mSurfaceFPS;
+        Fallback::Handle<float> mWorldAlpha;
+        Settings::Handle<bool> mShader;
+        Settings::Handle<bool> mUseRefraction;
         osg::ref_ptr<osgUtil::IncrementalCompileOperation> mIncrementalCompileOperation;
 
         std::unique_ptr<RippleSimulation> mSimulation;
@@ -110,9 +112,10 @@ namespace MWRender
         void changeCell(const MWWorld::CellStore* store);
         void setHeight(const float height);
 
-        void update(float dt);
+        /// @param cameraPos Only actors close to the camera make ripples
+        void update(float dt, const osg::Vec3f& cameraPos);
 
-        void processChangedSettings(const Settings::CategorySettingVector& settings);
+        void processChangedSettings();
 
         osg::Uniform *getRainIntensityUniform();
     };
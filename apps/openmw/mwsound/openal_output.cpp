@@ -117,6 +117,9 @@ LPALGETAUXILIARYEFFECTSLOTI alGetAuxiliaryEffectSloti;
 LPALGETAUXILIARYEFFECTSLOTIV alGetAuxiliaryEffectSlotiv;
 LPALGETAUXILIARYEFFECTSLOTF alGetAuxiliaryEffectSlotf;
 LPALGETAUXILIARYEFFECTSLOTFV alGetAuxiliaryEffectSlotfv;
+// Deferred source updates
+LPALDEFERUPDATESSOFT alDeferUpdatesSOFT;
+LPALPROCESSUPDATESSOFT alProcessUpdatesSOFT;
 
 
 void LoadEffect(ALuint effect, const EFXEAXREVERBPROPERTIES &props)
@@ -693,6 +696,14 @@ bool OpenAL_Output::init(const std::string &devname, const std::string &hrtfname
     }
 
     AL.SOFT_source_spatialize = alIsExtensionPresent("AL_SOFT_source_spatialize");
+    AL.SOFT_deferred_updates = alIsExtensionPresent("AL_SOFT_deferred_updates");
+    if(AL.SOFT_deferred_updates)
+    {
+        getALFunc(alDeferUpdatesSOFT, "alDeferUpdatesSOFT");
+        getALFunc(alProcessUpdatesSOFT, "alProcessUpdatesSOFT");
+        if(!alDeferUpdatesSOFT || !alProcessUpdatesSOFT)
+            AL.SOFT_deferred_updates = false;
+    }
 
     ALCuint maxtotal;
     ALCint maxmono = 0, maxstereo = 0;
@@ -1110,24 +1121,48 @@ void OpenAL_Output::initCommon3D(ALuint source, const osg::Vec3f &pos, ALfloat m
     alSource3f(source, AL_VELOCITY, 0.0f, 0.0f, 0.0f);
 }
 
-void OpenAL_Output::updateCommon(ALuint source, const osg::Vec3f& pos, ALfloat maxdist, ALfloat gain, ALfloat pitch, bool useenv, bool is3d)
+SourceParams OpenAL_Output::getSourceParams(const SoundBase *sound) const
 {
-    if(is3d)
+    SourceParams params(sound->getPosition(), sound->getRealVolume(), sound->getPitch());
+    if(sound->getIs3D())
     {
-        if((pos - mListenerPos).length2() > maxdist*maxdist)
-            gain = 0.0f;
+        float maxdist = sound->getMaxDistance();
+        if((params.mPos - mListenerPos).length2() > maxdist*maxdist)
+            params.mGain = 0.0f;
     }
-    if(useenv && mListenerEnv == Env_Underwater && !mWaterFilter)
+    if(sound->getUseEnv() && mListenerEnv == Env_Underwater && !mWaterFilter)
     {
-        gain *= 0.9f;
-        pitch *= 0.7f;
+        params.mGain *= 0.9f;
+        params.mPitch *= 0.7f;
     }
+    return params;
+}
 
-    alSourcef(source, AL_GAIN, gain);
-    alSourcef(source, AL_PITCH, pitch);
-    alSourcefv(source, AL_POSITION, pos.ptr());
-    alSource3f(source, AL_DIRECTION, 0.0f, 0.0f, 0.0f);
-    alSource3f(source, AL_VELOCITY, 0.0f, 0.0f, 0.0f);
+void OpenAL_Output::updateCommon(ALuint source, SoundBase *sound)
+{
+    // Direction and velocity never change after initCommon2D/3D, and unchanged or inaudible
+    // sources are skipped entirely, so most sources don't cost a single call per frame.
+    SourceParams params = getSourceParams(sound);
+    int changes = sound->updateSourceParams(params);
+
+    if(changes & SourceParams::Change_Gain)
+        alSourcef(source, AL_GAIN, params.mGain);
+    if(changes & SourceParams::Change_Pitch)
+        alSourcef(source, AL_PITCH, params.mPitch);
+    if(changes & SourceParams::Change_Position)
+        alSourcefv(source, AL_POSITION, params.mPos.ptr());
+}
+
+bool OpenAL_Output::stealSource(Sound *sound)
+{
+    // Give the least audible sound's source to the new sound, if the new sound would be more audible.
+    // The sound manager notices the stolen sound is no longer playing and releases it on its next update.
+    Sound *leastAudible = getLeastAudible(mActiveSounds, getSourceParams(sound).mGain);
+    if(!leastAudible)
+        return false;
+
+    finishSound(leastAudible);
+    return true;
 }
 
 
@@ -1135,7 +1170,7 @@ bool OpenAL_Output::playSound(Sound *sound, Sound_Handle data, float offset)
 {
     ALuint source;
 
-    if(mFreeSources.empty())
+    if(mFreeSources.empty() && !stealSource(sound))
     {
         std::cerr<< "No free sources!" <<std::endl;
         return false;
@@ -1155,6 +1190,7 @@ bool OpenAL_Output::playSound(Sound *sound, Sound_Handle data, float offset)
 
     mFreeSources.pop_front();
     sound->mHandle = MAKE_PTRID(source);
+    sound->updateSourceParams(getSourceParams(sound));
     mActiveSounds.push_back(sound);
 
     return true;
@@ -1164,7 +1200,7 @@ bool OpenAL_Output::playSound3D(Sound *sound, Sound_Handle data, float offset)
 {
     ALuint source;
 
-    if(mFreeSources.empty())
+    if(mFreeSources.empty() && !stealSource(sound))
     {
         std::cerr<< "No free sources!" <<std::endl;
         return false;
@@ -1185,6 +1221,7 @@ bool OpenAL_Output::playSound3D(Sound *sound, Sound_Handle data, float offset)
 
     mFreeSources.pop_front();
     sound->mHandle = MAKE_PTRID(source);
+    sound->updateSourceParams(getSourceParams(sound));
     mActiveSounds.push_back(sound);
 
     return true;
@@ -1224,8 +1261,17 @@ void OpenAL_Output::updateSound(Sound *sound)
     if(!sound->mHandle) return;
     ALuint source = GET_PTRID(sound->mHandle);
 
-    updateCommon(source, sound->getPosition(), sound->getMaxDistance(), sound->getRealVolume(),
-                 sound->getPitch(), sound->getUseEnv(), sound->getIs3D());
+    updateCommon(source, sound);
+    getALError();
+}
+
+void OpenAL_Output::updateSounds(const std::vector<Sound*> &sounds)
+{
+    for(Sound *sound : sounds)
+    {
+        if(sound->mHandle)
+            updateCommon(GET_PTRID(sound->mHandle), sound);
+    }
     getALError();
 }
 
@@ -1256,6 +1302,7 @@ bool OpenAL_Output::streamSound(DecoderPtr decoder, Stream *sound)
 
     mFreeSources.pop_front();
     sound->mHandle = stream;
+    sound->updateSourceParams(getSourceParams(sound));
     mActiveStreams.push_back(sound);
     return true;
 }
@@ -1286,6 +1333,7 @@ bool OpenAL_Output::streamSound3D(DecoderPtr decoder, Stream *sound, bool getLou
 
     mFreeSources.pop_front();
     sound->mHandle = stream;
+    sound->updateSourceParams(getSourceParams(sound));
     mActiveStreams.push_back(sound);
     return true;
 }
@@ -1349,20 +1397,35 @@ void OpenAL_Output::updateStream(Stream *sound)
     OpenAL_SoundStream *stream = reinterpret_cast<OpenAL_SoundStream*>(sound->mHandle);
     ALuint source = stream->mSource;
 
-    updateCommon(source, sound->getPosition(), sound->getMaxDistance(), sound->getRealVolume(),
-                 sound->getPitch(), sound->getUseEnv(), sound->getIs3D());
+    updateCommon(source, sound);
+    getALError();
+}
+
+void OpenAL_Output::updateStreams(const std::vector<Stream*> &sounds)
+{
+    for(Stream *sound : sounds)
+    {
+        if(sound->mHandle)
+            updateCommon(reinterpret_cast<OpenAL_SoundStream*>(sound->mHandle)->mSource, sound);
+    }
     getALError();
 }
 
 
 void OpenAL_Output::startUpdate()
 {
-    alcSuspendContext(alcGetCurrentContext());
+    if(AL.SOFT_deferred_updates)
+        alDeferUpdatesSOFT();
+    else
+        alcSuspendContext(alcGetCurrentContext());
 }
 
 void OpenAL_Output::finishUpdate()
 {
-    alcProcessContext(alcGetCurrentContext());
+    if(AL.SOFT_deferred_updates)
+        alProcessUpdatesSOFT();
+    else
+        alcProcessContext(alcGetCurrentContext());
 }
 
 
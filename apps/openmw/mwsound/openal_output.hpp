@@ -29,6 +29,7 @@ namespace MWSound
         } ALC;
         struct {
             bool SOFT_source_spatialize : 1;
+            bool SOFT_deferred_updates : 1;
         } AL;
 
         typedef std::deque<ALuint> IDDq;
@@ -53,7 +54,10 @@ namespace MWSound
         void initCommon2D(ALuint source, const osg::Vec3f &pos, ALfloat gain, ALfloat pitch, bool loop, bool useenv);
         void initCommon3D(ALuint source, const osg::Vec3f &pos, ALfloat mindist, ALfloat maxdist, ALfloat gain, ALfloat pitch, bool loop, bool useenv);
 
-        void updateCommon(ALuint source, const osg::Vec3f &pos, ALfloat maxdist, ALfloat gain, ALfloat pitch, bool useenv, bool is3d);
+        SourceParams getSourceParams(const SoundBase *sound) const;
+        void updateCommon(ALuint source, SoundBase *sound);
+
+        bool stealSource(Sound *sound);
 
         OpenAL_Output& operator=(const OpenAL_Output &rhs);
         OpenAL_Output(const OpenAL_Output &rhs);
@@ -74,6 +78,7 @@ namespace MWSound
         virtual void finishSound(Sound *sound);
         virtual bool isSoundPlaying(Sound *sound);
         virtual void updateSound(Sound *sound);
+        virtual void updateSounds(const std::vector<Sound*> &sounds);
 
         virtual bool streamSound(DecoderPtr decoder, Stream *sound);
         virtual bool streamSound3D(DecoderPtr decoder, Stream *sound, bool getLoudnessData);
@@ -83,6 +88,7 @@ namespace MWSound
         virtual float getStreamLoudness(Stream *sound);
         virtual bool isStreamPlaying(Stream *sound);
         virtual void updateStream(Stream *sound);
+        virtual void updateStreams(const std::vector<Stream*> &sounds);
 
         virtual void startUpdate();
         virtual void finishUpdate();
@@ -2,6 +2,7 @@
 #define GAME_SOUND_SOUND_H
 
 #include <algorithm>
+#include <vector>
 
 #include "sound_output.hpp"
 
@@ -11,6 +12,23 @@ namespace MWSound
     inline int operator&(int a, PlayMode b) { return a & static_cast<int>(b); }
     inline int operator&(PlayMode a, PlayMode b) { return static_cast<int>(a) & static_cast<int>(b); }
 
+    /// Parameters of an output source that may change while a sound is playing
+    struct SourceParams {
+        enum Changes {
+            Change_Gain = 1<<0,
+            Change_Pitch = 1<<1,
+            Change_Position = 1<<2,
+            Change_All = Change_Gain | Change_Pitch | Change_Position
+        };
+
+        osg::Vec3f mPos;
+        float mGain;
+        float mPitch;
+
+        SourceParams() : mPos(0.0f, 0.0f, 0.0f), mGain(1.0f), mPitch(1.0f) { }
+        SourceParams(const osg::Vec3f &pos, float gain, float pitch) : mPos(pos), mGain(gain), mPitch(pitch) { }
+    };
+
     class SoundBase {
         SoundBase& operator=(const SoundBase&) = delete;
         SoundBase(const SoundBase&) = delete;
@@ -26,6 +44,10 @@ namespace MWSound
 
         float mFadeOutTime;
 
+        /* Source parameters last applied by the output */
+        SourceParams mSourceParams;
+        bool mSourceParamsValid;
+
     protected:
         Sound_Instance mHandle;
 
@@ -59,6 +81,36 @@ namespace MWSound
         bool getDistanceCull() const { return mFlags&MWSound::PlayMode::RemoveAtDistance; }
         bool getIs3D() const { return mFlags&Play_3D; }
 
+        /// Source parameters last applied by the output, only valid after the first update.
+        const SourceParams &getSourceParams() const { return mSourceParams; }
+
+        /// Remember the source parameters the output is about to apply.
+        /// @note While the sound stays inaudible, other changes are deferred until it becomes audible again.
+        /// @return Bitmask of SourceParams::Changes the output needs to apply, 0 if the source needn't be touched.
+        int updateSourceParams(const SourceParams &params)
+        {
+            if(!mSourceParamsValid)
+            {
+                mSourceParams = params;
+                mSourceParamsValid = true;
+                return SourceParams::Change_All;
+            }
+
+            if(params.mGain <= 0.0f && mSourceParams.mGain <= 0.0f)
+                return 0;
+
+            int changes = 0;
+            if(params.mGain != mSourceParams.mGain)
+                changes |= SourceParams::Change_Gain;
+            if(params.mPitch != mSourceParams.mPitch)
+                changes |= SourceParams::Change_Pitch;
+            if(params.mPos != mSourceParams.mPos)
+                changes |= SourceParams::Change_Position;
+
+            mSourceParams = params;
+            return changes;
+        }
+
         void init(const osg::Vec3f& pos, float vol, float basevol, float pitch, float mindist, float maxdist, int flags)
         {
             mPos = pos;
@@ -69,6 +121,7 @@ namespace MWSound
             mMaxDistance = maxdist;
             mFlags = flags;
             mFadeOutTime = 0.0f;
+            mSourceParamsValid = false;
             mHandle = nullptr;
         }
 
@@ -82,13 +135,14 @@ namespace MWSound
             mMaxDistance = 1000.0f;
             mFlags = flags;
             mFadeOutTime = 0.0f;
+            mSourceParamsValid = false;
             mHandle = nullptr;
         }
 
         SoundBase()
           : mPos(0.0f, 0.0f, 0.0f), mVolume(1.0f), mBaseVolume(1.0f), mPitch(1.0f)
           , mMinDistance(1.0f), mMaxDistance(1000.0f), mFlags(0), mFadeOutTime(0.0f)
-          , mHandle(nullptr)
+          , mSourceParamsValid(false), mHandle(nullptr)
         { }
     };
 
@@ -101,6 +155,23 @@ namespace MWSound
         Sound() { }
     };
 
+    /// Find the least audible sound that may give up its source to a new sound with the given \a gain.
+    /// Looping sounds are never chosen, since they would not be restarted.
+    /// @return nullptr if no sound is less audible.
+    inline Sound *getLeastAudible(const std::vector<Sound*> &sounds, float gain)
+    {
+        Sound *found = nullptr;
+        for(Sound *sound : sounds)
+        {
+            if(sound->getIsLooping())
+                continue;
+            float audibility = sound->getSourceParams().mGain;
+            if(audibility < gain && (!found || audibility < found->getSourceParams().mGain))
+                found = sound;
+        }
+        return found;
+    }
+
     class Stream : public SoundBase {
         Stream& operator=(const Stream&) = delete;
         Stream(const Stream&) = delete;
@@ -11,8 +11,10 @@ namespace MWSound
 {
     class SoundManager;
     struct Sound_Decoder;
+    class SoundBase;
     class Sound;
     class Stream;
+    struct SourceParams;
 
     // An opaque handle for the implementation's sound buffers.
     typedef void *Sound_Handle;
@@ -44,6 +46,8 @@ namespace MWSound
         virtual void finishSound(Sound *sound) = 0;
         virtual bool isSoundPlaying(Sound *sound) = 0;
         virtual void updateSound(Sound *sound) = 0;
+        /// Update all \a sounds at once, only touching sources whose parameters changed.
+        virtual void updateSounds(const std::vector<Sound*> &sounds) = 0;
 
         virtual bool streamSound(DecoderPtr decoder, Stream *sound) = 0;
         virtual bool streamSound3D(DecoderPtr decoder, Stream *sound, bool getLoudnessData) = 0;
@@ -53,6 +57,7 @@ namespace MWSound
         virtual float getStreamLoudness(Stream *sound) = 0;
         virtual bool isStreamPlaying(Stream *sound) = 0;
         virtual void updateStream(Stream *sound) = 0;
+        virtual void updateStreams(const std::vector<Stream*> &sounds) = 0;
 
         virtual void startUpdate() = 0;
         virtual void finishUpdate() = 0;
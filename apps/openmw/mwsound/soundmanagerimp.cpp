@@ -966,6 +966,10 @@ namespace MWSound
 
         updateMusic(duration);
 
+        // Sources are updated in one batch once the finished sounds are gone
+        mSoundUpdates.clear();
+        mStreamUpdates.clear();
+
         // Check if any sounds are finished playing, and trash them
         SoundMap::iterator snditer = mActiveSounds.begin();
         while(snditer != mActiveSounds.end())
@@ -1007,7 +1011,7 @@ namespace MWSound
                 {
                     sound->updateFade(duration);
 
-                    mOutput->updateSound(sound);
+                    mSoundUpdates.push_back(sound);
                     ++sndidx;
                 }
             }
@@ -1045,7 +1049,7 @@ namespace MWSound
             {
                 sound->updateFade(duration);
 
-                mOutput->updateStream(sound);
+                mStreamUpdates.push_back(sound);
                 ++sayiter;
             }
         }
@@ -1063,11 +1067,14 @@ namespace MWSound
             {
                 sound->updateFade(duration);
 
-                mOutput->updateStream(sound);
+                mStreamUpdates.push_back(sound);
                 ++trkiter;
             }
         }
 
+        mOutput->updateSounds(mSoundUpdates);
+        mOutput->updateStreams(mStreamUpdates);
+
         if(mListenerUnderwater)
         {
             // Play underwater sound (after updating sounds)
@@ -1120,32 +1127,36 @@ namespace MWSound
 
         if(!mOutput->isInitialized())
             return;
-        mOutput->startUpdate();
+        mSoundUpdates.clear();
+        mStreamUpdates.clear();
         for(SoundMap::value_type &snd : mActiveSounds)
         {
             for(SoundBufferRefPair &sndbuf : snd.second)
             {
                 Sound *sound = sndbuf.first;
                 sound->setBaseVolume(volumeFromType(sound->getPlayType()));
-                mOutput->updateSound(sound);
+                mSoundUpdates.push_back(sound);
             }
         }
         for(SaySoundMap::value_type &snd : mActiveSaySounds)
         {
             Stream *sound = snd.second;
             sound->setBaseVolume(volumeFromType(sound->getPlayType()));
-            mOutput->updateStream(sound);
+            mStreamUpdates.push_back(sound);
         }
         for(Stream *sound : mActiveTracks)
         {
             sound->setBaseVolume(volumeFromType(sound->getPlayType()));
-            mOutput->updateStream(sound);
+            mStreamUpdates.push_back(sound);
         }
         if(mMusic)
         {
             mMusic->setBaseVolume(volumeFromType(mMusic->getPlayType()));
-            mOutput->updateStream(mMusic);
+            mStreamUpdates.push_back(mMusic);
         }
+        mOutput->startUpdate();
+        mOutput->updateSounds(mSoundUpdates);
+        mOutput->updateStreams(mStreamUpdates);
         mOutput->finishUpdate();
     }
 
@@ -99,6 +99,10 @@ namespace MWSound
         typedef std::vector<Stream*> TrackList;
         TrackList mActiveTracks;
 
+        // Reused between updates, to pass live sounds to the output in one batch
+        std::vector<Sound*> mSoundUpdates;
+        std::vector<Stream*> mStreamUpdates;
+
         Stream *mMusic;
         std::string mCurrentPlaylist;
 
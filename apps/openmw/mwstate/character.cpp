@@ -1,38 +1,214 @@
 #include "character.hpp"
 
 #include <sstream>
+#include <iostream>
+#include <map>
+#include <algorithm>
+#include <thread>
+#include <atomic>
 
 #include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
 
 #include <components/esm/esmreader.hpp>
+#include <components/esm/esmwriter.hpp>
 #include <components/esm/defs.hpp>
 
+#include <components/misc/stringops.hpp>
+
+namespace
+{
+    struct IndexEntry
+    {
+        ESM::SavedGame mProfile; // without screenshot
+        uint64_t mSize;
+        int64_t mTimeStamp;
+        bool mValid;
+
+        IndexEntry() : mSize (0), mTimeStamp (0), mValid (false) {}
+    };
+
+    // file name -> entry
+    typedef std::map<std::string, IndexEntry> Index;
+
+    void readIndex (const boost::filesystem::path& path, Index& index)
+    {
+        if (!boost::filesystem::exists (path))
+            return;
+
+        try
+        {
+            ESM::ESMReader reader;
+            reader.open (path.string());
+
+            if (reader.getFormat()!=ESM::SavedGame::sCurrentFormat)
+                return; // profile layout may have changed -> rebuild
+
+            while (reader.hasMoreRecs())
+            {
+                ESM::NAME n = reader.getRecName();
+                reader.getRecHeader();
+
+                if (n.intval!=ESM::REC_SAVE)
+                {
+                    reader.skipRecord();
+                    continue;
+                }
+
+                std::string fileName = reader.getHNString ("FILE");
+
+                IndexEntry entry;
+                reader.getHNT (entry.mSize, "SIZE");
+                reader.getHNT (entry.mTimeStamp, "MTIM");
+                entry.mProfile.load (reader);
+                entry.mValid = true;
+
+                index[fileName] = entry;
+            }
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << "Ignoring saved game index " << path << ": " << e.what() << std::endl;
+            index.clear();
+        }
+    }
+
+    void writeIndex (const boost::filesystem::path& path, const Index& index)
+    {
+        try
+        {
+            std::stringstream stream;
+
+            ESM::ESMWriter writer;
+            writer.setFormat (ESM::SavedGame::sCurrentFormat);
+            writer.setVersion (0);
+            writer.setType (0);
+            writer.setAuthor ("");
+            writer.setDescription ("");
+            writer.setRecordCount (static_cast<int> (index.size()));
+            writer.save (stream);
+
+            for (Index::const_iterator iter (index.begin()); iter!=index.end(); ++iter)
+            {
+                writer.startRecord (ESM::REC_SAVE);
+                writer.writeHNString ("FILE", iter->first);
+                writer.writeHNT ("SIZE", iter->second.mSize);
+                writer.writeHNT ("MTIM", iter->second.mTimeStamp);
+                iter->second.mProfile.save (writer);
+                writer.endRecord (ESM::REC_SAVE);
+            }
+
+            writer.close();
+
+            boost::filesystem::ofstream file (path, std::ios::binary);
+            file << stream.rdbuf();
+
+            if (file.fail())
+                throw std::runtime_error ("write operation failed");
+        }
+        catch (const std::exception& e)
+        {
+            // only a cache, the next start will scan the save files again
+            std::cerr << "Failed to write saved game index " << path << ": " << e.what() << std::endl;
+        }
+    }
+
+    bool readProfile (const boost::filesystem::path& path, ESM::SavedGame& profile, bool screenshot)
+    {
+        ESM::ESMReader reader;
+        reader.open (path.string());
+
+        if (reader.getRecName()!=ESM::REC_SAVE)
+            return false; // invalid save file -> ignore
+
+        reader.getRecHeader();
+
+        if (screenshot)
+            profile.load (reader);
+        else
+            profile.loadHeader (reader);
+
+        return true;
+    }
+
+    /// Reads the headers of save files missing from the index, shared by all worker threads
+    class HeaderReader
+    {
+            const std::vector<boost::filesystem::path>& mPaths;
+            std::vector<IndexEntry>& mEntries;
+            std::atomic<size_t> mNext;
+
+        public:
+
+            HeaderReader (const std::vector<boost::filesystem::path>& paths, std::vector<IndexEntry>& entries)
+            : mPaths (paths), mEntries (entries), mNext (0)
+            {}
+
+            void operator() ()
+            {
+                for (size_t i = mNext++; i<mPaths.size(); i = mNext++)
+                {
+                    try
+                    {
+                        mEntries[i].mValid = readProfile (mPaths[i], mEntries[i].mProfile, false);
+                    }
+                    catch (...) {} // ignoring bad saved game files for now
+                }
+            }
+    };
+
+    void readHeaders (const std::vector<boost::filesystem::path>& paths, std::vector<IndexEntry>& entries)
+    {
+        HeaderReader reader (paths, entries);
+
+        size_t threadCount = std::min (static_cast<size_t> (std::max (std::thread::hardware_concurrency(), 1u)),
+            paths.size());
+
+        std::vector<std::thread> threads;
+        for (size_t i=1; i<threadCount; ++i)
+            threads.push_back (std::thread (std::ref (reader)));
+
+        reader();
+
+        for (std::vector<std::thread>::iterator iter (threads.begin()); iter!=threads.end(); ++iter)
+            iter->join();
+    }
+}
+
 bool MWState::operator< (const Slot& left, const Slot& right)
 {
     return left.mTimeStamp<right.mTimeStamp;
 }
 
-
-void MWState::Character::addSlot (const boost::filesystem::path& path, const std::string& game)
+void MWState::readScreenshot (const Slot& slot, std::vector<char>& screenshot)
 {
-    Slot slot;
-    slot.mPath = path;
-    slot.mTimeStamp = boost::filesystem::last_write_time (path);
-
-    ESM::ESMReader reader;
-    reader.open (slot.mPath.string());
-
-    if (reader.getRecName()!=ESM::REC_SAVE)
-        return; // invalid save file -> ignore
+    if (!slot.mProfile.mScreenshot.empty())
+    {
+        screenshot = slot.mProfile.mScreenshot;
+        return;
+    }
 
-    reader.getRecHeader();
+    ESM::SavedGame profile;
+    if (readProfile (slot.mPath, profile, true))
+        screenshot.swap (profile.mScreenshot);
+    else
+        screenshot.clear();
+}
 
-    slot.mProfile.load (reader);
+const char* MWState::Character::sIndexFileName = "saves.idx";
 
-    if (Misc::StringUtils::lowerCase (slot.mProfile.mContentFiles.at (0))!=
-        Misc::StringUtils::lowerCase (game))
+void MWState::Character::addSlot (const boost::filesystem::path& path, const ESM::SavedGame& profile,
+    std::time_t timeStamp, const std::string& game)
+{
+    if (profile.mContentFiles.empty() ||
+        Misc::StringUtils::lowerCase (profile.mContentFiles.front())!=Misc::StringUtils::lowerCase (game))
         return; // this file is for a different game -> ignore
 
+    Slot slot;
+    slot.mPath = path;
+    slot.mProfile = profile;
+    slot.mTimeStamp = timeStamp;
+
     mSlots.push_back (slot);
 }
 
@@ -79,18 +255,63 @@ MWState::Character::Character (const boost::filesystem::path& saves, const std::
     }
     else
     {
+        const boost::filesystem::path indexPath = mPath / sIndexFileName;
+
+        Index index;
+        readIndex (indexPath, index);
+
+        Index updatedIndex;
+        std::vector<boost::filesystem::path> missing;
+        std::vector<IndexEntry> missingEntries;
+
         for (boost::filesystem::directory_iterator iter (mPath);
             iter!=boost::filesystem::directory_iterator(); ++iter)
         {
             boost::filesystem::path slotPath = *iter;
 
+            if (slotPath.filename()==sIndexFileName || !boost::filesystem::is_regular_file (slotPath))
+                continue;
+
             try
             {
-                addSlot (slotPath, game);
+                IndexEntry entry;
+                entry.mSize = boost::filesystem::file_size (slotPath);
+                entry.mTimeStamp = boost::filesystem::last_write_time (slotPath);
+
+                Index::const_iterator found = index.find (slotPath.filename().string());
+
+                if (found!=index.end() && found->second.mSize==entry.mSize &&
+                    found->second.mTimeStamp==entry.mTimeStamp)
+                {
+                    updatedIndex.insert (*found);
+                }
+                else
+                {
+                    missing.push_back (slotPath);
+                    missingEntries.push_back (entry);
+                }
             }
             catch (...) {} // ignoring bad saved game files for now
         }
 
+        readHeaders (missing, missingEntries);
+
+        bool changed = updatedIndex.size()!=index.size();
+
+        for (size_t i=0; i<missing.size(); ++i)
+            if (missingEntries[i].mValid)
+            {
+                updatedIndex[missing[i].filename().string()] = missingEntries[i];
+                changed = true;
+            }
+
+        for (Index::const_iterator iter (updatedIndex.begin()); iter!=updatedIndex.end(); ++iter)
+            addSlot (mPath / iter->first, iter->second.mProfile, static_cast<std::time_t> (iter->second.mTimeStamp),
+                game);
+
+        if (changed)
+            writeIndex (indexPath, updatedIndex);
+
         std::sort (mSlots.begin(), mSlots.end());
     }
 }
@@ -102,6 +323,8 @@ void MWState::Character::cleanup()
         // All slots are gone, no need to keep the empty directory
         if (boost::filesystem::is_directory (mPath))
         {
+            boost::filesystem::remove (mPath / sIndexFileName);
+
             // Extra safety check to make sure the directory is empty (e.g. slots failed to parse header)
             boost::filesystem::directory_iterator it(mPath);
             if (it == boost::filesystem::directory_iterator())
@@ -16,6 +16,9 @@ namespace MWState
 
     bool operator< (const Slot& left, const Slot& right);
 
+    void readScreenshot (const Slot& slot, std::vector<char>& screenshot);
+    ///< Slots found on startup do not keep the screenshot in memory; read it from the save file in this case.
+
     class Character
     {
         public:
@@ -27,16 +30,21 @@ namespace MWState
             boost::filesystem::path mPath;
             std::vector<Slot> mSlots;
 
-            void addSlot (const boost::filesystem::path& path, const std::string& game);
+            void addSlot (const boost::filesystem::path& path, const ESM::SavedGame& profile, std::time_t timeStamp,
+                const std::string& game);
 
             void addSlot (const ESM::SavedGame& profile);
 
         public:
 
+            static const char* sIndexFileName;
+
             Character (const boost::filesystem::path& saves, const std::string& game);
+            ///< Slot headers are taken from the index file in \a saves if it is up to date with the save file
+            /// (same size and modification time). Other save files are read in parallel and the index is updated.
 
             void cleanup();
-            ///< Delete the directory we used, if it is empty
+            ///< Delete the directory we used, if it is empty (except for the index file)
 
             const Slot *createSlot (const ESM::SavedGame& profile);
             ///< Create new slot.
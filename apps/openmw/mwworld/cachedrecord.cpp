@@ -0,0 +1,35 @@
+#include "cachedrecord.hpp"
+
+#include "generation.hpp"
+
+namespace MWWorld
+{
+    const std::string *CachedRecord::getRecord (uint64_t generation) const
+    {
+        if (!mHasRecord || mSavedGeneration!=generation)
+            return 0;
+
+        return &mRecord;
+    }
+
+    void CachedRecord::setRecord (const std::string& record, uint64_t generation)
+    {
+        mRecord = record;
+        mSavedGeneration = generation;
+        mHasRecord = true;
+    }
+
+    CachedRecord::CachedRecord()
+    : mGeneration (0), mSavedGeneration (0), mHasRecord (false)
+    {}
+
+    void CachedRecord::markChanged()
+    {
+        mGeneration = nextGeneration();
+    }
+
+    uint64_t CachedRecord::getGeneration() const
+    {
+        return mGeneration;
+    }
+}
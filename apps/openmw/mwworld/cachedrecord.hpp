@@ -0,0 +1,64 @@
+#ifndef GAME_MWWORLD_CACHEDRECORD_H
+#define GAME_MWWORLD_CACHEDRECORD_H
+
+#include <sstream>
+#include <string>
+#include <stdint.h>
+
+#include <components/esm/esmwriter.hpp>
+
+namespace MWWorld
+{
+    /// \brief Saved game record that is only serialised again after the state it was written from changed
+    ///
+    /// The owner of the state reports changes of its own state through markChanged. Other parts of the state
+    /// (e.g. the references of a cell) track their generation themselves, the owner passes the newest of all
+    /// of them to write.
+    class CachedRecord
+    {
+            uint64_t mGeneration;
+            uint64_t mSavedGeneration;
+            bool mHasRecord;
+            std::string mRecord;
+
+            const std::string *getRecord (uint64_t generation) const;
+            ///< Return the cached record, if it was written at \a generation (otherwise 0).
+
+            void setRecord (const std::string& record, uint64_t generation);
+
+        public:
+
+            CachedRecord();
+
+            void markChanged();
+            ///< The state of the owner changed.
+
+            uint64_t getGeneration() const;
+            ///< Generation of the last markChanged call, 0 if never changed.
+
+            /// Write the record. If it was cached at \a generation, the cached bytes are written. Otherwise
+            /// \a writeRecord (writer) is called to serialise the record again and the result is cached.
+            ///
+            /// \return Was the record serialised again?
+            template<typename Function>
+            bool write (ESM::ESMWriter& writer, uint64_t generation, Function writeRecord)
+            {
+                if (const std::string *record = getRecord (generation))
+                {
+                    writer.writeRecords (*record, 1);
+                    return false;
+                }
+
+                std::ostringstream stream;
+                writer.startCapture (stream);
+                writeRecord (writer);
+                writer.endCapture();
+
+                setRecord (stream.str(), generation);
+                writer.writeRecords (mRecord, 1);
+                return true;
+            }
+    };
+}
+
+#endif
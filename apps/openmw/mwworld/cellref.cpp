@@ -2,6 +2,8 @@
 
 #include <components/esm/objectstate.hpp>
 
+#include "generation.hpp"
+
 namespace MWWorld
 {
 
@@ -18,6 +20,7 @@ namespace MWWorld
     void CellRef::unsetRefNum()
     {
         mCellRef.mRefNum.unset();
+        mGeneration = nextGeneration();
     }
 
     std::string CellRef::getRefId() const
@@ -49,7 +52,7 @@ namespace MWWorld
     {
         if (scale != mCellRef.mScale)
         {
-            mChanged = true;
+            markChanged();
             mCellRef.mScale = scale;
         }
     }
@@ -61,7 +64,7 @@ namespace MWWorld
 
     void CellRef::setPosition(const ESM::Position &position)
     {
-        mChanged = true;
+        markChanged();
         mCellRef.mPos = position;
     }
 
@@ -74,7 +77,7 @@ namespace MWWorld
     {
         if (charge != mCellRef.mEnchantmentCharge)
         {
-            mChanged = true;
+            markChanged();
             mCellRef.mEnchantmentCharge = charge;
         }
     }
@@ -88,13 +91,14 @@ namespace MWWorld
     {
         if (charge != mCellRef.mChargeInt)
         {
-            mChanged = true;
+            markChanged();
             mCellRef.mChargeInt = charge;
         }
     }
 
     void CellRef::applyChargeRemainderToBeSubtracted(float chargeRemainder)
     {
+        mGeneration = nextGeneration();
         mCellRef.mChargeIntRemainder += std::abs(chargeRemainder);
         if (mCellRef.mChargeIntRemainder > 1.0f)
         {
@@ -120,7 +124,7 @@ namespace MWWorld
     {
         if (charge != mCellRef.mChargeFloat)
         {
-            mChanged = true;
+            markChanged();
             mCellRef.mChargeFloat = charge;
         }
     }
@@ -139,7 +143,7 @@ namespace MWWorld
     {
         if (!mCellRef.mGlobalVariable.empty())
         {
-            mChanged = true;
+            markChanged();
             mCellRef.mGlobalVariable.erase();
         }
     }
@@ -148,7 +152,7 @@ namespace MWWorld
     {
         if (factionRank != mCellRef.mFactionRank)
         {
-            mChanged = true;
+            markChanged();
             mCellRef.mFactionRank = factionRank;
         }
     }
@@ -162,7 +166,7 @@ namespace MWWorld
     {
         if (owner != mCellRef.mOwner)
         {
-            mChanged = true;
+            markChanged();
             mCellRef.mOwner = owner;
         }
     }
@@ -176,7 +180,7 @@ namespace MWWorld
     {
         if (soul != mCellRef.mSoul)
         {
-            mChanged = true;
+            markChanged();
             mCellRef.mSoul = soul;
         }
     }
@@ -190,7 +194,7 @@ namespace MWWorld
     {
         if (faction != mCellRef.mFaction)
         {
-            mChanged = true;
+            markChanged();
             mCellRef.mFaction = faction;
         }
     }
@@ -204,7 +208,7 @@ namespace MWWorld
     {
         if (lockLevel != mCellRef.mLockLevel)
         {
-            mChanged = true;
+            markChanged();
             mCellRef.mLockLevel = lockLevel;
         }
     }
@@ -223,7 +227,7 @@ namespace MWWorld
     {
         if (trap != mCellRef.mTrap)
         {
-            mChanged = true;
+            markChanged();
             mCellRef.mTrap = trap;
         }
     }
@@ -237,7 +241,7 @@ namespace MWWorld
     {
         if (value != mCellRef.mGoldValue)
         {
-            mChanged = true;
+            markChanged();
             mCellRef.mGoldValue = value;
         }
     }
@@ -252,4 +256,15 @@ namespace MWWorld
         return mChanged;
     }
 
+    uint64_t CellRef::getGeneration() const
+    {
+        return mGeneration;
+    }
+
+    void CellRef::markChanged()
+    {
+        mChanged = true;
+        mGeneration = nextGeneration();
+    }
+
 }
@@ -1,6 +1,8 @@
 #ifndef OPENMW_MWWORLD_CELLREF_H
 #define OPENMW_MWWORLD_CELLREF_H
 
+#include <stdint.h>
+
 #include <components/esm/cellref.hpp>
 
 namespace ESM
@@ -20,6 +22,7 @@ namespace MWWorld
             : mCellRef(ref)
         {
             mChanged = false;
+            mGeneration = 0;
         }
 
         // Note: Currently unused for items in containers
@@ -111,8 +114,14 @@ namespace MWWorld
         // Has this CellRef changed since it was originally loaded?
         bool hasChanged() const;
 
+        // Generation of the last change (see MWWorld::nextGeneration), 0 if never changed
+        uint64_t getGeneration() const;
+
     private:
+        void markChanged();
+
         bool mChanged;
+        uint64_t mGeneration;
         ESM::CellRef mCellRef;
     };
 
@@ -1,6 +1,7 @@
 #include "cells.hpp"
 
 #include <iostream>
+#include <sstream>
 
 #include <components/esm/esmreader.hpp>
 #include <components/esm/esmwriter.hpp>
@@ -17,6 +18,30 @@
 #include "containerstore.hpp"
 #include "cellstore.hpp"
 
+namespace
+{
+    struct WriteCellState
+    {
+        MWWorld::CellStore& mCell;
+
+        WriteCellState (MWWorld::CellStore& cell) : mCell (cell) {}
+
+        void operator() (ESM::ESMWriter& writer) const
+        {
+            ESM::CellState cellState;
+
+            mCell.saveState (cellState);
+
+            writer.startRecord (ESM::REC_CSTA);
+            cellState.mId.save (writer);
+            cellState.save (writer);
+            mCell.writeFog(writer);
+            mCell.writeReferences (writer);
+            writer.endRecord (ESM::REC_CSTA);
+        }
+    };
+}
+
 MWWorld::CellStore *MWWorld::Cells::getCellStore (const ESM::Cell *cell)
 {
     if (cell->mData.mFlags & ESM::Cell::Interior)
@@ -75,16 +100,8 @@ void MWWorld::Cells::writeCell (ESM::ESMWriter& writer, CellStore& cell) const
     if (cell.getState()!=CellStore::State_Loaded)
         cell.load ();
 
-    ESM::CellState cellState;
-
-    cell.saveState (cellState);
-
-    writer.startRecord (ESM::REC_CSTA);
-    cellState.mId.save (writer);
-    cellState.save (writer);
-    cell.writeFog(writer);
-    cell.writeReferences (writer);
-    writer.endRecord (ESM::REC_CSTA);
+    // Cells that haven't been touched since the last save are written from the cached record
+    cell.getSavedRecord().write (writer, cell.getGeneration(), WriteCellState (cell));
 }
 
 MWWorld::Cells::Cells (const MWWorld::ESMStore& store, std::vector<ESM::ESMReader>& reader)
@@ -27,6 +27,16 @@
 
 namespace
 {
+    template<typename T>
+    uint64_t getReferenceGeneration (const MWWorld::CellRefList<T>& list, uint64_t generation)
+    {
+        for (typename MWWorld::CellRefList<T>::List::const_iterator iter (list.mList.begin());
+             iter!=list.mList.end(); ++iter)
+            generation = std::max(generation, std::max(iter->mData.getGeneration(), iter->mRef.getGeneration()));
+
+        return generation;
+    }
+
     template<typename T>
     MWWorld::Ptr searchInContainerList (MWWorld::CellRefList<T>& containerList, const std::string& id)
     {
@@ -322,6 +332,7 @@ namespace MWWorld
 
     void CellStore::updateMergedRefs()
     {
+        markChanged();
         mMergedRefs.clear();
         MergeVisitor visitor(mMergedRefs, mMovedHere, mMovedToAnotherCell);
         forEachInternal(visitor);
@@ -428,6 +439,7 @@ namespace MWWorld
     {
         mWaterLevel = level;
         mHasState = true;
+        markChanged();
     }
 
     int CellStore::count() const
@@ -445,6 +457,7 @@ namespace MWWorld
             loadRefs ();
 
             mState = State_Loaded;
+            markChanged();
         }
     }
 
@@ -679,6 +692,7 @@ namespace MWWorld
 
         mWaterLevel = state.mWaterLevel;
         mLastRespawn = MWWorld::TimeStamp(state.mLastRespawn);
+        markChanged();
     }
 
     void CellStore::saveState (ESM::CellState& state) const
@@ -705,6 +719,7 @@ namespace MWWorld
     {
         mFogState.reset(new ESM::FogState());
         mFogState->load(reader);
+        markChanged();
     }
 
     void CellStore::writeReferences (ESM::ESMWriter& writer) const
@@ -936,6 +951,7 @@ namespace MWWorld
     void CellStore::setFog(ESM::FogState *fog)
     {
         mFogState.reset(fog);
+        markChanged();
     }
 
     ESM::FogState* CellStore::getFog() const
@@ -959,6 +975,7 @@ namespace MWWorld
             if (MWBase::Environment::get().getWorld()->getTimeStamp() - mLastRespawn > 24*30*iMonthsToRespawn)
             {
                 mLastRespawn = MWBase::Environment::get().getWorld()->getTimeStamp();
+                markChanged();
                 for (CellRefList<ESM::Container>::List::iterator it (mContainers.mList.begin()); it!=mContainers.mList.end(); ++it)
                 {
                     Ptr ptr = getCurrentPtr(&*it);
@@ -986,4 +1003,42 @@ namespace MWWorld
             }
         }
     }
+
+    void CellStore::markChanged()
+    {
+        mSavedRecord.markChanged();
+    }
+
+    uint64_t CellStore::getGeneration() const
+    {
+        // References moved to another cell stay in the lists of this cell, so their changes are seen here
+        uint64_t generation = mSavedRecord.getGeneration();
+        generation = getReferenceGeneration (mActivators, generation);
+        generation = getReferenceGeneration (mPotions, generation);
+        generation = getReferenceGeneration (mAppas, generation);
+        generation = getReferenceGeneration (mArmors, generation);
+        generation = getReferenceGeneration (mBooks, generation);
+        generation = getReferenceGeneration (mClothes, generation);
+        generation = getReferenceGeneration (mContainers, generation);
+        generation = getReferenceGeneration (mCreatures, generation);
+        generation = getReferenceGeneration (mDoors, generation);
+        generation = getReferenceGeneration (mIngreds, generation);
+        generation = getReferenceGeneration (mCreatureLists, generation);
+        generation = getReferenceGeneration (mItemLists, generation);
+        generation = getReferenceGeneration (mLights, generation);
+        generation = getReferenceGeneration (mLockpicks, generation);
+        generation = getReferenceGeneration (mMiscItems, generation);
+        generation = getReferenceGeneration (mNpcs, generation);
+        generation = getReferenceGeneration (mProbes, generation);
+        generation = getReferenceGeneration (mRepairs, generation);
+        generation = getReferenceGeneration (mStatics, generation);
+        generation = getReferenceGeneration (mWeapons, generation);
+        generation = getReferenceGeneration (mBodyParts, generation);
+        return generation;
+    }
+
+    CachedRecord& CellStore::getSavedRecord()
+    {
+        return mSavedRecord;
+    }
 }
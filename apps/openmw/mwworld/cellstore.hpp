@@ -10,6 +10,7 @@
 
 #include "livecellref.hpp"
 #include "cellreflist.hpp"
+#include "cachedrecord.hpp"
 
 #include <components/esm/loadacti.hpp>
 #include <components/esm/loadalch.hpp>
@@ -75,6 +76,11 @@ namespace MWWorld
 
             MWWorld::TimeStamp mLastRespawn;
 
+            // Tracks changes of the state of the cell itself, the references track their own changes. The saved
+            // game record of the cell is only written again after the generation of the cell or of one of its
+            // references changed.
+            CachedRecord mSavedRecord;
+
             // List of refs owned by this cell
             CellRefList<ESM::Activator>         mActivators;
             CellRefList<ESM::Potion>            mPotions;
@@ -375,6 +381,18 @@ namespace MWWorld
             void respawn ();
             ///< Check mLastRespawn and respawn references if necessary. This is a no-op if the cell is not loaded.
 
+            void markChanged();
+            ///< Mark the state of this cell as changed, invalidating the cached saved game record.
+            ///
+            /// \note Changes to a reference are tracked by its CellRef and RefData and do not need this.
+
+            uint64_t getGeneration() const;
+            ///< Changes whenever the state written for this cell may have changed, including
+            /// references moved from this cell to another cell.
+
+            CachedRecord& getSavedRecord();
+            ///< The saved game record of this cell, to be written at getGeneration().
+
         private:
 
             /// Run through references and store IDs
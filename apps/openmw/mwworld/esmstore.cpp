@@ -10,6 +10,10 @@
 #include <components/esm/esmreader.hpp>
 #include <components/esm/esmwriter.hpp>
 
+#include "../mwdialogue/selectwrapper.hpp"
+
+#include "globals.hpp"
+
 namespace MWWorld
 {
 
@@ -141,6 +145,31 @@ void ESMStore::setUp()
     mMagicEffects.setUp();
     mAttributes.setUp();
     mDialogs.setUp();
+
+    mGameSettingsCache.setUp(mGameSettings);
+}
+
+void ESMStore::resolveGlobalSlots (const Globals& globals)
+{
+    for (Store<ESM::Dialogue>::iterator iter = mDialogs.begin(); iter != mDialogs.end(); ++iter)
+    {
+        // The slots are runtime data next to the records, so changing them does not alter the records
+        ESM::Dialogue& dialogue = const_cast<ESM::Dialogue&>(*iter);
+
+        for (ESM::Dialogue::InfoContainer::iterator info = dialogue.mInfo.begin(); info != dialogue.mInfo.end(); ++info)
+        {
+            for (std::vector<ESM::DialInfo::SelectStruct>::iterator select = info->mSelects.begin();
+                select != info->mSelects.end(); ++select)
+            {
+                MWDialogue::SelectWrapper wrapper (*select);
+
+                if (wrapper.getFunction() == MWDialogue::SelectWrapper::Function_Global)
+                    select->mGlobalSlot = globals.getSlot (wrapper.getName());
+                else
+                    select->mGlobalSlot = -1;
+            }
+        }
+    }
 }
 
     int ESMStore::countSavedGameRecords() const
@@ -6,6 +6,7 @@
 
 #include <components/esm/records.hpp>
 #include "store.hpp"
+#include "gamesettingscache.hpp"
 
 namespace Loading
 {
@@ -14,6 +15,8 @@ namespace Loading
 
 namespace MWWorld
 {
+    class Globals;
+
     class ESMStore
     {
         Store<ESM::Activator>       mActivators;
@@ -72,8 +75,18 @@ namespace MWWorld
 
         ESM::NPC mPlayerTemplate;
 
+        GameSettingsCache mGameSettingsCache;
+
         unsigned int mDynamicCount;
 
+        template <class T>
+        void recordChanged(const Store<T>& store) {}
+
+        void recordChanged(const Store<ESM::GameSetting>& store)
+        {
+            mGameSettingsCache.invalidate();
+        }
+
     public:
         /// \todo replace with SharedIterator<StoreBase>
         typedef std::map<int, StoreBase *>::const_iterator iterator;
@@ -187,6 +200,7 @@ namespace MWWorld
                     mIds[ptr->mId] = it->first;
                 }
             }
+            recordChanged(store);
             return ptr;
         }
 
@@ -201,6 +215,7 @@ namespace MWWorld
                     mIds[ptr->mId] = it->first;
                 }
             }
+            recordChanged(store);
             return ptr;
         }
 
@@ -223,6 +238,7 @@ namespace MWWorld
                     mIds[ptr->mId] = it->first;
                 }
             }
+            recordChanged(store);
             return ptr;
         }
 
@@ -230,6 +246,18 @@ namespace MWWorld
         //  from the outside, so it must be public.
         void setUp();
 
+        /// Store the slots of the global variables read by dialogue conditions in the select
+        /// structs of all infos (ESM::DialInfo::SelectStruct::mGlobalSlot).
+        ///
+        /// \note Must be called after setUp(). Slots only depend on the content files, so this is
+        /// done once per session.
+        void resolveGlobalSlots (const Globals& globals);
+
+        /// Pre-resolved GMST lookups, see GmstHandle.
+        const GameSettingsCache& getGameSettings() const {
+            return mGameSettingsCache;
+        }
+
         int countSavedGameRecords() const;
 
         void write (ESM::ESMWriter& writer, Loading::Listener& progress) const;
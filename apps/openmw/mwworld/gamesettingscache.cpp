@@ -0,0 +1,37 @@
+#include "gamesettingscache.hpp"
+
+#include <stdexcept>
+
+namespace
+{
+    // Shared by all caches, so that a handle can never mistake one cache's generation for another's.
+    // 0 is never handed out and marks a handle that was not resolved yet.
+    unsigned int sLastGeneration = 0;
+}
+
+namespace MWWorld
+{
+    GameSettingsCache::GameSettingsCache()
+        : mStore(NULL), mGeneration(++sLastGeneration)
+    {
+    }
+
+    void GameSettingsCache::setUp(const Store<ESM::GameSetting>& store)
+    {
+        mStore = &store;
+        invalidate();
+    }
+
+    void GameSettingsCache::invalidate()
+    {
+        mGeneration = ++sLastGeneration;
+    }
+
+    const ESM::GameSetting* GameSettingsCache::find(const std::string& id) const
+    {
+        if (!mStore)
+            throw std::runtime_error("GameSetting '" + id + "' requested before the game settings cache was set up");
+
+        return mStore->find(id);
+    }
+}
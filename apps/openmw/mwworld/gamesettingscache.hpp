@@ -0,0 +1,99 @@
+#ifndef OPENMW_MWWORLD_GAMESETTINGSCACHE_H
+#define OPENMW_MWWORLD_GAMESETTINGSCACHE_H
+
+#include <string>
+
+#include <components/esm/loadgmst.hpp>
+
+#include "store.hpp"
+
+namespace MWWorld
+{
+    /// \brief Resolves GMST ids once and hands out direct record pointers
+    ///
+    /// Set up by ESMStore::setUp() after content loading. Every change to the GameSetting store (record overrides,
+    /// a new setUp()) must call invalidate(), which makes all GmstHandles re-resolve on their next access.
+    class GameSettingsCache
+    {
+            const Store<ESM::GameSetting>* mStore;
+            unsigned int mGeneration;
+
+        public:
+
+            GameSettingsCache();
+
+            void setUp(const Store<ESM::GameSetting>& store);
+
+            void invalidate();
+
+            /// Generation stamp, unique among all caches. Handles compare against it to detect stale pointers.
+            unsigned int getGeneration() const
+            {
+                return mGeneration;
+            }
+
+            const ESM::GameSetting* find(const std::string& id) const;
+            ///< Throws an exception if the cache is not set up or the GMST does not exist.
+    };
+
+    template <typename T>
+    T getGameSettingValue(const ESM::GameSetting& setting);
+
+    template <>
+    inline float getGameSettingValue<float>(const ESM::GameSetting& setting)
+    {
+        return setting.getFloat();
+    }
+
+    template <>
+    inline int getGameSettingValue<int>(const ESM::GameSetting& setting)
+    {
+        return setting.getInt();
+    }
+
+    template <>
+    inline std::string getGameSettingValue<std::string>(const ESM::GameSetting& setting)
+    {
+        return setting.getString();
+    }
+
+    /// \brief Typed reference to a GMST, resolved lazily against a GameSettingsCache
+    ///
+    /// Meant to be declared once (e.g. as a function-local static) and queried on hot paths. Only the first
+    /// access after an invalidation does a string lookup; all others just compare the generation stamp.
+    /// \note Not thread-safe, use from the main thread only.
+    template <typename T>
+    class GmstHandle
+    {
+            std::string mId;
+            mutable const ESM::GameSetting* mSetting;
+            mutable unsigned int mGeneration;
+
+        public:
+
+            explicit GmstHandle(const std::string& id)
+                : mId(id), mSetting(NULL), mGeneration(0)
+            {}
+
+            const std::string& getId() const
+            {
+                return mId;
+            }
+
+            T get(const GameSettingsCache& cache) const
+            {
+                if (mGeneration != cache.getGeneration())
+                {
+                    mSetting = cache.find(mId);
+                    mGeneration = cache.getGeneration();
+                }
+                return getGameSettingValue<T>(*mSetting);
+            }
+    };
+
+    typedef GmstHandle<float> GmstFloat;
+    typedef GmstHandle<int> GmstInt;
+    typedef GmstHandle<std::string> GmstString;
+}
+
+#endif
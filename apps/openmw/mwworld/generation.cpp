@@ -0,0 +1,10 @@
+#include "generation.hpp"
+
+namespace MWWorld
+{
+    uint64_t nextGeneration()
+    {
+        static uint64_t sGeneration = 0;
+        return ++sGeneration;
+    }
+}
@@ -0,0 +1,15 @@
+#ifndef GAME_MWWORLD_GENERATION_H
+#define GAME_MWWORLD_GENERATION_H
+
+#include <stdint.h>
+
+namespace MWWorld
+{
+    uint64_t nextGeneration();
+    ///< Return a value greater than all values returned before.
+    ///
+    /// Changes to cells and references store a new generation, so that a cell can tell whether
+    /// anything it writes to a saved game has changed since the last save (see CellStore::getGeneration).
+}
+
+#endif
@@ -11,57 +11,52 @@
 
 namespace MWWorld
 {
-    Globals::Collection::const_iterator Globals::find (const std::string& name) const
+    int Globals::find (const std::string& name) const
     {
-        Collection::const_iterator iter = mVariables.find (Misc::StringUtils::lowerCase (name));
+        int slot = getSlot (name);
 
-        if (iter==mVariables.end())
+        if (slot==-1)
             throw std::runtime_error ("unknown global variable: " + name);
 
-        return iter;
-    }
-
-    Globals::Collection::iterator Globals::find (const std::string& name)
-    {
-        Collection::iterator iter = mVariables.find (Misc::StringUtils::lowerCase (name));
-
-        if (iter==mVariables.end())
-            throw std::runtime_error ("unknown global variable: " + name);
-
-        return iter;
+        return slot;
     }
 
     void Globals::fill (const MWWorld::ESMStore& store)
     {
         mVariables.clear();
+        mSlots.clear();
 
         const MWWorld::Store<ESM::Global>& globals = store.get<ESM::Global>();
 
+        mVariables.reserve (globals.getSize());
+
         for (MWWorld::Store<ESM::Global>::iterator iter = globals.begin(); iter!=globals.end();
             ++iter)
         {
-            mVariables.insert (std::make_pair (Misc::StringUtils::lowerCase (iter->mId), *iter));
+            if (mSlots.insert (std::make_pair (Misc::StringUtils::lowerCase (iter->mId),
+                static_cast<int> (mVariables.size()))).second)
+                mVariables.push_back (*iter);
         }
     }
 
     const ESM::Variant& Globals::operator[] (const std::string& name) const
     {
-        return find (Misc::StringUtils::lowerCase (name))->second.mValue;
+        return mVariables[find (name)].mValue;
     }
 
     ESM::Variant& Globals::operator[] (const std::string& name)
     {
-        return find (Misc::StringUtils::lowerCase (name))->second.mValue;
+        return mVariables[find (name)].mValue;
     }
 
     char Globals::getType (const std::string& name) const
     {
-        Collection::const_iterator iter = mVariables.find (Misc::StringUtils::lowerCase (name));
+        int slot = getSlot (name);
 
-        if (iter==mVariables.end())
+        if (slot==-1)
             return ' ';
 
-        switch (iter->second.mValue.getType())
+        switch (mVariables[slot].mValue.getType())
         {
             case ESM::VT_Short: return 's';
             case ESM::VT_Long: return 'l';
@@ -71,6 +66,27 @@ namespace MWWorld
         }
     }
 
+    int Globals::getSlot (const std::string& name) const
+    {
+        std::unordered_map<std::string, int>::const_iterator iter =
+            mSlots.find (Misc::StringUtils::lowerCase (name));
+
+        if (iter==mSlots.end())
+            return -1;
+
+        return iter->second;
+    }
+
+    const ESM::Variant& Globals::getValue (int slot) const
+    {
+        return mVariables.at (slot).mValue;
+    }
+
+    ESM::Variant& Globals::getValue (int slot)
+    {
+        return mVariables.at (slot).mValue;
+    }
+
     int Globals::countSavedGameRecords() const
     {
         return mVariables.size();
@@ -78,10 +94,10 @@ namespace MWWorld
 
     void Globals::write (ESM::ESMWriter& writer, Loading::Listener& progress) const
     {
-        for (Collection::const_iterator iter (mVariables.begin()); iter!=mVariables.end(); ++iter)
+        for (std::vector<ESM::Global>::const_iterator iter (mVariables.begin()); iter!=mVariables.end(); ++iter)
         {
             writer.startRecord (ESM::REC_GLOB);
-            iter->second.save (writer);
+            iter->save (writer);
             writer.endRecord (ESM::REC_GLOB);
         }
     }
@@ -96,11 +112,9 @@ namespace MWWorld
             // This readRecord() method is used when reading a saved game.
             // Deleted globals can't appear there, so isDeleted will be ignored here.
             global.load(reader, isDeleted);
-            Misc::StringUtils::lowerCaseInPlace(global.mId);
-
-            Collection::iterator iter = mVariables.find (global.mId);
-            if (iter!=mVariables.end())
-                iter->second = global;
+            int slot = getSlot (global.mId);
+            if (slot!=-1)
+                mVariables[slot] = global;
 
             return true;
         }
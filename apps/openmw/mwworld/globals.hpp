@@ -3,7 +3,7 @@
 
 #include <vector>
 #include <string>
-#include <map>
+#include <unordered_map>
 
 #include <stdint.h>
 
@@ -25,17 +25,20 @@ namespace MWWorld
 {
     class ESMStore;
 
+    /// \brief Global variables
+    ///
+    /// Each variable gets a slot when the variables are filled from the content files. Slots are
+    /// stable until the next fill, so callers that access a variable often can resolve its name
+    /// once and use the slot afterwards.
     class Globals
     {
         private:
 
-            typedef std::map<std::string, ESM::Global> Collection;
+            std::vector<ESM::Global> mVariables; // by slot
+            std::unordered_map<std::string, int> mSlots; // lower case name -> slot
 
-            Collection mVariables; // type, value
-
-            Collection::const_iterator find (const std::string& name) const;
-
-            Collection::iterator find (const std::string& name);
+            int find (const std::string& name) const;
+            ///< Throws an exception, if there is no global variable with this name.
 
         public:
 
@@ -46,6 +49,13 @@ namespace MWWorld
             char getType (const std::string& name) const;
             ///< If there is no global variable with this name, ' ' is returned.
 
+            int getSlot (const std::string& name) const;
+            ///< If there is no global variable with this name, -1 is returned.
+
+            const ESM::Variant& getValue (int slot) const;
+
+            ESM::Variant& getValue (int slot);
+
             void fill (const MWWorld::ESMStore& store);
             ///< Replace variables with variables from \a store with default values.
 
@@ -4,6 +4,7 @@
 
 #include "customdata.hpp"
 #include "cellstore.hpp"
+#include "generation.hpp"
 
 #include "../mwbase/environment.hpp"
 #include "../mwbase/world.hpp"
@@ -29,6 +30,7 @@ namespace MWWorld
         mCount = refData.mCount;
         mPosition = refData.mPosition;
         mChanged = refData.mChanged;
+        mGeneration = refData.mGeneration;
         mDeletedByContentFile = refData.mDeletedByContentFile;
         mFlags = refData.mFlags;
 
@@ -46,7 +48,8 @@ namespace MWWorld
     }
 
     RefData::RefData()
-    : mBaseNode(0), mDeletedByContentFile(false), mEnabled (true), mCount (1), mCustomData (0), mChanged(false), mFlags(0)
+    : mBaseNode(0), mDeletedByContentFile(false), mEnabled (true), mCount (1), mCustomData (0), mChanged(false),
+      mGeneration(0), mFlags(0)
     {
         for (int i=0; i<3; ++i)
         {
@@ -59,7 +62,7 @@ namespace MWWorld
     : mBaseNode(0), mDeletedByContentFile(false), mEnabled (true),
       mCount (1), mPosition (cellRef.mPos),
       mCustomData (0),
-      mChanged(false), mFlags(0) // Loading from ESM/ESP files -> assume unchanged
+      mChanged(false), mGeneration(0), mFlags(0) // Loading from ESM/ESP files -> assume unchanged
     {
     }
 
@@ -70,7 +73,7 @@ namespace MWWorld
       mPosition (objectState.mPosition),
       mAnimationState(objectState.mAnimationState),
       mCustomData (0),
-      mChanged(true), mFlags(objectState.mFlags) // Loading from a savegame -> assume changed
+      mChanged(true), mGeneration(0), mFlags(objectState.mFlags) // Loading from a savegame -> assume changed
     {
         // "Note that the ActivationFlag_UseEnabled is saved to the reference,
         // which will result in permanently suppressed activation if the reference script is removed.
@@ -154,7 +157,10 @@ namespace MWWorld
     void RefData::setLocals (const ESM::Script& script)
     {
         if (mLocals.configure (script) && !mLocals.isEmpty())
+        {
             mChanged = true;
+            mGeneration = nextGeneration();
+        }
     }
 
     void RefData::setCount (int count)
@@ -163,6 +169,7 @@ namespace MWWorld
             MWBase::Environment::get().getWorld()->removeRefScript(this);
 
         mChanged = true;
+        mGeneration = nextGeneration();
 
         mCount = count;
     }
@@ -170,6 +177,7 @@ namespace MWWorld
     void RefData::setDeletedByContentFile(bool deleted)
     {
         mDeletedByContentFile = deleted;
+        mGeneration = nextGeneration();
     }
 
     bool RefData::isDeleted() const
@@ -184,6 +192,7 @@ namespace MWWorld
 
     MWScript::Locals& RefData::getLocals()
     {
+        mGeneration = nextGeneration();
         return mLocals;
     }
 
@@ -197,6 +206,7 @@ namespace MWWorld
         if (!mEnabled)
         {
             mChanged = true;
+            mGeneration = nextGeneration();
             mEnabled = true;
         }
     }
@@ -206,6 +216,7 @@ namespace MWWorld
         if (mEnabled)
         {
             mChanged = true;
+            mGeneration = nextGeneration();
             mEnabled = false;
         }
     }
@@ -213,6 +224,7 @@ namespace MWWorld
     void RefData::setPosition(const ESM::Position& pos)
     {
         mChanged = true;
+        mGeneration = nextGeneration();
         mPosition = pos;
     }
 
@@ -224,12 +236,15 @@ namespace MWWorld
     void RefData::setCustomData (CustomData *data)
     {
         mChanged = true; // We do not currently track CustomData, so assume anything with a CustomData is changed
+        mGeneration = nextGeneration();
         delete mCustomData;
         mCustomData = data;
     }
 
     CustomData *RefData::getCustomData()
     {
+        // Inventories and stats are changed through the custom data, which is not tracked itself
+        mGeneration = nextGeneration();
         return mCustomData;
     }
 
@@ -243,10 +258,16 @@ namespace MWWorld
         return mChanged || !mAnimationState.empty();
     }
 
+    uint64_t RefData::getGeneration() const
+    {
+        return mGeneration;
+    }
+
     bool RefData::activateByScript()
     {
         bool ret = (mFlags & Flag_ActivationBuffered);
         mFlags &= ~(Flag_SuppressActivate|Flag_OnActivate);
+        mGeneration = nextGeneration();
         return ret;
     }
 
@@ -255,6 +276,7 @@ namespace MWWorld
         if (mFlags & Flag_SuppressActivate)
         {
             mFlags |= Flag_OnActivate|Flag_ActivationBuffered;
+            mGeneration = nextGeneration();
             return false;
         }
         else
@@ -268,6 +290,7 @@ namespace MWWorld
         bool ret = mFlags & Flag_OnActivate;
         mFlags |= Flag_SuppressActivate;
         mFlags &= (~Flag_OnActivate);
+        mGeneration = nextGeneration();
         return ret;
     }
 
@@ -278,6 +301,7 @@ namespace MWWorld
 
     ESM::AnimationState& RefData::getAnimationState()
     {
+        mGeneration = nextGeneration();
         return mAnimationState;
     }
 
@@ -7,6 +7,7 @@
 #include "../mwscript/locals.hpp"
 
 #include <string>
+#include <stdint.h>
 #include <osg/Vec3f>
 
 namespace SceneUtil
@@ -53,6 +54,8 @@ namespace MWWorld
 
             bool mChanged;
 
+            uint64_t mGeneration;
+
             unsigned int mFlags;
 
         public:
@@ -136,6 +139,12 @@ namespace MWWorld
             bool hasChanged() const;
             ///< Has this RefData changed since it was originally loaded?
 
+            uint64_t getGeneration() const;
+            ///< Generation of the last change (see MWWorld::nextGeneration), 0 if never changed.
+            ///
+            /// \note Mutable access to the local variables, the custom data and the animation state
+            /// counts as a change.
+
             const ESM::AnimationState& getAnimationState() const;
             ESM::AnimationState& getAnimationState();
     };
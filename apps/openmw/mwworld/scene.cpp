@@ -281,10 +281,12 @@ namespace MWWorld
                 int cellX = cell->getCell()->getGridX();
                 int cellY = cell->getCell()->getGridY();
                 osg::ref_ptr<const ESMTerrain::LandObject> land = mRendering.getLandManager()->getLand(cellX, cellY);
-                const ESM::Land::LandData* data = land ? land->getData(ESM::Land::DATA_VHGT) : 0;
-                if (data)
+                osg::ref_ptr<const ESMTerrain::DecodedLandData> decoded = land ? land->getData(ESM::Land::DATA_VHGT) : 0;
+                if (decoded)
                 {
-                    mPhysics->addHeightField (data->mHeights, cellX, cell->getCell()->getGridY(), worldsize / (verts-1), verts, data->mMinHeight, data->mMaxHeight, land.get());
+                    // the heightfield keeps the decoded data alive, even if it is evicted from the land data cache
+                    const ESM::Land::LandData* data = &decoded->mData;
+                    mPhysics->addHeightField (data->mHeights, cellX, cell->getCell()->getGridY(), worldsize / (verts-1), verts, data->mMinHeight, data->mMaxHeight, decoded.get());
                 }
                 else
                 {
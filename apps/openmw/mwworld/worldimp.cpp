@@ -186,6 +186,7 @@ namespace MWWorld
 
         mStore.setUp();
         mStore.movePlayerRecord();
+        mStore.resolveGlobalSlots (mGlobalVariables);
 
         mSwimHeightScale = mStore.get<ESM::GameSetting>().find("fSwimHeightScale")->getFloat();
 
@@ -613,6 +614,11 @@ namespace MWWorld
         return mGlobalVariables.getType (name);
     }
 
+    float World::getGlobalFloat (int slot) const
+    {
+        return mGlobalVariables.getValue (slot).getFloat();
+    }
+
     std::string World::getCellName (const MWWorld::CellStore *cell) const
     {
         if (!cell)
@@ -2056,11 +2062,6 @@ namespace MWWorld
         return dropped;
     }
 
-    void World::processChangedSettings(const Settings::CategorySettingVector& settings)
-    {
-        mRendering->processChangedSettings(settings);
-    }
-
     bool World::isFlying(const MWWorld::Ptr &ptr) const
     {
         const MWMechanics::CreatureStats &stats = ptr.getClass().getCreatureStats(ptr);
@@ -258,6 +258,9 @@ namespace MWWorld
             char getGlobalVariableType (const std::string& name) const override;
             ///< Return ' ', if there is no global variable with this name.
 
+            float getGlobalFloat (int slot) const override;
+            ///< Get value independently from real type.
+
             std::string getCellName (const MWWorld::CellStore *cell = 0) const override;
             ///< Return name of the cell.
             ///
@@ -477,8 +480,6 @@ namespace MWWorld
             bool canPlaceObject(float cursorX, float cursorY) override;
             ///< @return true if it is possible to place on object at specified cursor location
 
-            void processChangedSettings(const Settings::CategorySettingVector& settings) override;
-
             bool isFlying(const MWWorld::Ptr &ptr) const override;
             bool isSlowFalling(const MWWorld::Ptr &ptr) const override;
             ///Is the head of the creature underwater?
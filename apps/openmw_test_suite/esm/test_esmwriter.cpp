@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <stdexcept>
+
+#include "components/esm/esmreader.hpp"
+#include "components/esm/esmwriter.hpp"
+
+namespace
+{
+    const int sObjectsPerCell = 20;
+
+    /// Stand-in for the state of a cell as it is written to a saved game
+    struct CellRecord
+    {
+        std::string mName;
+        int mRevision;
+        std::string mCache;
+        bool mHasCache;
+
+        CellRecord(const std::string& name) : mName(name), mRevision(0), mHasCache(false) {}
+
+        void write(ESM::ESMWriter& writer) const
+        {
+            writer.startRecord("CSTA");
+            writer.writeHNString("NAME", mName);
+            writer.writeHNT("REVI", mRevision);
+            for (int i = 0; i < sObjectsPerCell; ++i)
+            {
+                writer.writeHNT("OBJE", i);
+                writer.writeHNString("NAME", mName + "_object");
+                float position[6] = { float(i), float(mRevision), 0.f, 0.f, 0.f, 1.f };
+                writer.writeHNT("DATA", position, sizeof(position));
+            }
+            writer.endRecord("CSTA");
+        }
+
+        /// Write from the cache, capturing the record again if it is out of date
+        void writeCached(ESM::ESMWriter& writer)
+        {
+            if (!mHasCache)
+            {
+                std::ostringstream stream;
+                writer.startCapture(stream);
+                write(writer);
+                writer.endCapture();
+                mCache = stream.str();
+                mHasCache = true;
+            }
+
+            writer.writeRecords(mCache, 1);
+        }
+
+        void change()
+        {
+            ++mRevision;
+            mHasCache = false;
+        }
+    };
+
+    std::string save(std::vector<CellRecord>& cells, bool cached, int& recordCount)
+    {
+        ESM::ESMWriter writer;
+        writer.setFormat(0);
+        writer.setRecordCount(static_cast<int>(cells.size()));
+
+        std::ostringstream stream;
+        writer.save(stream);
+        for (std::vector<CellRecord>::iterator it = cells.begin(); it != cells.end(); ++it)
+        {
+            if (cached)
+                it->writeCached(writer);
+            else
+                it->write(writer);
+        }
+        writer.close();
+
+        recordCount = writer.getRecordCount();
+        return stream.str();
+    }
+}
+
+TEST(EsmWriterTest, spliced_records_are_identical_to_written_records)
+{
+    std::vector<CellRecord> cells;
+    cells.push_back(CellRecord("Balmora"));
+    cells.push_back(CellRecord("Seyda Neen"));
+    cells.push_back(CellRecord("Vivec, Arena"));
+
+    int directCount = 0;
+    int cachedCount = 0;
+    std::string direct = save(cells, false, directCount);
+    EXPECT_EQ(direct, save(cells, true, cachedCount));
+    EXPECT_EQ(directCount, cachedCount);
+    EXPECT_EQ(static_cast<int>(cells.size()) + 1, cachedCount);
+
+    // read it back, the record sizes must be correct
+    ESM::ESMReader reader;
+    reader.open(Files::IStreamPtr(new std::istringstream(save(cells, true, cachedCount))), "savegame");
+    for (std::vector<CellRecord>::const_iterator it = cells.begin(); it != cells.end(); ++it)
+    {
+        ASSERT_TRUE(reader.hasMoreRecs());
+        EXPECT_EQ("CSTA", reader.getRecName().toString());
+        reader.getRecHeader();
+        EXPECT_EQ(it->mName, reader.getHNString("NAME"));
+        reader.skipRecord();
+    }
+    EXPECT_FALSE(reader.hasMoreRecs());
+}
+
+TEST(EsmWriterTest, capturing_is_rejected_inside_a_record)
+{
+    ESM::ESMWriter writer;
+    std::ostringstream file;
+    std::ostringstream capture;
+    writer.save(file);
+
+    writer.startRecord("CSTA");
+    EXPECT_THROW(writer.startCapture(capture), std::runtime_error);
+    EXPECT_THROW(writer.writeRecords(std::string(), 1), std::runtime_error);
+    writer.endRecord("CSTA");
+
+    EXPECT_THROW(writer.endCapture(), std::runtime_error);
+    writer.startCapture(capture);
+    EXPECT_THROW(writer.startCapture(capture), std::runtime_error);
+    writer.endCapture();
+}
+
+TEST(EsmWriterTest, splicing_cached_records_of_5000_cells_matches_full_save)
+{
+    std::vector<CellRecord> cells;
+    for (int i = 0; i < 5000; ++i)
+    {
+        std::ostringstream name;
+        name << "cell " << i;
+        cells.push_back(CellRecord(name.str()));
+    }
+
+    int count = 0;
+    save(cells, true, count);
+
+    for (int pass = 0; pass < 5; ++pass)
+    {
+        // a few cells change between saves
+        for (size_t i = pass; i < cells.size(); i += 97)
+            cells[i].change();
+
+        std::string cached = save(cells, true, count);
+        int fullCount = 0;
+        std::string full = save(cells, false, fullCount);
+
+        ASSERT_EQ(full, cached) << "pass " << pass;
+        EXPECT_EQ(fullCount, count);
+    }
+}
@@ -0,0 +1,261 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cfloat>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <components/esmterrain/compactlanddata.hpp>
+#include <components/esmterrain/landdatacache.hpp>
+
+namespace
+{
+    const int allData = ESM::Land::DATA_VHGT | ESM::Land::DATA_VNML | ESM::Land::DATA_VCLR | ESM::Land::DATA_VTEX;
+
+    /// Fill \a data like ESM::Land::loadData would from a VHGT subrecord with the given offset and deltas
+    void fillHeights (ESM::Land::LandData& data, float heightOffset, const std::vector<signed char>& deltas)
+    {
+        data.mMinHeight = FLT_MAX;
+        data.mMaxHeight = -FLT_MAX;
+        float rowOffset = heightOffset;
+        for (int y = 0; y < ESM::Land::LAND_SIZE; y++)
+        {
+            rowOffset += deltas[y * ESM::Land::LAND_SIZE];
+            data.mHeights[y * ESM::Land::LAND_SIZE] = rowOffset * ESM::Land::HEIGHT_SCALE;
+
+            float colOffset = rowOffset;
+            for (int x = 1; x < ESM::Land::LAND_SIZE; x++)
+            {
+                colOffset += deltas[y * ESM::Land::LAND_SIZE + x];
+                data.mHeights[x + y * ESM::Land::LAND_SIZE] = colOffset * ESM::Land::HEIGHT_SCALE;
+            }
+        }
+
+        for (int i = 0; i < ESM::Land::LAND_NUM_VERTS; ++i)
+        {
+            data.mMinHeight = std::min(data.mMinHeight, data.mHeights[i]);
+            data.mMaxHeight = std::max(data.mMaxHeight, data.mHeights[i]);
+        }
+    }
+
+    void expectSameData (const ESM::Land::LandData& expected, const ESM::Land::LandData& actual)
+    {
+        ASSERT_EQ(expected.mDataLoaded, actual.mDataLoaded);
+
+        if (expected.mDataLoaded & ESM::Land::DATA_VHGT)
+        {
+            EXPECT_EQ(0, std::memcmp(expected.mHeights, actual.mHeights, sizeof(expected.mHeights)));
+            EXPECT_EQ(expected.mMinHeight, actual.mMinHeight);
+            EXPECT_EQ(expected.mMaxHeight, actual.mMaxHeight);
+            EXPECT_EQ(expected.mUnk1, actual.mUnk1);
+            EXPECT_EQ(expected.mUnk2, actual.mUnk2);
+        }
+        if (expected.mDataLoaded & ESM::Land::DATA_VNML)
+            EXPECT_EQ(0, std::memcmp(expected.mNormals, actual.mNormals, sizeof(expected.mNormals)));
+        if (expected.mDataLoaded & ESM::Land::DATA_VCLR)
+            EXPECT_EQ(0, std::memcmp(expected.mColours, actual.mColours, sizeof(expected.mColours)));
+        if (expected.mDataLoaded & ESM::Land::DATA_VTEX)
+            EXPECT_EQ(0, std::memcmp(expected.mTextures, actual.mTextures, sizeof(expected.mTextures)));
+    }
+
+    struct CompactLandDataTest : public ::testing::Test
+    {
+        std::mt19937 mRandom;
+
+        int random (int min, int max)
+        {
+            return std::uniform_int_distribution<int>(min, max)(mRandom);
+        }
+
+        /// Land data as loaded from a content file
+        std::unique_ptr<ESM::Land::LandData> makeLandData (int seed)
+        {
+            mRandom.seed(seed);
+
+            std::unique_ptr<ESM::Land::LandData> data (new ESM::Land::LandData);
+            data->mDataLoaded = allData;
+            data->mHeightOffset = 0;
+            data->mUnk1 = static_cast<short>(random(0, 1000));
+            data->mUnk2 = static_cast<uint8_t>(random(0, 255));
+
+            std::vector<signed char> deltas (ESM::Land::LAND_NUM_VERTS);
+            for (size_t i = 0; i < deltas.size(); ++i)
+                deltas[i] = static_cast<signed char>(random(-128, 127));
+            fillHeights(*data, random(-5000, 5000) + 0.5f * random(0, 1), deltas);
+
+            for (int i = 0; i < ESM::Land::LAND_NUM_VERTS * 3; ++i)
+            {
+                data->mNormals[i] = static_cast<signed char>(random(-128, 127));
+                data->mColours[i] = static_cast<unsigned char>(random(0, 255));
+            }
+            for (int i = 0; i < ESM::Land::LAND_NUM_TEXTURES; ++i)
+                data->mTextures[i] = static_cast<uint16_t>(random(0, 300));
+
+            return data;
+        }
+    };
+}
+
+TEST_F(CompactLandDataTest, round_trip_matches_original_data)
+{
+    for (int seed = 0; seed < 20; ++seed)
+    {
+        std::unique_ptr<ESM::Land::LandData> original = makeLandData(seed);
+
+        ESMTerrain::CompactLandData compact (*original);
+        EXPECT_EQ(allData, compact.getDataLoaded());
+
+        std::unique_ptr<ESM::Land::LandData> decoded (new ESM::Land::LandData);
+        compact.decode(*decoded);
+        expectSameData(*original, *decoded);
+    }
+}
+
+TEST_F(CompactLandDataTest, content_file_heights_use_byte_deltas)
+{
+    std::unique_ptr<ESM::Land::LandData> original = makeLandData(1);
+    std::memset(original->mNormals, 0, sizeof(original->mNormals));
+    std::memset(original->mColours, 255, sizeof(original->mColours));
+
+    ESMTerrain::CompactLandData compact (*original);
+
+    // byte deltas instead of floats, and a single colour instead of one per vertex
+    EXPECT_LT(compact.getMemoryUsage(), sizeof(ESM::Land::LandData) / 2);
+
+    std::unique_ptr<ESM::Land::LandData> decoded (new ESM::Land::LandData);
+    compact.decode(*decoded);
+    expectSameData(*original, *decoded);
+}
+
+TEST_F(CompactLandDataTest, edited_heights_fall_back_to_wider_encodings)
+{
+    std::unique_ptr<ESM::Land::LandData> original = makeLandData(2);
+
+    // steps too large for byte deltas
+    for (int i = 0; i < ESM::Land::LAND_NUM_VERTS; ++i)
+        original->mHeights[i] = (i % 2) * 2048.f - 1024.f;
+
+    ESMTerrain::CompactLandData steep (*original);
+    std::unique_ptr<ESM::Land::LandData> decoded (new ESM::Land::LandData);
+    steep.decode(*decoded);
+    expectSameData(*original, *decoded);
+
+    // heights that are not multiples of ESM::Land::HEIGHT_SCALE
+    for (int i = 0; i < ESM::Land::LAND_NUM_VERTS; ++i)
+        original->mHeights[i] = i * 0.3f;
+
+    ESMTerrain::CompactLandData smooth (*original);
+    smooth.decode(*decoded);
+    expectSameData(*original, *decoded);
+
+    EXPECT_LT(steep.getMemoryUsage(), smooth.getMemoryUsage());
+}
+
+TEST_F(CompactLandDataTest, only_loaded_data_is_kept)
+{
+    std::unique_ptr<ESM::Land::LandData> original = makeLandData(3);
+    original->mDataLoaded = ESM::Land::DATA_VTEX;
+
+    ESMTerrain::CompactLandData compact (*original);
+    EXPECT_EQ(ESM::Land::DATA_VTEX, compact.getDataLoaded());
+
+    std::unique_ptr<ESM::Land::LandData> decoded (new ESM::Land::LandData);
+    compact.decode(*decoded);
+    expectSameData(*original, *decoded);
+}
+
+TEST_F(CompactLandDataTest, cache_respects_budget_under_random_access)
+{
+    const size_t numCells = 100;
+    const size_t maxEntries = 8;
+
+    std::vector<ESMTerrain::CompactLandData> cells;
+    std::vector<float> firstHeights;
+    for (size_t i = 0; i < numCells; ++i)
+    {
+        std::unique_ptr<ESM::Land::LandData> data = makeLandData(static_cast<int>(i));
+        cells.push_back(ESMTerrain::CompactLandData(*data));
+        firstHeights.push_back(data->mHeights[0]);
+    }
+
+    osg::ref_ptr<ESMTerrain::LandDataCache> cache (new ESMTerrain::LandDataCache(maxEntries * sizeof(ESMTerrain::DecodedLandData)));
+
+    std::vector<osg::ref_ptr<const ESMTerrain::DecodedLandData> > held;
+    std::vector<size_t> heldCells;
+
+    for (int i = 0; i < 2000; ++i)
+    {
+        size_t cell = random(0, numCells - 1);
+        osg::ref_ptr<const ESMTerrain::DecodedLandData> data = cache->getData(cells[cell]);
+        ASSERT_TRUE(data);
+        EXPECT_EQ(firstHeights[cell], data->mData.mHeights[0]);
+
+        EXPECT_LE(cache->getMemoryUsage(), cache->getBudget());
+        EXPECT_LE(cache->getNumEntries(), maxEntries);
+
+        if (i % 100 == 0)
+        {
+            held.push_back(data);
+            heldCells.push_back(cell);
+        }
+    }
+
+    // data that was handed out stays valid after eviction
+    for (size_t i = 0; i < held.size(); ++i)
+        EXPECT_EQ(firstHeights[heldCells[i]], held[i]->mData.mHeights[0]);
+
+    // data used within the last maxEntries accesses is not decoded again
+    const ESMTerrain::DecodedLandData* first = cache->getData(cells[0]).get();
+    for (size_t i = 1; i < maxEntries; ++i)
+        cache->getData(cells[i]);
+    EXPECT_EQ(first, cache->getData(cells[0]).get());
+
+    cache->setBudget(sizeof(ESMTerrain::DecodedLandData));
+    EXPECT_EQ(1u, cache->getNumEntries());
+
+    cache->remove(cells[0]);
+    EXPECT_EQ(0u, cache->getNumEntries());
+    EXPECT_EQ(0u, cache->getMemoryUsage());
+}
+
+TEST_F(CompactLandDataTest, cache_is_thread_safe)
+{
+    const size_t numCells = 32;
+
+    std::vector<ESMTerrain::CompactLandData> cells;
+    std::vector<float> firstHeights;
+    for (size_t i = 0; i < numCells; ++i)
+    {
+        std::unique_ptr<ESM::Land::LandData> data = makeLandData(static_cast<int>(i));
+        cells.push_back(ESMTerrain::CompactLandData(*data));
+        firstHeights.push_back(data->mHeights[0]);
+    }
+
+    osg::ref_ptr<ESMTerrain::LandDataCache> cache (new ESMTerrain::LandDataCache(4 * sizeof(ESMTerrain::DecodedLandData)));
+
+    std::vector<int> errors (4, 0);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < errors.size(); ++t)
+    {
+        threads.push_back(std::thread([&, t] ()
+        {
+            std::mt19937 random (static_cast<unsigned>(t));
+            for (int i = 0; i < 500; ++i)
+            {
+                size_t cell = std::uniform_int_distribution<size_t>(0, numCells - 1)(random);
+                osg::ref_ptr<const ESMTerrain::DecodedLandData> data = cache->getData(cells[cell]);
+                if (!data || data->mData.mHeights[0] != firstHeights[cell])
+                    ++errors[t];
+            }
+        }));
+    }
+    for (size_t t = 0; t < threads.size(); ++t)
+        threads[t].join();
+
+    for (size_t t = 0; t < errors.size(); ++t)
+        EXPECT_EQ(0, errors[t]);
+    EXPECT_LE(cache->getMemoryUsage(), cache->getBudget());
+}
@@ -0,0 +1,186 @@
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <sstream>
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include <components/files/collections.hpp>
+
+namespace
+{
+    struct CollectionsTest : public ::testing::Test
+    {
+        boost::filesystem::path mRoot;
+
+        CollectionsTest()
+            : mRoot(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("openmw-collections-%%%%-%%%%"))
+        {
+            boost::filesystem::create_directories(mRoot);
+        }
+
+        ~CollectionsTest()
+        {
+            boost::system::error_code error;
+            boost::filesystem::remove_all(mRoot, error);
+        }
+
+        boost::filesystem::path addDirectory(const std::string& name)
+        {
+            boost::filesystem::path path = mRoot / name;
+            boost::filesystem::create_directories(path);
+            return path;
+        }
+
+        static void addFile(const boost::filesystem::path& path)
+        {
+            boost::filesystem::ofstream file(path);
+            file << path.filename().string();
+        }
+
+        /// Pretend the directory was last modified a while ago, so that a listing made now can be trusted
+        static void age(const boost::filesystem::path& directory)
+        {
+            boost::filesystem::last_write_time(directory, std::time(0) - 100);
+        }
+    };
+}
+
+TEST_F(CollectionsTest, later_directories_have_priority_in_collections)
+{
+    Files::PathContainer directories;
+    directories.push_back(addDirectory("Data Files"));
+    directories.push_back(addDirectory("mod"));
+    directories.push_back(addDirectory("missing"));
+    boost::filesystem::remove(directories.back());
+
+    addFile(directories[0] / "Morrowind.esm");
+    addFile(directories[0] / "Tribunal.esm");
+    addFile(directories[0] / "Morrowind.bsa");
+    addFile(directories[1] / "morrowind.esm");
+    addFile(directories[1] / "Mod.ESP");
+
+    Files::Collections collections(directories, true);
+
+    const Files::MultiDirCollection& esm = collections.getCollection(".esm");
+    EXPECT_EQ(directories[1] / "morrowind.esm", esm.getPath("Morrowind.esm"));
+    EXPECT_EQ(directories[0] / "Tribunal.esm", esm.getPath("TRIBUNAL.ESM"));
+    EXPECT_FALSE(esm.doesExist("Morrowind.bsa"));
+    EXPECT_THROW(esm.getPath("Bloodmoon.esm"), std::runtime_error);
+
+    EXPECT_TRUE(collections.getCollection(".esp").doesExist("mod.esp"));
+
+    // whole-collection lookups keep using the first directory that has the file
+    EXPECT_EQ(directories[0] / "Morrowind.esm", collections.getPath("morrowind.esm"));
+    EXPECT_EQ(directories[0] / "Morrowind.bsa", collections.getPath("Morrowind.bsa"));
+    EXPECT_FALSE(collections.doesExist("Bloodmoon.bsa"));
+
+    Files::Collections strict(directories, false);
+    EXPECT_FALSE(strict.getCollection(".esp").doesExist("Mod.ESP"));
+    EXPECT_EQ(directories[0] / "Morrowind.esm", strict.getCollection(".esm").getPath("Morrowind.esm"));
+    EXPECT_EQ(directories[1] / "morrowind.esm", strict.getPath("morrowind.esm"));
+    EXPECT_FALSE(strict.doesExist("tribunal.esm"));
+}
+
+TEST_F(CollectionsTest, cached_listings_are_reused_until_the_directory_changes)
+{
+    Files::PathContainer directories;
+    for (int i = 0; i < 3; ++i)
+    {
+        std::ostringstream name;
+        name << "mod " << i;
+        directories.push_back(addDirectory(name.str()));
+        addFile(directories.back() / (name.str() + ".esp"));
+        age(directories.back());
+    }
+
+    boost::filesystem::path cacheFile = mRoot / "cache" / Files::DirectoryIndex::sCacheFileName;
+
+    {
+        Files::DirectoryIndex index(directories, cacheFile);
+        EXPECT_EQ(0u, index.getNumCached());
+        EXPECT_TRUE(boost::filesystem::exists(cacheFile));
+    }
+
+    {
+        Files::DirectoryIndex index(directories, cacheFile);
+        EXPECT_EQ(3u, index.getNumCached());
+        ASSERT_TRUE(index.find("MOD 1.esp") != NULL);
+        EXPECT_EQ(directories[1] / "mod 1.esp", index.getPath(index.find("mod 1.esp")->front()));
+    }
+
+    // adding a file modifies the directory, only that one is listed again
+    addFile(directories[2] / "patch.esp");
+    boost::filesystem::last_write_time(directories[2], std::time(0) - 50);
+
+    {
+        Files::Collections collections(directories, true, cacheFile);
+        EXPECT_TRUE(collections.getCollection(".esp").doesExist("patch.esp"));
+    }
+
+    Files::DirectoryIndex index(directories, cacheFile);
+    EXPECT_EQ(3u, index.getNumCached());
+    EXPECT_TRUE(index.find("patch.esp") != NULL);
+
+    // a directory modified in the second it was listed can't be trusted
+    boost::filesystem::last_write_time(directories[0], std::time(0));
+    Files::DirectoryIndex recent(directories, cacheFile);
+    Files::DirectoryIndex again(directories, cacheFile);
+    EXPECT_EQ(2u, again.getNumCached());
+}
+
+TEST_F(CollectionsTest, broken_cache_files_are_ignored)
+{
+    Files::PathContainer directories;
+    directories.push_back(addDirectory("Data Files"));
+    addFile(directories[0] / "Morrowind.esm");
+    age(directories[0]);
+
+    boost::filesystem::path cacheFile = mRoot / Files::DirectoryIndex::sCacheFileName;
+    {
+        boost::filesystem::ofstream file(cacheFile);
+        file << "OpenMW directory index 1\n" << directories[0].string() << "\n12 34 5\nMorrowind.esm\n";
+    }
+
+    Files::Collections collections(directories, true, cacheFile);
+    EXPECT_TRUE(collections.doesExist("morrowind.esm"));
+
+    Files::DirectoryIndex index(directories, cacheFile);
+    EXPECT_EQ(1u, index.getNumCached());
+}
+
+TEST_F(CollectionsTest, cached_index_of_200_directories)
+{
+    Files::PathContainer directories;
+    for (int i = 0; i < 200; ++i)
+    {
+        std::ostringstream name;
+        name << "mod " << i;
+        directories.push_back(addDirectory(name.str()));
+        for (int file = 0; file < 20; ++file)
+        {
+            std::ostringstream fileName;
+            fileName << "file " << file << (file % 4 ? ".dds" : ".esp");
+            addFile(directories.back() / fileName.str());
+        }
+        age(directories.back());
+    }
+
+    boost::filesystem::path cacheFile = mRoot / Files::DirectoryIndex::sCacheFileName;
+
+    Files::DirectoryIndex firstRun(directories, cacheFile);
+    EXPECT_EQ(0u, firstRun.getNumCached());
+
+    Files::Collections collections(directories, true, cacheFile);
+    for (const char* extension : { ".esp", ".esm", ".bsa", ".omwaddon", ".omwgame" })
+        collections.getCollection(extension);
+    EXPECT_EQ(directories.back() / "file 0.esp", collections.getCollection(".esp").getPath("file 0.esp"));
+
+    // the same five plugin names in every directory
+    const Files::MultiDirCollection& plugins = collections.getCollection(".esp");
+    EXPECT_EQ(5, std::distance(plugins.begin(), plugins.end()));
+
+    Files::DirectoryIndex secondRun(directories, cacheFile);
+    EXPECT_EQ(200u, secondRun.getNumCached());
+}
@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
+#include "components/misc/prefixindex.hpp"
+#include "components/misc/stringops.hpp"
+
+namespace
+{
+    std::vector<std::string> makeIds (size_t count)
+    {
+        const char* words[] = { "Bal", "Vivec", "ex", "Common", "Dwrv", "Misc", "Ingred", "Potion", "_", "Sc", "Daedric" };
+        const size_t numWords = sizeof(words) / sizeof(words[0]);
+
+        std::mt19937 random;
+        std::vector<std::string> ids;
+        for (size_t i = 0; i < count; ++i)
+        {
+            std::string id = words[random() % numWords];
+            id += words[random() % numWords];
+            id += std::to_string(i);
+            ids.push_back(id);
+        }
+        return ids;
+    }
+
+    /// The linear scan the console used for completion
+    void findPrefixLinear (const std::vector<std::string>& names, const std::string& prefix, std::vector<std::string>& out)
+    {
+        for (std::vector<std::string>::const_iterator it = names.begin(); it != names.end(); ++it)
+            if (it->size() >= prefix.size() && Misc::StringUtils::ciCompareLen(*it, prefix, prefix.size()) == 0)
+                out.push_back(*it);
+    }
+
+    /// Compares the strings themselves case-insensitively, like the Qt order of the editor
+    struct CompareInPlace
+    {
+        typedef std::string Key;
+
+        static const std::string& makeKey (const std::string& value)
+        {
+            return value;
+        }
+
+        static int compare (const std::string& left, const std::string& right)
+        {
+            if (Misc::StringUtils::ciLess(left, right))
+                return -1;
+            return Misc::StringUtils::ciLess(right, left) ? 1 : 0;
+        }
+
+        static bool startsWith (const std::string& value, const std::string& prefix)
+        {
+            return value.size() >= prefix.size() && Misc::StringUtils::ciCompareLen(value, prefix, prefix.size()) == 0;
+        }
+    };
+}
+
+TEST(MiscPrefixIndexTest, finds_strings_by_case_insensitive_prefix)
+{
+    Misc::PrefixIndex index;
+    index.insert("Balmora");
+    index.insert("bal_isra");
+    index.insert("Vivec");
+    index.insert("BALMORA");
+    index.insert("Balmora");
+
+    EXPECT_EQ(4u, index.size());
+
+    std::vector<std::string> matches;
+    index.findPrefix("bAlM", matches);
+    ASSERT_EQ(2u, matches.size());
+    EXPECT_EQ("BALMORA", matches[0]);
+    EXPECT_EQ("Balmora", matches[1]);
+
+    matches.clear();
+    index.findPrefix("bal", matches);
+    EXPECT_EQ(3u, matches.size());
+    EXPECT_EQ("bal_isra", matches[0]);
+
+    matches.clear();
+    index.findPrefix("x", matches);
+    EXPECT_TRUE(matches.empty());
+
+    matches.clear();
+    index.findPrefix("", matches);
+    EXPECT_EQ(4u, matches.size());
+}
+
+TEST(MiscPrefixIndexTest, supports_incremental_updates)
+{
+    Misc::PrefixIndex index;
+    index.insert("b");
+    index.insert("d");
+    EXPECT_EQ("d", index.get(1));
+
+    index.insert("c");
+    index.insert("a");
+    EXPECT_EQ(4u, index.size());
+    EXPECT_EQ("a", index.get(0));
+    EXPECT_EQ("c", index.get(2));
+
+    EXPECT_TRUE(index.remove("c"));
+    EXPECT_FALSE(index.remove("c"));
+    EXPECT_FALSE(index.remove("A"));
+    EXPECT_EQ(3u, index.size());
+    EXPECT_EQ(2u, index.lowerBound("C"));
+
+    index.clear();
+    EXPECT_TRUE(index.empty());
+}
+
+TEST(MiscPrefixIndexTest, uses_the_order_it_is_given)
+{
+    Misc::BasicPrefixIndex<std::string, CompareInPlace> index;
+    index.insert("Balmora");
+    index.insert("bal_isra");
+    index.insert("BALMORA");
+    index.insert("Vivec");
+
+    EXPECT_EQ("bal_isra", index.get(0));
+    EXPECT_EQ("BALMORA", index.get(1));
+    EXPECT_EQ(1u, index.find("BALMORA"));
+    EXPECT_EQ(2u, index.find("Balmora"));
+    EXPECT_EQ(3u, index.find("balmorb"));
+
+    std::vector<std::string> matches;
+    index.findPrefix("BALM", matches);
+    ASSERT_EQ(2u, matches.size());
+    EXPECT_EQ("BALMORA", matches[0]);
+    EXPECT_EQ("Balmora", matches[1]);
+}
+
+TEST(MiscPrefixIndexTest, matches_linear_scan_over_100k_ids)
+{
+    std::vector<std::string> ids = makeIds(100000);
+
+    Misc::PrefixIndex index;
+    index.insert(ids);
+    EXPECT_EQ(ids.size(), index.size());
+
+    const char* prefixes[] = { "b", "BalV", "vivecex1", "common_", "dwrvmisc99", "sc", "daedricpotion4" };
+
+    for (size_t i = 0; i < sizeof(prefixes) / sizeof(prefixes[0]); ++i)
+    {
+        std::vector<std::string> expected;
+        std::vector<std::string> actual;
+
+        index.findPrefix(prefixes[i], actual);
+        findPrefixLinear(ids, prefixes[i], expected);
+
+        std::sort(expected.begin(), expected.end());
+        std::sort(actual.begin(), actual.end());
+        EXPECT_EQ(expected, actual) << prefixes[i];
+    }
+
+    // a few incremental changes after the initial build
+    for (size_t i = 0; i < 100; ++i)
+    {
+        index.insert("new_id_" + std::to_string(i));
+        index.remove(ids[i * 7]);
+    }
+    EXPECT_EQ(ids.size(), index.size());
+
+    // and a large block of removals at once
+    std::vector<std::string> removed(ids.begin() + 1000, ids.begin() + 11000);
+    index.remove(removed);
+    EXPECT_EQ(ids.size() - removed.size(), index.size());
+
+    std::vector<std::string> matches;
+    index.findPrefix("new_id_", matches);
+    EXPECT_EQ(100u, matches.size());
+
+    for (size_t i = 0; i < removed.size(); i += 97)
+    {
+        size_t position = index.find(removed[i]);
+        EXPECT_TRUE(position == index.size() || index.get(position) != removed[i]) << removed[i];
+    }
+}
@@ -0,0 +1,261 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <list>
+#include <map>
+#include <memory>
+#include <random>
+
+#include <components/esm/loadinfo.hpp>
+
+#include "apps/openmw/mwdialogue/journaltext.hpp"
+#include "apps/openmw/mwgui/journalbookcache.hpp"
+
+namespace
+{
+    /// The hyperlink handling JournalViewModel used before, without the topic lookup
+    void extractHyperlinksInPlace (std::string& utf8text, std::map<std::pair<size_t, size_t>, std::string>& links)
+    {
+        size_t pos_end = 0;
+        for(;;)
+        {
+            size_t pos_begin = utf8text.find('@');
+            if (pos_begin != std::string::npos)
+                pos_end = utf8text.find('#', pos_begin);
+
+            if (pos_begin != std::string::npos && pos_end != std::string::npos)
+            {
+                std::string link = utf8text.substr(pos_begin + 1, pos_end - pos_begin - 1);
+                const char specialPseudoAsteriskCharacter = 127;
+                std::replace(link.begin(), link.end(), specialPseudoAsteriskCharacter, '*');
+
+                std::string displayName = link;
+                while (displayName[displayName.size()-1] == '*')
+                    displayName.erase(displayName.size()-1, 1);
+
+                utf8text.replace(pos_begin, pos_end+1-pos_begin, displayName);
+
+                links[std::make_pair(pos_begin, pos_begin+displayName.size())] = link;
+            }
+            else
+                break;
+        }
+    }
+
+    typedef std::shared_ptr<std::string> Book;
+
+    /// Lays out the whole journal, like JournalBooks::createJournalBook, into a single string
+    struct TypesetJournal
+    {
+        const std::vector<MWDialogue::EntryText>& mEntries;
+        size_t& mTypesetEntries;
+
+        TypesetJournal(const std::vector<MWDialogue::EntryText>& entries, size_t& typesetEntries)
+            : mEntries(entries), mTypesetEntries(typesetEntries) {}
+
+        Book operator()() const
+        {
+            Book book = std::make_shared<std::string>();
+            for (std::vector<MWDialogue::EntryText>::const_iterator it = mEntries.begin(); it != mEntries.end(); ++it)
+            {
+                std::string text;
+                std::vector<MWDialogue::Hyperlink> links;
+                MWDialogue::extractHyperlinks(it->get(), text, links);
+
+                *book += text;
+                *book += '\n';
+                ++mTypesetEntries;
+            }
+            return book;
+        }
+    };
+
+    struct JournalTextTest : public ::testing::Test
+    {
+        std::list<ESM::DialInfo> mInfos;
+
+        /// Info records like those of a large content file: some with links as used by translations,
+        /// some with escape sequences, most with plain text.
+        void createInfos (size_t count, std::mt19937& random)
+        {
+            const char* words[] = { "Balmora", "Caius", "the", "Fighters Guild", "a", "Dwemer", "ruin", "Vivec", "dagger" };
+            const size_t numWords = sizeof(words) / sizeof(words[0]);
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                ESM::DialInfo info;
+                info.blank();
+                info.mId = std::to_string(1000000 + i) + "2657812345";
+
+                std::string response;
+                size_t length = 10 + random() % 40;
+                for (size_t word = 0; word < length; ++word)
+                {
+                    if (random() % 20 == 0)
+                        response += "@" + std::string(words[random() % numWords]) + (random() % 2 ? "\x7f" : "") + "# ";
+                    else if (random() % 500 == 0)
+                        response += "%PCName ";
+                    else
+                        response += std::string(words[random() % numWords]) + " ";
+                }
+                info.mResponse = response;
+                mInfos.push_back(info);
+            }
+        }
+
+        /// What Interpreter::fixDefinesDialog does for the escape sequence used by createInfos
+        static std::string fixDefines (const std::string& text)
+        {
+            std::string result = text;
+            size_t pos;
+            while ((pos = result.find("%PCName")) != std::string::npos)
+                result.replace(pos, 7, "Nerevar");
+            return result;
+        }
+    };
+}
+
+TEST_F(JournalTextTest, entry_text_is_only_copied_if_it_differs_from_the_response)
+{
+    ESM::DialInfo info;
+    info.blank();
+    info.mId = "19511310302976825065";
+    info.mResponse = "You are to report to %PCName.";
+
+    MWDialogue::EntryText same (&info, info.mResponse);
+    EXPECT_FALSE(same.hasOwnText());
+    EXPECT_EQ(info.mResponse, same.get());
+    EXPECT_EQ(info.mId, same.getInfoId());
+    EXPECT_EQ(&info, same.getInfo());
+
+    MWDialogue::EntryText fixed (&info, fixDefines(info.mResponse));
+    EXPECT_TRUE(fixed.hasOwnText());
+    EXPECT_EQ("You are to report to Nerevar.", fixed.get());
+
+    // e.g. a saved game from before the response was changed by a mod
+    MWDialogue::EntryText empty (&info, "");
+    EXPECT_TRUE(empty.hasOwnText());
+    EXPECT_EQ("", empty.get());
+
+    EXPECT_THROW(MWDialogue::EntryText(NULL, "text"), std::runtime_error);
+}
+
+TEST_F(JournalTextTest, extracts_links_like_the_journal_did)
+{
+    const char* texts[] = {
+        "", "no links", "@Balmora# is a city", "visit @Vivec\x7f#, then @Fighters Guild#.",
+        "unterminated @link", "@a@b# nested", "@dagger\x7f\x7f# at the end @x#"
+    };
+
+    for (size_t i = 0; i < sizeof(texts) / sizeof(texts[0]); ++i)
+    {
+        std::string expected = texts[i];
+        std::map<std::pair<size_t, size_t>, std::string> expectedLinks;
+        extractHyperlinksInPlace(expected, expectedLinks);
+
+        std::string actual;
+        std::vector<MWDialogue::Hyperlink> links;
+        MWDialogue::extractHyperlinks(texts[i], actual, links);
+
+        EXPECT_EQ(expected, actual) << texts[i];
+
+        ASSERT_EQ(expectedLinks.size(), links.size()) << texts[i];
+        for (std::vector<MWDialogue::Hyperlink>::const_iterator it = links.begin(); it != links.end(); ++it)
+        {
+            std::map<std::pair<size_t, size_t>, std::string>::const_iterator found =
+                expectedLinks.find(std::make_pair(it->mBegin, it->mEnd));
+            ASSERT_TRUE(found != expectedLinks.end()) << texts[i];
+            EXPECT_EQ(found->second, it->mTopic);
+        }
+    }
+
+    // an empty link, the old code read before the start of the display name here
+    std::string actual;
+    std::vector<MWDialogue::Hyperlink> links;
+    MWDialogue::extractHyperlinks("@#", actual, links);
+    EXPECT_EQ("", actual);
+    ASSERT_EQ(1u, links.size());
+    EXPECT_EQ(links[0].mBegin, links[0].mEnd);
+}
+
+TEST_F(JournalTextTest, renders_50k_entries_like_copied_texts)
+{
+    std::mt19937 random;
+    createInfos(5000, random);
+
+    std::vector<const ESM::DialInfo*> infos;
+    for (std::list<ESM::DialInfo>::const_iterator it = mInfos.begin(); it != mInfos.end(); ++it)
+        infos.push_back(&*it);
+
+    // the journal as it was stored before, with a copy of the text in every entry
+    std::vector<std::string> copiedTexts;
+    std::vector<MWDialogue::EntryText> entries;
+    size_t copiedBytes = 0;
+    size_t ownBytes = 0;
+    for (size_t i = 0; i < 50000; ++i)
+    {
+        const ESM::DialInfo* info = infos[random() % infos.size()];
+        std::string text = fixDefines(info->mResponse);
+
+        copiedTexts.push_back(text);
+        copiedBytes += text.capacity();
+
+        entries.push_back(MWDialogue::EntryText(info, text));
+        if (entries.back().hasOwnText())
+            ownBytes += entries.back().get().capacity();
+    }
+
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        ASSERT_EQ(copiedTexts[i], entries[i].get()) << i;
+
+        std::string expected = copiedTexts[i];
+        std::map<std::pair<size_t, size_t>, std::string> expectedLinks;
+        extractHyperlinksInPlace(expected, expectedLinks);
+
+        std::string actual;
+        std::vector<MWDialogue::Hyperlink> links;
+        MWDialogue::extractHyperlinks(entries[i].get(), actual, links);
+
+        ASSERT_EQ(expected, actual) << i;
+        ASSERT_EQ(expectedLinks.size(), links.size()) << i;
+        for (size_t link = 0; link < links.size(); ++link)
+            ASSERT_EQ(expectedLinks[std::make_pair(links[link].mBegin, links[link].mEnd)], links[link].mTopic);
+    }
+
+    EXPECT_LT(ownBytes * 4, copiedBytes);
+
+    // opening the journal again without new entries doesn't lay it out again
+    MWGui::JournalBookCache<Book> cache;
+    size_t typesetEntries = 0;
+    uint64_t revision = 1;
+
+    Book book = cache.get(revision, TypesetJournal(entries, typesetEntries));
+    EXPECT_EQ(entries.size(), typesetEntries);
+
+    for (int open = 0; open < 3; ++open)
+        EXPECT_EQ(book, cache.get(revision, TypesetJournal(entries, typesetEntries)));
+    EXPECT_EQ(entries.size(), typesetEntries);
+
+    // a new entry changes the revision of the journal, and shows up when it is opened next
+    const ESM::DialInfo* info = infos.front();
+    entries.push_back(MWDialogue::EntryText(info, fixDefines(info->mResponse)));
+    ++revision;
+
+    typesetEntries = 0;
+    Book changed = cache.get(revision, TypesetJournal(entries, typesetEntries));
+    EXPECT_NE(book, changed);
+    EXPECT_EQ(entries.size(), typesetEntries);
+
+    size_t freshEntries = 0;
+    EXPECT_EQ(*TypesetJournal(entries, freshEntries)(), *changed);
+
+    std::string last;
+    std::vector<MWDialogue::Hyperlink> links;
+    MWDialogue::extractHyperlinks(entries.back().get(), last, links);
+    EXPECT_EQ(*book + last + '\n', *changed);
+
+    typesetEntries = 0;
+    EXPECT_EQ(changed, cache.get(revision, TypesetJournal(entries, typesetEntries)));
+    EXPECT_EQ(0u, typesetEntries);
+}
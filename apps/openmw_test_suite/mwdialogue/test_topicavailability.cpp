@@ -0,0 +1,291 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <list>
+#include <map>
+#include <random>
+#include <sstream>
+
+#include <components/esm/loaddial.hpp>
+#include <components/esm/loadinfo.hpp>
+#include <components/misc/stringops.hpp>
+
+#include "apps/openmw/mwdialogue/selectwrapper.hpp"
+#include "apps/openmw/mwdialogue/topicavailability.hpp"
+
+namespace
+{
+    /// Minimal stand-in for the game state read by MWDialogue::Filter
+    struct SyntheticState
+    {
+        std::map<std::string, int> mJournal;
+        std::map<std::string, float> mGlobals;
+        std::map<std::string, int> mItems;
+        int mPcLevel;
+
+        SyntheticState() : mPcLevel (1) {}
+
+        template<typename T>
+        static T get (const std::map<std::string, T>& values, const std::string& name)
+        {
+            typename std::map<std::string, T>::const_iterator iter = values.find (name);
+            return iter==values.end() ? 0 : iter->second;
+        }
+    };
+
+    class SyntheticEvaluator : public MWDialogue::TopicEvaluator
+    {
+            const SyntheticState& mState;
+            std::string mActor;
+
+            bool testSelect (const MWDialogue::SelectWrapper& select) const
+            {
+                switch (select.getFunction())
+                {
+                    case MWDialogue::SelectWrapper::Function_Journal:
+                        return select.selectCompare (SyntheticState::get (mState.mJournal, select.getName()));
+                    case MWDialogue::SelectWrapper::Function_Global:
+                        return select.selectCompare (SyntheticState::get (mState.mGlobals, select.getName()));
+                    case MWDialogue::SelectWrapper::Function_Item:
+                        return select.selectCompare (SyntheticState::get (mState.mItems, select.getName()));
+                    case MWDialogue::SelectWrapper::Function_PcLevel:
+                        return select.selectCompare (mState.mPcLevel);
+                    default:
+                        return true;
+                }
+            }
+
+            bool testActor (const ESM::DialInfo& info) const
+            {
+                return info.mActor.empty() || Misc::StringUtils::ciEqual (info.mActor, mActor);
+            }
+
+        public:
+
+            int mEvaluations;
+
+            SyntheticEvaluator (const SyntheticState& state, const std::string& actor)
+            : mState (state), mActor (actor), mEvaluations (0)
+            {}
+
+            virtual bool hasActorResponses (const ESM::Dialogue& topic)
+            {
+                for (ESM::Dialogue::InfoContainer::const_iterator iter = topic.mInfo.begin();
+                    iter!=topic.mInfo.end(); ++iter)
+                    if (testActor (*iter))
+                        return true;
+
+                return false;
+            }
+
+            virtual bool isAvailable (const ESM::Dialogue& topic)
+            {
+                ++mEvaluations;
+
+                for (ESM::Dialogue::InfoContainer::const_iterator iter = topic.mInfo.begin();
+                    iter!=topic.mInfo.end(); ++iter)
+                {
+                    if (!testActor (*iter))
+                        continue;
+
+                    bool match = true;
+
+                    for (std::vector<ESM::DialInfo::SelectStruct>::const_iterator select = iter->mSelects.begin();
+                        select!=iter->mSelects.end() && match; ++select)
+                        match = testSelect (MWDialogue::SelectWrapper (*select));
+
+                    if (match)
+                        return true;
+                }
+
+                return false;
+            }
+
+            virtual double readInput (const MWDialogue::FilterInput& input)
+            {
+                switch (input.mType)
+                {
+                    case MWDialogue::FilterInput::Type_Journal: return SyntheticState::get (mState.mJournal, input.mName);
+                    case MWDialogue::FilterInput::Type_Global: return SyntheticState::get (mState.mGlobals, input.mName);
+                    case MWDialogue::FilterInput::Type_Item: return SyntheticState::get (mState.mItems, input.mName);
+                    default: return std::nan ("");
+                }
+            }
+    };
+
+    ESM::DialInfo::SelectStruct makeSelect (char type, const std::string& function, char comparison,
+        const std::string& name, int value)
+    {
+        ESM::DialInfo::SelectStruct select;
+        select.mSelectRule = std::string ("0") + type + function + comparison + name;
+        select.mValue.setType (ESM::VT_Int);
+        select.mValue.setInteger (value);
+        return select;
+    }
+
+    std::string makeName (const std::string& prefix, int index)
+    {
+        std::ostringstream stream;
+        stream << prefix << index;
+        return stream.str();
+    }
+
+    std::vector<std::string> getIds (const std::vector<const ESM::Dialogue*>& topics)
+    {
+        std::vector<std::string> ids;
+        for (std::vector<const ESM::Dialogue*>::const_iterator iter = topics.begin(); iter!=topics.end(); ++iter)
+            ids.push_back ((*iter)->mId);
+        return ids;
+    }
+}
+
+struct TopicAvailabilityTest : public ::testing::Test
+{
+    protected:
+
+        std::list<ESM::Dialogue> mTopics;
+        SyntheticState mState;
+        MWDialogue::TopicAvailability mAvailability;
+        std::mt19937 mRandom;
+
+        int random (int max)
+        {
+            return std::uniform_int_distribution<int> (0, max-1) (mRandom);
+        }
+
+        ESM::DialInfo::SelectStruct makeRandomSelect()
+        {
+            const char comparison = static_cast<char> ('0' + random (6));
+
+            switch (random (20))
+            {
+                case 0: return makeSelect ('1', "06", comparison, "", random (5)); // PcLevel
+                case 1: case 2: case 3: case 4: case 5:
+                    return makeSelect ('2', "fX", comparison, makeName ("global_", random (30)), random (3));
+                case 6: case 7: case 8: case 9:
+                    return makeSelect ('5', "IX", comparison, makeName ("item_", random (30)), random (3));
+                default:
+                    return makeSelect ('4', "JX", comparison, makeName ("quest_", random (200)), random (4) * 10);
+            }
+        }
+
+        virtual void SetUp()
+        {
+            const char* actors[] = { "", "", "", "actor_a", "actor_b" };
+
+            for (int i=0; i<5000; ++i)
+            {
+                ESM::Dialogue topic;
+                topic.mId = makeName ("topic_", i);
+                topic.mType = ESM::Dialogue::Topic;
+
+                for (int j=random (3); j>=0; --j)
+                {
+                    ESM::DialInfo info;
+                    info.mActor = actors[random (5)];
+                    info.mData.mPCrank = -1;
+
+                    for (int k=random (4); k>0; --k)
+                        info.mSelects.push_back (makeRandomSelect());
+
+                    topic.mInfo.push_back (info);
+                }
+
+                mTopics.push_back (topic);
+                mAvailability.addTopic (mTopics.back());
+            }
+        }
+
+        void mutate()
+        {
+            switch (random (4))
+            {
+                case 0: mState.mJournal[makeName ("quest_", random (200))] = random (4) * 10; break;
+                case 1: mState.mGlobals[makeName ("global_", random (30))] = static_cast<float> (random (3)); break;
+                case 2: mState.mItems[makeName ("item_", random (30))] = random (3); break;
+                case 3: mState.mPcLevel = random (5); break;
+            }
+        }
+
+        std::vector<std::string> evaluateAll (const std::string& actor)
+        {
+            SyntheticEvaluator evaluator (mState, actor);
+            std::vector<std::string> ids;
+            for (std::list<ESM::Dialogue>::const_iterator iter = mTopics.begin(); iter!=mTopics.end(); ++iter)
+                if (evaluator.isAvailable (*iter))
+                    ids.push_back (iter->mId);
+            return ids;
+        }
+
+        std::vector<std::string> evaluateCached (const std::string& actor)
+        {
+            SyntheticEvaluator evaluator (mState, actor);
+            std::vector<const ESM::Dialogue*> topics;
+            mAvailability.update (actor, evaluator, topics);
+            return getIds (topics);
+        }
+};
+
+TEST_F(TopicAvailabilityTest, cached_evaluation_matches_full_evaluation)
+{
+    const char* actors[] = { "actor_a", "actor_b", "someone_else" };
+
+    for (int round=0; round<200; ++round)
+    {
+        for (int i=random (5); i>=0; --i)
+            mutate();
+
+        const std::string actor = actors[random (3)];
+        ASSERT_EQ (evaluateAll (actor), evaluateCached (actor)) << "round " << round << ", actor " << actor;
+    }
+}
+
+TEST_F(TopicAvailabilityTest, only_dependent_topics_are_evaluated)
+{
+    std::vector<std::string> initial = evaluateCached ("actor_a");
+    const size_t candidates = mAvailability.getLastEvaluationCount();
+
+    ASSERT_EQ (evaluateAll ("actor_a"), initial);
+
+    // nothing changed: only topics checking the player level are evaluated again
+    EXPECT_EQ (initial, evaluateCached ("actor_a"));
+    const size_t volatileTopics = mAvailability.getLastEvaluationCount();
+    EXPECT_LT (volatileTopics, candidates / 4);
+
+    mState.mJournal["quest_7"] = 20;
+    EXPECT_EQ (evaluateAll ("actor_a"), evaluateCached ("actor_a"));
+    EXPECT_GT (mAvailability.getLastEvaluationCount(), volatileTopics);
+    EXPECT_LT (mAvailability.getLastEvaluationCount(), candidates / 4);
+
+    // actor ids are case-insensitive
+    mState.mGlobals["global_3"] = 2;
+    EXPECT_EQ (evaluateAll ("actor_a"), evaluateCached ("ACTOR_A"));
+}
+
+TEST(TopicAvailabilityInputTest, collects_inputs_of_infos)
+{
+    ESM::DialInfo info;
+    info.mData.mPCrank = 2;
+    info.mCell = "Balmora";
+    info.mSelects.push_back (makeSelect ('4', "JX", '0', "A1_1_FindSpymaster", 10));
+    info.mSelects.push_back (makeSelect ('3', "sX", '0', "NoLore", 0));
+    info.mSelects.push_back (makeSelect ('7', "XX", '0', "fargoth", 0)); // NotId
+
+    std::vector<MWDialogue::FilterInput> inputs;
+    bool isVolatile = false;
+    MWDialogue::TopicAvailability::collectInputs (info, inputs, isVolatile);
+
+    EXPECT_FALSE (isVolatile);
+    ASSERT_EQ (4u, inputs.size());
+    EXPECT_EQ (MWDialogue::FilterInput::Type_PcFaction, inputs[0].mType);
+    EXPECT_EQ ("", inputs[0].mName);
+    EXPECT_EQ (MWDialogue::FilterInput::Type_PcCell, inputs[1].mType);
+    EXPECT_EQ ("balmora", inputs[1].mName);
+    EXPECT_EQ (MWDialogue::FilterInput::Type_Journal, inputs[2].mType);
+    EXPECT_EQ ("a1_1_findspymaster", inputs[2].mName);
+    EXPECT_EQ (MWDialogue::FilterInput::Type_Local, inputs[3].mType);
+
+    info.mSelects.push_back (makeSelect ('1', "59", '0', "", 3)); // Weather
+    MWDialogue::TopicAvailability::collectInputs (info, inputs, isVolatile);
+    EXPECT_TRUE (isVolatile);
+}
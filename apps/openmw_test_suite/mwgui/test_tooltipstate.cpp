@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include <typeinfo>
+
+#include <components/esm/loadarmo.hpp>
+#include <components/esm/loadbook.hpp>
+#include <components/esm/loaddoor.hpp>
+#include <components/esm/loadingr.hpp>
+#include <components/esm/loadligh.hpp>
+#include <components/esm/loadmisc.hpp>
+#include <components/esm/loadnpc.hpp>
+#include <components/esm/loadweap.hpp>
+
+#include "apps/openmw/mwgui/tooltipstate.hpp"
+
+namespace
+{
+    using MWGui::ToolTipState;
+
+    /// Every field set to a value, to check which changes make a new tooltip
+    ToolTipState makeState(const void* object, const std::string& typeName, int count = 1, double value = 1)
+    {
+        ToolTipState state(object, "object", typeName, count);
+        for (int i = 0; i < ToolTipState::NumFields; ++i)
+            state.set(static_cast<ToolTipState::Field>(i), value);
+        state.setSoul("ancestor_ghost");
+        return state;
+    }
+
+    /// @return The fields whose change makes objects of the type \a typeName need a new tooltip
+    int getInvalidatingFields(const std::string& typeName)
+    {
+        int object;
+        const ToolTipState state = makeState(&object, typeName);
+
+        int fields = 0;
+        for (int i = 0; i < ToolTipState::NumFields; ++i)
+        {
+            ToolTipState changed = state;
+            changed.set(static_cast<ToolTipState::Field>(i), 2);
+            if (i == ToolTipState::Field_Soul)
+                changed.setSoul("golden saint");
+
+            if (changed != state)
+                fields |= 1 << i;
+        }
+        return fields;
+    }
+
+    int bit(ToolTipState::Field field)
+    {
+        return 1 << field;
+    }
+}
+
+TEST(ToolTipStateTest, item_condition_and_charges)
+{
+    EXPECT_EQ(bit(ToolTipState::Field_Charge) | bit(ToolTipState::Field_EnchantmentCharge),
+              getInvalidatingFields(typeid(ESM::Weapon).name()));
+
+    EXPECT_EQ(bit(ToolTipState::Field_Charge) | bit(ToolTipState::Field_EnchantmentCharge)
+              | bit(ToolTipState::Field_ArmorRating),
+              getInvalidatingFields(typeid(ESM::Armor).name()));
+
+    // a burning light counts down its remaining time
+    EXPECT_EQ(bit(ToolTipState::Field_Charge), getInvalidatingFields(typeid(ESM::Light).name()));
+}
+
+TEST(ToolTipStateTest, souls_locks_and_player_skills)
+{
+    EXPECT_EQ(bit(ToolTipState::Field_Soul), getInvalidatingFields(typeid(ESM::Miscellaneous).name()));
+
+    EXPECT_EQ(bit(ToolTipState::Field_LockLevel) | bit(ToolTipState::Field_Trapped),
+              getInvalidatingFields(typeid(ESM::Door).name()));
+
+    EXPECT_EQ(bit(ToolTipState::Field_AlchemySkill), getInvalidatingFields(typeid(ESM::Ingredient).name()));
+
+    EXPECT_EQ(bit(ToolTipState::Field_Werewolf), getInvalidatingFields(typeid(ESM::NPC).name()));
+}
+
+TEST(ToolTipStateTest, static_tooltips_change_with_object_and_count_only)
+{
+    const std::string book = typeid(ESM::Book).name();
+    EXPECT_EQ(0, getInvalidatingFields(book));
+    EXPECT_EQ(0, ToolTipState::getFields("unknown type"));
+
+    int first;
+    int second;
+    EXPECT_EQ(makeState(&first, book), makeState(&first, book, 1, 5));
+    EXPECT_NE(makeState(&first, book), makeState(&second, book));
+    EXPECT_NE(makeState(&first, book), makeState(&first, book, 2));
+
+    // the same object could be used for another record after it was deleted
+    ToolTipState other(&first, "other", book, 1);
+    EXPECT_NE(makeState(&first, book), other);
+}
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include <components/esm/attr.hpp>
+#include <components/esm/loadskil.hpp>
+
+#include "apps/openmw/mwmechanics/statchannel.hpp"
+
+namespace
+{
+    using MWMechanics::StatEvent;
+
+    struct Recorder : public MWMechanics::StatListener
+    {
+        std::vector<StatEvent> mEvents;
+
+        virtual void statChanged(const StatEvent& event)
+        {
+            mEvents.push_back(event);
+        }
+    };
+
+    struct StatChannelTest : public ::testing::Test
+    {
+        MWMechanics::StatChannel mChannel;
+        Recorder mHud;
+        Recorder mStats;
+    };
+}
+
+TEST_F(StatChannelTest, listeners_only_get_the_types_they_subscribed_to)
+{
+    mChannel.subscribe(StatEvent::Type_Dynamic, &mHud);
+    mChannel.subscribe(StatEvent::Type_Dynamic, &mStats);
+    mChannel.subscribe(StatEvent::Type_Level, &mStats);
+
+    mChannel.publish(StatEvent::makeDynamic(0, MWMechanics::DynamicStat<float>(50)));
+    mChannel.publish(StatEvent::makeLevel(3));
+    mChannel.publish(StatEvent::makeText(StatEvent::Type_Name, "Nerevar"));
+
+    EXPECT_TRUE(mHud.mEvents.empty());
+
+    mChannel.dispatch();
+
+    ASSERT_EQ(1u, mHud.mEvents.size());
+    EXPECT_EQ(StatEvent::Type_Dynamic, mHud.mEvents[0].mType);
+    EXPECT_EQ(2u, mStats.mEvents.size());
+
+    mChannel.unsubscribe(&mStats);
+    mChannel.publish(StatEvent::makeLevel(4));
+    mChannel.dispatch();
+
+    EXPECT_EQ(2u, mStats.mEvents.size());
+}
+
+TEST_F(StatChannelTest, only_the_last_change_of_a_stat_is_delivered)
+{
+    mChannel.subscribe(StatEvent::Type_Attribute, &mStats);
+    mChannel.subscribe(StatEvent::Type_Skill, &mStats);
+
+    for (int value = 40; value <= 50; ++value)
+    {
+        mChannel.publish(StatEvent::makeAttribute(ESM::Attribute::Strength, MWMechanics::AttributeValue()));
+        mChannel.publish(StatEvent::makeSkill(ESM::Skill::Athletics, MWMechanics::SkillValue()));
+
+        MWMechanics::AttributeValue attribute;
+        attribute.setBase(value);
+        mChannel.publish(StatEvent::makeAttribute(ESM::Attribute::Luck, attribute));
+    }
+
+    EXPECT_EQ(3u, mChannel.getNumPending());
+
+    mChannel.dispatch();
+
+    ASSERT_EQ(3u, mStats.mEvents.size());
+    EXPECT_EQ(ESM::Attribute::Strength, mStats.mEvents[0].mIndex);
+    EXPECT_EQ(ESM::Skill::Athletics, mStats.mEvents[1].mIndex);
+    EXPECT_EQ(ESM::Attribute::Luck, mStats.mEvents[2].mIndex);
+    EXPECT_EQ(50, mStats.mEvents[2].mAttribute.getBase());
+
+    EXPECT_EQ(0u, mChannel.getNumPending());
+    mChannel.dispatch();
+    EXPECT_EQ(3u, mStats.mEvents.size());
+}
+
+TEST_F(StatChannelTest, events_carry_the_published_values)
+{
+    for (int i = 0; i < StatEvent::Type_Length; ++i)
+        mChannel.subscribe(static_cast<StatEvent::Type>(i), &mStats);
+
+    MWMechanics::SkillValue skill;
+    skill.setBase(35);
+    skill.setModifier(5);
+    skill.setProgress(0.5f);
+
+    MWMechanics::DynamicStat<float> fatigue(200);
+    fatigue.setCurrent(-20, true);
+
+    mChannel.publish(StatEvent::makeSkill(ESM::Skill::Marksman, skill));
+    mChannel.publish(StatEvent::makeDynamic(2, fatigue));
+    mChannel.publish(StatEvent::makeText(StatEvent::Type_Race, "dark elf"));
+    mChannel.publish(StatEvent::makeText(StatEvent::Type_Class, "Spellsword"));
+    mChannel.dispatch();
+
+    ASSERT_EQ(4u, mStats.mEvents.size());
+    EXPECT_TRUE(mStats.mEvents[0].mSkill == skill);
+    EXPECT_EQ(40, mStats.mEvents[0].mSkill.getModified());
+    EXPECT_TRUE(mStats.mEvents[1].mDynamic == fatigue);
+    EXPECT_EQ(-20, mStats.mEvents[1].mDynamic.getCurrent());
+    EXPECT_EQ("dark elf", mStats.mEvents[2].mString);
+    EXPECT_EQ(StatEvent::Type_Class, mStats.mEvents[3].mType);
+    EXPECT_EQ("Spellsword", mStats.mEvents[3].mString);
+}
+
+TEST_F(StatChannelTest, invalid_stats_are_rejected)
+{
+    EXPECT_THROW(mChannel.publish(StatEvent::makeAttribute(ESM::Attribute::Length, MWMechanics::AttributeValue())),
+        std::runtime_error);
+    EXPECT_THROW(mChannel.publish(StatEvent::makeDynamic(3, MWMechanics::DynamicStat<float>())), std::runtime_error);
+    EXPECT_THROW(StatEvent::makeText(StatEvent::Type_Level, ""), std::logic_error);
+    EXPECT_EQ(0u, mChannel.getNumPending());
+}
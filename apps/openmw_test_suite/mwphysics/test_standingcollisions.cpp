@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+
+#include "apps/openmw/mwphysics/standingcollisions.hpp"
+
+namespace
+{
+    /// The previous bookkeeping of MWPhysics::PhysicsSystem, an actor -> object map that is scanned linearly
+    struct ReferenceCollisions
+    {
+        typedef std::map<MWWorld::Ptr, MWWorld::Ptr> CollisionMap;
+        CollisionMap mMap;
+
+        void setStandingOn (const MWWorld::Ptr& actor, const MWWorld::Ptr& object)
+        {
+            mMap[actor] = object;
+        }
+
+        bool isStandingOn (const MWWorld::Ptr& actor, const MWWorld::ConstPtr& object) const
+        {
+            for (CollisionMap::const_iterator it = mMap.begin(); it != mMap.end(); ++it)
+                if (it->first == actor && it->second == object)
+                    return true;
+            return false;
+        }
+
+        void getActorsStandingOn (const MWWorld::ConstPtr& object, std::vector<MWWorld::Ptr>& out) const
+        {
+            for (CollisionMap::const_iterator it = mMap.begin(); it != mMap.end(); ++it)
+                if (it->second == object)
+                    out.push_back(it->first);
+        }
+
+        void updatePtr (const MWWorld::Ptr& old, const MWWorld::Ptr& updated)
+        {
+            CollisionMap::iterator found = mMap.find(old);
+            if (found != mMap.end())
+            {
+                mMap[updated] = found->second;
+                mMap.erase(found);
+            }
+
+            for (CollisionMap::iterator it = mMap.begin(); it != mMap.end(); ++it)
+                if (it->second == old)
+                    it->second = updated;
+        }
+    };
+
+    struct StandingCollisionsTest : public ::testing::Test
+    {
+        static const size_t sNumActors = 2000;
+        static const size_t sNumPlatforms = 200;
+
+        // Handles are only compared, never dereferenced, so any distinct addresses will do
+        std::vector<char> mStorage;
+        size_t mNextRef;
+
+        std::vector<MWWorld::Ptr> mActors;
+        std::vector<MWWorld::Ptr> mPlatforms;
+
+        std::mt19937 mRandom;
+
+        StandingCollisionsTest()
+            : mStorage(100000), mNextRef(0)
+        {
+            for (size_t i = 0; i < sNumActors; ++i)
+                mActors.push_back(makePtr());
+            for (size_t i = 0; i < sNumPlatforms; ++i)
+                mPlatforms.push_back(makePtr());
+        }
+
+        MWWorld::Ptr makePtr()
+        {
+            return MWWorld::Ptr(static_cast<MWWorld::LiveCellRefBase*>(static_cast<void*>(&mStorage.at(mNextRef++))));
+        }
+
+        size_t random (size_t max)
+        {
+            return std::uniform_int_distribution<size_t>(0, max - 1)(mRandom);
+        }
+    };
+}
+
+TEST_F(StandingCollisionsTest, matches_actor_object_map_with_moving_platforms)
+{
+    MWPhysics::StandingCollisions collisions;
+    ReferenceCollisions reference;
+
+    for (int frame = 0; frame < 20; ++frame)
+    {
+        collisions.clear();
+        reference.mMap.clear();
+
+        // most actors stand on a platform, the rest on terrain
+        for (size_t i = 0; i < sNumActors; ++i)
+        {
+            if (random(4) == 0)
+                continue;
+            const MWWorld::Ptr& platform = mPlatforms[random(sNumPlatforms)];
+            collisions.setStandingOn(mActors[i], platform);
+            reference.setStandingOn(mActors[i], platform);
+        }
+
+        // platforms and actors moving to another cell get a new Ptr
+        for (int i = 0; i < 5; ++i)
+        {
+            MWWorld::Ptr& platform = mPlatforms[random(sNumPlatforms)];
+            MWWorld::Ptr updated = makePtr();
+
+            collisions.updatePtr(platform, updated);
+            reference.updatePtr(platform, updated);
+
+            platform = updated;
+
+            MWWorld::Ptr& actor = mActors[random(sNumActors)];
+            updated = makePtr();
+            collisions.updatePtr(actor, updated);
+            reference.updatePtr(actor, updated);
+            actor = updated;
+        }
+
+        ASSERT_EQ(reference.mMap.size(), collisions.size());
+
+        for (size_t i = 0; i < sNumPlatforms; ++i)
+        {
+            std::vector<MWWorld::Ptr> expected;
+            std::vector<MWWorld::Ptr> actual;
+
+            collisions.getActorsStandingOn(mPlatforms[i], actual);
+            reference.getActorsStandingOn(mPlatforms[i], expected);
+
+            ASSERT_EQ(expected, actual) << "frame " << frame << ", platform " << i;
+        }
+
+        for (int i = 0; i < 200; ++i)
+        {
+            const MWWorld::Ptr& actor = mActors[random(sNumActors)];
+            const MWWorld::Ptr& platform = mPlatforms[random(sNumPlatforms)];
+
+            bool actual = collisions.isStandingOn(actor, platform);
+            bool expected = reference.isStandingOn(actor, platform);
+
+            ASSERT_EQ(expected, actual);
+
+            ReferenceCollisions::CollisionMap::const_iterator found = reference.mMap.find(actor);
+            EXPECT_EQ(found == reference.mMap.end() ? MWWorld::Ptr() : found->second, collisions.getStandingOn(actor));
+        }
+    }
+}
+
+TEST_F(StandingCollisionsTest, removing_a_platform_only_affects_its_actors)
+{
+    MWPhysics::StandingCollisions collisions;
+    collisions.setStandingOn(mActors[0], mPlatforms[0]);
+    collisions.setStandingOn(mActors[1], mPlatforms[0]);
+    collisions.setStandingOn(mActors[2], mPlatforms[1]);
+
+    // moving to another platform
+    collisions.setStandingOn(mActors[1], mPlatforms[1]);
+
+    std::vector<MWWorld::Ptr> actors;
+    collisions.getActorsStandingOn(mPlatforms[0], actors);
+    ASSERT_EQ(1u, actors.size());
+    EXPECT_EQ(mActors[0], actors[0]);
+
+    collisions.remove(mPlatforms[1]);
+    EXPECT_EQ(1u, collisions.size());
+    EXPECT_TRUE(collisions.getStandingOn(mActors[1]).isEmpty());
+    EXPECT_TRUE(collisions.getStandingOn(mActors[2]).isEmpty());
+    EXPECT_TRUE(collisions.isStandingOn(mActors[0], mPlatforms[0]));
+
+    collisions.remove(mActors[0]);
+    EXPECT_EQ(0u, collisions.size());
+    actors.clear();
+    collisions.getActorsStandingOn(mPlatforms[0], actors);
+    EXPECT_TRUE(actors.empty());
+}
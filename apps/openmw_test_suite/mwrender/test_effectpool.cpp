@@ -0,0 +1,245 @@
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include <osg/FrameStamp>
+#include <osg/Group>
+#include <osg/Viewport>
+
+#include <osgParticle/BoxPlacer>
+#include <osgParticle/ConstantRateCounter>
+#include <osgParticle/ParticleSystemUpdater>
+
+#include <osgUtil/CullVisitor>
+#include <osgUtil/RenderStage>
+#include <osgUtil/StateGraph>
+
+#include <components/nifosg/particle.hpp>
+#include <components/sceneutil/clone.hpp>
+
+#include "apps/openmw/mwrender/effectpool.hpp"
+
+namespace
+{
+    MWRender::EffectPool::Instance createInstance()
+    {
+        MWRender::EffectPool::Instance instance;
+        instance.mTransform = new osg::PositionAttitudeTransform;
+        instance.mMaxControllerLength = 1.f;
+        return instance;
+    }
+
+    const double sFrameTime = 0.125;
+
+    /// A model with a single emitter, set up like NifOsg::Loader does for a NiParticleSystemController
+    osg::ref_ptr<osg::Group> createEmitterTemplate()
+    {
+        osg::ref_ptr<NifOsg::ParticleSystem> partsys (new NifOsg::ParticleSystem);
+        partsys->setQuota(1000);
+
+        osg::ref_ptr<NifOsg::Emitter> emitter (new NifOsg::Emitter);
+
+        osgParticle::ConstantRateCounter* counter = new osgParticle::ConstantRateCounter;
+        counter->setNumberOfParticlesPerSecondToCreate(16);
+        emitter->setCounter(counter);
+
+        // every particle lives for one second
+        emitter->setShooter(new NifOsg::ParticleShooter(0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 1.f, 0.f));
+
+        osgParticle::BoxPlacer* placer = new osgParticle::BoxPlacer;
+        placer->setXRange(0.f, 0.f);
+        placer->setYRange(0.f, 0.f);
+        placer->setZRange(0.f, 0.f);
+        emitter->setPlacer(placer);
+
+        emitter->setParticleSystem(partsys);
+
+        osg::ref_ptr<osgParticle::ParticleSystemUpdater> updater (new osgParticle::ParticleSystemUpdater);
+        updater->addParticleSystem(partsys);
+
+        osg::ref_ptr<osg::Group> root (new osg::Group);
+        root->addChild(emitter);
+        root->addChild(updater);
+        root->addChild(partsys);
+        return root;
+    }
+
+    /// Run the cull traversal of a frame, that is where osgParticle emits and updates particles
+    void cull(osg::Node* node, unsigned int frameNumber, double time)
+    {
+        osg::ref_ptr<osg::FrameStamp> frameStamp (new osg::FrameStamp);
+        frameStamp->setFrameNumber(frameNumber);
+        frameStamp->setReferenceTime(time);
+        frameStamp->setSimulationTime(time);
+
+        osg::ref_ptr<osgUtil::StateGraph> stateGraph (new osgUtil::StateGraph);
+        osg::ref_ptr<osgUtil::RenderStage> renderStage (new osgUtil::RenderStage);
+
+        osg::ref_ptr<osgUtil::CullVisitor> cullVisitor (new osgUtil::CullVisitor);
+        cullVisitor->setFrameStamp(frameStamp);
+        cullVisitor->setStateGraph(stateGraph);
+        cullVisitor->setRenderStage(renderStage);
+        cullVisitor->setComputeNearFarMode(osg::CullSettings::DO_NOT_COMPUTE_NEAR_FAR);
+
+        osg::ref_ptr<osg::Viewport> viewport (new osg::Viewport(0, 0, 256, 256));
+        cullVisitor->pushViewport(viewport);
+        cullVisitor->pushProjectionMatrix(new osg::RefMatrix(osg::Matrix::perspective(60.0, 1.0, 1.0, 1000.0)));
+        cullVisitor->pushModelViewMatrix(new osg::RefMatrix(osg::Matrix::lookAt(osg::Vec3(0.f, -100.f, 0.f),
+            osg::Vec3(), osg::Vec3(0.f, 0.f, 1.f))), osg::Transform::ABSOLUTE_RF);
+
+        node->accept(*cullVisitor);
+
+        cullVisitor->popModelViewMatrix();
+        cullVisitor->popProjectionMatrix();
+        cullVisitor->popViewport();
+    }
+
+    int countAliveParticles(osg::Group* root)
+    {
+        osgParticle::ParticleSystem* partsys = dynamic_cast<osgParticle::ParticleSystem*>(root->getChild(2));
+        if (!partsys)
+            return -1;
+
+        int alive = 0;
+        for (int i = 0; i < partsys->numParticles(); ++i)
+            if (partsys->getParticle(i)->isAlive())
+                ++alive;
+        return alive;
+    }
+}
+
+TEST(EffectPoolTest, finished_instances_are_reused_for_the_same_key)
+{
+    MWRender::EffectPool pool (4, 16);
+
+    MWRender::EffectPool::Instance instance;
+    EXPECT_FALSE(pool.take("meshes\\e\\magic_hit.nif", instance));
+    EXPECT_EQ(1u, pool.getNumMissed());
+
+    MWRender::EffectPool::Instance created = createInstance();
+    EXPECT_TRUE(pool.put("meshes\\e\\magic_hit.nif", created));
+    EXPECT_EQ(1u, pool.getNumIdle());
+
+    EXPECT_FALSE(pool.take("meshes\\e\\magic_cast.nif", instance));
+    ASSERT_TRUE(pool.take("meshes\\e\\magic_hit.nif", instance));
+    EXPECT_EQ(created.mTransform, instance.mTransform);
+    EXPECT_EQ(1.f, instance.mMaxControllerLength);
+
+    EXPECT_EQ(0u, pool.getNumIdle());
+    EXPECT_EQ(1u, pool.getNumReused());
+    EXPECT_EQ(2u, pool.getNumMissed());
+
+    // each instance is handed out only once
+    EXPECT_FALSE(pool.take("meshes\\e\\magic_hit.nif", instance));
+}
+
+TEST(EffectPoolTest, idle_instances_are_bounded)
+{
+    MWRender::EffectPool pool (2, 3);
+
+    EXPECT_TRUE(pool.put("a", createInstance()));
+    EXPECT_TRUE(pool.put("a", createInstance()));
+    EXPECT_FALSE(pool.put("a", createInstance()));
+    EXPECT_TRUE(pool.put("b", createInstance()));
+    EXPECT_FALSE(pool.put("c", createInstance()));
+
+    EXPECT_EQ(3u, pool.getNumIdle());
+    EXPECT_EQ(2u, pool.getNumDiscarded());
+
+    MWRender::EffectPool::Instance instance;
+    ASSERT_TRUE(pool.take("a", instance));
+    EXPECT_TRUE(pool.put("c", createInstance()));
+
+    pool.clear();
+    EXPECT_EQ(0u, pool.getNumIdle());
+    EXPECT_FALSE(pool.take("c", instance));
+}
+
+TEST(EffectPoolTest, spell_heavy_combat_reuses_most_instances)
+{
+    const char* models[] = { "meshes\\e\\magic_hit_dst.nif", "meshes\\e\\magic_hit_fir.nif",
+                             "meshes\\e\\magic_hit_shk.nif", "meshes\\e\\magic_cast_dst.nif" };
+    const size_t numModels = sizeof(models) / sizeof(models[0]);
+
+    MWRender::EffectPool pool (16, 32);
+    std::mt19937 random;
+
+    struct Active
+    {
+        std::string mKey;
+        MWRender::EffectPool::Instance mInstance;
+        int mEndFrame;
+    };
+    std::vector<Active> active;
+
+    unsigned int created = 0;
+    for (int frame = 0; frame < 3000; ++frame)
+    {
+        // a few effects start every frame and play for about a second
+        for (int i = 0; i < 3; ++i)
+        {
+            Active effect;
+            effect.mKey = models[random() % numModels];
+            effect.mEndFrame = frame + 30 + random() % 60;
+            if (!pool.take(effect.mKey, effect.mInstance))
+            {
+                effect.mInstance = createInstance();
+                ++created;
+            }
+            active.push_back(effect);
+        }
+
+        for (size_t i = 0; i < active.size(); )
+        {
+            if (active[i].mEndFrame <= frame)
+            {
+                pool.put(active[i].mKey, active[i].mInstance);
+                std::swap(active[i], active.back());
+                active.pop_back();
+            }
+            else
+                ++i;
+        }
+
+        ASSERT_LE(pool.getNumIdle(), 32u);
+    }
+
+    EXPECT_EQ(created, pool.getNumMissed());
+    EXPECT_EQ(9000u, pool.getNumReused() + pool.getNumMissed());
+    EXPECT_LT(created * 10, pool.getNumReused());
+}
+
+TEST(EffectPoolTest, reused_emitter_creates_as_many_particles_as_a_new_one)
+{
+    osg::ref_ptr<osg::Group> base = createEmitterTemplate();
+
+    // plays once
+    osg::ref_ptr<osg::Group> reused = osg::clone(base.get(), SceneUtil::CopyOp());
+    unsigned int frameNumber = 1;
+    double time = 0.0;
+    for (int i = 0; i < 16; ++i, ++frameNumber, time += sFrameTime)
+        cull(reused, frameNumber, time);
+    EXPECT_GT(countAliveParticles(reused), 0);
+
+    // then waits in the pool while the game goes on
+    frameNumber += 1000;
+    time += 1000 * sFrameTime;
+
+    ASSERT_TRUE(MWRender::recreateParticles(*reused, *base));
+    osg::ref_ptr<osg::Group> created = osg::clone(base.get(), SceneUtil::CopyOp());
+
+    for (int i = 0; i < 16; ++i, ++frameNumber, time += sFrameTime)
+    {
+        cull(reused, frameNumber, time);
+        cull(created, frameNumber, time);
+        ASSERT_EQ(countAliveParticles(created), countAliveParticles(reused)) << "frame " << i;
+    }
+    EXPECT_GT(countAliveParticles(created), 0);
+
+    // the template itself is never simulated
+    EXPECT_EQ(0, countAliveParticles(base));
+
+    // an instance of another model can't be reused
+    osg::ref_ptr<osg::Group> other (new osg::Group);
+    EXPECT_FALSE(MWRender::recreateParticles(*other, *base));
+}
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+#include "apps/openmw/mwrender/previewsignature.hpp"
+
+namespace
+{
+    const int sSlots = 19;
+    const int sSlotCuirass = 1;
+    const int sSlotCarriedRight = 16;
+
+    /// Stand-in for the character preview of the inventory window, counting what it would set up
+    struct Preview
+    {
+        MWRender::PreviewChangeTracker mChanges;
+        int mRedraws;
+
+        Preview() : mRedraws(0) {}
+
+        void rebuild(const MWRender::PreviewSignature& signature)
+        {
+            if (!mChanges.needsRebuild(signature))
+                return;
+            mChanges.rebuilt(signature);
+            ++mRedraws;
+        }
+
+        void update(const MWRender::PreviewSignature& signature)
+        {
+            if (mChanges.update(signature) != MWRender::PreviewChangeTracker::Change_None)
+                ++mRedraws;
+        }
+    };
+
+    struct PreviewSignatureTest : public ::testing::Test
+    {
+        int mNpc;
+        MWRender::PreviewSignature mSignature;
+
+        PreviewSignatureTest()
+        {
+            mSignature.mCharacter = &mNpc;
+            mSignature.mNpc = &mNpc;
+            mSignature.mRace = "Dark Elf";
+            mSignature.mHead = "b_n_dark elf_m_head_01";
+            mSignature.mHair = "b_n_dark elf_m_hair_01";
+            mSignature.mEquipped.resize(sSlots);
+            mSignature.mEquipped[sSlotCarriedRight] = "iron dagger";
+            mSignature.mAnimGroup = "inventoryweapononehand";
+            mSignature.mShowCarriedLeft = true;
+        }
+    };
+}
+
+TEST_F(PreviewSignatureTest, inventory_window_sequence_rebuilds_only_on_changes)
+{
+    Preview preview;
+
+    // InventoryWindow::updatePlayer: rebuild, update, then dirtyPreview updates again
+    preview.rebuild(mSignature);
+    preview.update(mSignature);
+    preview.update(mSignature);
+    EXPECT_EQ(1u, preview.mChanges.getNumRebuilds());
+    EXPECT_EQ(1u, preview.mChanges.getNumPartUpdates());
+    EXPECT_EQ(2, preview.mRedraws);
+
+    // sorting, filtering, dragging an item around and dropping it back notify the window of changed content
+    for (int i = 0; i < 50; ++i)
+        preview.update(mSignature);
+    EXPECT_EQ(1u, preview.mChanges.getNumPartUpdates());
+    EXPECT_EQ(51u, preview.mChanges.getNumSkippedUpdates());
+
+    // equipping a cuirass changes the parts, but not the pose
+    mSignature.mEquipped[sSlotCuirass] = "iron_cuirass";
+    preview.update(mSignature);
+    EXPECT_EQ(2u, preview.mChanges.getNumPartUpdates());
+    EXPECT_EQ(3, preview.mRedraws);
+
+    // a two handed weapon changes both
+    mSignature.mEquipped[sSlotCarriedRight] = "iron claymore";
+    mSignature.mAnimGroup = "inventoryweapontwohand";
+    mSignature.mShowCarriedLeft = false;
+    preview.update(mSignature);
+    EXPECT_EQ(3u, preview.mChanges.getNumPartUpdates());
+    EXPECT_EQ(3u, preview.mChanges.getNumAnimationUpdates());
+
+    // reopening the window or an unchanged character after loading don't rebuild
+    preview.rebuild(mSignature);
+    preview.update(mSignature);
+    EXPECT_EQ(1u, preview.mChanges.getNumRebuilds());
+    EXPECT_EQ(4, preview.mRedraws);
+
+    // becoming a vampire does
+    mSignature.mNpcType = 1;
+    preview.update(mSignature);
+    EXPECT_EQ(4u, preview.mChanges.getNumPartUpdates());
+}
+
+TEST_F(PreviewSignatureTest, a_rebuild_sets_up_parts_again)
+{
+    Preview preview;
+    preview.rebuild(mSignature);
+    preview.update(mSignature);
+
+    // e.g. character creation changes the race
+    mSignature.mRace = "High Elf";
+    EXPECT_TRUE(preview.mChanges.needsRebuild(mSignature));
+
+    // updating first doesn't hide the changed base
+    preview.update(mSignature);
+    EXPECT_TRUE(preview.mChanges.needsRebuild(mSignature));
+
+    preview.rebuild(mSignature);
+    EXPECT_FALSE(preview.mChanges.needsRebuild(mSignature));
+    EXPECT_EQ(MWRender::PreviewChangeTracker::Change_Parts | MWRender::PreviewChangeTracker::Change_Animation,
+              preview.mChanges.update(mSignature));
+    EXPECT_EQ(MWRender::PreviewChangeTracker::Change_None, preview.mChanges.update(mSignature));
+
+    // a different character, as after loading a game
+    int otherNpc;
+    mSignature.mCharacter = &otherNpc;
+    EXPECT_TRUE(preview.mChanges.needsRebuild(mSignature));
+
+    preview.mChanges.reset();
+    mSignature.mCharacter = &mNpc;
+    EXPECT_TRUE(preview.mChanges.needsRebuild(mSignature));
+}
+
+TEST_F(PreviewSignatureTest, pose_changes_do_not_update_parts)
+{
+    Preview preview;
+    preview.rebuild(mSignature);
+    preview.update(mSignature);
+
+    mSignature.mTorch = true;
+    EXPECT_EQ(MWRender::PreviewChangeTracker::Change_Animation, preview.mChanges.update(mSignature));
+    EXPECT_EQ(1u, preview.mChanges.getNumPartUpdates());
+    EXPECT_EQ(2u, preview.mChanges.getNumAnimationUpdates());
+}
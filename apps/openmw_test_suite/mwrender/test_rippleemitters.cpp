@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+
+#include <map>
+
+#include "apps/openmw/mwrender/rippleemitters.hpp"
+
+namespace
+{
+    /// Synthetic actors: positions are set by the test, the water surface is at height 0
+    struct Actors : public MWRender::RippleEmitters::Actors
+    {
+        std::map<const MWWorld::LiveCellRefBase*, osg::Vec3f> mPositions;
+        int mNumContactTests;
+
+        Actors() : mNumContactTests(0) {}
+
+        virtual osg::Vec3f getPosition(const MWWorld::ConstPtr& ptr)
+        {
+            return mPositions[ptr.mRef];
+        }
+
+        virtual bool isAtWaterSurface(const MWWorld::ConstPtr& ptr)
+        {
+            ++mNumContactTests;
+            float z = mPositions[ptr.mRef].z();
+            return z < 0 && z > -100;
+        }
+    };
+
+    struct RippleEmittersTest : public ::testing::Test
+    {
+        // only their addresses are used to tell objects and cells apart
+        char mObjects[101];
+        char mCells[4];
+
+        MWRender::RippleEmitters mEmitters;
+        Actors mActors;
+        std::vector<osg::Vec3f> mRipples;
+
+        RippleEmittersTest()
+            : mEmitters(8192.f, 0.1f)
+        {
+        }
+
+        MWWorld::ConstPtr getPtr(int object, int cell)
+        {
+            return MWWorld::ConstPtr(reinterpret_cast<const MWWorld::LiveCellRefBase*>(&mObjects[object]),
+                                     reinterpret_cast<const MWWorld::CellStore*>(&mCells[cell]));
+        }
+
+        void setPosition(int object, const osg::Vec3f& position)
+        {
+            mActors.mPositions[reinterpret_cast<const MWWorld::LiveCellRefBase*>(&mObjects[object])] = position;
+        }
+
+        std::size_t update(float dt, const osg::Vec3f& camera = osg::Vec3f())
+        {
+            mRipples.clear();
+            mEmitters.update(dt, camera, mActors, mRipples);
+            return mRipples.size();
+        }
+    };
+}
+
+TEST_F(RippleEmittersTest, moving_actors_at_the_water_surface_emit)
+{
+    mEmitters.add(getPtr(0, 0), 1.f, 1.f); // swimming
+    mEmitters.add(getPtr(1, 0), 1.f, 1.f); // on land
+    mEmitters.add(getPtr(2, 1), 1.f, 1.f); // submerged
+    mEmitters.add(getPtr(0, 0), 1.f, 1.f); // added twice
+
+    EXPECT_EQ(3u, mEmitters.size());
+
+    int ripples = 0;
+    for (int frame = 0; frame < 60; ++frame)
+    {
+        // 300 units per second at 60 frames per second
+        setPosition(0, osg::Vec3f(frame * 5.f, 0, -50));
+        setPosition(1, osg::Vec3f(frame * 5.f, 100, 50));
+        setPosition(2, osg::Vec3f(frame * 5.f, 200, -500));
+        ripples += update(1/60.f);
+    }
+
+    // a ripple every 0.1 seconds from the swimmer
+    EXPECT_GE(ripples, 9);
+    EXPECT_LE(ripples, 10);
+
+    // standing still doesn't make new ripples once the swimmer caught up
+    update(1.f);
+    EXPECT_EQ(0u, update(1.f));
+}
+
+TEST_F(RippleEmittersTest, distant_actors_are_not_tested)
+{
+    for (int i = 0; i < 100; ++i)
+        mEmitters.add(getPtr(i, i % 4), 1.f, 1.f);
+
+    for (int frame = 0; frame < 10; ++frame)
+    {
+        for (int i = 0; i < 100; ++i)
+            setPosition(i, osg::Vec3f(i * 1000.f, frame * 20.f, -50));
+
+        update(0.2f, osg::Vec3f(0, 0, 0));
+
+        // within 8192 units: actors 0 to 8
+        EXPECT_EQ(9u, mEmitters.getNumTested());
+        EXPECT_EQ(9u, mRipples.size());
+    }
+    EXPECT_EQ(90, mActors.mNumContactTests);
+}
+
+TEST_F(RippleEmittersTest, emitters_are_removed_by_cell)
+{
+    for (int i = 0; i < 100; ++i)
+    {
+        mEmitters.add(getPtr(i, i % 4), 1.f, 1.f);
+        setPosition(i, osg::Vec3f(0, 0, -50));
+    }
+
+    // the player (0) moves from cell 0 to cell 1, another actor (4) is replaced by a new ptr in cell 2
+    MWWorld::ConstPtr player = getPtr(0, 1);
+    mEmitters.updatePtr(player, player);
+    mEmitters.updatePtr(getPtr(4, 0), getPtr(100, 2));
+
+    mEmitters.removeCell(reinterpret_cast<const MWWorld::CellStore*>(&mCells[0]), player);
+    EXPECT_EQ(77u, mEmitters.size());
+
+    // the player is kept when its old cell is unloaded before its ptr was updated
+    mEmitters.removeCell(reinterpret_cast<const MWWorld::CellStore*>(&mCells[1]), getPtr(0, 3));
+    EXPECT_EQ(52u, mEmitters.size());
+
+    mEmitters.remove(getPtr(100, 2));
+    mEmitters.remove(getPtr(2, 2));
+    mEmitters.remove(getPtr(2, 2));
+    EXPECT_EQ(50u, mEmitters.size());
+
+    mEmitters.removeCell(reinterpret_cast<const MWWorld::CellStore*>(&mCells[2]), player);
+    mEmitters.removeCell(reinterpret_cast<const MWWorld::CellStore*>(&mCells[3]), player);
+    EXPECT_EQ(1u, mEmitters.size());
+
+    EXPECT_EQ(1u, update(1.f));
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include "apps/openmw/mwsound/sound.hpp"
+
+namespace
+{
+    using namespace MWSound;
+
+    /// Counts the source updates an output backend would issue
+    struct NullOutput
+    {
+        int mCalls;
+
+        NullOutput() : mCalls(0) { }
+
+        void update(SoundBase& sound, const SourceParams& params)
+        {
+            int changes = sound.updateSourceParams(params);
+            for (int change = SourceParams::Change_Gain; change <= SourceParams::Change_Position; change <<= 1)
+                if (changes & change)
+                    ++mCalls;
+        }
+    };
+
+    Sound* makeSound (float gain, bool loop = false)
+    {
+        Sound* sound = new Sound;
+        sound->init(osg::Vec3f(), gain, 1.0f, 1.0f, 1.0f, 1000.0f, static_cast<int>(loop ? PlayMode::Loop : PlayMode::Normal));
+        sound->updateSourceParams(SourceParams(osg::Vec3f(), gain, 1.0f));
+        return sound;
+    }
+}
+
+TEST(MWSoundSourceParamsTest, unchanged_sources_are_not_updated)
+{
+    Sound sound;
+    NullOutput output;
+
+    output.update(sound, SourceParams(osg::Vec3f(1, 2, 3), 0.5f, 1.0f));
+    EXPECT_EQ(3, output.mCalls);
+
+    for (int frame = 0; frame < 100; ++frame)
+        output.update(sound, SourceParams(osg::Vec3f(1, 2, 3), 0.5f, 1.0f));
+    EXPECT_EQ(3, output.mCalls);
+
+    output.update(sound, SourceParams(osg::Vec3f(1, 2, 4), 0.5f, 1.0f));
+    EXPECT_EQ(4, output.mCalls);
+}
+
+TEST(MWSoundSourceParamsTest, inaudible_sources_are_updated_when_audible_again)
+{
+    Sound sound;
+    NullOutput output;
+
+    output.update(sound, SourceParams(osg::Vec3f(), 0.0f, 1.0f));
+    output.mCalls = 0;
+
+    // out of range sources only move
+    for (int frame = 0; frame < 100; ++frame)
+        output.update(sound, SourceParams(osg::Vec3f(frame, 0, 0), 0.0f, 1.0f + frame));
+    EXPECT_EQ(0, output.mCalls);
+
+    output.update(sound, SourceParams(osg::Vec3f(100, 0, 0), 0.5f, 2.0f));
+    EXPECT_EQ(3, output.mCalls);
+    EXPECT_EQ(osg::Vec3f(100, 0, 0), sound.getSourceParams().mPos);
+    EXPECT_EQ(2.0f, sound.getSourceParams().mPitch);
+}
+
+TEST(MWSoundSourceParamsTest, reused_sounds_are_fully_updated)
+{
+    Sound sound;
+    NullOutput output;
+
+    output.update(sound, SourceParams(osg::Vec3f(), 0.5f, 1.0f));
+    sound.init(0.5f, 1.0f, 1.0f, static_cast<int>(PlayMode::Normal));
+    output.mCalls = 0;
+
+    output.update(sound, SourceParams(osg::Vec3f(), 0.5f, 1.0f));
+    EXPECT_EQ(3, output.mCalls);
+}
+
+TEST(MWSoundSourceParamsTest, least_audible_non_looping_sound_gives_up_its_source)
+{
+    std::vector<Sound*> sounds;
+    sounds.push_back(makeSound(0.1f, true));
+    sounds.push_back(makeSound(0.5f));
+    sounds.push_back(makeSound(0.2f));
+    sounds.push_back(makeSound(0.8f));
+
+    EXPECT_EQ(sounds[2], getLeastAudible(sounds, 0.9f));
+    EXPECT_EQ(sounds[2], getLeastAudible(sounds, 0.3f));
+    EXPECT_EQ(nullptr, getLeastAudible(sounds, 0.2f));
+    EXPECT_EQ(nullptr, getLeastAudible(std::vector<Sound*>(), 1.0f));
+
+    for (Sound* sound : sounds)
+        delete sound;
+}
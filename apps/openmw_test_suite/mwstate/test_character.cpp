@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include <components/esm/esmreader.hpp>
+#include <components/esm/esmwriter.hpp>
+#include <components/esm/defs.hpp>
+
+#include "apps/openmw/mwstate/character.hpp"
+
+struct CharacterTest : public ::testing::Test
+{
+    protected:
+
+        boost::filesystem::path mPath;
+
+        virtual void SetUp()
+        {
+            mPath = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path ("openmw-saves-%%%%-%%%%");
+            boost::filesystem::create_directories (mPath);
+        }
+
+        virtual void TearDown()
+        {
+            boost::filesystem::remove_all (mPath);
+        }
+
+        static ESM::SavedGame makeProfile (int index, const std::string& game)
+        {
+            std::ostringstream description;
+            description << "Save " << index;
+
+            ESM::SavedGame profile;
+            profile.mContentFiles.push_back (game);
+            profile.mPlayerName = "Nerevar";
+            profile.mPlayerLevel = 1 + index % 50;
+            profile.mPlayerClassId = "warrior";
+            profile.mPlayerCell = "Seyda Neen";
+            profile.mInGameTime.mGameHour = 12.5f;
+            profile.mInGameTime.mDay = 16;
+            profile.mInGameTime.mMonth = 7;
+            profile.mInGameTime.mYear = 427;
+            profile.mTimePlayed = index * 60.0;
+            profile.mDescription = description.str();
+            profile.mScreenshot.assign (1000 + index, static_cast<char> (index));
+            return profile;
+        }
+
+        void writeSave (const std::string& fileName, const ESM::SavedGame& profile, std::time_t timeStamp)
+        {
+            std::stringstream stream;
+
+            ESM::ESMWriter writer;
+            writer.setFormat (ESM::SavedGame::sCurrentFormat);
+            writer.setVersion (0);
+            writer.setType (0);
+            writer.setAuthor ("");
+            writer.setDescription ("");
+            writer.save (stream);
+            writer.startRecord (ESM::REC_SAVE);
+            profile.save (writer);
+            writer.endRecord (ESM::REC_SAVE);
+            writer.close();
+
+            boost::filesystem::ofstream file (mPath / fileName, std::ios::binary);
+            file << stream.rdbuf();
+            file.close();
+
+            boost::filesystem::last_write_time (mPath / fileName, timeStamp);
+        }
+
+        static std::string fileName (int index)
+        {
+            std::ostringstream stream;
+            stream << "Save_" << index << ".omwsave";
+            return stream.str();
+        }
+
+        void expectSameSlots (const MWState::Character& left, const MWState::Character& right)
+        {
+            MWState::Character::SlotIterator leftIter = left.begin();
+            MWState::Character::SlotIterator rightIter = right.begin();
+
+            for (; leftIter!=left.end() && rightIter!=right.end(); ++leftIter, ++rightIter)
+            {
+                EXPECT_EQ (leftIter->mPath, rightIter->mPath);
+                EXPECT_EQ (leftIter->mTimeStamp, rightIter->mTimeStamp);
+                EXPECT_EQ (leftIter->mProfile.mDescription, rightIter->mProfile.mDescription);
+                EXPECT_EQ (leftIter->mProfile.mPlayerLevel, rightIter->mProfile.mPlayerLevel);
+                EXPECT_EQ (leftIter->mProfile.mPlayerCell, rightIter->mProfile.mPlayerCell);
+                EXPECT_EQ (leftIter->mProfile.mTimePlayed, rightIter->mProfile.mTimePlayed);
+                EXPECT_EQ (leftIter->mProfile.mContentFiles, rightIter->mProfile.mContentFiles);
+            }
+
+            EXPECT_TRUE (leftIter==left.end());
+            EXPECT_TRUE (rightIter==right.end());
+        }
+};
+
+TEST_F(CharacterTest, index_matches_full_scan)
+{
+    const std::time_t base = 1400000000;
+    for (int i=0; i<200; ++i)
+        writeSave (fileName (i), makeProfile (i, i%10==0 ? "Other.esm" : "Morrowind.esm"), base + i);
+
+    // not a save file
+    boost::filesystem::ofstream (mPath / "notes.txt") << "not a save";
+
+    MWState::Character scanned (mPath, "morrowind.esm");
+    ASSERT_TRUE (boost::filesystem::exists (mPath / MWState::Character::sIndexFileName));
+
+    MWState::Character indexed (mPath, "morrowind.esm");
+    expectSameSlots (scanned, indexed);
+
+    int count = 0;
+    for (MWState::Character::SlotIterator iter = indexed.begin(); iter!=indexed.end(); ++iter)
+    {
+        // screenshots are not kept in memory, but can be read on demand
+        EXPECT_TRUE (iter->mProfile.mScreenshot.empty());
+        ++count;
+    }
+    EXPECT_EQ (180, count);
+
+    // newest first
+    EXPECT_EQ ("Save 199", indexed.begin()->mProfile.mDescription);
+
+    std::vector<char> screenshot;
+    MWState::readScreenshot (*indexed.begin(), screenshot);
+    EXPECT_EQ (makeProfile (199, "Morrowind.esm").mScreenshot, screenshot);
+}
+
+TEST_F(CharacterTest, stale_entries_are_detected)
+{
+    const std::time_t base = 1400000000;
+    for (int i=0; i<20; ++i)
+        writeSave (fileName (i), makeProfile (i, "Morrowind.esm"), base + i);
+
+    {
+        MWState::Character initial (mPath, "Morrowind.esm");
+    }
+
+    // overwritten (same file size, only the modification time tells), removed and added saves
+    ESM::SavedGame changed = makeProfile (5, "Morrowind.esm");
+    changed.mDescription = "Save_5";
+    writeSave (fileName (5), changed, base + 100);
+    boost::filesystem::remove (mPath / fileName (7));
+    writeSave (fileName (20), makeProfile (20, "Morrowind.esm"), base + 50);
+
+    MWState::Character indexed (mPath, "Morrowind.esm");
+
+    EXPECT_EQ ("Save_5", indexed.begin()->mProfile.mDescription);
+
+    int count = 0;
+    for (MWState::Character::SlotIterator iter = indexed.begin(); iter!=indexed.end(); ++iter, ++count)
+        EXPECT_NE (mPath / fileName (7), iter->mPath);
+    EXPECT_EQ (20, count);
+
+    boost::filesystem::remove (mPath / MWState::Character::sIndexFileName);
+    MWState::Character scanned (mPath, "Morrowind.esm");
+    expectSameSlots (scanned, indexed);
+}
+
+TEST_F(CharacterTest, corrupt_index_is_ignored)
+{
+    writeSave (fileName (0), makeProfile (0, "Morrowind.esm"), 1400000000);
+    boost::filesystem::ofstream (mPath / MWState::Character::sIndexFileName, std::ios::binary) << "garbage";
+
+    MWState::Character character (mPath, "Morrowind.esm");
+    ASSERT_TRUE (character.begin()!=character.end());
+    EXPECT_EQ ("Save 0", character.begin()->mProfile.mDescription);
+}
+
+TEST_F(CharacterTest, empty_screenshot_is_still_written)
+{
+    ESM::SavedGame profile = makeProfile (0, "Morrowind.esm");
+    profile.mScreenshot.clear();
+    writeSave (fileName (0), profile, 1400000000);
+
+    ESM::ESMReader reader;
+    reader.open ((mPath / fileName (0)).string());
+    ASSERT_TRUE (reader.getRecName()==ESM::REC_SAVE);
+    reader.getRecHeader();
+
+    ESM::SavedGame loaded;
+    loaded.loadHeader (reader);
+    ASSERT_TRUE (reader.isNextSub ("SCRN"));
+    reader.getSubHeader();
+    EXPECT_EQ (0u, reader.getSubSize());
+
+    MWState::Character character (mPath, "Morrowind.esm");
+    std::vector<char> screenshot (1, 'x');
+    MWState::readScreenshot (*character.begin(), screenshot);
+    EXPECT_TRUE (screenshot.empty());
+}
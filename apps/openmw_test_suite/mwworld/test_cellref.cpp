@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include "apps/openmw/mwworld/cellref.hpp"
+#include "apps/openmw/mwworld/generation.hpp"
+
+namespace
+{
+    ESM::CellRef makeRef()
+    {
+        ESM::CellRef ref;
+        ref.blank();
+        ref.mRefID = "chest";
+        ref.mOwner = "player";
+        ref.mLockLevel = 50;
+        return ref;
+    }
+}
+
+TEST(CellRefTest, loaded_reference_has_no_generation)
+{
+    MWWorld::CellRef ref(makeRef());
+
+    EXPECT_EQ(0u, ref.getGeneration());
+    EXPECT_FALSE(ref.hasChanged());
+}
+
+TEST(CellRefTest, reading_does_not_change_the_generation)
+{
+    MWWorld::CellRef ref(makeRef());
+
+    ref.getRefId();
+    ref.getPosition();
+    ref.getOwner();
+    ref.getLockLevel();
+    ref.getCharge();
+
+    EXPECT_EQ(0u, ref.getGeneration());
+}
+
+TEST(CellRefTest, setting_the_same_value_does_not_change_the_generation)
+{
+    MWWorld::CellRef ref(makeRef());
+
+    ref.setOwner("player");
+    ref.setLockLevel(50);
+    ref.setScale(ref.getScale());
+    ref.resetGlobalVariable();
+
+    EXPECT_EQ(0u, ref.getGeneration());
+    EXPECT_FALSE(ref.hasChanged());
+}
+
+TEST(CellRefTest, every_change_gets_a_newer_generation)
+{
+    MWWorld::CellRef ref(makeRef());
+
+    uint64_t before = MWWorld::nextGeneration();
+    ref.setOwner("");
+    uint64_t owner = ref.getGeneration();
+    EXPECT_LT(before, owner);
+    EXPECT_TRUE(ref.hasChanged());
+
+    ref.setLockLevel(-50);
+    uint64_t lock = ref.getGeneration();
+    EXPECT_LT(owner, lock);
+
+    ref.unsetRefNum();
+    EXPECT_LT(lock, ref.getGeneration());
+}
+
+TEST(CellRefTest, generation_is_shared_between_references)
+{
+    MWWorld::CellRef first(makeRef());
+    MWWorld::CellRef second(makeRef());
+
+    first.setTrap("trap");
+    second.setSoul("soul");
+
+    // a later change to any reference is newer than all earlier ones
+    EXPECT_LT(first.getGeneration(), second.getGeneration());
+}
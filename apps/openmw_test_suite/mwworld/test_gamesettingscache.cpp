@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include <components/esm/esmreader.hpp>
+#include <components/esm/esmwriter.hpp>
+#include <components/loadinglistener/loadinglistener.hpp>
+
+#include "apps/openmw/mwworld/esmstore.hpp"
+
+struct GameSettingsCacheTest : public ::testing::Test
+{
+protected:
+
+    virtual void SetUp()
+    {
+        addSetting("fCombatBlockLeftAngle", ESM::Variant(-90.f));
+        addSetting("fSwingBlockMult", ESM::Variant(1.f));
+        addSetting("fSwingBlockBase", ESM::Variant(150.f));
+        addSetting("iBlockMaxChance", makeInt(50));
+        addSetting("iBlockMinChance", makeInt(10));
+        addSetting("sNotifyMessage50", ESM::Variant(std::string("%s has no effect on you.")));
+
+        ESM::ESMWriter writer;
+        std::stringstream* stream = new std::stringstream;
+        writer.setFormat(0);
+        writer.save(*stream);
+        for (std::vector<ESM::GameSetting>::const_iterator it = mSettings.begin(); it != mSettings.end(); ++it)
+        {
+            writer.startRecord(ESM::GameSetting::sRecordId);
+            it->save(writer);
+            writer.endRecord(ESM::GameSetting::sRecordId);
+        }
+
+        ESM::ESMReader reader;
+        std::vector<ESM::ESMReader> readerList;
+        readerList.push_back(reader);
+        reader.setGlobalReaderList(&readerList);
+        reader.open(Files::IStreamPtr(stream), "filename");
+        mEsmStore.load(reader, &mListener);
+        mEsmStore.setUp();
+    }
+
+    static ESM::Variant makeInt(int value)
+    {
+        // GMSTs store integers as VT_Int rather than the VT_Long the Variant(int) constructor picks
+        ESM::Variant variant;
+        variant.setType(ESM::VT_Int);
+        variant.setInteger(value);
+        return variant;
+    }
+
+    void addSetting(const std::string& id, const ESM::Variant& value)
+    {
+        ESM::GameSetting setting;
+        setting.mId = id;
+        setting.mValue = value;
+        mSettings.push_back(setting);
+    }
+
+    Loading::Listener mListener;
+    std::vector<ESM::GameSetting> mSettings;
+    MWWorld::ESMStore mEsmStore;
+};
+
+TEST_F(GameSettingsCacheTest, handles_match_store_lookups_after_load)
+{
+    const MWWorld::Store<ESM::GameSetting>& store = mEsmStore.get<ESM::GameSetting>();
+    const MWWorld::GameSettingsCache& cache = mEsmStore.getGameSettings();
+
+    const MWWorld::GmstFloat fSwingBlockMult("fSwingBlockMult");
+    const MWWorld::GmstFloat fCombatBlockLeftAngle("fCombatBlockLeftAngle");
+    const MWWorld::GmstInt iBlockMaxChance("iBlockMaxChance");
+    const MWWorld::GmstString sNotifyMessage50("sNotifyMessage50");
+
+    EXPECT_EQ(store.find("fSwingBlockMult")->getFloat(), fSwingBlockMult.get(cache));
+    EXPECT_EQ(store.find("fCombatBlockLeftAngle")->getFloat(), fCombatBlockLeftAngle.get(cache));
+    EXPECT_EQ(store.find("iBlockMaxChance")->getInt(), iBlockMaxChance.get(cache));
+    EXPECT_EQ(store.find("sNotifyMessage50")->getString(), sNotifyMessage50.get(cache));
+
+    // ids are case-insensitive, like for Store::find
+    const MWWorld::GmstInt iBlockMinChance("IBLOCKMINCHANCE");
+    EXPECT_EQ(10, iBlockMinChance.get(cache));
+}
+
+TEST_F(GameSettingsCacheTest, handles_follow_overrides)
+{
+    const MWWorld::GameSettingsCache& cache = mEsmStore.getGameSettings();
+
+    const MWWorld::GmstFloat fSwingBlockBase("fSwingBlockBase");
+    ASSERT_EQ(150.f, fSwingBlockBase.get(cache));
+
+    ESM::GameSetting setting;
+    setting.mId = "fSwingBlockBase";
+    setting.mValue = ESM::Variant(75.f);
+    mEsmStore.overrideRecord(setting);
+
+    EXPECT_EQ(mEsmStore.get<ESM::GameSetting>().find("fSwingBlockBase")->getFloat(), fSwingBlockBase.get(cache));
+    EXPECT_EQ(75.f, fSwingBlockBase.get(cache));
+
+    // a repeated setUp must not leave the handle with a stale record pointer either
+    mEsmStore.setUp();
+    EXPECT_EQ(75.f, fSwingBlockBase.get(cache));
+}
+
+TEST_F(GameSettingsCacheTest, missing_settings_throw)
+{
+    const MWWorld::GmstFloat fDoesNotExist("fDoesNotExist");
+    EXPECT_THROW(fDoesNotExist.get(mEsmStore.getGameSettings()), std::runtime_error);
+
+    MWWorld::GameSettingsCache unused;
+    const MWWorld::GmstFloat fSwingBlockMult("fSwingBlockMult");
+    EXPECT_THROW(fSwingBlockMult.get(unused), std::runtime_error);
+}
+
+TEST_F(GameSettingsCacheTest, handles_agree_with_store_in_combat_formula)
+{
+    // The GMST reads done by MWMechanics::blockMeleeAttack for every blocked hit
+    const MWWorld::Store<ESM::GameSetting>& store = mEsmStore.get<ESM::GameSetting>();
+    const MWWorld::GameSettingsCache& cache = mEsmStore.getGameSettings();
+
+    const MWWorld::GmstFloat fSwingBlockMult("fSwingBlockMult");
+    const MWWorld::GmstFloat fSwingBlockBase("fSwingBlockBase");
+    const MWWorld::GmstInt iBlockMaxChance("iBlockMaxChance");
+    const MWWorld::GmstInt iBlockMinChance("iBlockMinChance");
+
+    float mapResult = store.find("fSwingBlockMult")->getFloat() + store.find("fSwingBlockBase")->getFloat()
+            + store.find("iBlockMaxChance")->getInt() - store.find("iBlockMinChance")->getInt();
+    float handleResult = fSwingBlockMult.get(cache) + fSwingBlockBase.get(cache)
+            + iBlockMaxChance.get(cache) - iBlockMinChance.get(cache);
+
+    EXPECT_EQ(mapResult, handleResult);
+}
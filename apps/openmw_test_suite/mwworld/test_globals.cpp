@@ -0,0 +1,247 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <stdexcept>
+
+#include <components/esm/esmreader.hpp>
+#include <components/esm/esmwriter.hpp>
+#include <components/loadinglistener/loadinglistener.hpp>
+
+#include "apps/openmw/mwworld/esmstore.hpp"
+#include "apps/openmw/mwworld/globals.hpp"
+
+struct GlobalsTest : public ::testing::Test
+{
+protected:
+
+    virtual void SetUp()
+    {
+        addGlobal("GameHour", ESM::Variant(9.f));
+        addGlobal("Day", ESM::Variant(16));
+        addGlobal("PCRace", makeShort(1));
+        addGlobal("CharGenState", makeShort(10));
+        addGlobal("WerewolfClawMult", ESM::Variant(25.f));
+
+        loadStore(mRecords, mEsmStore);
+    }
+
+    void loadStore(const std::vector<ESM::Global>& records, MWWorld::ESMStore& store,
+        const std::vector<ESM::DialInfo>& infos = std::vector<ESM::DialInfo>())
+    {
+        ESM::ESMWriter writer;
+        std::stringstream* stream = new std::stringstream;
+        writer.setFormat(0);
+        writer.save(*stream);
+        for (std::vector<ESM::Global>::const_iterator it = records.begin(); it != records.end(); ++it)
+        {
+            writer.startRecord(ESM::Global::sRecordId);
+            it->save(writer);
+            writer.endRecord(ESM::Global::sRecordId);
+        }
+
+        if (!infos.empty())
+        {
+            ESM::Dialogue dialogue;
+            dialogue.mId = "Topic";
+            dialogue.mType = ESM::Dialogue::Topic;
+            writer.startRecord(ESM::Dialogue::sRecordId);
+            dialogue.save(writer);
+            writer.endRecord(ESM::Dialogue::sRecordId);
+
+            for (std::vector<ESM::DialInfo>::const_iterator it = infos.begin(); it != infos.end(); ++it)
+            {
+                writer.startRecord(ESM::DialInfo::sRecordId);
+                it->save(writer);
+                writer.endRecord(ESM::DialInfo::sRecordId);
+            }
+        }
+
+        ESM::ESMReader reader;
+        std::vector<ESM::ESMReader> readerList;
+        readerList.push_back(reader);
+        reader.setGlobalReaderList(&readerList);
+        reader.open(Files::IStreamPtr(stream), "filename");
+        store.load(reader, &mListener);
+        store.setUp();
+    }
+
+    static ESM::DialInfo makeInfo(const std::string& id, const std::string& prev, const std::vector<std::string>& rules)
+    {
+        ESM::DialInfo info;
+        info.blank();
+        info.mId = id;
+        info.mPrev = prev;
+        for (std::vector<std::string>::const_iterator it = rules.begin(); it != rules.end(); ++it)
+        {
+            ESM::DialInfo::SelectStruct select;
+            select.mSelectRule = *it;
+            select.mValue.setType(ESM::VT_Int);
+            select.mValue.setInteger(1);
+            info.mSelects.push_back(select);
+        }
+        return info;
+    }
+
+    static ESM::Variant makeShort(int value)
+    {
+        ESM::Variant variant;
+        variant.setType(ESM::VT_Short);
+        variant.setInteger(value);
+        return variant;
+    }
+
+    void addGlobal(const std::string& id, const ESM::Variant& value)
+    {
+        ESM::Global global;
+        global.mId = id;
+        global.mValue = value;
+        mRecords.push_back(global);
+    }
+
+    /// Write \a globals the way a saved game does and read the records back into \a target.
+    void saveAndLoad(const MWWorld::Globals& globals, MWWorld::Globals& target)
+    {
+        ESM::ESMWriter writer;
+        std::stringstream* stream = new std::stringstream;
+        writer.setFormat(0);
+        writer.save(*stream);
+        globals.write(writer, mListener);
+        writer.close();
+
+        ESM::ESMReader reader;
+        reader.open(Files::IStreamPtr(stream), "savegame");
+        while (reader.hasMoreRecs())
+        {
+            ESM::NAME name = reader.getRecName();
+            reader.getRecHeader();
+            ASSERT_TRUE(target.readRecord(reader, name.intval));
+        }
+    }
+
+    Loading::Listener mListener;
+    std::vector<ESM::Global> mRecords;
+    MWWorld::ESMStore mEsmStore;
+};
+
+TEST_F(GlobalsTest, slot_lookups_match_name_lookups)
+{
+    MWWorld::Globals globals;
+    globals.fill(mEsmStore);
+
+    EXPECT_EQ(static_cast<int>(mRecords.size()), globals.countSavedGameRecords());
+
+    for (std::vector<ESM::Global>::const_iterator it = mRecords.begin(); it != mRecords.end(); ++it)
+    {
+        int slot = globals.getSlot(it->mId);
+        ASSERT_NE(-1, slot) << it->mId;
+        EXPECT_EQ(slot, globals.getSlot(Misc::StringUtils::lowerCase(it->mId)));
+        EXPECT_EQ(&globals[it->mId], &globals.getValue(slot));
+        EXPECT_EQ(it->mValue.getFloat(), globals.getValue(slot).getFloat());
+    }
+
+    EXPECT_EQ('s', globals.getType("pcrace"));
+    EXPECT_EQ('l', globals.getType("DAY"));
+    EXPECT_EQ('f', globals.getType("gamehour"));
+
+    EXPECT_EQ(-1, globals.getSlot("NoSuchGlobal"));
+    EXPECT_EQ(' ', globals.getType("NoSuchGlobal"));
+    EXPECT_THROW(globals["NoSuchGlobal"], std::runtime_error);
+    EXPECT_THROW(globals.getValue(static_cast<int>(mRecords.size())), std::out_of_range);
+
+    globals.getValue(globals.getSlot("chargenstate")).setInteger(-1);
+    EXPECT_EQ(-1, globals["CharGenState"].getInteger());
+}
+
+TEST_F(GlobalsTest, slots_are_stable_across_save_and_load)
+{
+    MWWorld::Globals globals;
+    globals.fill(mEsmStore);
+
+    globals["gamehour"].setFloat(21.5f);
+    globals["chargenstate"].setInteger(-1);
+
+    MWWorld::Globals loaded;
+    loaded.fill(mEsmStore);
+
+    std::vector<int> slots;
+    for (std::vector<ESM::Global>::const_iterator it = mRecords.begin(); it != mRecords.end(); ++it)
+        slots.push_back(loaded.getSlot(it->mId));
+
+    saveAndLoad(globals, loaded);
+
+    for (size_t i = 0; i < mRecords.size(); ++i)
+    {
+        EXPECT_EQ(slots[i], globals.getSlot(mRecords[i].mId));
+        EXPECT_EQ(slots[i], loaded.getSlot(mRecords[i].mId));
+        EXPECT_EQ(globals.getValue(slots[i]).getFloat(), loaded.getValue(slots[i]).getFloat()) << mRecords[i].mId;
+    }
+
+    EXPECT_EQ(21.5f, loaded["GameHour"].getFloat());
+    EXPECT_EQ(-1, loaded["chargenstate"].getInteger());
+
+    // starting a new game restores the defaults in the same slots
+    loaded.fill(mEsmStore);
+    for (size_t i = 0; i < mRecords.size(); ++i)
+        EXPECT_EQ(slots[i], loaded.getSlot(mRecords[i].mId));
+    EXPECT_EQ(9.f, loaded["gamehour"].getFloat());
+}
+
+TEST_F(GlobalsTest, saved_records_for_unknown_globals_are_dropped)
+{
+    MWWorld::Globals globals;
+    globals.fill(mEsmStore);
+
+    std::vector<ESM::Global> records = mRecords;
+    records.push_back(ESM::Global());
+    records.back().mId = "RemovedByMod";
+    records.back().mValue = ESM::Variant(1.f);
+
+    MWWorld::ESMStore store;
+    loadStore(records, store);
+
+    MWWorld::Globals withExtra;
+    withExtra.fill(store);
+    EXPECT_NE(-1, withExtra.getSlot("removedbymod"));
+
+    saveAndLoad(withExtra, globals);
+    EXPECT_EQ(-1, globals.getSlot("removedbymod"));
+    EXPECT_EQ(5, globals.countSavedGameRecords());
+}
+
+TEST_F(GlobalsTest, dialogue_conditions_get_global_slots)
+{
+    std::vector<std::string> rules;
+    rules.push_back("02000PCRace");           // global
+    rules.push_back("03000NoSuchLocal");      // local, no slot
+    rules.push_back("02000NoSuchGlobal");     // unknown global
+    std::vector<ESM::DialInfo> infos;
+    infos.push_back(makeInfo("1", "", rules));
+
+    rules.clear();
+    rules.push_back("1000");                  // function, no name
+    rules.push_back("02000werewolfclawmult"); // global, case differs from the record
+    infos.push_back(makeInfo("2", "1", rules));
+
+    MWWorld::ESMStore store;
+    loadStore(mRecords, store, infos);
+
+    MWWorld::Globals globals;
+    globals.fill(store);
+    store.resolveGlobalSlots(globals);
+
+    const ESM::Dialogue* dialogue = store.get<ESM::Dialogue>().find("topic");
+    ASSERT_EQ(2u, dialogue->mInfo.size());
+
+    const ESM::DialInfo& first = dialogue->mInfo.front();
+    ASSERT_EQ(3u, first.mSelects.size());
+    EXPECT_EQ(globals.getSlot("pcrace"), first.mSelects[0].mGlobalSlot);
+    EXPECT_NE(-1, first.mSelects[0].mGlobalSlot);
+    EXPECT_EQ(-1, first.mSelects[1].mGlobalSlot);
+    EXPECT_EQ(-1, first.mSelects[2].mGlobalSlot);
+
+    const ESM::DialInfo& second = dialogue->mInfo.back();
+    ASSERT_EQ(2u, second.mSelects.size());
+    EXPECT_EQ(-1, second.mSelects[0].mGlobalSlot);
+    EXPECT_EQ(globals.getSlot("WerewolfClawMult"), second.mSelects[1].mGlobalSlot);
+    EXPECT_EQ(25.f, globals.getValue(second.mSelects[1].mGlobalSlot).getFloat());
+}
@@ -0,0 +1,250 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <sstream>
+
+#include <components/esm/cellref.hpp>
+#include <components/esm/defs.hpp>
+#include <components/esm/esmwriter.hpp>
+#include <components/esm/objectstate.hpp>
+
+#include "apps/openmw/mwworld/cachedrecord.hpp"
+#include "apps/openmw/mwworld/cellref.hpp"
+#include "apps/openmw/mwworld/customdata.hpp"
+#include "apps/openmw/mwworld/refdata.hpp"
+
+namespace
+{
+    ESM::CellRef makeRef()
+    {
+        ESM::CellRef ref;
+        ref.blank();
+        ref.mRefID = "chest";
+        ref.mLockLevel = 50;
+        ref.mPos.pos[0] = 128.f;
+        return ref;
+    }
+
+    class TestCustomData : public MWWorld::CustomData
+    {
+    public:
+        virtual MWWorld::CustomData *clone() const
+        {
+            return new TestCustomData(*this);
+        }
+    };
+
+    /// Stand-in for a cell with a single reference, whose record is cached the same way as the record of a
+    /// CellStore in Cells::writeCell
+    struct TestCell
+    {
+        MWWorld::CachedRecord mSavedRecord;
+        float mWaterLevel;
+        MWWorld::CellRef mRef;
+        MWWorld::RefData mData;
+
+        TestCell() : mWaterLevel(0.f), mRef(makeRef()), mData(makeRef()) {}
+
+        /// Same as CellStore::setWaterLevel
+        void setWaterLevel(float level)
+        {
+            mWaterLevel = level;
+            mSavedRecord.markChanged();
+        }
+
+        /// Same as CellStore::getGeneration
+        uint64_t getGeneration() const
+        {
+            return std::max(mSavedRecord.getGeneration(), std::max(mData.getGeneration(), mRef.getGeneration()));
+        }
+
+        void writeState(ESM::ESMWriter& writer) const
+        {
+            writer.startRecord(ESM::REC_CSTA);
+            writer.writeHNT("WLVL", mWaterLevel);
+
+            ESM::ObjectState state;
+            state.blank();
+            mRef.writeState(state);
+            mData.write(state);
+            state.save(writer);
+
+            writer.endRecord(ESM::REC_CSTA);
+        }
+    };
+
+    struct WriteTestCell
+    {
+        const TestCell& mCell;
+
+        WriteTestCell(const TestCell& cell) : mCell(cell) {}
+
+        void operator()(ESM::ESMWriter& writer) const
+        {
+            mCell.writeState(writer);
+        }
+    };
+
+    /// Save \a cell through \a record into a new saved game
+    std::string save(MWWorld::CachedRecord& record, const TestCell& cell, bool& serialised)
+    {
+        ESM::ESMWriter writer;
+        writer.setFormat(0);
+        writer.setRecordCount(1);
+
+        std::ostringstream stream;
+        writer.save(stream);
+        serialised = record.write(writer, cell.getGeneration(), WriteTestCell(cell));
+        writer.close();
+
+        // the header and the cell
+        EXPECT_EQ(2, writer.getRecordCount());
+        return stream.str();
+    }
+
+    /// Save \a cell without a cached record
+    std::string saveFully(const TestCell& cell)
+    {
+        MWWorld::CachedRecord record;
+        bool serialised = false;
+        std::string saved = save(record, cell, serialised);
+        EXPECT_TRUE(serialised);
+        return saved;
+    }
+
+    struct Change
+    {
+        const char *mName;
+        void (*mApply) (TestCell& cell);
+        bool mChangesRecord; ///< Does the change show up in the saved game?
+    };
+
+    void setPosition(TestCell& cell)
+    {
+        ESM::Position position = cell.mData.getPosition();
+        position.pos[2] += 64.f;
+        cell.mData.setPosition(position);
+    }
+
+    void setCount(TestCell& cell) { cell.mData.setCount(5); }
+    void disable(TestCell& cell) { cell.mData.disable(); }
+    void setDeletedByContentFile(TestCell& cell) { cell.mData.setDeletedByContentFile(true); }
+    void onActivate(TestCell& cell) { cell.mData.onActivate(); }
+    void getLocals(TestCell& cell) { cell.mData.getLocals(); }
+    void setCustomData(TestCell& cell) { cell.mData.setCustomData(new TestCustomData); }
+    void getCustomData(TestCell& cell) { cell.mData.getCustomData(); }
+
+    void getAnimationState(TestCell& cell)
+    {
+        ESM::AnimationState::ScriptedAnimation animation;
+        animation.mGroup = "idle2";
+        animation.mLoopCount = 3;
+        cell.mData.getAnimationState().mScriptedAnims.push_back(animation);
+    }
+
+    void setLockLevel(TestCell& cell) { cell.mRef.setLockLevel(100); }
+    void setWaterLevel(TestCell& cell) { cell.setWaterLevel(-256.f); }
+
+    const Change sChanges[] =
+    {
+        { "RefData::setPosition", setPosition, true },
+        { "RefData::setCount", setCount, true },
+        { "RefData::disable", disable, true },
+        { "RefData::setDeletedByContentFile", setDeletedByContentFile, false },
+        { "RefData::onActivate", onActivate, true },
+        { "RefData::getLocals", getLocals, false },
+        { "RefData::setCustomData", setCustomData, false },
+        { "RefData::getCustomData", getCustomData, false },
+        { "RefData::getAnimationState", getAnimationState, true },
+        { "CellRef::setLockLevel", setLockLevel, true },
+        { "cell water level", setWaterLevel, true }
+    };
+}
+
+TEST(RefDataTest, loaded_reference_has_no_generation)
+{
+    MWWorld::RefData data(makeRef());
+
+    EXPECT_EQ(0u, data.getGeneration());
+    EXPECT_FALSE(data.hasChanged());
+}
+
+TEST(RefDataTest, reading_does_not_change_the_generation)
+{
+    const MWWorld::RefData data(makeRef());
+
+    data.getPosition();
+    data.getCount();
+    data.isEnabled();
+    data.isDeleted();
+    data.getCustomData();
+    data.getAnimationState();
+    data.hasChanged();
+
+    EXPECT_EQ(0u, data.getGeneration());
+}
+
+TEST(RefDataTest, copy_keeps_the_generation)
+{
+    MWWorld::RefData data(makeRef());
+    data.disable();
+
+    MWWorld::RefData copy(data);
+    EXPECT_EQ(data.getGeneration(), copy.getGeneration());
+
+    MWWorld::RefData assigned(makeRef());
+    assigned = data;
+    EXPECT_EQ(data.getGeneration(), assigned.getGeneration());
+}
+
+TEST(RefDataTest, unchanged_cell_is_written_from_the_cached_record)
+{
+    TestCell cell;
+    bool serialised = false;
+
+    std::string first = save(cell.mSavedRecord, cell, serialised);
+    EXPECT_TRUE(serialised);
+
+    std::string second = save(cell.mSavedRecord, cell, serialised);
+    EXPECT_FALSE(serialised);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(saveFully(cell), second);
+}
+
+TEST(RefDataTest, every_change_advances_the_generation_and_is_written_again)
+{
+    for (unsigned int i=0; i<sizeof(sChanges)/sizeof(sChanges[0]); ++i)
+    {
+        const Change& change = sChanges[i];
+        SCOPED_TRACE(change.mName);
+
+        TestCell cell;
+        bool serialised = false;
+        std::string stale = save(cell.mSavedRecord, cell, serialised);
+        uint64_t generation = cell.getGeneration();
+
+        change.mApply(cell);
+        EXPECT_GT(cell.getGeneration(), generation);
+
+        std::string saved = save(cell.mSavedRecord, cell, serialised);
+        EXPECT_TRUE(serialised);
+        EXPECT_EQ(saveFully(cell), saved);
+
+        if (change.mChangesRecord)
+            EXPECT_NE(stale, saved);
+
+        // and cached again afterwards
+        EXPECT_EQ(saved, save(cell.mSavedRecord, cell, serialised));
+        EXPECT_FALSE(serialised);
+    }
+}
+
+TEST(RefDataTest, setters_without_effect_do_not_change_the_generation)
+{
+    MWWorld::RefData data(makeRef());
+
+    data.enable();
+    data.activate();
+
+    EXPECT_EQ(0u, data.getGeneration());
+}
@@ -0,0 +1,223 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <sstream>
+
+#include <osg/Geometry>
+#include <osg/Group>
+#include <osg/KdTree>
+
+#include <osgDB/ReaderWriter>
+#include <osgDB/Registry>
+
+#include <osgUtil/IntersectionVisitor>
+#include <osgUtil/LineSegmentIntersector>
+
+#include <components/resource/resourcesystem.hpp>
+#include <components/resource/scenemanager.hpp>
+
+#include <components/vfs/archive.hpp>
+#include <components/vfs/manager.hpp>
+
+namespace
+{
+    const char* const sMeshName = "meshes\\soup.testmesh";
+
+    /// Empty file, the content of the mesh is made up by TestMeshReader
+    class EmptyFile : public VFS::File
+    {
+    public:
+        virtual Files::IStreamPtr open()
+        {
+            return Files::IStreamPtr(new std::istringstream);
+        }
+    };
+
+    class MeshArchive : public VFS::Archive
+    {
+        EmptyFile mFile;
+
+    public:
+        virtual void listResources(std::map<std::string, VFS::File*>& out, char (*normalize_function) (char))
+        {
+            std::string name = sMeshName;
+            std::transform(name.begin(), name.end(), name.begin(), normalize_function);
+            out[name] = &mFile;
+        }
+    };
+
+    /// Reads every .testmesh file as a soup of random triangles
+    class TestMeshReader : public osgDB::ReaderWriter
+    {
+    public:
+        mutable int mNumReads;
+
+        TestMeshReader() : mNumReads(0)
+        {
+            supportsExtension("testmesh", "Random triangles for tests");
+        }
+
+        virtual const char* className() const { return "TestMeshReader"; }
+
+        using osgDB::ReaderWriter::readNode;
+
+        virtual ReadResult readNode(std::istream& stream, const osgDB::Options* options) const
+        {
+            ++mNumReads;
+
+            std::mt19937 random;
+            std::uniform_real_distribution<float> coordinate(-1.f, 1.f);
+
+            osg::ref_ptr<osg::Vec3Array> vertices (new osg::Vec3Array);
+            for (int i=0; i<3*500; ++i)
+                vertices->push_back(osg::Vec3f(coordinate(random), coordinate(random), coordinate(random)));
+
+            osg::ref_ptr<osg::Geometry> geometry (new osg::Geometry);
+            geometry->setVertexArray(vertices);
+            geometry->addPrimitiveSet(new osg::DrawArrays(GL_TRIANGLES, 0, vertices->size()));
+
+            osg::ref_ptr<osg::Group> group (new osg::Group);
+            group->addChild(geometry);
+            return group.get();
+        }
+    };
+
+    class CollectGeometryVisitor : public osg::NodeVisitor
+    {
+    public:
+        std::vector<osg::Geometry*> mGeometries;
+
+        CollectGeometryVisitor() : osg::NodeVisitor(TRAVERSE_ALL_CHILDREN) {}
+
+        virtual void apply(osg::Geometry& geometry)
+        {
+            mGeometries.push_back(&geometry);
+        }
+    };
+
+    std::vector<osg::Geometry*> collectGeometry(osg::Node* node)
+    {
+        CollectGeometryVisitor visitor;
+        node->accept(visitor);
+        return visitor.mGeometries;
+    }
+
+    /// The nearest intersection, the same way the editor picks
+    bool intersect(osg::Node* node, const osg::Vec3d& start, const osg::Vec3d& end,
+                   osgUtil::LineSegmentIntersector::Intersection& nearest)
+    {
+        osg::ref_ptr<osgUtil::LineSegmentIntersector> intersector (new osgUtil::LineSegmentIntersector(
+            osgUtil::Intersector::MODEL, start, end));
+        intersector->setIntersectionLimit(osgUtil::LineSegmentIntersector::NO_LIMIT);
+
+        osgUtil::IntersectionVisitor visitor(intersector);
+        node->accept(visitor);
+
+        if (!intersector->containsIntersections())
+            return false;
+
+        nearest = *intersector->getIntersections().begin();
+        return true;
+    }
+
+    struct SceneManagerTest : public ::testing::Test
+    {
+        VFS::Manager mVFS;
+        osg::ref_ptr<TestMeshReader> mReader;
+        std::unique_ptr<Resource::ResourceSystem> mResourceSystem;
+
+        SceneManagerTest()
+            : mVFS(false)
+            , mReader(new TestMeshReader)
+        {
+            mVFS.addArchive(new MeshArchive);
+            mVFS.buildIndex();
+
+            osgDB::Registry::instance()->addReaderWriter(mReader);
+
+            mResourceSystem.reset(new Resource::ResourceSystem(&mVFS));
+        }
+
+        ~SceneManagerTest()
+        {
+            mResourceSystem.reset();
+            osgDB::Registry::instance()->removeReaderWriter(mReader);
+        }
+
+        Resource::SceneManager& getSceneManager()
+        {
+            return *mResourceSystem->getSceneManager();
+        }
+    };
+}
+
+TEST_F(SceneManagerTest, kd_trees_are_not_built_by_default)
+{
+    osg::ref_ptr<osg::Node> instance = getSceneManager().getInstance(sMeshName);
+
+    std::vector<osg::Geometry*> geometries = collectGeometry(instance);
+    ASSERT_EQ(1u, geometries.size());
+    EXPECT_FALSE(geometries.front()->getShape());
+}
+
+TEST_F(SceneManagerTest, kd_trees_are_built_once_per_mesh)
+{
+    getSceneManager().setBuildKdTrees(true);
+
+    osg::ref_ptr<osg::Node> instance = getSceneManager().getInstance(sMeshName);
+    osg::ref_ptr<osg::Node> other = getSceneManager().getInstance(sMeshName);
+    EXPECT_EQ(1, mReader->mNumReads);
+
+    std::vector<osg::Geometry*> geometries = collectGeometry(instance);
+    std::vector<osg::Geometry*> otherGeometries = collectGeometry(other);
+    ASSERT_EQ(1u, geometries.size());
+    ASSERT_EQ(1u, otherGeometries.size());
+
+    ASSERT_NE(instance.get(), other.get());
+    EXPECT_TRUE(dynamic_cast<osg::KdTree*>(geometries.front()->getShape()));
+    EXPECT_EQ(geometries.front()->getShape(), otherGeometries.front()->getShape());
+}
+
+TEST_F(SceneManagerTest, picking_with_kd_trees_finds_the_same_nearest_hit)
+{
+    getSceneManager().setBuildKdTrees(true);
+
+    osg::ref_ptr<osg::Node> instance = getSceneManager().getInstance(sMeshName);
+    std::vector<osg::Geometry*> geometries = collectGeometry(instance);
+    ASSERT_EQ(1u, geometries.size());
+    ASSERT_TRUE(dynamic_cast<osg::KdTree*>(geometries.front()->getShape()));
+
+    // the same triangles, tested one by one
+    osg::ref_ptr<osg::Geometry> bruteForce (new osg::Geometry(*geometries.front(), osg::CopyOp::SHALLOW_COPY));
+    bruteForce->setShape(NULL);
+    osg::ref_ptr<osg::Group> bruteForceRoot (new osg::Group);
+    bruteForceRoot->addChild(bruteForce);
+
+    std::mt19937 random;
+    std::uniform_real_distribution<double> coordinate(-1.0, 1.0);
+
+    int numHits = 0;
+    for (int i=0; i<500; ++i)
+    {
+        osg::Vec3d start (coordinate(random), coordinate(random), coordinate(random));
+        start.normalize();
+        start *= 3.0;
+        osg::Vec3d end = -start + osg::Vec3d(coordinate(random), coordinate(random), coordinate(random));
+
+        osgUtil::LineSegmentIntersector::Intersection expected;
+        osgUtil::LineSegmentIntersector::Intersection hit;
+        bool expectHit = intersect(bruteForceRoot, start, end, expected);
+        ASSERT_EQ(expectHit, intersect(instance, start, end, hit)) << "ray " << i;
+
+        if (!expectHit)
+            continue;
+
+        ++numHits;
+        EXPECT_EQ(expected.primitiveIndex, hit.primitiveIndex) << "ray " << i;
+        EXPECT_NEAR(expected.ratio, hit.ratio, 1e-5) << "ray " << i;
+    }
+
+    EXPECT_GT(numHits, 100);
+}
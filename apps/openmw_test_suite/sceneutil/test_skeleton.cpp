@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include <osg/MatrixTransform>
+#include <osg/PositionAttitudeTransform>
+
+#include <components/sceneutil/skeleton.hpp>
+
+namespace
+{
+    osg::MatrixTransform* addBone(osg::Group* parent, const std::string& name, const osg::Vec3f& offset)
+    {
+        osg::MatrixTransform* bone = new osg::MatrixTransform(osg::Matrixf::translate(offset));
+        bone->setName(name);
+        parent->addChild(bone);
+        return bone;
+    }
+
+    /// Skinned NIF layout: bones nested below the skeleton, with non-bone groups and transforms in between
+    struct SkeletonTest : public ::testing::Test
+    {
+        osg::ref_ptr<SceneUtil::Skeleton> mSkeleton;
+        osg::MatrixTransform* mRoot;
+        osg::MatrixTransform* mPelvis;
+        osg::MatrixTransform* mSpine;
+        osg::MatrixTransform* mWeapon;
+
+        SkeletonTest()
+            : mSkeleton(new SceneUtil::Skeleton)
+        {
+            mRoot = addBone(mSkeleton, "Bip01", osg::Vec3f(0, 0, 10));
+            mPelvis = addBone(mRoot, "Bip01 Pelvis", osg::Vec3f(0, 1, 0));
+
+            osg::Group* group = new osg::Group;
+            mPelvis->addChild(group);
+            mSpine = addBone(group, "Bip01 Spine", osg::Vec3f(2, 0, 0));
+
+            osg::PositionAttitudeTransform* trans = new osg::PositionAttitudeTransform;
+            mSpine->addChild(trans);
+            mWeapon = addBone(trans, "Weapon Bone", osg::Vec3f(0, 0, 5));
+        }
+    };
+}
+
+TEST_F(SkeletonTest, bones_are_found_by_case_insensitive_name)
+{
+    SceneUtil::Bone* spine = mSkeleton->getBone("bip01 SPINE");
+    ASSERT_TRUE(spine != NULL);
+    EXPECT_EQ(mSpine, spine->mNode);
+    EXPECT_EQ(spine, mSkeleton->getBone("Bip01 Spine"));
+    EXPECT_EQ(spine, mSkeleton->getBone(mSkeleton->getBoneIndex("BIP01 SPINE")));
+
+    EXPECT_EQ(-1, mSkeleton->getBoneIndex("Bip01 Head"));
+    EXPECT_TRUE(mSkeleton->getBone("Bip01 Head") == NULL);
+
+    // bones below other transforms are not part of the skeleton
+    EXPECT_TRUE(mSkeleton->getBone("Weapon Bone") == NULL);
+}
+
+TEST_F(SkeletonTest, bone_matrices_are_in_skeleton_space)
+{
+    SceneUtil::Bone* spine = mSkeleton->getBone("Bip01 Spine");
+    SceneUtil::Bone* root = mSkeleton->getBone("Bip01");
+    ASSERT_TRUE(spine != NULL);
+    ASSERT_TRUE(root != NULL);
+
+    mSkeleton->updateBoneMatrices(1);
+
+    EXPECT_EQ(osg::Vec3f(2, 1, 10), spine->mMatrixInSkeletonSpace.getTrans());
+    EXPECT_EQ(osg::Vec3f(0, 0, 10), root->mMatrixInSkeletonSpace.getTrans());
+
+    mPelvis->setMatrix(osg::Matrixf::translate(osg::Vec3f(0, -1, 0)));
+    mSkeleton->updateBoneMatrices(2);
+
+    EXPECT_EQ(osg::Vec3f(2, -1, 10), spine->mMatrixInSkeletonSpace.getTrans());
+}
+
+TEST_F(SkeletonTest, bones_are_kept_when_the_skeleton_changes)
+{
+    SceneUtil::Bone* spine = mSkeleton->getBone("Bip01 Spine");
+
+    // e.g. a new body part is attached
+    osg::MatrixTransform* head = addBone(mSkeleton, "Bip01 Head", osg::Vec3f(0, 0, 20));
+
+    SceneUtil::Bone* newHead = mSkeleton->getBone("Bip01 Head");
+    ASSERT_TRUE(newHead != NULL);
+    EXPECT_EQ(head, newHead->mNode);
+    EXPECT_EQ(spine, mSkeleton->getBone("Bip01 Spine"));
+}
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include <components/settings/settings.hpp>
+#include <components/fallback/fallback.hpp>
+
+namespace
+{
+    struct RecordingListener : public Settings::Listener
+    {
+        std::vector<Settings::CategorySetting> mChanges;
+
+        virtual void settingChanged(const std::string& setting, const std::string& category)
+        {
+            mChanges.push_back(std::make_pair(category, setting));
+        }
+    };
+}
+
+struct SettingsHandleTest : public ::testing::Test
+{
+protected:
+
+    virtual void SetUp()
+    {
+        Settings::Manager manager;
+        manager.clear();
+        Settings::Manager::mDefaultSettings[std::make_pair("Game", "difficulty")] = "0";
+        Settings::Manager::mDefaultSettings[std::make_pair("Game", "best attack")] = "false";
+        Settings::Manager::mDefaultSettings[std::make_pair("Camera", "field of view")] = "55";
+        Settings::Manager::mDefaultSettings[std::make_pair("Shaders", "normal map pattern")] = "_n";
+    }
+
+    virtual void TearDown()
+    {
+        Settings::Manager manager;
+        manager.clear();
+    }
+};
+
+TEST_F(SettingsHandleTest, parses_typed_values)
+{
+    const Settings::Handle<int> difficulty("difficulty", "Game");
+    const Settings::Handle<bool> bestAttack("best attack", "Game");
+    const Settings::Handle<float> fieldOfView("field of view", "Camera");
+    const Settings::Handle<std::string> pattern("normal map pattern", "Shaders");
+
+    EXPECT_EQ(0, difficulty.get());
+    EXPECT_FALSE(bestAttack.get());
+    EXPECT_EQ(55.f, fieldOfView.get());
+    EXPECT_EQ("_n", pattern.get());
+    EXPECT_FALSE(difficulty.isDirty());
+}
+
+TEST_F(SettingsHandleTest, user_settings_take_precedence)
+{
+    Settings::Manager::mUserSettings[std::make_pair("Camera", "field of view")] = "75";
+
+    const Settings::Handle<float> fieldOfView("field of view", "Camera");
+    EXPECT_EQ(Settings::Manager::getFloat("field of view", "Camera"), fieldOfView.get());
+    EXPECT_EQ(75.f, fieldOfView.get());
+}
+
+TEST_F(SettingsHandleTest, set_invalidates_only_matching_handles)
+{
+    const Settings::Handle<int> difficulty("difficulty", "Game");
+    const Settings::Handle<bool> bestAttack("best attack", "Game");
+    ASSERT_EQ(0, difficulty.get());
+    ASSERT_FALSE(bestAttack.get());
+
+    Settings::Manager::setInt("difficulty", "Game", 50);
+    EXPECT_TRUE(difficulty.isDirty());
+    EXPECT_FALSE(bestAttack.isDirty());
+    EXPECT_EQ(50, difficulty.get());
+
+    // setting the same value again is not a change
+    Settings::Manager::setInt("difficulty", "Game", 50);
+    EXPECT_FALSE(difficulty.isDirty());
+
+    // copies are registered on their own
+    Settings::Handle<int> copy(difficulty);
+    Settings::Manager::setInt("difficulty", "Game", -20);
+    EXPECT_EQ(-20, difficulty.get());
+    EXPECT_EQ(-20, copy.get());
+}
+
+TEST_F(SettingsHandleTest, loading_invalidates_all_handles)
+{
+    const Settings::Handle<bool> bestAttack("best attack", "Game");
+    ASSERT_FALSE(bestAttack.get());
+
+    Settings::Manager manager;
+    manager.clear();
+    EXPECT_TRUE(bestAttack.isDirty());
+    EXPECT_THROW(bestAttack.get(), std::runtime_error);
+}
+
+TEST_F(SettingsHandleTest, listeners_are_notified_per_category)
+{
+    RecordingListener gameListener;
+    RecordingListener allListener;
+    Settings::Manager::addListener(&gameListener, "Game");
+    Settings::Manager::addListener(&allListener, "");
+
+    Settings::Manager::setBool("best attack", "Game", true);
+    Settings::Manager::setFloat("field of view", "Camera", 60.f);
+
+    Settings::Manager::removeListener(&gameListener);
+    Settings::Manager::removeListener(&allListener);
+    Settings::Manager::setInt("difficulty", "Game", 10);
+
+    ASSERT_EQ(1u, gameListener.mChanges.size());
+    EXPECT_EQ(std::make_pair(std::string("Game"), std::string("best attack")), gameListener.mChanges[0]);
+    ASSERT_EQ(2u, allListener.mChanges.size());
+    EXPECT_EQ(std::make_pair(std::string("Camera"), std::string("field of view")), allListener.mChanges[1]);
+}
+
+TEST(FallbackHandleTest, parses_once_with_map_defaults)
+{
+    std::map<std::string, std::string> values;
+    values["Water_RippleFrameCount"] = "4";
+    values["Water_RippleLifetime"] = "3.5";
+    values["LightAttenuation_UseLinear"] = "1";
+    values["Water_RippleTexture"] = "vfx_ripple";
+    const Fallback::Map map(values);
+
+    EXPECT_EQ(4, Fallback::Handle<int>(map, "Water_RippleFrameCount").get());
+    EXPECT_EQ(3.5f, Fallback::Handle<float>(map, "Water_RippleLifetime").get());
+    EXPECT_TRUE(Fallback::Handle<bool>(map, "LightAttenuation_UseLinear").get());
+    EXPECT_EQ("vfx_ripple", Fallback::Handle<std::string>(map, "Water_RippleTexture").get());
+
+    // missing values fall back the same way as the Map getters do
+    EXPECT_EQ(0.f, Fallback::Handle<float>(map, "Water_Missing").get());
+}
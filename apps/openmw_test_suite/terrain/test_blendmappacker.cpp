@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <stdexcept>
+
+#include <components/terrain/blendmappacker.hpp>
+
+namespace
+{
+    const int sBlendmapSize = 65;
+
+    osg::ref_ptr<osg::Image> createBlendmap(int size)
+    {
+        osg::ref_ptr<osg::Image> image (new osg::Image);
+        image->allocateImage(size, size, 1, GL_ALPHA, GL_UNSIGNED_BYTE);
+        return image;
+    }
+
+    /// Blendmaps as created by ESMTerrain::Storage::getBlendmaps: every texel belongs to one layer, and has a
+    /// value of 255 in the blendmap of that layer (none for the base layer) and 0 in all others
+    std::vector<osg::ref_ptr<osg::Image> > createBlendmaps(unsigned int numLayers, std::mt19937& random)
+    {
+        std::vector<osg::ref_ptr<osg::Image> > blendmaps;
+        for (unsigned int i=1; i<numLayers; ++i)
+            blendmaps.push_back(createBlendmap(sBlendmapSize));
+
+        for (int texel=0; texel<sBlendmapSize*sBlendmapSize; ++texel)
+        {
+            unsigned int layer = random() % numLayers;
+            for (unsigned int i=0; i<blendmaps.size(); ++i)
+                blendmaps[i]->data()[texel] = (i+1 == layer) ? 255 : 0;
+        }
+        return blendmaps;
+    }
+
+    /// Packed blend value of layer i+1, as read by the single pass shader
+    unsigned char getPackedValue(const std::vector<osg::ref_ptr<osg::Image> >& packed, unsigned int i, int texel)
+    {
+        return packed[i / 4]->data()[texel*4 + i % 4];
+    }
+
+    /// The colour the multipass path produces: the base layer, then each layer alpha-blended on top
+    float blendMultipass(const std::vector<osg::ref_ptr<osg::Image> >& blendmaps, const std::vector<float>& layerColours,
+                         int texel)
+    {
+        float colour = layerColours[0];
+        for (unsigned int i=0; i<blendmaps.size(); ++i)
+        {
+            float alpha = blendmaps[i]->data()[texel] / 255.f;
+            colour = colour * (1.f - alpha) + layerColours[i+1] * alpha;
+        }
+        return colour;
+    }
+
+    /// The colour the single pass shader produces (mix() of each layer in turn) from the packed blendmaps
+    float blendSinglePass(const std::vector<osg::ref_ptr<osg::Image> >& packed, const std::vector<float>& layerColours,
+                          int texel)
+    {
+        float colour = layerColours[0];
+        for (unsigned int i=0; i+1<layerColours.size(); ++i)
+        {
+            float weight = getPackedValue(packed, i, texel) / 255.f;
+            colour = colour + (layerColours[i+1] - colour) * weight;
+        }
+        return colour;
+    }
+}
+
+TEST(TerrainBlendmapPackerTest, packs_layers_into_channels_in_splatting_order)
+{
+    std::mt19937 random;
+    std::vector<osg::ref_ptr<osg::Image> > blendmaps = createBlendmaps(7, random);
+
+    std::vector<osg::ref_ptr<osg::Image> > packed;
+    Terrain::packBlendmaps(blendmaps, packed);
+
+    ASSERT_EQ(2u, packed.size());
+
+    for (unsigned int i=0; i<packed.size(); ++i)
+    {
+        EXPECT_EQ(GLenum(GL_RGBA), packed[i]->getPixelFormat());
+        EXPECT_EQ(sBlendmapSize, packed[i]->s());
+        EXPECT_EQ(sBlendmapSize, packed[i]->t());
+    }
+
+    for (int texel=0; texel<sBlendmapSize*sBlendmapSize; ++texel)
+    {
+        // layer 1 in red, layer 2 in green ... layer 5 in red of the second blendmap
+        for (unsigned int i=0; i<blendmaps.size(); ++i)
+            ASSERT_EQ(blendmaps[i]->data()[texel], packed[i / 4]->data()[texel*4 + i % 4]) << "layer " << i+1;
+
+        // channels without a layer don't contribute
+        EXPECT_EQ(0, packed[1]->data()[texel*4 + 2]);
+        EXPECT_EQ(0, packed[1]->data()[texel*4 + 3]);
+    }
+}
+
+TEST(TerrainBlendmapPackerTest, single_pass_blending_matches_multipass_blending)
+{
+    std::mt19937 random;
+    for (unsigned int numLayers=1; numLayers<=Terrain::sLayersPerPackedBlendmap+1; ++numLayers)
+    {
+        std::vector<osg::ref_ptr<osg::Image> > blendmaps = createBlendmaps(numLayers, random);
+
+        // blended weights between 0 and 255, like bilinear filtering produces between texels
+        for (unsigned int i=0; i<blendmaps.size(); ++i)
+            for (int texel=0; texel<sBlendmapSize; ++texel)
+                blendmaps[i]->data()[texel] = random() % 256;
+
+        std::vector<float> layerColours;
+        for (unsigned int i=0; i<numLayers; ++i)
+            layerColours.push_back((random() % 1000) / 1000.f);
+
+        std::vector<osg::ref_ptr<osg::Image> > packed;
+        Terrain::packBlendmaps(blendmaps, packed);
+        EXPECT_EQ(numLayers > 1 ? 1u : 0u, packed.size());
+
+        for (int texel=0; texel<sBlendmapSize*sBlendmapSize; ++texel)
+        {
+            ASSERT_NEAR(blendMultipass(blendmaps, layerColours, texel), blendSinglePass(packed, layerColours, texel), 1e-5f)
+                << numLayers << " layers, texel " << texel;
+        }
+    }
+}
+
+TEST(TerrainBlendmapPackerTest, rejects_blendmaps_of_different_sizes_or_formats)
+{
+    std::vector<osg::ref_ptr<osg::Image> > blendmaps;
+    blendmaps.push_back(createBlendmap(sBlendmapSize));
+    blendmaps.push_back(createBlendmap(sBlendmapSize*2-1));
+
+    std::vector<osg::ref_ptr<osg::Image> > packed;
+    EXPECT_THROW(Terrain::packBlendmaps(blendmaps, packed), std::runtime_error);
+
+    osg::ref_ptr<osg::Image> rgba (new osg::Image);
+    rgba->allocateImage(sBlendmapSize, sBlendmapSize, 1, GL_RGBA, GL_UNSIGNED_BYTE);
+    blendmaps.back() = rgba;
+    EXPECT_THROW(Terrain::packBlendmaps(blendmaps, packed), std::runtime_error);
+}
@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <components/terrain/quadtreenode.hpp>
+#include <components/terrain/viewdata.hpp>
+
+namespace
+{
+    const float sCellWorldSize = 8192.f;
+    const float sMinSize = 1/4.f;
+
+    int Log2(unsigned int n)
+    {
+        int targetlevel = 0;
+        while (n >>= 1) ++targetlevel;
+        return targetlevel;
+    }
+
+    /// Same LOD metric as the default LOD callback of QuadTreeWorld, on the horizontal distance to the node
+    bool isSufficientDetail(Terrain::QuadTreeNode* node, const osg::Vec3f& eyePoint)
+    {
+        const osg::BoundingBox& box = node->getBoundingBox();
+        float dx = std::max(0.f, std::max(box.xMin() - eyePoint.x(), eyePoint.x() - box.xMax()));
+        float dy = std::max(0.f, std::max(box.yMin() - eyePoint.y(), eyePoint.y() - box.yMax()));
+        float dist = std::sqrt(dx*dx + dy*dy);
+
+        int nativeLodLevel = Log2(static_cast<unsigned int>(node->getSize()/sMinSize));
+        int lodLevel = Log2(static_cast<unsigned int>(dist/(8192*sMinSize)));
+        return nativeLodLevel <= lodLevel;
+    }
+
+    void addChildren(Terrain::QuadTreeNode* parent)
+    {
+        float size = parent->getSize()/2.f;
+        const osg::Vec2f offsets[4] = { osg::Vec2f(-size/2.f, size/2.f), osg::Vec2f(size/2.f, size/2.f),
+                                        osg::Vec2f(-size/2.f, -size/2.f), osg::Vec2f(size/2.f, -size/2.f) };
+
+        osg::BoundingBox boundingBox;
+        for (unsigned int i=0; i<4; ++i)
+        {
+            osg::Vec2f center = parent->getCenter() + offsets[i];
+            osg::ref_ptr<Terrain::QuadTreeNode> node = new Terrain::QuadTreeNode(parent,
+                static_cast<Terrain::ChildDirection>(i), size, center);
+            parent->addChild(node);
+
+            if (size <= sMinSize)
+            {
+                float half = size/2.f;
+                node->setBoundingBox(osg::BoundingBox(
+                    osg::Vec3f((center.x()-half)*sCellWorldSize, (center.y()-half)*sCellWorldSize, 0),
+                    osg::Vec3f((center.x()+half)*sCellWorldSize, (center.y()+half)*sCellWorldSize, 0)));
+            }
+            else
+                addChildren(node);
+
+            boundingBox.expandBy(node->getBoundingBox());
+        }
+        parent->setBoundingBox(boundingBox);
+    }
+
+    void traverse(Terrain::QuadTreeNode* node, Terrain::ViewData& vd, const osg::Vec3f& eyePoint)
+    {
+        if (!node->hasValidBounds())
+            return;
+
+        if (isSufficientDetail(node, eyePoint) || !node->getNumChildren())
+            vd.add(node, true);
+        else
+        {
+            for (unsigned int i=0; i<node->getNumChildren(); ++i)
+                traverse(node->getChild(i), vd, eyePoint);
+        }
+    }
+
+    /// The previous stitching code: a linear search through the entries for every step up from every neighbour
+    bool containsLinear(Terrain::ViewData& vd, Terrain::QuadTreeNode* node)
+    {
+        for (unsigned int i=0; i<vd.getNumEntries(); ++i)
+            if (vd.getEntry(i).mNode == node)
+                return true;
+        return false;
+    }
+
+    unsigned int getLodFlagsLinear(Terrain::QuadTreeNode* node, Terrain::ViewData& vd)
+    {
+        int ourLod = Log2(int(node->getSize()));
+        unsigned int lodFlags = 0;
+        for (unsigned int i=0; i<4; ++i)
+        {
+            Terrain::QuadTreeNode* neighbour = node->getNeighbour(static_cast<Terrain::Direction>(i));
+            while (neighbour && !containsLinear(vd, neighbour))
+                neighbour = neighbour->getParent();
+            int lod = neighbour ? Log2(int(neighbour->getSize())) : 0;
+            if (lod > ourLod)
+                lodFlags |= static_cast<unsigned int>(lod - ourLod) << (4*i);
+        }
+        return lodFlags;
+    }
+
+    struct ViewDataTest : public ::testing::Test
+    {
+        osg::ref_ptr<Terrain::QuadTreeNode> mRoot;
+
+        ViewDataTest()
+        {
+            mRoot = new Terrain::QuadTreeNode(NULL, Terrain::Root, 32.f, osg::Vec2f(0.f, 0.f));
+            addChildren(mRoot);
+            mRoot->initNeighbours();
+        }
+    };
+}
+
+TEST_F(ViewDataTest, index_tracks_nodes_added_since_reset)
+{
+    Terrain::ViewData vd;
+    Terrain::QuadTreeNode* first = mRoot->getChild(Terrain::NW);
+    Terrain::QuadTreeNode* second = mRoot->getChild(Terrain::SE);
+
+    vd.add(first, true);
+    EXPECT_TRUE(vd.contains(first));
+    EXPECT_FALSE(vd.contains(second));
+    ASSERT_TRUE(vd.findEntry(first) != NULL);
+    EXPECT_EQ(&vd.getEntry(0), vd.findEntry(first));
+    EXPECT_TRUE(vd.findEntry(second) == NULL);
+
+    vd.reset(1);
+    EXPECT_FALSE(vd.contains(first));
+
+    vd.add(second, true);
+    std::vector<Terrain::QuadTreeNode*> changed;
+    vd.getChangedNodes(changed);
+    ASSERT_EQ(2u, changed.size());
+    EXPECT_EQ(second, changed[0]);
+    EXPECT_EQ(first, changed[1]);
+
+    vd.reset(2);
+    vd.add(second, true);
+    changed.clear();
+    vd.getChangedNodes(changed);
+    EXPECT_TRUE(changed.empty());
+}
+
+TEST_F(ViewDataTest, incremental_lod_flags_match_full_recomputation_along_camera_path)
+{
+    Terrain::ViewData vd;
+
+    for (int frame = 0; frame < 200; ++frame)
+    {
+        // a walk across the terrain, with a few teleports
+        float t = frame * 0.05f;
+        osg::Vec3f eyePoint (std::sin(t) * 12.f * sCellWorldSize, (frame % 70 - 35) * 0.4f * sCellWorldSize, 0.f);
+
+        traverse(mRoot, vd, eyePoint);
+        vd.updateLodFlags();
+
+        ASSERT_GT(vd.getNumEntries(), 0u);
+
+        for (unsigned int i=0; i<vd.getNumEntries(); ++i)
+        {
+            Terrain::ViewData::Entry& entry = vd.getEntry(i);
+            EXPECT_FALSE(entry.mLodFlagsDirty);
+
+            unsigned int expected = getLodFlagsLinear(entry.mNode, vd);
+            ASSERT_EQ(expected, entry.mLodFlags) << "frame " << frame << ", entry " << i;
+        }
+
+        vd.reset(frame);
+    }
+}
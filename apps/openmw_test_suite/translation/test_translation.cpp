@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <sstream>
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include <components/translation/translation.hpp>
+
+namespace
+{
+    struct TranslationTest : public ::testing::Test
+    {
+        boost::filesystem::path mDataDir;
+        ToUTF8::Utf8Encoder mEncoder;
+        Translation::Storage mStorage;
+
+        TranslationTest()
+            : mDataDir(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("openmw-translation-%%%%-%%%%"))
+            , mEncoder(ToUTF8::WINDOWS_1252)
+        {
+            boost::filesystem::create_directories(mDataDir);
+            mStorage.setEncoder(&mEncoder);
+        }
+
+        ~TranslationTest()
+        {
+            boost::system::error_code error;
+            boost::filesystem::remove_all(mDataDir, error);
+        }
+
+        void writeFile(const std::string& name, const std::string& content)
+        {
+            boost::filesystem::ofstream file(mDataDir / name, std::ios::binary);
+            file << content;
+        }
+
+        void load(const std::string& esmFileName)
+        {
+            Files::PathContainer dataDirs(1, mDataDir);
+            Files::Collections collections(dataDirs, true);
+            mStorage.loadTranslationData(collections, esmFileName);
+        }
+    };
+}
+
+TEST_F(TranslationTest, sample_files_are_loaded)
+{
+    writeFile("Morrowind.cel", "Balmora\tBalmora (translated)\r\nSeyda Neen\tSejda Nin\r\n");
+    writeFile("Morrowind.top", "lowest dwemer\tdwemer\nabout the dwemer\tdwemer\n");
+    writeFile("Morrowind.mrk", "dwemer\tDwemer\n");
+
+    EXPECT_FALSE(mStorage.hasTranslation());
+    load("Morrowind.esm");
+    EXPECT_TRUE(mStorage.hasTranslation());
+
+    EXPECT_EQ("Sejda Nin", mStorage.translateCellName("Seyda Neen"));
+    EXPECT_EQ("Balmora (translated)", mStorage.translateCellName("balmora"));
+    EXPECT_EQ("Vivec", mStorage.translateCellName("Vivec"));
+
+    EXPECT_EQ("dwemer", mStorage.topicStandardForm("About the Dwemer"));
+    EXPECT_EQ("Dwemer", mStorage.topicID("lowest dwemer"));
+    EXPECT_EQ("Dwemer", mStorage.topicID("dwemer"));
+    EXPECT_EQ("unknown topic", mStorage.topicID("unknown topic"));
+}
+
+TEST_F(TranslationTest, invalid_lines_are_skipped_and_first_entries_kept)
+{
+    writeFile("morrowind.cel",
+              "\n"
+              "no tab\n"
+              "\tno key\n"
+              "no value\t\n"
+              "Ald-ruhn\tAld'ruhn\n"
+              "ALD-RUHN\tduplicate\n"
+              "Caldera\tvalue\twith tab\n"
+              "Last line\twithout newline");
+    writeFile("tribunal.cel", "Ald-ruhn\tfrom a later file\nMournhold\tMournhold (translated)\n");
+
+    load("Morrowind.esm");
+    load("Tribunal.esm");
+
+    EXPECT_EQ("Ald'ruhn", mStorage.translateCellName("Ald-ruhn"));
+    EXPECT_EQ("value\twith tab", mStorage.translateCellName("Caldera"));
+    EXPECT_EQ("without newline", mStorage.translateCellName("last line"));
+    EXPECT_EQ("Mournhold (translated)", mStorage.translateCellName("Mournhold"));
+    EXPECT_EQ("no tab", mStorage.translateCellName("no tab"));
+    EXPECT_EQ("no value", mStorage.translateCellName("no value"));
+}
+
+TEST_F(TranslationTest, text_is_converted_to_utf8)
+{
+    writeFile("morrowind.top", "\xe9l\xe9phant\tanimal\n");
+    writeFile("morrowind.mrk", "animal\tB\xeate\n");
+
+    load("Morrowind.esm");
+
+    EXPECT_EQ("B\xc3\xaate", mStorage.topicID("\xc3\xa9l\xc3\xa9phant"));
+}
+
+TEST_F(TranslationTest, many_phrases_match_map_lookups)
+{
+    const int count = 20000;
+
+    std::ostringstream topics;
+    std::map<std::string, std::string> map;
+    for (int i = 0; i < count; ++i)
+    {
+        std::ostringstream phrase;
+        phrase << "phrase number " << i * 7919 % count;
+        std::ostringstream topic;
+        topic << "topic " << i % 500;
+        topics << phrase.str() << '\t' << topic.str() << '\n';
+        map.insert(std::make_pair(phrase.str(), topic.str()));
+    }
+    writeFile("morrowind.top", topics.str());
+
+    load("Morrowind.esm");
+
+    for (std::map<std::string, std::string>::const_iterator it = map.begin(); it != map.end(); ++it)
+        ASSERT_EQ(it->second, mStorage.topicStandardForm(it->first)) << it->first;
+
+    EXPECT_EQ("phrase number 20000", mStorage.topicStandardForm("phrase number 20000"));
+}
@@ -11,6 +11,8 @@ namespace ESM
     ESMWriter::ESMWriter()
         : mRecords()
         , mStream(NULL)
+        , mFileStream(NULL)
+        , mFileRecordCount(0)
         , mHeaderPos()
         , mEncoder(NULL)
         , mRecordCount(0)
@@ -72,6 +74,7 @@ namespace ESM
         mRecords.clear();
         mCounting = true;
         mStream = &file;
+        mFileStream = NULL;
 
         startRecord("TES3", 0);
 
@@ -86,6 +89,39 @@ namespace ESM
             throw std::runtime_error ("Unclosed record remaining");
     }
 
+    void ESMWriter::startCapture(std::ostream& stream)
+    {
+        if (!mRecords.empty())
+            throw std::runtime_error ("Can't start capturing records inside a record");
+        if (mFileStream)
+            throw std::runtime_error ("Already capturing records");
+
+        mFileStream = mStream;
+        mFileRecordCount = mRecordCount;
+        mStream = &stream;
+    }
+
+    void ESMWriter::endCapture()
+    {
+        if (!mFileStream)
+            throw std::runtime_error ("Not capturing records");
+        if (!mRecords.empty())
+            throw std::runtime_error ("Unclosed record remaining");
+
+        mStream = mFileStream;
+        mRecordCount = mFileRecordCount;
+        mFileStream = NULL;
+    }
+
+    void ESMWriter::writeRecords(const std::string& data, int count)
+    {
+        if (!mRecords.empty())
+            throw std::runtime_error ("Can't write records inside a record");
+
+        mStream->write(data.data(), data.size());
+        mRecordCount += count;
+    }
+
     void ESMWriter::startRecord(const std::string& name, uint32_t flags)
     {
         mRecordCount++;
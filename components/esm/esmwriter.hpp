@@ -55,6 +55,17 @@ class ESMWriter
         void close();
         ///< \note Does not close the stream.
 
+        void startCapture(std::ostream& stream);
+        ///< Write the following records to \a stream instead of the file, so that they can be
+        /// cached and passed to writeRecords later.
+        /// \note Must not be called while a record is open. Captured records are not counted.
+
+        void endCapture();
+        ///< Continue writing to the file.
+
+        void writeRecords(const std::string& data, int count);
+        ///< Write \a count complete records that were captured before.
+
         void writeHNString(const std::string& name, const std::string& data);
         void writeHNString(const std::string& name, const std::string& data, size_t size);
         void writeHNCString(const std::string& name, const std::string& data)
@@ -129,6 +140,8 @@ public:
     private:
         std::list<RecordData> mRecords;
         std::ostream* mStream;
+        std::ostream* mFileStream;
+        int mFileRecordCount;
         std::streampos mHeaderPos;
         ToUTF8::Utf8Encoder* mEncoder;
         int mRecordCount;
@@ -51,6 +51,12 @@ struct DialInfo
     {
         std::string mSelectRule; // This has a complicated format
         Variant mValue;
+
+        // Slot of the global variable read by this rule, -1 if there is none. Resolved by the game
+        // after loading, not saved.
+        int mGlobalSlot;
+
+        SelectStruct() : mGlobalSlot(-1) {}
     };
 
     // Journal quest indices (introduced with the quest system in Tribunal)
@@ -8,6 +8,21 @@ unsigned int ESM::SavedGame::sRecordId = ESM::REC_SAVE;
 int ESM::SavedGame::sCurrentFormat = 3;
 
 void ESM::SavedGame::load (ESMReader &esm)
+{
+    loadHeader (esm);
+
+    mScreenshot.clear();
+
+    if (esm.isNextSub ("SCRN"))
+    {
+        esm.getSubHeader();
+        mScreenshot.resize(esm.getSubSize());
+        if (!mScreenshot.empty())
+            esm.getExact(&mScreenshot[0], mScreenshot.size());
+    }
+}
+
+void ESM::SavedGame::loadHeader (ESMReader &esm)
 {
     mPlayerName = esm.getHNString("PLNA");
     esm.getHNOT (mPlayerLevel, "PLLE");
@@ -20,13 +35,9 @@ void ESM::SavedGame::load (ESMReader &esm)
     esm.getHNT (mTimePlayed, "TIME");
     mDescription = esm.getHNString ("DESC");
 
+    mContentFiles.clear();
     while (esm.isNextSub ("DEPE"))
         mContentFiles.push_back (esm.getHString());
-
-    esm.getSubNameIs("SCRN");
-    esm.getSubHeader();
-    mScreenshot.resize(esm.getSubSize());
-    esm.getExact(&mScreenshot[0], mScreenshot.size());
 }
 
 void ESM::SavedGame::save (ESMWriter &esm) const
@@ -49,6 +60,7 @@ void ESM::SavedGame::save (ESMWriter &esm) const
          esm.writeHNString ("DEPE", *iter);
 
     esm.startSubRecord("SCRN");
-    esm.write(&mScreenshot[0], mScreenshot.size());
+    if (!mScreenshot.empty())
+        esm.write(&mScreenshot[0], mScreenshot.size());
     esm.endRecord("SCRN");
 }
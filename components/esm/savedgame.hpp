@@ -43,6 +43,10 @@ namespace ESM
 
         void load (ESMReader &esm);
         void save (ESMWriter &esm) const;
+        ///< \note The screenshot is omitted if empty.
+
+        void loadHeader (ESMReader &esm);
+        ///< Load everything but the screenshot.
     };
 }
 
@@ -0,0 +1,183 @@
+#include "compactlanddata.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace ESMTerrain
+{
+
+    CompactLandData::CompactLandData()
+        : mDataLoaded(0)
+        , mHeightEncoding(Heights_Float)
+        , mHeightOffset(0)
+        , mFirstHeight(0)
+        , mMinHeight(0)
+        , mMaxHeight(0)
+        , mUnk1(0)
+        , mUnk2(0)
+    {
+    }
+
+    CompactLandData::CompactLandData(const ESM::Land::LandData& data)
+        : mDataLoaded(data.mDataLoaded)
+        , mHeightEncoding(Heights_Float)
+        , mHeightOffset(data.mHeightOffset)
+        , mFirstHeight(0)
+        , mMinHeight(0)
+        , mMaxHeight(0)
+        , mUnk1(0)
+        , mUnk2(0)
+    {
+        if (mDataLoaded & ESM::Land::DATA_VHGT)
+        {
+            mFirstHeight = data.mHeights[0];
+            mMinHeight = data.mMinHeight;
+            mMaxHeight = data.mMaxHeight;
+            mUnk1 = data.mUnk1;
+            mUnk2 = data.mUnk2;
+
+            if (encodeHeights(data, mHeightDeltas8))
+                mHeightEncoding = Heights_Delta8;
+            else if (encodeHeights(data, mHeightDeltas16))
+                mHeightEncoding = Heights_Delta16;
+            else
+            {
+                mHeightEncoding = Heights_Float;
+                mHeights.assign(data.mHeights, data.mHeights + ESM::Land::LAND_NUM_VERTS);
+            }
+        }
+
+        if (mDataLoaded & ESM::Land::DATA_VNML)
+            mNormals.assign(data.mNormals, data.mNormals + ESM::Land::LAND_NUM_VERTS * 3);
+
+        if (mDataLoaded & ESM::Land::DATA_VCLR)
+        {
+            bool uniform = true;
+            for (int i = 3; i < ESM::Land::LAND_NUM_VERTS * 3 && uniform; ++i)
+                uniform = data.mColours[i] == data.mColours[i % 3];
+
+            mColours.assign(data.mColours, data.mColours + (uniform ? 3 : ESM::Land::LAND_NUM_VERTS * 3));
+        }
+
+        if (mDataLoaded & ESM::Land::DATA_VTEX)
+            mTextures.assign(data.mTextures, data.mTextures + ESM::Land::LAND_NUM_TEXTURES);
+    }
+
+    template <typename T>
+    bool CompactLandData::encodeHeights(const ESM::Land::LandData& data, std::vector<T>& deltas)
+    {
+        // Mirrors the arithmetic of decodeHeights, so that every height can be checked to decode to the exact same value
+        deltas.resize(ESM::Land::LAND_NUM_VERTS);
+
+        float rowOffset = mFirstHeight / ESM::Land::HEIGHT_SCALE;
+        for (int y = 0; y < ESM::Land::LAND_SIZE; ++y)
+        {
+            float colOffset = rowOffset;
+            for (int x = 0; x < ESM::Land::LAND_SIZE; ++x)
+            {
+                int index = y * ESM::Land::LAND_SIZE + x;
+                float& offset = (x == 0) ? rowOffset : colOffset;
+
+                float delta = (x == 0 && y == 0) ? 0.f : std::floor(data.mHeights[index] / ESM::Land::HEIGHT_SCALE - offset + 0.5f);
+                if (!(delta >= std::numeric_limits<T>::min() && delta <= std::numeric_limits<T>::max()))
+                {
+                    deltas.clear();
+                    return false;
+                }
+
+                deltas[index] = static_cast<T>(delta);
+                offset += deltas[index];
+                if (x == 0)
+                    colOffset = rowOffset;
+
+                if (offset * ESM::Land::HEIGHT_SCALE != data.mHeights[index])
+                {
+                    deltas.clear();
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    template <typename T>
+    void CompactLandData::decodeHeights(const std::vector<T>& deltas, float* heights) const
+    {
+        float rowOffset = mFirstHeight / ESM::Land::HEIGHT_SCALE;
+        for (int y = 0; y < ESM::Land::LAND_SIZE; ++y)
+        {
+            rowOffset += deltas[y * ESM::Land::LAND_SIZE];
+            heights[y * ESM::Land::LAND_SIZE] = rowOffset * ESM::Land::HEIGHT_SCALE;
+
+            float colOffset = rowOffset;
+            for (int x = 1; x < ESM::Land::LAND_SIZE; ++x)
+            {
+                colOffset += deltas[y * ESM::Land::LAND_SIZE + x];
+                heights[y * ESM::Land::LAND_SIZE + x] = colOffset * ESM::Land::HEIGHT_SCALE;
+            }
+        }
+    }
+
+    void CompactLandData::decode(ESM::Land::LandData& data) const
+    {
+        data.mDataLoaded = mDataLoaded;
+        data.mHeightOffset = mHeightOffset;
+
+        if (mDataLoaded & ESM::Land::DATA_VHGT)
+        {
+            switch (mHeightEncoding)
+            {
+                case Heights_Delta8:
+                    decodeHeights(mHeightDeltas8, data.mHeights);
+                    break;
+                case Heights_Delta16:
+                    decodeHeights(mHeightDeltas16, data.mHeights);
+                    break;
+                case Heights_Float:
+                    std::memcpy(data.mHeights, &mHeights[0], sizeof(data.mHeights));
+                    break;
+            }
+
+            data.mMinHeight = mMinHeight;
+            data.mMaxHeight = mMaxHeight;
+            data.mUnk1 = mUnk1;
+            data.mUnk2 = mUnk2;
+        }
+
+        if (mDataLoaded & ESM::Land::DATA_VNML)
+            std::memcpy(data.mNormals, &mNormals[0], sizeof(data.mNormals));
+
+        if (mDataLoaded & ESM::Land::DATA_VCLR)
+        {
+            if (mColours.size() == 3)
+            {
+                for (int i = 0; i < ESM::Land::LAND_NUM_VERTS; ++i)
+                    std::memcpy(data.mColours + i * 3, &mColours[0], 3);
+            }
+            else
+                std::memcpy(data.mColours, &mColours[0], sizeof(data.mColours));
+        }
+
+        if (mDataLoaded & ESM::Land::DATA_VTEX)
+            std::memcpy(data.mTextures, &mTextures[0], sizeof(data.mTextures));
+    }
+
+    int CompactLandData::getDataLoaded() const
+    {
+        return mDataLoaded;
+    }
+
+    size_t CompactLandData::getMemoryUsage() const
+    {
+        return sizeof(*this)
+            + mHeightDeltas8.capacity() * sizeof(signed char)
+            + mHeightDeltas16.capacity() * sizeof(short)
+            + mHeights.capacity() * sizeof(float)
+            + mNormals.capacity() * sizeof(ESM::Land::VNML)
+            + mColours.capacity()
+            + mTextures.capacity() * sizeof(uint16_t);
+    }
+
+}
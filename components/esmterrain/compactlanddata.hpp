@@ -0,0 +1,69 @@
+#ifndef COMPONENTS_ESM_TERRAIN_COMPACTLANDDATA_H
+#define COMPONENTS_ESM_TERRAIN_COMPACTLANDDATA_H
+
+#include <vector>
+
+#include <components/esm/loadland.hpp>
+
+namespace ESMTerrain
+{
+
+    /// @brief Compact in-memory representation of ESM::Land::LandData, decoded on demand.
+    /// @par Heights are stored as row/column deltas in units of ESM::Land::HEIGHT_SCALE, like in the VHGT subrecord. This
+    /// is lossless for all heights loaded from content files; heights that can't be represented exactly (e.g. after editing)
+    /// fall back to wider deltas or plain floats. Normals keep the 8-bit quantization of the VNML subrecord, and a cell with a
+    /// uniform vertex colour stores that colour only once.
+    /// @note Immutable after construction, so it may be decoded from multiple threads at once.
+    class CompactLandData
+    {
+    public:
+        CompactLandData();
+
+        /// Encode the data types of \a data that are flagged as loaded.
+        explicit CompactLandData(const ESM::Land::LandData& data);
+
+        /// Overwrite \a data with the decoded content.
+        void decode(ESM::Land::LandData& data) const;
+
+        /// Data types contained, see ESM::Land::DATA_VNML etc.
+        int getDataLoaded() const;
+
+        /// Approximate number of bytes used.
+        size_t getMemoryUsage() const;
+
+    private:
+        enum HeightEncoding
+        {
+            Heights_Delta8,
+            Heights_Delta16,
+            Heights_Float
+        };
+
+        template <typename T>
+        bool encodeHeights(const ESM::Land::LandData& data, std::vector<T>& deltas);
+
+        template <typename T>
+        void decodeHeights(const std::vector<T>& deltas, float* heights) const;
+
+        int mDataLoaded;
+
+        HeightEncoding mHeightEncoding;
+        float mHeightOffset;
+        float mFirstHeight;
+        float mMinHeight;
+        float mMaxHeight;
+        std::vector<signed char> mHeightDeltas8;
+        std::vector<short> mHeightDeltas16;
+        std::vector<float> mHeights;
+
+        std::vector<ESM::Land::VNML> mNormals;
+        std::vector<unsigned char> mColours;
+        std::vector<uint16_t> mTextures;
+
+        short mUnk1;
+        uint8_t mUnk2;
+    };
+
+}
+
+#endif
@@ -0,0 +1,129 @@
+#include "landdatacache.hpp"
+
+#include <OpenThreads/ScopedLock>
+
+#include "compactlanddata.hpp"
+
+namespace ESMTerrain
+{
+
+    DecodedLandData::DecodedLandData()
+    {
+    }
+
+    DecodedLandData::DecodedLandData(const DecodedLandData& copy, const osg::CopyOp& copyop)
+        : osg::Object(copy, copyop)
+        , mData(copy.mData)
+    {
+    }
+
+    LandDataCache::LandDataCache(size_t budget)
+        : mBudget(budget)
+        , mMemoryUsage(0)
+    {
+    }
+
+    LandDataCache::~LandDataCache()
+    {
+    }
+
+    osg::ref_ptr<const DecodedLandData> LandDataCache::getData(const CompactLandData& data)
+    {
+        {
+            OpenThreads::ScopedLock<OpenThreads::Mutex> lock(mMutex);
+            EntryMap::iterator found = mEntries.find(&data);
+            if (found != mEntries.end())
+            {
+                mUsage.splice(mUsage.begin(), mUsage, found->second.mUsage);
+                return found->second.mData;
+            }
+        }
+
+        osg::ref_ptr<DecodedLandData> decoded (new DecodedLandData);
+        data.decode(decoded->mData);
+
+        OpenThreads::ScopedLock<OpenThreads::Mutex> lock(mMutex);
+
+        // Another thread may have decoded the same data in the meantime
+        EntryMap::iterator found = mEntries.find(&data);
+        if (found != mEntries.end())
+        {
+            mUsage.splice(mUsage.begin(), mUsage, found->second.mUsage);
+            return found->second.mData;
+        }
+
+        mUsage.push_front(&data);
+        Entry& entry = mEntries[&data];
+        entry.mData = decoded;
+        entry.mUsage = mUsage.begin();
+        mMemoryUsage += sizeof(DecodedLandData);
+
+        evict();
+
+        return decoded;
+    }
+
+    void LandDataCache::remove(const CompactLandData& data)
+    {
+        osg::ref_ptr<DecodedLandData> removed;
+
+        OpenThreads::ScopedLock<OpenThreads::Mutex> lock(mMutex);
+        EntryMap::iterator found = mEntries.find(&data);
+        if (found == mEntries.end())
+            return;
+
+        removed = found->second.mData;
+        mUsage.erase(found->second.mUsage);
+        mEntries.erase(found);
+        mMemoryUsage -= sizeof(DecodedLandData);
+    }
+
+    void LandDataCache::clear()
+    {
+        EntryMap entries;
+        {
+            OpenThreads::ScopedLock<OpenThreads::Mutex> lock(mMutex);
+            mEntries.swap(entries);
+            mUsage.clear();
+            mMemoryUsage = 0;
+        }
+        // entries are released outside of the lock
+    }
+
+    void LandDataCache::setBudget(size_t budget)
+    {
+        OpenThreads::ScopedLock<OpenThreads::Mutex> lock(mMutex);
+        mBudget = budget;
+        evict();
+    }
+
+    size_t LandDataCache::getBudget() const
+    {
+        OpenThreads::ScopedLock<OpenThreads::Mutex> lock(mMutex);
+        return mBudget;
+    }
+
+    size_t LandDataCache::getMemoryUsage() const
+    {
+        OpenThreads::ScopedLock<OpenThreads::Mutex> lock(mMutex);
+        return mMemoryUsage;
+    }
+
+    size_t LandDataCache::getNumEntries() const
+    {
+        OpenThreads::ScopedLock<OpenThreads::Mutex> lock(mMutex);
+        return mEntries.size();
+    }
+
+    void LandDataCache::evict()
+    {
+        // Evicted data stays valid for as long as it is still referenced, e.g. by the caller of getData
+        while (mMemoryUsage > mBudget && !mUsage.empty())
+        {
+            mEntries.erase(mUsage.back());
+            mUsage.pop_back();
+            mMemoryUsage -= sizeof(DecodedLandData);
+        }
+    }
+
+}
@@ -0,0 +1,83 @@
+#ifndef COMPONENTS_ESM_TERRAIN_LANDDATACACHE_H
+#define COMPONENTS_ESM_TERRAIN_LANDDATACACHE_H
+
+#include <list>
+#include <map>
+
+#include <OpenThreads/Mutex>
+
+#include <osg/Object>
+#include <osg/ref_ptr>
+
+#include <components/esm/loadland.hpp>
+
+namespace ESMTerrain
+{
+
+    class CompactLandData;
+
+    /// @brief Reference counted, fully decoded land data. Holders may keep using it after it was evicted from the cache.
+    class DecodedLandData : public osg::Object
+    {
+    public:
+        DecodedLandData();
+        DecodedLandData(const DecodedLandData& copy, const osg::CopyOp& copyop);
+
+        META_Object(ESMTerrain, DecodedLandData)
+
+        ESM::Land::LandData mData;
+    };
+
+    /// @brief Least recently used cache of decoded land data, limited by a byte budget.
+    /// @note Thread safe. Decoding happens outside of the lock, so background chunk builders don't block each other.
+    class LandDataCache : public osg::Referenced
+    {
+    public:
+        /// @param budget Maximum number of bytes held by the cache.
+        LandDataCache(size_t budget);
+
+        /// Return the decoded content of \a data, decoding it if necessary.
+        /// @note \a data is used as the key and must be removed from the cache before it is destroyed.
+        osg::ref_ptr<const DecodedLandData> getData(const CompactLandData& data);
+
+        void remove(const CompactLandData& data);
+
+        void clear();
+
+        /// Evicts least recently used entries if the new budget is exceeded.
+        void setBudget(size_t budget);
+
+        size_t getBudget() const;
+
+        /// Number of bytes held by the cache, not counting entries that were evicted but are still referenced elsewhere.
+        size_t getMemoryUsage() const;
+
+        size_t getNumEntries() const;
+
+    private:
+        virtual ~LandDataCache();
+
+        void evict();
+
+        typedef std::list<const CompactLandData*> UsageList;
+
+        struct Entry
+        {
+            osg::ref_ptr<DecodedLandData> mData;
+            UsageList::iterator mUsage;
+        };
+
+        typedef std::map<const CompactLandData*, Entry> EntryMap;
+
+        EntryMap mEntries;
+        UsageList mUsage; ///< most recently used first
+
+        size_t mBudget;
+        size_t mMemoryUsage;
+
+        mutable OpenThreads::Mutex mMutex;
+    };
+
+}
+
+#endif
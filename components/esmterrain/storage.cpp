@@ -1,5 +1,6 @@
 #include "storage.hpp"
 
+#include <cstring>
 #include <set>
 #include <iostream>
 
@@ -21,32 +22,50 @@ namespace ESMTerrain
     public:
         typedef std::map<std::pair<int, int>, osg::ref_ptr<const LandObject> > Map;
         Map mMap;
+
+        /// Decoded data is held here for as long as the cache is used, even if the LandDataCache evicts it
+        typedef std::map<std::pair<int, int>, osg::ref_ptr<const DecodedLandData> > DataMap;
+        DataMap mData;
     };
 
     LandObject::LandObject()
+        : mLand(NULL)
+        , mLoadFlags(0)
     {
     }
 
-    LandObject::LandObject(const ESM::Land *land, int loadFlags)
+    LandObject::LandObject(const ESM::Land *land, int loadFlags, LandDataCache* cache)
         : mLand(land)
         , mLoadFlags(loadFlags)
+        , mCache(cache)
     {
-        mLand->loadData(mLoadFlags, &mData);
+        osg::ref_ptr<DecodedLandData> data (new DecodedLandData);
+        mLand->loadData(mLoadFlags, &data->mData);
+
+        if (mCache)
+            mCompactData = CompactLandData(data->mData);
+        else
+            mData = data;
     }
 
     LandObject::LandObject(const LandObject &copy, const osg::CopyOp &copyop)
+        : mLand(NULL)
+        , mLoadFlags(0)
     {
     }
 
     LandObject::~LandObject()
     {
+        if (mCache)
+            mCache->remove(mCompactData);
     }
 
-    const ESM::Land::LandData *LandObject::getData(int flags) const
+    osg::ref_ptr<const DecodedLandData> LandObject::getData(int flags) const
     {
-        if ((mData.mDataLoaded & flags) != flags)
+        osg::ref_ptr<const DecodedLandData> data = mCache ? mCache->getData(mCompactData) : mData;
+        if (!data || (data->mData.mDataLoaded & flags) != flags)
             return NULL;
-        return &mData;
+        return data;
     }
 
     int LandObject::getPlugin() const
@@ -82,8 +101,8 @@ namespace ESMTerrain
         int endRow = startRow + size * (ESM::Land::LAND_SIZE-1) + 1;
         int endColumn = startColumn + size * (ESM::Land::LAND_SIZE-1) + 1;
 
-        osg::ref_ptr<const LandObject> land = getLand (cellX, cellY);
-        const ESM::Land::LandData* data = land ? land->getData(ESM::Land::DATA_VHGT) : 0;
+        LandCache cache;
+        const ESM::Land::LandData* data = getLandData(cellX, cellY, ESM::Land::DATA_VHGT, cache);
         if (data)
         {
             min = std::numeric_limits<float>::max();
@@ -130,8 +149,7 @@ namespace ESMTerrain
             row += ESM::Land::LAND_SIZE-1;
         }
 
-        const LandObject* land = getLand(cellX, cellY, cache);
-        const ESM::Land::LandData* data = land ? land->getData(ESM::Land::DATA_VNML) : 0;
+        const ESM::Land::LandData* data = getLandData(cellX, cellY, ESM::Land::DATA_VNML, cache);
         if (data)
         {
             normal.x() = data->mNormals[col*ESM::Land::LAND_SIZE*3+row*3];
@@ -167,8 +185,7 @@ namespace ESMTerrain
             row = 0;
         }
 
-        const LandObject* land = getLand(cellX, cellY, cache);
-        const ESM::Land::LandData* data = land ? land->getData(ESM::Land::DATA_VCLR) : 0;
+        const ESM::Land::LandData* data = getLandData(cellX, cellY, ESM::Land::DATA_VCLR, cache);
         if (data)
         {
             color.r() = data->mColours[col*ESM::Land::LAND_SIZE*3+row*3] / 255.f;
@@ -216,16 +233,9 @@ namespace ESMTerrain
             float vertX_ = 0; // of current cell corner
             for (int cellX = startCellX; cellX < startCellX + std::ceil(size); ++cellX)
             {
-                const LandObject* land = getLand(cellX, cellY, cache);
-                const ESM::Land::LandData *heightData = 0;
-                const ESM::Land::LandData *normalData = 0;
-                const ESM::Land::LandData *colourData = 0;
-                if (land)
-                {
-                    heightData = land->getData(ESM::Land::DATA_VHGT);
-                    normalData = land->getData(ESM::Land::DATA_VNML);
-                    colourData = land->getData(ESM::Land::DATA_VCLR);
-                }
+                const ESM::Land::LandData *heightData = getLandData(cellX, cellY, ESM::Land::DATA_VHGT, cache);
+                const ESM::Land::LandData *normalData = getLandData(cellX, cellY, ESM::Land::DATA_VNML, cache);
+                const ESM::Land::LandData *colourData = getLandData(cellX, cellY, ESM::Land::DATA_VCLR, cache);
 
                 int rowStart = 0;
                 int colStart = 0;
@@ -346,15 +356,13 @@ namespace ESMTerrain
         assert(x<ESM::Land::LAND_TEXTURE_SIZE);
         assert(y<ESM::Land::LAND_TEXTURE_SIZE);
 
-        const LandObject* land = getLand(cellX, cellY, cache);
-
-        const ESM::Land::LandData *data = land ? land->getData(ESM::Land::DATA_VTEX) : 0;
+        const ESM::Land::LandData *data = getLandData(cellX, cellY, ESM::Land::DATA_VTEX, cache);
         if (data)
         {
             int tex = data->mTextures[y * ESM::Land::LAND_TEXTURE_SIZE + x];
             if (tex == 0)
                 return std::make_pair(0,0); // vtex 0 is always the base texture, regardless of plugin
-            return std::make_pair(tex, land->getPlugin());
+            return std::make_pair(tex, getLand(cellX, cellY, cache)->getPlugin());
         }
         return std::make_pair(0,0);
     }
@@ -428,35 +436,38 @@ namespace ESMTerrain
 
         int channels = pack ? 4 : 1;
 
-        // Second iteration - create and fill in the blend maps
+        // Second iteration - create the blend maps and fill them in a single pass over the texels.
+        // Every texel belongs to exactly one layer, so only that layer's value is set.
         const int blendmapSize = (realTextureSize-1) * chunkSize + 1;
 
+        std::vector<unsigned char*> blendmapData;
         for (int i=0; i<numBlendmaps; ++i)
         {
             GLenum format = pack ? GL_RGBA : GL_ALPHA;
 
             osg::ref_ptr<osg::Image> image (new osg::Image);
             image->allocateImage(blendmapSize, blendmapSize, 1, format, GL_UNSIGNED_BYTE);
-            unsigned char* pData = image->data();
+            std::memset(image->data(), 0, blendmapSize*blendmapSize*channels);
+
+            blendmapData.push_back(image->data());
+            blendmaps.push_back(image);
+        }
 
-            for (int y=0; y<blendmapSize; ++y)
+        for (int y=0; y<blendmapSize; ++y)
+        {
+            for (int x=0; x<blendmapSize; ++x)
             {
-                for (int x=0; x<blendmapSize; ++x)
-                {
-                    UniqueTextureId id = getVtexIndexAt(cellX, cellY, x+rowStart, y+colStart, cache);
-                    assert(textureIndicesMap.find(id) != textureIndicesMap.end());
-                    int layerIndex = textureIndicesMap.find(id)->second;
-                    int blendIndex = (pack ? static_cast<int>(std::floor((layerIndex - 1) / 4.f)) : layerIndex - 1);
-                    int channel = pack ? std::max(0, (layerIndex-1) % 4) : 0;
-
-                    if (blendIndex == i)
-                        pData[(blendmapSize - y - 1)*blendmapSize*channels + x*channels + channel] = 255;
-                    else
-                        pData[(blendmapSize - y - 1)*blendmapSize*channels + x*channels + channel] = 0;
-                }
-            }
+                UniqueTextureId id = getVtexIndexAt(cellX, cellY, x+rowStart, y+colStart, cache);
+                assert(textureIndicesMap.find(id) != textureIndicesMap.end());
+                int layerIndex = textureIndicesMap.find(id)->second;
+                if (layerIndex == 0)
+                    continue; // base layer
 
-            blendmaps.push_back(image);
+                int blendIndex = (pack ? (layerIndex - 1) / 4 : layerIndex - 1);
+                int channel = pack ? (layerIndex-1) % 4 : 0;
+
+                blendmapData[blendIndex][(blendmapSize - y - 1)*blendmapSize*channels + x*channels + channel] = 255;
+            }
         }
     }
 
@@ -465,11 +476,8 @@ namespace ESMTerrain
         int cellX = static_cast<int>(std::floor(worldPos.x() / 8192.f));
         int cellY = static_cast<int>(std::floor(worldPos.y() / 8192.f));
 
-        osg::ref_ptr<const LandObject> land = getLand(cellX, cellY);
-        if (!land)
-            return defaultHeight;
-
-        const ESM::Land::LandData* data = land->getData(ESM::Land::DATA_VHGT);
+        LandCache cache;
+        const ESM::Land::LandData* data = getLandData(cellX, cellY, ESM::Land::DATA_VHGT, cache);
         if (!data)
             return defaultHeight;
 
@@ -563,6 +571,22 @@ namespace ESMTerrain
         }
     }
 
+    const ESM::Land::LandData* Storage::getLandData(int cellX, int cellY, int flags, LandCache& cache)
+    {
+        const LandObject* land = getLand(cellX, cellY, cache);
+        if (!land)
+            return NULL;
+
+        LandCache::DataMap::iterator found = cache.mData.find(std::make_pair(cellX, cellY));
+        if (found == cache.mData.end())
+            found = cache.mData.insert(std::make_pair(std::make_pair(cellX, cellY), land->getData(0))).first;
+
+        const DecodedLandData* data = found->second.get();
+        if (!data || (data->mData.mDataLoaded & flags) != flags)
+            return NULL;
+        return &data->mData;
+    }
+
     Terrain::LayerInfo Storage::getLayerInfo(const std::string& texture)
     {
         OpenThreads::ScopedLock<OpenThreads::Mutex> lock(mLayerInfoMutex);
@@ -8,6 +8,9 @@
 #include <components/esm/loadland.hpp>
 #include <components/esm/loadltex.hpp>
 
+#include "compactlanddata.hpp"
+#include "landdatacache.hpp"
+
 namespace VFS
 {
     class Manager;
@@ -19,24 +22,31 @@ namespace ESMTerrain
     class LandCache;
 
     /// @brief Wrapper around Land Data with reference counting. The wrapper needs to be held as long as the data is still in use
+    /// @par If a LandDataCache is given, only a CompactLandData is kept, and the data is decoded on demand through the cache.
     class LandObject : public osg::Object
     {
     public:
         LandObject();
-        LandObject(const ESM::Land* land, int loadFlags);
+        LandObject(const ESM::Land* land, int loadFlags, LandDataCache* cache = NULL);
         LandObject(const LandObject& copy, const osg::CopyOp& copyop);
         virtual ~LandObject();
 
         META_Object(ESMTerrain, LandObject)
 
-        const ESM::Land::LandData* getData(int flags) const;
+        /// @note Will return NULL if the requested data types are not available.
+        /// @note The returned object needs to be held as long as the data is still in use.
+        osg::ref_ptr<const DecodedLandData> getData(int flags) const;
         int getPlugin() const;
 
     private:
         const ESM::Land* mLand;
         int mLoadFlags;
 
-        ESM::Land::LandData mData;
+        osg::ref_ptr<LandDataCache> mCache;
+        CompactLandData mCompactData;
+
+        /// Only used without a cache
+        osg::ref_ptr<const DecodedLandData> mData;
     };
 
     /// @brief Feeds data from ESM terrain records (ESM::Land, ESM::LandTexture)
@@ -115,6 +125,10 @@ namespace ESMTerrain
 
         const LandObject* getLand(int cellX, int cellY, LandCache& cache);
 
+        /// Decoded data of the given cell, held by \a cache.
+        /// @note Will return NULL if the land or the requested data types are not available.
+        const ESM::Land::LandData* getLandData(int cellX, int cellY, int flags, LandCache& cache);
+
         // Since plugins can define new texture palettes, we need to know the plugin index too
         // in order to retrieve the correct texture name.
         // pair  <texture id, plugin id>
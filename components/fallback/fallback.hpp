@@ -21,6 +21,30 @@ namespace Fallback
             int getFallbackInt(const std::string& fall) const;
             bool getFallbackBool(const std::string& fall) const;
             osg::Vec4f getFallbackColour(const std::string& fall) const;
+
+            template <typename T>
+            T getFallback(const std::string& fall) const;
+            ///< typed access, specialized for std::string, float, int, bool and osg::Vec4f (colour)
+    };
+
+    template <> inline std::string Map::getFallback<std::string>(const std::string& fall) const { return getFallbackString(fall); }
+    template <> inline float Map::getFallback<float>(const std::string& fall) const { return getFallbackFloat(fall); }
+    template <> inline int Map::getFallback<int>(const std::string& fall) const { return getFallbackInt(fall); }
+    template <> inline bool Map::getFallback<bool>(const std::string& fall) const { return getFallbackBool(fall); }
+    template <> inline osg::Vec4f Map::getFallback<osg::Vec4f>(const std::string& fall) const { return getFallbackColour(fall); }
+
+    /// @brief Typed fallback value, parsed once when the handle is created.
+    /// @note The fallback map is fixed after startup, so unlike Settings::Handle there is nothing to invalidate.
+    template <typename T>
+    class Handle
+    {
+            T mValue;
+        public:
+            Handle(const Map& map, const std::string& fall)
+                : mValue(map.getFallback<T>(fall))
+            {}
+
+            const T& get() const { return mValue; }
     };
 }
 #endif
@@ -1,7 +1,5 @@
 #include "collections.hpp"
 
-#include <components/misc/stringops.hpp>
-
 namespace Files
 {
     Collections::Collections()
@@ -11,20 +9,30 @@ namespace Files
     {
     }
 
-    Collections::Collections(const Files::PathContainer& directories, bool foldCase)
+    Collections::Collections(const Files::PathContainer& directories, bool foldCase,
+        const boost::filesystem::path& cacheFile)
         : mDirectories(directories)
         , mFoldCase(foldCase)
+        , mCacheFile(cacheFile)
         , mCollections()
     {
     }
 
+    const DirectoryIndex& Collections::getIndex() const
+    {
+        if (!mIndex)
+            mIndex.reset(new DirectoryIndex(mDirectories, mCacheFile));
+
+        return *mIndex;
+    }
+
     const MultiDirCollection& Collections::getCollection(const std::string& extension) const
     {
         MultiDirCollectionContainer::iterator iter = mCollections.find(extension);
         if (iter==mCollections.end())
         {
             std::pair<MultiDirCollectionContainer::iterator, bool> result =
-                mCollections.insert(std::make_pair(extension, MultiDirCollection(mDirectories, extension, mFoldCase)));
+                mCollections.insert(std::make_pair(extension, MultiDirCollection(getIndex(), extension, mFoldCase)));
 
             iter = result.first;
         }
@@ -32,50 +40,34 @@ namespace Files
         return iter->second;
     }
 
-    boost::filesystem::path Collections::getPath(const std::string& file) const
+    const DirectoryIndex::Entry* Collections::find(const std::string& file) const
     {
-        for (Files::PathContainer::const_iterator iter = mDirectories.begin();
-             iter != mDirectories.end(); ++iter)
-        {
-            for (boost::filesystem::directory_iterator iter2 (*iter);
-                iter2!=boost::filesystem::directory_iterator(); ++iter2)
-            {
-                boost::filesystem::path path = *iter2;
+        const std::vector<DirectoryIndex::Entry>* entries = getIndex().find(file);
+        if (!entries)
+            return NULL;
 
-                if (mFoldCase)
-                {
-                    if (Misc::StringUtils::ciEqual(file, path.filename().string()))
-                        return path.string();
-                }
-                else if (path.filename().string() == file)
-                    return path.string();
-            }
+        // the first directory that contains the file
+        for (std::vector<DirectoryIndex::Entry>::const_iterator iter = entries->begin(); iter != entries->end(); ++iter)
+        {
+            if (mFoldCase || *iter->mName == file)
+                return &*iter;
         }
 
-        throw std::runtime_error ("file " + file + " not found");
+        return NULL;
     }
 
-    bool Collections::doesExist(const std::string& file) const
+    boost::filesystem::path Collections::getPath(const std::string& file) const
     {
-        for (Files::PathContainer::const_iterator iter = mDirectories.begin();
-             iter != mDirectories.end(); ++iter)
-        {
-            for (boost::filesystem::directory_iterator iter2 (*iter);
-                iter2!=boost::filesystem::directory_iterator(); ++iter2)
-            {
-                boost::filesystem::path path = *iter2;
+        const DirectoryIndex::Entry* entry = find(file);
+        if (!entry)
+            throw std::runtime_error ("file " + file + " not found");
 
-                if (mFoldCase)
-                {
-                    if (Misc::StringUtils::ciEqual(file, path.filename().string()))
-                        return true;
-                }
-                else if (path.filename().string() == file)
-                    return true;
-            }
-        }
+        return getIndex().getPath(*entry);
+    }
 
-        return false;
+    bool Collections::doesExist(const std::string& file) const
+    {
+        return find(file) != NULL;
     }
 
     const Files::PathContainer& Collections::getPaths() const
@@ -1,6 +1,9 @@
 #ifndef COMPONENTS_FILES_COLLECTION_HPP
 #define COMPONENTS_FILES_COLLECTION_HPP
 
+#include <map>
+#include <memory>
+
 #include <boost/filesystem.hpp>
 
 #include "multidircollection.hpp"
@@ -13,7 +16,9 @@ namespace Files
             Collections();
 
             ///< Directories are listed with increasing priority.
-            Collections(const Files::PathContainer& directories, bool foldCase);
+            /// \param cacheFile Cache for the directory listings, see DirectoryIndex. Empty for no cache.
+            Collections(const Files::PathContainer& directories, bool foldCase,
+                const boost::filesystem::path& cacheFile = boost::filesystem::path());
 
             ///< Return a file collection for the given extension. Extension must contain the
             /// leading dot and must be all lower-case.
@@ -36,7 +41,15 @@ namespace Files
             Files::PathContainer mDirectories;
 
             bool mFoldCase;
+            boost::filesystem::path mCacheFile;
+
+            /// Listing of all directories, made on first use and shared by copies
+            mutable std::shared_ptr<const DirectoryIndex> mIndex;
             mutable MultiDirCollectionContainer mCollections;
+
+            const DirectoryIndex& getIndex() const;
+
+            const DirectoryIndex::Entry* find(const std::string& file) const;
     };
 }
 
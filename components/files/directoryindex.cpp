@@ -0,0 +1,262 @@
+#include "directoryindex.hpp"
+
+#include <atomic>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <thread>
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include <components/misc/stringops.hpp>
+
+namespace
+{
+    const char* sCacheHeader = "OpenMW directory index 1";
+
+    typedef std::map<boost::filesystem::path, Files::DirectoryIndex::Directory> Cache;
+
+    void readCache (const boost::filesystem::path& path, Cache& cache)
+    {
+        if (path.empty() || !boost::filesystem::exists (path))
+            return;
+
+        try
+        {
+            boost::filesystem::ifstream file (path, std::ios::binary);
+
+            std::string line;
+            if (!std::getline (file, line) || line!=sCacheHeader)
+                return; // format may have changed -> list again
+
+            while (std::getline (file, line))
+            {
+                Files::DirectoryIndex::Directory& directory = cache[line];
+                directory.mPath = line;
+                directory.mValid = true;
+
+                if (!std::getline (file, line))
+                    throw std::runtime_error ("unexpected end of file");
+
+                std::size_t count = 0;
+                std::istringstream stream (line);
+                if (!(stream >> directory.mModified >> directory.mListed >> count))
+                    throw std::runtime_error ("invalid directory header");
+
+                directory.mFiles.resize (count);
+                for (std::size_t i=0; i<count; ++i)
+                    if (!std::getline (file, directory.mFiles[i]))
+                        throw std::runtime_error ("unexpected end of file");
+            }
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << "Ignoring directory index " << path << ": " << e.what() << std::endl;
+            cache.clear();
+        }
+    }
+
+    /// Lists the directories that are not up to date in the cache, shared by all worker threads
+    class DirectoryLister
+    {
+            std::vector<Files::DirectoryIndex::Directory>& mDirectories;
+            const Cache& mCache;
+            std::atomic<std::size_t> mNext;
+            std::atomic<std::size_t> mNumCached;
+
+            void list (Files::DirectoryIndex::Directory& directory)
+            {
+                boost::system::error_code error;
+                if (!boost::filesystem::is_directory (directory.mPath, error))
+                    return;
+
+                std::time_t modified = boost::filesystem::last_write_time (directory.mPath, error);
+                if (error)
+                    return;
+
+                directory.mValid = true;
+
+                Cache::const_iterator cached = mCache.find (directory.mPath);
+
+                // A modification in the second of the listing might not have been seen by it
+                if (cached!=mCache.end() && cached->second.mModified==modified && modified<cached->second.mListed)
+                {
+                    directory.mModified = modified;
+                    directory.mListed = cached->second.mListed;
+                    directory.mFiles = cached->second.mFiles;
+                    ++mNumCached;
+                    return;
+                }
+
+                directory.mModified = modified;
+                directory.mListed = std::time (0);
+
+                for (boost::filesystem::directory_iterator iter (directory.mPath);
+                    iter!=boost::filesystem::directory_iterator(); ++iter)
+                {
+                    directory.mFiles.push_back (iter->path().filename().string());
+                }
+            }
+
+        public:
+
+            DirectoryLister (std::vector<Files::DirectoryIndex::Directory>& directories, const Cache& cache)
+            : mDirectories (directories), mCache (cache), mNext (0), mNumCached (0)
+            {}
+
+            void operator() ()
+            {
+                for (std::size_t i = mNext++; i<mDirectories.size(); i = mNext++)
+                {
+                    try
+                    {
+                        list (mDirectories[i]);
+                    }
+                    catch (const std::exception& e)
+                    {
+                        std::cerr << "Failed to list directory " << mDirectories[i].mPath << ": " << e.what() << std::endl;
+                        mDirectories[i].mValid = false;
+                        mDirectories[i].mFiles.clear();
+                    }
+                }
+            }
+
+            std::size_t getNumCached() const
+            {
+                return mNumCached;
+            }
+    };
+}
+
+namespace Files
+{
+    const char* DirectoryIndex::sCacheFileName = "datafiles.idx";
+
+    DirectoryIndex::DirectoryIndex (const PathContainer& directories, const boost::filesystem::path& cacheFile)
+    : mNumCached (0)
+    {
+        Cache cache;
+        readCache (cacheFile, cache);
+
+        mDirectories.resize (directories.size());
+        for (std::size_t i=0; i<directories.size(); ++i)
+            mDirectories[i].mPath = directories[i];
+
+        DirectoryLister lister (mDirectories, cache);
+
+        std::size_t threadCount = std::min (static_cast<std::size_t> (std::max (std::thread::hardware_concurrency(), 1u)),
+            mDirectories.size());
+
+        std::vector<std::thread> threads;
+        for (std::size_t i=1; i<threadCount; ++i)
+            threads.push_back (std::thread (std::ref (lister)));
+
+        lister();
+
+        for (std::vector<std::thread>::iterator iter (threads.begin()); iter!=threads.end(); ++iter)
+            iter->join();
+
+        mNumCached = lister.getNumCached();
+
+        std::size_t numValid = 0;
+        for (std::size_t i=0; i<mDirectories.size(); ++i)
+        {
+            if (!mDirectories[i].mValid)
+            {
+                std::cout << "Skipping invalid directory: " << mDirectories[i].mPath.string() << std::endl;
+                continue;
+            }
+
+            ++numValid;
+
+            const std::vector<std::string>& files = mDirectories[i].mFiles;
+            for (std::vector<std::string>::const_iterator iter (files.begin()); iter!=files.end(); ++iter)
+            {
+                Entry entry;
+                entry.mDirectory = i;
+                entry.mName = &*iter;
+                mIndex[Misc::StringUtils::lowerCase (*iter)].push_back (entry);
+            }
+        }
+
+        if (!cacheFile.empty() && mNumCached<numValid)
+            save (cacheFile);
+    }
+
+    const std::vector<DirectoryIndex::Directory>& DirectoryIndex::getDirectories() const
+    {
+        return mDirectories;
+    }
+
+    const std::vector<DirectoryIndex::Entry>* DirectoryIndex::find (const std::string& file) const
+    {
+        TIndex::const_iterator iter = mIndex.find (Misc::StringUtils::lowerCase (file));
+
+        if (iter==mIndex.end())
+            return 0;
+
+        return &iter->second;
+    }
+
+    boost::filesystem::path DirectoryIndex::getPath (const Entry& entry) const
+    {
+        return mDirectories[entry.mDirectory].mPath / *entry.mName;
+    }
+
+    std::size_t DirectoryIndex::getNumCached() const
+    {
+        return mNumCached;
+    }
+
+    void DirectoryIndex::save (const boost::filesystem::path& cacheFile) const
+    {
+        boost::filesystem::path tempFile = cacheFile;
+        tempFile += ".tmp";
+
+        try
+        {
+            if (cacheFile.has_parent_path())
+                boost::filesystem::create_directories (cacheFile.parent_path());
+
+            {
+                boost::filesystem::ofstream file (tempFile, std::ios::binary);
+
+                file << sCacheHeader << '\n';
+
+                for (std::vector<Directory>::const_iterator iter (mDirectories.begin()); iter!=mDirectories.end(); ++iter)
+                {
+                    if (!iter->mValid || iter->mPath.string().find ('\n')!=std::string::npos)
+                        continue;
+
+                    bool valid = true;
+                    for (std::vector<std::string>::const_iterator name (iter->mFiles.begin());
+                        name!=iter->mFiles.end() && valid; ++name)
+                        valid = name->find ('\n')==std::string::npos;
+
+                    if (!valid)
+                        continue; // can't be stored line by line, list again next time
+
+                    file << iter->mPath.string() << '\n'
+                        << iter->mModified << ' ' << iter->mListed << ' ' << iter->mFiles.size() << '\n';
+
+                    for (std::vector<std::string>::const_iterator name (iter->mFiles.begin());
+                        name!=iter->mFiles.end(); ++name)
+                        file << *name << '\n';
+                }
+
+                file.flush();
+                if (file.fail())
+                    throw std::runtime_error ("write operation failed");
+            }
+
+            // don't leave a partial index if another process reads it at the same time
+            boost::filesystem::rename (tempFile, cacheFile);
+        }
+        catch (const std::exception& e)
+        {
+            // only a cache, the next start will list the directories again
+            std::cerr << "Failed to write directory index " << cacheFile << ": " << e.what() << std::endl;
+        }
+    }
+}
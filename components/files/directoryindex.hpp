@@ -0,0 +1,79 @@
+#ifndef COMPONENTS_FILES_DIRECTORYINDEX_HPP
+#define COMPONENTS_FILES_DIRECTORYINDEX_HPP
+
+#include <ctime>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/filesystem/path.hpp>
+
+namespace Files
+{
+    typedef std::vector<boost::filesystem::path> PathContainer;
+
+    /// \brief Names of the files in several directories
+    ///
+    /// Each directory is listed once for all extensions, and the directories are listed in parallel.
+    /// The listings can be saved to a cache file. The next index made with that file takes the listings
+    /// of directories that were not modified since from the cache instead of listing them again.
+    class DirectoryIndex
+    {
+        public:
+
+            struct Directory
+            {
+                boost::filesystem::path mPath;
+                bool mValid; ///< Does the directory exist?
+                std::time_t mModified; ///< Modification time of the directory when it was listed
+                std::time_t mListed; ///< Time of the listing
+                std::vector<std::string> mFiles; ///< Names of all entries, including subdirectories
+
+                Directory() : mValid (false), mModified (0), mListed (0) {}
+            };
+
+            /// A file name in one of the directories
+            struct Entry
+            {
+                std::size_t mDirectory; ///< Index in the list of directories
+                const std::string* mName;
+            };
+
+            /// Lower case file name -> entries in the order of the directories
+            typedef std::unordered_map<std::string, std::vector<Entry> > TIndex;
+
+            static const char* sCacheFileName;
+
+        private:
+
+            std::vector<Directory> mDirectories;
+            TIndex mIndex;
+            std::size_t mNumCached;
+
+            DirectoryIndex (const DirectoryIndex&);
+            DirectoryIndex& operator= (const DirectoryIndex&);
+
+        public:
+
+            DirectoryIndex (const PathContainer& directories,
+                const boost::filesystem::path& cacheFile = boost::filesystem::path());
+            ///< Directories are listed with increasing priority.
+            /// \param cacheFile Listings of unmodified directories are taken from this file if it exists.
+            /// If any directory had to be listed again, the file is updated. Empty for no cache.
+
+            const std::vector<Directory>& getDirectories() const;
+
+            const std::vector<Entry>* find (const std::string& file) const;
+            ///< \return All files with the name \a file, ignoring case, or a null pointer if there is none
+
+            boost::filesystem::path getPath (const Entry& entry) const;
+
+            std::size_t getNumCached() const;
+            ///< \return Number of directories taken from the cache file
+
+            void save (const boost::filesystem::path& cacheFile) const;
+            ///< Write the listings to \a cacheFile. Failing to write is reported, but not an error.
+    };
+}
+
+#endif
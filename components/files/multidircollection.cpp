@@ -1,88 +1,52 @@
 #include "multidircollection.hpp"
 
-#include <iostream>
+#include <stdexcept>
 
-#include <boost/filesystem.hpp>
+#include <components/misc/stringops.hpp>
 
 namespace Files
 {
-    struct NameEqual
+    MultiDirCollection::MultiDirCollection(const Files::PathContainer& directories,
+        const std::string& extension, bool foldCase)
+    : mFoldCase (foldCase)
     {
-        bool mStrict;
-
-        NameEqual (bool strict) : mStrict (strict) {}
-
-        bool operator() (const std::string& left, const std::string& right) const
-        {
-            if (mStrict)
-                return left==right;
-
-            std::size_t len = left.length();
-
-            if (len!=right.length())
-                return false;
-
-            for (std::size_t i=0; i<len; ++i)
-            {
-                char l = Misc::StringUtils::toLower (left[i]);
-                char r = Misc::StringUtils::toLower (right[i]);
-
-                if (l!=r)
-                    return false;
-            }
+        add (DirectoryIndex (directories), extension);
+    }
 
-            return true;
-        }
-    };
+    MultiDirCollection::MultiDirCollection(const DirectoryIndex& index, const std::string& extension, bool foldCase)
+    : mFoldCase (foldCase)
+    {
+        add (index, extension);
+    }
 
-    MultiDirCollection::MultiDirCollection(const Files::PathContainer& directories,
-        const std::string& extension, bool foldCase)
-    : mFiles (NameLess (!foldCase))
+    void MultiDirCollection::add (const DirectoryIndex& index, const std::string& extension)
     {
-        NameEqual equal (!foldCase);
+        const std::vector<DirectoryIndex::Directory>& directories = index.getDirectories();
 
-        for (PathContainer::const_iterator iter = directories.begin();
+        for (std::vector<DirectoryIndex::Directory>::const_iterator iter = directories.begin();
             iter!=directories.end(); ++iter)
         {
-            if (!boost::filesystem::is_directory(*iter))
-            {
-                std::cout << "Skipping invalid directory: " << (*iter).string() << std::endl;
-                continue;
-            }
-
-            for (boost::filesystem::directory_iterator dirIter(*iter);
-                    dirIter != boost::filesystem::directory_iterator(); ++dirIter)
+            for (std::vector<std::string>::const_iterator file = iter->mFiles.begin(); file!=iter->mFiles.end(); ++file)
             {
-                boost::filesystem::path path = *dirIter;
+                std::string fileExtension = boost::filesystem::path (*file).extension().string();
 
-                if (!equal (extension, path.extension().string()))
+                if (mFoldCase ? !Misc::StringUtils::ciEqual (extension, fileExtension) : extension!=fileExtension)
                     continue;
 
-                std::string filename = path.filename().string();
-
-                TIter result = mFiles.find (filename);
-
-                if (result==mFiles.end())
-                {
-                    mFiles.insert (std::make_pair (filename, path));
-                }
-                else if (result->first==filename)
-                {
-                    mFiles[filename] = path;
-                }
-                else
-                {
-                    // handle case folding
-                    mFiles.erase (result->first);
-                    mFiles.insert (std::make_pair (filename, path));
-                }
+                // later directories have a higher priority
+                mFiles[getKey (*file)] = iter->mPath / *file;
             }
         }
     }
 
+    std::string MultiDirCollection::getKey (const std::string& file) const
+    {
+        return mFoldCase ? Misc::StringUtils::lowerCase (file) : file;
+    }
+
     boost::filesystem::path MultiDirCollection::getPath (const std::string& file) const
     {
-        TIter iter = mFiles.find (file);
+        TIter iter = mFiles.find (getKey (file));
 
         if (iter==mFiles.end())
             throw std::runtime_error ("file " + file + " not found");
@@ -92,7 +56,7 @@ namespace Files
 
     bool MultiDirCollection::doesExist (const std::string& file) const
     {
-        return mFiles.find (file)!=mFiles.end();
+        return mFiles.find (getKey (file))!=mFiles.end();
     }
 
     MultiDirCollection::TIter MultiDirCollection::begin() const
@@ -1,47 +1,18 @@
 #ifndef COMPONENTS_FILES_MULTIDIRSOLLECTION_HPP
 #define COMPONENTS_FILES_MULTIDIRSOLLECTION_HPP
 
-#include <map>
+#include <unordered_map>
 #include <vector>
 #include <string>
-#include <cctype>
 
 #include <boost/filesystem/path.hpp>
 
 #include <components/misc/stringops.hpp>
 
+#include "directoryindex.hpp"
+
 namespace Files
 {
-    typedef std::vector<boost::filesystem::path> PathContainer;
-
-    struct NameLess
-    {
-        bool mStrict;
-
-        NameLess (bool strict) : mStrict (strict) {}
-
-        bool operator() (const std::string& left, const std::string& right) const
-        {
-            if (mStrict)
-                return left<right;
-
-            std::size_t min = std::min (left.length(), right.length());
-
-            for (std::size_t i=0; i<min; ++i)
-            {
-                char l = Misc::StringUtils::toLower (left[i]);
-                char r = Misc::StringUtils::toLower (right[i]);
-
-                if (l<r)
-                    return true;
-                if (l>r)
-                    return false;
-            }
-
-            return left.length()<right.length();
-        }
-    };
-
     /// \brief File collection across several directories
     ///
     /// This class lists all files with one specific extensions within one or more
@@ -51,12 +22,18 @@ namespace Files
     {
         public:
 
-            typedef std::map<std::string, boost::filesystem::path, NameLess> TContainer;
+            /// File name (lower case if case is folded) -> path
+            typedef std::unordered_map<std::string, boost::filesystem::path> TContainer;
             typedef TContainer::const_iterator TIter;
 
         private:
 
             TContainer mFiles;
+            bool mFoldCase;
+
+            void add (const DirectoryIndex& index, const std::string& extension);
+
+            std::string getKey (const std::string& file) const;
 
         public:
 
@@ -67,6 +44,9 @@ namespace Files
             /// contain the leading dot.
             /// \param foldCase Ignore filename case
 
+            MultiDirCollection (const DirectoryIndex& index, const std::string& extension, bool foldCase);
+            ///< Same as the above, with the directories listed in \a index.
+
             boost::filesystem::path getPath (const std::string& file) const;
             ///< Return full path (including filename) of \a file.
             ///
@@ -0,0 +1,235 @@
+#ifndef MISC_PREFIXINDEX_H
+#define MISC_PREFIXINDEX_H
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "stringops.hpp"
+
+namespace Misc
+{
+    /// \brief ASCII case-insensitive order of std::strings for BasicPrefixIndex
+    ///
+    /// The lower case form of each string is stored as its key, so that comparisons don't
+    /// convert the strings again.
+    struct CiStringOrder
+    {
+        typedef std::string Key;
+
+        static Key makeKey (const std::string& value)
+        {
+            return StringUtils::lowerCase (value);
+        }
+
+        static int compare (const Key& left, const Key& right)
+        {
+            return left.compare (right);
+        }
+
+        static bool startsWith (const Key& key, const Key& prefix)
+        {
+            return key.compare (0, prefix.size(), prefix)==0;
+        }
+    };
+
+    /// \brief Case-insensitive index of strings for completion
+    ///
+    /// Strings are kept sorted case-insensitively, so that all strings starting with a prefix
+    /// form a single range that is found by binary search. Insertions are collected and merged
+    /// into the sorted array on the next query, so building the index from many strings
+    /// doesn't shift the array for every single one.
+    ///
+    /// \a Order defines the case-insensitive order. It provides a Key type, makeKey (value),
+    /// compare (key, key) returning <0, 0 or >0, and startsWith (key, prefixKey). Strings with
+    /// equal keys are ordered case-sensitively by String::operator<.
+    template<typename String, typename Order = CiStringOrder>
+    class BasicPrefixIndex
+    {
+            struct Entry
+            {
+                typename Order::Key mKey;
+                String mValue;
+
+                Entry() {}
+
+                Entry (const String& value) : mKey (Order::makeKey (value)), mValue (value) {}
+
+                bool operator< (const Entry& entry) const
+                {
+                    int result = Order::compare (mKey, entry.mKey);
+                    return result!=0 ? result<0 : mValue<entry.mValue;
+                }
+
+                bool operator== (const Entry& entry) const
+                {
+                    return mValue==entry.mValue;
+                }
+            };
+
+            struct KeyLess
+            {
+                bool operator() (const Entry& entry, const typename Order::Key& key) const
+                {
+                    return Order::compare (entry.mKey, key)<0;
+                }
+            };
+
+            mutable std::vector<Entry> mEntries;
+            mutable size_t mSorted; // number of entries at the front that are sorted and unique
+
+            void flush() const
+            {
+                if (mSorted==mEntries.size())
+                    return;
+
+                typename std::vector<Entry>::iterator middle = mEntries.begin()+mSorted;
+                std::sort (middle, mEntries.end());
+                std::inplace_merge (mEntries.begin(), middle, mEntries.end());
+
+                // Equal values have equal keys, so duplicates are adjacent after sorting
+                mEntries.erase (std::unique (mEntries.begin(), mEntries.end()), mEntries.end());
+
+                mSorted = mEntries.size();
+            }
+
+        public:
+
+            BasicPrefixIndex() : mSorted (0) {}
+
+            /// Add \a value, unless it is already present (compared case-sensitively).
+            void insert (const String& value)
+            {
+                mEntries.push_back (Entry (value));
+            }
+
+            /// Add all of \a values.
+            void insert (const std::vector<String>& values)
+            {
+                mEntries.reserve (mEntries.size()+values.size());
+
+                for (typename std::vector<String>::const_iterator iter (values.begin()); iter!=values.end(); ++iter)
+                    insert (*iter);
+            }
+
+            /// Remove \a value (compared case-sensitively).
+            /// \return Was \a value present?
+            bool remove (const String& value)
+            {
+                Entry entry (value);
+
+                // Pending insertions are not merged yet, so check them separately
+                typename std::vector<Entry>::iterator middle = mEntries.begin()+mSorted;
+                bool removed = false;
+
+                typename std::vector<Entry>::iterator pending = std::remove (middle, mEntries.end(), entry);
+                if (pending!=mEntries.end())
+                {
+                    mEntries.erase (pending, mEntries.end());
+                    removed = true;
+                }
+
+                middle = mEntries.begin()+mSorted;
+                typename std::vector<Entry>::iterator iter = std::lower_bound (mEntries.begin(), middle, entry);
+                if (iter!=middle && *iter==entry)
+                {
+                    mEntries.erase (iter);
+                    --mSorted;
+                    removed = true;
+                }
+
+                return removed;
+            }
+
+            /// Remove all of \a values in a single pass over the index.
+            void remove (const std::vector<String>& values)
+            {
+                flush();
+
+                std::vector<Entry> removed (values.begin(), values.end());
+                std::sort (removed.begin(), removed.end());
+
+                typename std::vector<Entry>::iterator end = mEntries.begin();
+                for (typename std::vector<Entry>::iterator iter (mEntries.begin()); iter!=mEntries.end(); ++iter)
+                    if (!std::binary_search (removed.begin(), removed.end(), *iter))
+                        *end++ = *iter;
+
+                mEntries.erase (end, mEntries.end());
+                mSorted = mEntries.size();
+            }
+
+            void clear()
+            {
+                mEntries.clear();
+                mSorted = 0;
+            }
+
+            bool empty() const
+            {
+                return mEntries.empty();
+            }
+
+            size_t size() const
+            {
+                flush();
+                return mEntries.size();
+            }
+
+            /// \return The string at \a index in case-insensitive order.
+            const String& get (size_t index) const
+            {
+                flush();
+
+                if (index>=mEntries.size())
+                    throw std::out_of_range ("prefix index out of range");
+
+                return mEntries[index].mValue;
+            }
+
+            /// \return Index of \a value, or of the position it would be inserted at.
+            size_t find (const String& value) const
+            {
+                flush();
+                return std::lower_bound (mEntries.begin(), mEntries.end(), Entry (value)) - mEntries.begin();
+            }
+
+            /// \return Index of the first string that doesn't compare case-insensitively less than
+            /// \a prefix, i.e. the first string starting with \a prefix if there is any.
+            size_t lowerBound (const String& prefix) const
+            {
+                flush();
+                return std::lower_bound (mEntries.begin(), mEntries.end(), Order::makeKey (prefix), KeyLess())
+                    - mEntries.begin();
+            }
+
+            /// Append all strings starting with \a prefix (case-insensitive) to \a out, sorted.
+            void findPrefix (const String& prefix, std::vector<String>& out) const
+            {
+                typename Order::Key key = Order::makeKey (prefix);
+
+                for (size_t i = lowerBound (prefix); i<mEntries.size(); ++i)
+                {
+                    if (!Order::startsWith (mEntries[i].mKey, key))
+                        break;
+
+                    out.push_back (mEntries[i].mValue);
+                }
+            }
+
+            /// Append all strings in case-insensitive order to \a out.
+            void getAll (std::vector<String>& out) const
+            {
+                flush();
+
+                out.reserve (out.size()+mEntries.size());
+
+                for (typename std::vector<Entry>::const_iterator iter (mEntries.begin()); iter!=mEntries.end(); ++iter)
+                    out.push_back (iter->mValue);
+            }
+    };
+
+    typedef BasicPrefixIndex<std::string> PrefixIndex;
+}
+
+#endif
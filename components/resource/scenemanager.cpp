@@ -3,6 +3,7 @@
 #include <iostream>
 #include <cstdlib>
 
+#include <osg/KdTree>
 #include <osg/Node>
 #include <osg/UserDataContainer>
 
@@ -228,6 +229,7 @@ namespace Resource
         , mMagFilter(osg::Texture::LINEAR)
         , mMaxAnisotropy(1)
         , mUnRefImageDataAfterApply(false)
+        , mBuildKdTrees(false)
         , mParticleSystemMask(~0u)
     {
     }
@@ -538,6 +540,13 @@ namespace Resource
                 optimizer.optimize(loaded, options);
             }
 
+            // after optimizing, so the trees are built for the merged geometry
+            if (mBuildKdTrees)
+            {
+                osg::KdTreeBuilder builder;
+                loaded->accept(builder);
+            }
+
             if (mIncrementalCompileOperation)
                 mIncrementalCompileOperation->add(loaded);
 
@@ -705,6 +714,16 @@ namespace Resource
         mUnRefImageDataAfterApply = unref;
     }
 
+    void SceneManager::setBuildKdTrees(bool build)
+    {
+        mBuildKdTrees = build;
+    }
+
+    bool SceneManager::getBuildKdTrees() const
+    {
+        return mBuildKdTrees;
+    }
+
     void SceneManager::updateCache(double referenceTime)
     {
         ResourceManager::updateCache(referenceTime);
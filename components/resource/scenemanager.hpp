@@ -137,6 +137,12 @@ namespace Resource
         /// the filter settings are applied automatically. This method is provided for textures that were created outside of the SceneManager.
         void applyFilterSettings (osg::Texture* tex);
 
+        /// Build kd-trees for the geometry of newly loaded templates, to speed up intersection tests (e.g. picking).
+        /// Instances share the geometry of their template, so the trees are built once per mesh.
+        /// @note Off by default, since the game does not intersect rendered geometry.
+        void setBuildKdTrees(bool build);
+        bool getBuildKdTrees() const;
+
         /// Keep a copy of the texture data around in system memory? This is needed when using multiple graphics contexts,
         /// otherwise should be disabled to reduce memory usage.
         void setUnRefImageDataAfterApply(bool unref);
@@ -174,6 +180,7 @@ namespace Resource
         osg::Texture::FilterMode mMagFilter;
         int mMaxAnisotropy;
         bool mUnRefImageDataAfterApply;
+        bool mBuildKdTrees;
 
         osg::ref_ptr<osgUtil::IncrementalCompileOperation> mIncrementalCompileOperation;
 
@@ -45,9 +45,9 @@ namespace SceneUtil
 
         virtual void apply(osg::Drawable& drawable)
         {
-            std::string lowerName = Misc::StringUtils::lowerCase(drawable.getName());
-            if ((lowerName.size() >= mFilter.size() && lowerName.compare(0, mFilter.size(), mFilter) == 0)
-                    || (lowerName.size() >= mFilter2.size() && lowerName.compare(0, mFilter2.size(), mFilter2) == 0))
+            const std::string& name = drawable.getName();
+            if ((name.size() >= mFilter.size() && Misc::StringUtils::ciCompareLen(name, mFilter, mFilter.size()) == 0)
+                    || (name.size() >= mFilter2.size() && Misc::StringUtils::ciCompareLen(name, mFilter2, mFilter2.size()) == 0))
             {
                 osg::Node* node = &drawable;
                 while (node && node->getNumParents() && !node->getStateSet())
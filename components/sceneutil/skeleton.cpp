@@ -13,8 +13,9 @@ namespace SceneUtil
 class InitBoneCacheVisitor : public osg::NodeVisitor
 {
 public:
-    InitBoneCacheVisitor(std::map<std::string, std::pair<osg::NodePath, osg::MatrixTransform*> >& cache)
+    InitBoneCacheVisitor(std::vector<Skeleton::BoneEntry>& table, std::unordered_map<std::string, int>& cache)
         : osg::NodeVisitor(TRAVERSE_ALL_CHILDREN)
+        , mTable(table)
         , mCache(cache)
     {
     }
@@ -25,12 +26,23 @@ public:
         if (!bone)
             return;
 
-        mCache[Misc::StringUtils::lowerCase(bone->getName())] = std::make_pair(getNodePath(), bone);
+        Skeleton::BoneEntry entry;
+        entry.mNode = bone;
+        entry.mParent = mParents.empty() ? -1 : mParents.back();
+        entry.mBone = NULL;
 
+        int index = static_cast<int>(mTable.size());
+        mTable.push_back(entry);
+        mCache[Misc::StringUtils::lowerCase(bone->getName())] = index;
+
+        mParents.push_back(index);
         traverse(node);
+        mParents.pop_back();
     }
 private:
-    std::map<std::string, std::pair<osg::NodePath, osg::MatrixTransform*> >& mCache;
+    std::vector<Skeleton::BoneEntry>& mTable;
+    std::unordered_map<std::string, int>& mCache;
+    std::vector<int> mParents;
 };
 
 Skeleton::Skeleton()
@@ -54,55 +66,75 @@ Skeleton::Skeleton(const Skeleton &copy, const osg::CopyOp &copyop)
 
 }
 
+void Skeleton::initBoneCache()
+{
+    InitBoneCacheVisitor visitor(mBoneTable, mBoneCache);
+    accept(visitor);
+    mBoneCacheInit = true;
+}
+
 Bone* Skeleton::getBone(const std::string &name)
+{
+    int index = getBoneIndex(name);
+    if (index == -1)
+        return NULL;
+
+    return getBone(index);
+}
+
+int Skeleton::getBoneIndex(const std::string &name)
 {
     if (!mBoneCacheInit)
-    {
-        InitBoneCacheVisitor visitor(mBoneCache);
-        accept(visitor);
-        mBoneCacheInit = true;
-    }
+        initBoneCache();
 
-    BoneCache::iterator found = mBoneCache.find(Misc::StringUtils::lowerCase(name));
+    BoneCache::const_iterator found = mBoneCache.find(Misc::StringUtils::lowerCase(name));
     if (found == mBoneCache.end())
-        return NULL;
+        return -1;
+
+    return found->second;
+}
+
+Bone* Skeleton::getBone(int index)
+{
+    if (!mBoneCacheInit)
+        initBoneCache();
+
+    BoneEntry& entry = mBoneTable.at(index);
+    if (entry.mBone)
+        return entry.mBone;
 
     // find or insert in the bone hierarchy
 
-    if (!mRootBone.get())
+    Bone* parent;
+    if (entry.mParent != -1)
+        parent = getBone(entry.mParent);
+    else
     {
-        mRootBone.reset(new Bone);
+        if (!mRootBone.get())
+            mRootBone.reset(new Bone);
+        parent = mRootBone.get();
     }
 
-    const osg::NodePath& path = found->second.first;
-    Bone* bone = mRootBone.get();
-    for (osg::NodePath::const_iterator it = path.begin(); it != path.end(); ++it)
+    // bones created before the skeleton was last marked dirty are reused
+    Bone* bone = NULL;
+    for (unsigned int i=0; i<parent->mChildren.size(); ++i)
     {
-        osg::MatrixTransform* matrixTransform = dynamic_cast<osg::MatrixTransform*>(*it);
-        if (!matrixTransform)
-            continue;
-
-        Bone* child = NULL;
-        for (unsigned int i=0; i<bone->mChildren.size(); ++i)
+        if (parent->mChildren[i]->mNode == entry.mNode)
         {
-            if (bone->mChildren[i]->mNode == *it)
-            {
-                child = bone->mChildren[i];
-                break;
-            }
+            bone = parent->mChildren[i];
+            break;
         }
+    }
 
-        if (!child)
-        {
-            child = new Bone;
-            bone->mChildren.push_back(child);
-            mNeedToUpdateBoneMatrices = true;
-        }
-        bone = child;
-
-        bone->mNode = matrixTransform;
+    if (!bone)
+    {
+        bone = new Bone;
+        bone->mNode = entry.mNode;
+        parent->mChildren.push_back(bone);
+        mNeedToUpdateBoneMatrices = true;
     }
 
+    entry.mBone = bone;
     return bone;
 }
 
@@ -138,6 +170,7 @@ bool Skeleton::getActive() const
 void Skeleton::markDirty()
 {
     mLastFrameNumber = 0;
+    mBoneTable.clear();
     mBoneCache.clear();
     mBoneCacheInit = false;
 }
@@ -4,6 +4,7 @@
 #include <osg/Group>
 
 #include <memory>
+#include <unordered_map>
 
 namespace SceneUtil
 {
@@ -44,6 +45,13 @@ namespace SceneUtil
         /// Retrieve a bone by name.
         Bone* getBone(const std::string& name);
 
+        /// Retrieve the index of a bone in the bone table, or -1 if there is no bone with this name.
+        /// @note Indices are only valid until the skeleton's children change.
+        int getBoneIndex(const std::string& name);
+
+        /// Retrieve a bone by its index in the bone table.
+        Bone* getBone(int index);
+
         /// Request an update of bone matrices. May be a no-op if already updated in this frame.
         void updateBoneMatrices(unsigned int traversalNumber);
 
@@ -72,7 +80,22 @@ namespace SceneUtil
         // As far as the scene graph goes we support multiple root bones.
         std::unique_ptr<Bone> mRootBone;
 
-        typedef std::map<std::string, std::pair<osg::NodePath, osg::MatrixTransform*> > BoneCache;
+        friend class InitBoneCacheVisitor;
+
+        /// A MatrixTransform below the skeleton, in traversal order.
+        struct BoneEntry
+        {
+            osg::MatrixTransform* mNode;
+            int mParent; ///< Index of the closest bone above this one, -1 if there is none.
+            Bone* mBone; ///< NULL until the bone is first requested.
+        };
+
+        void initBoneCache();
+
+        std::vector<BoneEntry> mBoneTable;
+
+        // <lower case bone name, index in mBoneTable>
+        typedef std::unordered_map<std::string, int> BoneCache;
         BoneCache mBoneCache;
         bool mBoneCacheInit;
 
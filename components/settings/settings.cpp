@@ -2,6 +2,7 @@
 
 #include <sstream>
 #include <iostream>
+#include <vector>
 
 #include <components/misc/stringops.hpp>
 
@@ -48,6 +49,22 @@ namespace
         return val ? "true" : "false";
     }
 
+    // Function-local statics, so that handles with static storage duration can register themselves
+    // regardless of static initialization order.
+    typedef std::multimap<Settings::CategorySetting, Settings::HandleBase*> HandleMap;
+    HandleMap& getHandles()
+    {
+        static HandleMap handles;
+        return handles;
+    }
+
+    typedef std::multimap<std::string, Settings::Listener*> ListenerMap;
+    ListenerMap& getListeners()
+    {
+        static ListenerMap listeners;
+        return listeners;
+    }
+
 }
 
 namespace Settings
@@ -356,18 +373,21 @@ void Manager::clear()
     mDefaultSettings.clear();
     mUserSettings.clear();
     mChangedSettings.clear();
+    markAllDirty();
 }
 
 void Manager::loadDefault(const std::string &file)
 {
     SettingsFileParser parser;
     parser.loadSettingsFile(file, mDefaultSettings);
+    markAllDirty();
 }
 
 void Manager::loadUser(const std::string &file)
 {
     SettingsFileParser parser;
     parser.loadSettingsFile(file, mUserSettings);
+    markAllDirty();
 }
 
 void Manager::saveUser(const std::string &file)
@@ -420,6 +440,17 @@ void Manager::setString(const std::string &setting, const std::string &category,
     mUserSettings[key] = value;
 
     mChangedSettings.insert(key);
+
+    markDirty(key);
+
+    // Copy the interested listeners first, a listener may (un)register others while being notified
+    std::vector<Listener*> listeners;
+    const ListenerMap& listenerMap = getListeners();
+    for (ListenerMap::const_iterator it = listenerMap.begin(); it != listenerMap.end(); ++it)
+        if (it->first.empty() || it->first == category)
+            listeners.push_back(it->second);
+    for (std::vector<Listener*>::iterator it = listeners.begin(); it != listeners.end(); ++it)
+        (*it)->settingChanged(setting, category);
 }
 
 void Manager::setInt (const std::string& setting, const std::string& category, const int value)
@@ -444,4 +475,108 @@ const CategorySettingVector Manager::apply()
     return vec;
 }
 
+template <>
+int Manager::get<int> (const std::string& setting, const std::string& category)
+{
+    return getInt(setting, category);
+}
+
+template <>
+float Manager::get<float> (const std::string& setting, const std::string& category)
+{
+    return getFloat(setting, category);
+}
+
+template <>
+bool Manager::get<bool> (const std::string& setting, const std::string& category)
+{
+    return getBool(setting, category);
+}
+
+template <>
+std::string Manager::get<std::string> (const std::string& setting, const std::string& category)
+{
+    return getString(setting, category);
+}
+
+void Manager::addListener(Listener *listener, const std::string &category)
+{
+    getListeners().insert(std::make_pair(category, listener));
+}
+
+void Manager::removeListener(Listener *listener)
+{
+    ListenerMap& listeners = getListeners();
+    for (ListenerMap::iterator it = listeners.begin(); it != listeners.end();)
+    {
+        if (it->second == listener)
+            listeners.erase(it++);
+        else
+            ++it;
+    }
+}
+
+void Manager::registerHandle(HandleBase *handle)
+{
+    getHandles().insert(std::make_pair(handle->mKey, handle));
+}
+
+void Manager::unregisterHandle(HandleBase *handle)
+{
+    HandleMap& handles = getHandles();
+    std::pair<HandleMap::iterator, HandleMap::iterator> range = handles.equal_range(handle->mKey);
+    for (HandleMap::iterator it = range.first; it != range.second; ++it)
+    {
+        if (it->second == handle)
+        {
+            handles.erase(it);
+            return;
+        }
+    }
+}
+
+void Manager::markDirty(const CategorySetting &key)
+{
+    HandleMap& handles = getHandles();
+    std::pair<HandleMap::iterator, HandleMap::iterator> range = handles.equal_range(key);
+    for (HandleMap::iterator it = range.first; it != range.second; ++it)
+        it->second->mDirty = true;
+}
+
+void Manager::markAllDirty()
+{
+    HandleMap& handles = getHandles();
+    for (HandleMap::iterator it = handles.begin(); it != handles.end(); ++it)
+        it->second->mDirty = true;
+}
+
+HandleBase::HandleBase(const std::string &setting, const std::string &category)
+    : mKey(category, setting), mDirty(true)
+{
+    Manager::registerHandle(this);
+}
+
+HandleBase::HandleBase(const HandleBase &other)
+    : mKey(other.mKey), mDirty(true)
+{
+    Manager::registerHandle(this);
+}
+
+HandleBase::~HandleBase()
+{
+    Manager::unregisterHandle(this);
+}
+
+HandleBase& HandleBase::operator=(const HandleBase &other)
+{
+    if (this != &other)
+    {
+        Manager::unregisterHandle(this);
+        mKey = other.mKey;
+        mDirty = true;
+        Manager::registerHandle(this);
+    }
+    return *this;
+}
+
 }
@@ -11,6 +11,19 @@ namespace Settings
     typedef std::set< std::pair<std::string, std::string> > CategorySettingVector;
     typedef std::map < CategorySetting, std::string > CategorySettingValueMap;
 
+    class HandleBase;
+
+    ///
+    /// \brief Interface for subsystems that want to react to setting changes as soon as they are made
+    ///
+    class Listener
+    {
+    public:
+        virtual ~Listener() {}
+
+        virtual void settingChanged (const std::string& setting, const std::string& category) = 0;
+    };
+
     ///
     /// \brief Settings management (can change during runtime)
     ///
@@ -47,6 +60,81 @@ namespace Settings
         static void setFloat (const std::string& setting, const std::string& category, const float value);
         static void setString (const std::string& setting, const std::string& category, const std::string& value);
         static void setBool (const std::string& setting, const std::string& category, const bool value);
+
+        template <typename T>
+        static T get (const std::string& setting, const std::string& category);
+        ///< typed access, specialized for int, float, bool and std::string
+
+        static void addListener (Listener* listener, const std::string& category);
+        ///< notify \a listener of every change in \a category, or of every change at all if \a category is empty
+
+        static void removeListener (Listener* listener);
+
+        static void registerHandle (HandleBase* handle);
+        static void unregisterHandle (HandleBase* handle);
+
+    private:
+        static void markDirty (const CategorySetting& key);
+        static void markAllDirty();
+    };
+
+    template <> int Manager::get<int> (const std::string& setting, const std::string& category);
+    template <> float Manager::get<float> (const std::string& setting, const std::string& category);
+    template <> bool Manager::get<bool> (const std::string& setting, const std::string& category);
+    template <> std::string Manager::get<std::string> (const std::string& setting, const std::string& category);
+
+    ///
+    /// \brief Registration and dirty state shared by all typed setting handles
+    ///
+    class HandleBase
+    {
+    public:
+        HandleBase (const std::string& setting, const std::string& category);
+        HandleBase (const HandleBase& other);
+        virtual ~HandleBase();
+
+        HandleBase& operator= (const HandleBase& other);
+
+        const std::string& getSetting() const { return mKey.second; }
+        const std::string& getCategory() const { return mKey.first; }
+
+        bool isDirty() const { return mDirty; }
+
+    protected:
+        CategorySetting mKey;
+        mutable bool mDirty;
+
+        friend class Manager;
+    };
+
+    ///
+    /// \brief Cached, typed view of a single setting
+    ///
+    /// The value string is parsed on first access and then only after the Manager marks the handle dirty, i.e.
+    /// when the setting was changed through Manager::set* or the settings files were (re)loaded. User settings
+    /// take precedence over the defaults, same as for Manager::get*.
+    /// \note Not thread-safe; the Manager itself is not either.
+    ///
+    template <typename T>
+    class Handle : public HandleBase
+    {
+    public:
+        Handle (const std::string& setting, const std::string& category)
+            : HandleBase(setting, category), mValue()
+        {}
+
+        const T& get() const
+        {
+            if (mDirty)
+            {
+                mValue = Manager::get<T>(mKey.second, mKey.first);
+                mDirty = false;
+            }
+            return mValue;
+        }
+
+    private:
+        mutable T mValue;
     };
 
 }
@@ -0,0 +1,45 @@
+#include "blendmappacker.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace Terrain
+{
+
+    void packBlendmaps(const std::vector<osg::ref_ptr<osg::Image> >& blendmaps, std::vector<osg::ref_ptr<osg::Image> >& packed)
+    {
+        packed.clear();
+
+        if (blendmaps.empty())
+            return;
+
+        const int width = blendmaps.front()->s();
+        const int height = blendmaps.front()->t();
+        const unsigned int numTexels = width * height;
+
+        for (unsigned int i=0; i<blendmaps.size(); ++i)
+        {
+            const osg::Image* blendmap = blendmaps[i].get();
+            if (blendmap->getPixelFormat() != GL_ALPHA || blendmap->getDataType() != GL_UNSIGNED_BYTE)
+                throw std::runtime_error("Can't pack blendmap: unsupported format");
+            if (blendmap->s() != width || blendmap->t() != height || blendmap->r() != 1)
+                throw std::runtime_error("Can't pack blendmaps of different sizes");
+
+            unsigned int channel = i % sLayersPerPackedBlendmap;
+
+            if (channel == 0)
+            {
+                osg::ref_ptr<osg::Image> image (new osg::Image);
+                image->allocateImage(width, height, 1, GL_RGBA, GL_UNSIGNED_BYTE);
+                std::memset(image->data(), 0, numTexels*4);
+                packed.push_back(image);
+            }
+
+            const unsigned char* source = blendmap->data();
+            unsigned char* target = packed.back()->data() + channel;
+            for (unsigned int texel=0; texel<numTexels; ++texel)
+                target[texel*4] = source[texel];
+        }
+    }
+
+}
@@ -0,0 +1,27 @@
+#ifndef COMPONENTS_TERRAIN_BLENDMAPPACKER_H
+#define COMPONENTS_TERRAIN_BLENDMAPPACKER_H
+
+#include <vector>
+
+#include <osg/ref_ptr>
+#include <osg/Image>
+
+namespace Terrain
+{
+
+    /// Number of layers whose blend values fit into one packed blendmap.
+    const unsigned int sLayersPerPackedBlendmap = 4;
+
+    /// @brief Pack blendmaps as created for multipass rendering into the channels of RGBA images, so that
+    /// a shader can splat up to sLayersPerPackedBlendmap layers from a single texture.
+    /// @param blendmaps one GL_ALPHA blendmap per blended layer, in splatting order. All blendmaps must be of
+    ///        the same size.
+    /// @param packed the packed blendmaps will be written here. The blend values of layer i (the base layer
+    ///        being layer 0) are in channel (i-1)%4 of blendmap (i-1)/4, the same layout as
+    ///        Storage::getBlendmaps with packing enabled. Channels that don't belong to a layer are set to 0.
+    /// @note Thread safe.
+    void packBlendmaps(const std::vector<osg::ref_ptr<osg::Image> >& blendmaps, std::vector<osg::ref_ptr<osg::Image> >& packed);
+
+}
+
+#endif
@@ -2,6 +2,7 @@
 
 #include <sstream>
 
+#include <osg/KdTree>
 #include <osg/Texture2D>
 
 #include <osgUtil/IncrementalCompileOperation>
@@ -13,6 +14,7 @@
 #include <components/sceneutil/lightmanager.hpp>
 
 #include "terraindrawable.hpp"
+#include "blendmappacker.hpp"
 #include "material.hpp"
 #include "storage.hpp"
 #include "texturemanager.hpp"
@@ -118,16 +120,34 @@ void ChunkManager::createCompositeMapGeometry(float chunkSize, const osg::Vec2f&
     }
 }
 
-std::vector<osg::ref_ptr<osg::StateSet> > ChunkManager::createPasses(float chunkSize, const osg::Vec2f &chunkCenter, bool forCompositeMap)
+namespace
 {
-    std::vector<LayerInfo> layerList;
-    std::vector<osg::ref_ptr<osg::Image> > blendmaps;
-    mStorage->getBlendmaps(chunkSize, chunkCenter, false, blendmaps, layerList);
+    std::vector<osg::ref_ptr<osg::Texture2D> > createBlendmapTextures(const std::vector<osg::ref_ptr<osg::Image> >& blendmaps)
+    {
+        std::vector<osg::ref_ptr<osg::Texture2D> > blendmapTextures;
+        for (std::vector<osg::ref_ptr<osg::Image> >::const_iterator it = blendmaps.begin(); it != blendmaps.end(); ++it)
+        {
+            osg::ref_ptr<osg::Texture2D> texture (new osg::Texture2D);
+            texture->setImage(*it);
+            texture->setWrap(osg::Texture::WRAP_S, osg::Texture::CLAMP_TO_EDGE);
+            texture->setWrap(osg::Texture::WRAP_T, osg::Texture::CLAMP_TO_EDGE);
+            texture->setResizeNonPowerOfTwoHint(false);
+            blendmapTextures.push_back(texture);
+        }
+        return blendmapTextures;
+    }
+}
 
+std::vector<osg::ref_ptr<osg::StateSet> > ChunkManager::createPasses(float chunkSize, const osg::Vec2f &chunkCenter, bool forCompositeMap)
+{
     bool useShaders = mSceneManager->getForceShaders();
     if (!mSceneManager->getClampLighting())
         useShaders = true; // always use shaders when lighting is unclamped, this is to avoid lighting seams between a terrain chunk with normal maps and one without normal maps
 
+    std::vector<LayerInfo> layerList;
+    std::vector<osg::ref_ptr<osg::Image> > blendmaps;
+    mStorage->getBlendmaps(chunkSize, chunkCenter, false, blendmaps, layerList);
+
     std::vector<TextureLayer> layers;
     {
         for (std::vector<LayerInfo>::const_iterator it = layerList.begin(); it != layerList.end(); ++it)
@@ -151,18 +171,23 @@ std::vector<osg::ref_ptr<osg::StateSet> > ChunkManager::createPasses(float chunk
     if (forCompositeMap)
         useShaders = false;
 
-    std::vector<osg::ref_ptr<osg::Texture2D> > blendmapTextures;
-    for (std::vector<osg::ref_ptr<osg::Image> >::const_iterator it = blendmaps.begin(); it != blendmaps.end(); ++it)
+    float blendmapScale = mStorage->getBlendmapScale(chunkSize);
+
+    // Splat all layers in one pass where possible, so the chunk isn't drawn once per layer. The per-layer
+    // blendmaps are kept for createPasses, in case the shader of the single pass is unavailable.
+    if (useShaders && canUseSinglePass(layers))
     {
-        osg::ref_ptr<osg::Texture2D> texture (new osg::Texture2D);
-        texture->setImage(*it);
-        texture->setWrap(osg::Texture::WRAP_S, osg::Texture::CLAMP_TO_EDGE);
-        texture->setWrap(osg::Texture::WRAP_T, osg::Texture::CLAMP_TO_EDGE);
-        texture->setResizeNonPowerOfTwoHint(false);
-        blendmapTextures.push_back(texture);
+        std::vector<osg::ref_ptr<osg::Image> > packedBlendmaps;
+        packBlendmaps(blendmaps, packedBlendmaps);
+
+        std::vector<osg::ref_ptr<osg::StateSet> > passes = ::Terrain::createSinglePass(mSceneManager->getForcePerPixelLighting(),
+                                     mSceneManager->getClampLighting(), &mSceneManager->getShaderManager(), layers,
+                                     createBlendmapTextures(packedBlendmaps), blendmapScale, blendmapScale);
+        if (!passes.empty())
+            return passes;
     }
 
-    float blendmapScale = mStorage->getBlendmapScale(chunkSize);
+    std::vector<osg::ref_ptr<osg::Texture2D> > blendmapTextures = createBlendmapTextures(blendmaps);
 
     return ::Terrain::createPasses(useShaders, mSceneManager->getForcePerPixelLighting(),
                                      mSceneManager->getClampLighting(), &mSceneManager->getShaderManager(), layers, blendmapTextures, blendmapScale, blendmapScale);
@@ -228,6 +253,13 @@ osg::ref_ptr<osg::Node> ChunkManager::createChunk(float chunkSize, const osg::Ve
         geometry->setPasses(createPasses(chunkSize, chunkCenter, false));
     }
 
+    // chunks are cached like the templates of the scene manager, so the tree is built once per chunk
+    if (mSceneManager->getBuildKdTrees())
+    {
+        osg::KdTreeBuilder builder;
+        geometry->accept(builder);
+    }
+
     transform->addChild(geometry);
 
     if (!mCullingActive)
@@ -1,5 +1,6 @@
 #include "material.hpp"
 
+#include <sstream>
 #include <stdexcept>
 
 #include <osg/Depth>
@@ -10,6 +11,8 @@
 
 #include <components/shader/shadermanager.hpp>
 
+#include "blendmappacker.hpp"
+
 
 namespace Terrain
 {
@@ -57,6 +60,79 @@ namespace Terrain
         return depth;
     }
 
+    void addPackedLayerDefines(Shader::ShaderManager::DefineMap& defineMap, unsigned int numLayers)
+    {
+        std::ostringstream stream;
+        stream << numLayers;
+        defineMap["packedLayers"] = stream.str();
+    }
+
+    bool canUseSinglePass(const std::vector<TextureLayer>& layers)
+    {
+        if (layers.size() < 2 || layers.size() > sLayersPerPackedBlendmap+1)
+            return false;
+
+        for (std::vector<TextureLayer>::const_iterator it = layers.begin(); it != layers.end(); ++it)
+        {
+            if (it->mNormalMap || it->mSpecular)
+                return false;
+        }
+        return true;
+    }
+
+    std::vector<osg::ref_ptr<osg::StateSet> > createSinglePass(bool forcePerPixelLighting, bool clampLighting, Shader::ShaderManager* shaderManager,
+                                                               const std::vector<TextureLayer>& layers,
+                                                               const std::vector<osg::ref_ptr<osg::Texture2D> >& packedBlendmaps, int blendmapScale, float layerTileSize)
+    {
+        std::vector<osg::ref_ptr<osg::StateSet> > passes;
+
+        if (!canUseSinglePass(layers) || packedBlendmaps.size() != 1)
+            return passes;
+
+        osg::ref_ptr<osg::StateSet> stateset (new osg::StateSet);
+
+        // Same texture units as the passes of createPasses, so the shader uses the same texture matrices
+        stateset->setTextureAttributeAndModes(0, layers.front().mDiffuseMap);
+        if (layerTileSize != 1.f)
+            stateset->setTextureAttributeAndModes(0, getLayerTexMat(layerTileSize), osg::StateAttribute::ON);
+        stateset->addUniform(new osg::Uniform("diffuseMap", 0));
+
+        stateset->setTextureAttributeAndModes(1, packedBlendmaps.front().get());
+        stateset->setTextureAttributeAndModes(1, getBlendmapTexMat(blendmapScale));
+        stateset->addUniform(new osg::Uniform("blendMap", 1));
+
+        for (unsigned int i=1; i<layers.size(); ++i)
+        {
+            int texunit = i+1;
+            stateset->setTextureAttributeAndModes(texunit, layers[i].mDiffuseMap);
+
+            std::ostringstream name;
+            name << "diffuseMap" << i;
+            stateset->addUniform(new osg::Uniform(name.str().c_str(), texunit));
+        }
+
+        Shader::ShaderManager::DefineMap defineMap;
+        defineMap["forcePPL"] = forcePerPixelLighting ? "1" : "0";
+        defineMap["clamp"] = clampLighting ? "1" : "0";
+        defineMap["normalMap"] = "0";
+        defineMap["blendMap"] = "0";
+        defineMap["colorMode"] = "2";
+        defineMap["specularMap"] = "0";
+        defineMap["parallax"] = "0";
+        addPackedLayerDefines(defineMap, layers.size());
+
+        osg::ref_ptr<osg::Shader> vertexShader = shaderManager->getShader("terrain_vertex.glsl", defineMap, osg::Shader::VERTEX);
+        osg::ref_ptr<osg::Shader> fragmentShader = shaderManager->getShader("terrain_fragment.glsl", defineMap, osg::Shader::FRAGMENT);
+        if (!vertexShader || !fragmentShader)
+            return passes;
+
+        stateset->setAttributeAndModes(shaderManager->getProgram(vertexShader, fragmentShader));
+        stateset->setRenderBinDetails(0, "RenderBin");
+
+        passes.push_back(stateset);
+        return passes;
+    }
+
     std::vector<osg::ref_ptr<osg::StateSet> > createPasses(bool useShaders, bool forcePerPixelLighting, bool clampLighting, Shader::ShaderManager* shaderManager, const std::vector<TextureLayer> &layers,
                                                            const std::vector<osg::ref_ptr<osg::Texture2D> > &blendmaps, int blendmapScale, float layerTileSize)
     {
@@ -112,6 +188,7 @@ namespace Terrain
                 defineMap["colorMode"] = "2";
                 defineMap["specularMap"] = it->mSpecular ? "1" : "0";
                 defineMap["parallax"] = (it->mNormalMap && it->mParallax) ? "1" : "0";
+                addPackedLayerDefines(defineMap, 0);
 
                 osg::ref_ptr<osg::Shader> vertexShader = shaderManager->getShader("terrain_vertex.glsl", defineMap, osg::Shader::VERTEX);
                 osg::ref_ptr<osg::Shader> fragmentShader = shaderManager->getShader("terrain_fragment.glsl", defineMap, osg::Shader::FRAGMENT);
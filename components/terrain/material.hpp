@@ -30,6 +30,19 @@ namespace Terrain
                                                            const std::vector<TextureLayer>& layers,
                                                            const std::vector<osg::ref_ptr<osg::Texture2D> >& blendmaps, int blendmapScale, float layerTileSize);
 
+    /// @brief Can @a layers be splatted in a single pass by createSinglePass?
+    /// @note Layers with normal or specular maps are only supported by the passes of createPasses.
+    bool canUseSinglePass(const std::vector<TextureLayer>& layers);
+
+    /// @brief Create a single shader pass that splats all @a layers at once.
+    /// @param packedBlendmaps the blendmaps as created by packBlendmaps (or Storage::getBlendmaps with packing
+    ///        enabled), i.e. the blend values of layer i are in channel (i-1)%4 of blendmap (i-1)/4.
+    /// @return the pass, or no passes if the layers are not supported or the shaders are unavailable.
+    ///         createPasses should be used instead in that case.
+    std::vector<osg::ref_ptr<osg::StateSet> > createSinglePass(bool forcePerPixelLighting, bool clampLighting, Shader::ShaderManager* shaderManager,
+                                                               const std::vector<TextureLayer>& layers,
+                                                               const std::vector<osg::ref_ptr<osg::Texture2D> >& packedBlendmaps, int blendmapScale, float layerTileSize);
+
 }
 
 #endif
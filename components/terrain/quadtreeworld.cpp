@@ -292,48 +292,8 @@ void traverseToCell(QuadTreeNode* node, ViewData* vd, int cellX, int cellY)
     }
 }
 
-unsigned int getLodFlags(QuadTreeNode* node, int ourLod, ViewData* vd)
+void loadRenderingNode(ViewData::Entry& entry, ChunkManager* chunkManager)
 {
-    unsigned int lodFlags = 0;
-    for (unsigned int i=0; i<4; ++i)
-    {
-        QuadTreeNode* neighbour = node->getNeighbour(static_cast<Direction>(i));
-
-        // If the neighbour isn't currently rendering itself,
-        // go up until we find one. NOTE: We don't need to go down,
-        // because in that case neighbour's detail would be higher than
-        // our detail and the neighbour would handle stitching by itself.
-        while (neighbour && !vd->contains(neighbour))
-            neighbour = neighbour->getParent();
-        int lod = 0;
-        if (neighbour)
-            lod = Log2(int(neighbour->getSize()));
-
-        if (lod <= ourLod) // We only need to worry about neighbours less detailed than we are -
-            lod = 0;         // neighbours with more detail will do the stitching themselves
-        // Use 4 bits for each LOD delta
-        if (lod > 0)
-        {
-            lodFlags |= static_cast<unsigned int>(lod - ourLod) << (4*i);
-        }
-    }
-    return lodFlags;
-}
-
-void loadRenderingNode(ViewData::Entry& entry, ViewData* vd, ChunkManager* chunkManager)
-{
-    if (vd->hasChanged())
-    {
-        // have to recompute the lodFlags in case a neighbour has changed LOD.
-        int ourLod = Log2(int(entry.mNode->getSize()));
-        unsigned int lodFlags = getLodFlags(entry.mNode, ourLod, vd);
-        if (lodFlags != entry.mLodFlags)
-        {
-            entry.mRenderingNode = NULL;
-            entry.mLodFlags = lodFlags;
-        }
-    }
-
     if (!entry.mRenderingNode)
     {
         int ourLod = Log2(int(entry.mNode->getSize()));
@@ -367,11 +327,13 @@ void QuadTreeWorld::accept(osg::NodeVisitor &nv)
     else
         mRootNode->traverse(nv);
 
+    vd->updateLodFlags();
+
     for (unsigned int i=0; i<vd->getNumEntries(); ++i)
     {
         ViewData::Entry& entry = vd->getEntry(i);
 
-        loadRenderingNode(entry, vd, mChunkManager.get());
+        loadRenderingNode(entry, mChunkManager.get());
 
         if (entry.mVisible)
         {
@@ -425,10 +387,12 @@ void QuadTreeWorld::cacheCell(View *view, int x, int y)
     ViewData* vd = static_cast<ViewData*>(view);
     traverseToCell(mRootNode.get(), vd, x, y);
 
+    vd->updateLodFlags();
+
     for (unsigned int i=0; i<vd->getNumEntries(); ++i)
     {
         ViewData::Entry& entry = vd->getEntry(i);
-        loadRenderingNode(entry, vd, mChunkManager.get());
+        loadRenderingNode(entry, mChunkManager.get());
     }
 }
 
@@ -444,10 +408,12 @@ void QuadTreeWorld::preload(View *view, const osg::Vec3f &eyePoint)
     ViewData* vd = static_cast<ViewData*>(view);
     traverse(mRootNode.get(), vd, NULL, mRootNode->getLodCallback(), eyePoint, false);
 
+    vd->updateLodFlags();
+
     for (unsigned int i=0; i<vd->getNumEntries(); ++i)
     {
         ViewData::Entry& entry = vd->getEntry(i);
-        loadRenderingNode(entry, vd, mChunkManager.get());
+        loadRenderingNode(entry, mChunkManager.get());
     }
 }
 
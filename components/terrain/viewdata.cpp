@@ -1,5 +1,76 @@
 #include "viewdata.hpp"
 
+#include <algorithm>
+
+#include "quadtreenode.hpp"
+
+namespace
+{
+
+    int Log2( unsigned int n )
+    {
+        int targetlevel = 0;
+        while (n >>= 1) ++targetlevel;
+        return targetlevel;
+    }
+
+    unsigned int getLodFlags(Terrain::QuadTreeNode* node, int ourLod, const Terrain::ViewData& vd)
+    {
+        unsigned int lodFlags = 0;
+        for (unsigned int i=0; i<4; ++i)
+        {
+            Terrain::QuadTreeNode* neighbour = node->getNeighbour(static_cast<Terrain::Direction>(i));
+
+            // If the neighbour isn't currently rendering itself,
+            // go up until we find one. NOTE: We don't need to go down,
+            // because in that case neighbour's detail would be higher than
+            // our detail and the neighbour would handle stitching by itself.
+            while (neighbour && !vd.contains(neighbour))
+                neighbour = neighbour->getParent();
+            int lod = 0;
+            if (neighbour)
+                lod = Log2(int(neighbour->getSize()));
+
+            if (lod <= ourLod) // We only need to worry about neighbours less detailed than we are -
+                lod = 0;         // neighbours with more detail will do the stitching themselves
+            // Use 4 bits for each LOD delta
+            if (lod > 0)
+            {
+                lodFlags |= static_cast<unsigned int>(lod - ourLod) << (4*i);
+            }
+        }
+        return lodFlags;
+    }
+
+    /// Mark the entries for @a node or its descendants along its @a side as dirty.
+    void markBorderEntries(Terrain::QuadTreeNode* node, Terrain::Direction side, Terrain::ViewData& vd)
+    {
+        if (!node->hasValidBounds())
+            return;
+
+        if (Terrain::ViewData::Entry* entry = vd.findEntry(node))
+        {
+            entry->mLodFlagsDirty = true;
+            return;
+        }
+
+        if (!node->getNumChildren())
+            return;
+
+        const Terrain::ChildDirection children[4][2] =
+        {
+            { Terrain::NW, Terrain::NE }, // N
+            { Terrain::NE, Terrain::SE }, // E
+            { Terrain::SW, Terrain::SE }, // S
+            { Terrain::NW, Terrain::SW }  // W
+        };
+
+        for (unsigned int i=0; i<2; ++i)
+            markBorderEntries(node->getChild(children[side][i]), side, vd);
+    }
+
+}
+
 namespace Terrain
 {
 
@@ -27,6 +98,8 @@ void ViewData::add(QuadTreeNode *node, bool visible)
     Entry& entry = mEntries[index];
     if (entry.set(node, visible))
         mChanged = true;
+
+    mIndex.insert(node, index);
 }
 
 unsigned int ViewData::getNumEntries() const
@@ -39,6 +112,73 @@ ViewData::Entry &ViewData::getEntry(unsigned int i)
     return mEntries[i];
 }
 
+ViewData::Entry *ViewData::findEntry(QuadTreeNode *node)
+{
+    int index = mIndex.find(node);
+    return index == -1 ? NULL : &mEntries[index];
+}
+
+void ViewData::getChangedNodes(std::vector<QuadTreeNode *> &out) const
+{
+    const std::vector<QuadTreeNode*>& nodes = mIndex.getNodes();
+    const std::vector<QuadTreeNode*>& previousNodes = mPreviousIndex.getNodes();
+
+    // No entry changed, so the nodes are a prefix of the previous nodes
+    if (!mChanged && nodes.size() == previousNodes.size())
+        return;
+
+    for (std::vector<QuadTreeNode*>::const_iterator it = nodes.begin(); it != nodes.end(); ++it)
+        if (mPreviousIndex.find(*it) == -1)
+            out.push_back(*it);
+
+    for (std::vector<QuadTreeNode*>::const_iterator it = previousNodes.begin(); it != previousNodes.end(); ++it)
+        if (mIndex.find(*it) == -1)
+            out.push_back(*it);
+}
+
+void ViewData::updateLodFlags()
+{
+    // A node that appeared or disappeared changes the LOD next to it, so only the entries along its border
+    // (and the entries showing a different node than before) have to recompute their flags.
+    std::vector<QuadTreeNode*> changedNodes;
+    getChangedNodes(changedNodes);
+
+    for (std::vector<QuadTreeNode*>::const_iterator it = changedNodes.begin(); it != changedNodes.end(); ++it)
+    {
+        for (unsigned int i=0; i<4; ++i)
+        {
+            QuadTreeNode* neighbour = (*it)->getNeighbour(static_cast<Direction>(i));
+            if (!neighbour)
+                continue;
+
+            // A less detailed node covering the neighbour stitches to a node of its own size, not to this one
+            bool covered = false;
+            for (QuadTreeNode* parent = neighbour->getParent(); parent && !covered; parent = parent->getParent())
+                covered = contains(parent);
+
+            if (!covered)
+                markBorderEntries(neighbour, static_cast<Direction>((i+2)%4), *this);
+        }
+    }
+
+    for (unsigned int i=0; i<mNumEntries; ++i)
+    {
+        Entry& entry = mEntries[i];
+        if (!entry.mLodFlagsDirty)
+            continue;
+
+        int ourLod = Log2(int(entry.mNode->getSize()));
+        unsigned int lodFlags = getLodFlags(entry.mNode, ourLod, *this);
+        if (lodFlags != entry.mLodFlags)
+        {
+            // have to rebuild the chunk for the new stitching
+            entry.mRenderingNode = NULL;
+            entry.mLodFlags = lodFlags;
+        }
+        entry.mLodFlagsDirty = false;
+    }
+}
+
 bool ViewData::hasChanged() const
 {
     return mChanged;
@@ -70,6 +210,9 @@ void ViewData::reset(unsigned int frame)
     mNumEntries = 0;
     mChanged = false;
 
+    std::swap(mIndex, mPreviousIndex);
+    mIndex.clear();
+
     mFrameLastUsed = frame;
 }
 
@@ -80,20 +223,86 @@ void ViewData::clear()
     mNumEntries = 0;
     mFrameLastUsed = 0;
     mChanged = false;
+    mIndex.clear();
+    mPreviousIndex.clear();
 }
 
-bool ViewData::contains(QuadTreeNode *node)
+bool ViewData::contains(QuadTreeNode *node) const
 {
-    for (unsigned int i=0; i<mNumEntries; ++i)
-        if (mEntries[i].mNode == node)
-            return true;
-    return false;
+    return mIndex.find(node) != -1;
+}
+
+ViewData::NodeIndex::NodeIndex()
+{
+
+}
+
+void ViewData::NodeIndex::insert(QuadTreeNode *node, unsigned int index)
+{
+    if ((mNodes.size()+1)*2 > mSlots.size())
+        grow();
+
+    Slot& slot = mSlots[getSlot(node)];
+    if (slot.mNode == node)
+        return;
+
+    slot.mNode = node;
+    slot.mIndex = index;
+    mNodes.push_back(node);
+}
+
+int ViewData::NodeIndex::find(QuadTreeNode *node) const
+{
+    if (mSlots.empty())
+        return -1;
+
+    const Slot& slot = mSlots[getSlot(node)];
+    return slot.mNode == node ? static_cast<int>(slot.mIndex) : -1;
+}
+
+void ViewData::NodeIndex::clear()
+{
+    if (mNodes.empty())
+        return;
+
+    Slot empty = { NULL, 0 };
+    std::fill(mSlots.begin(), mSlots.end(), empty);
+    mNodes.clear();
+}
+
+size_t ViewData::NodeIndex::getSlot(QuadTreeNode *node) const
+{
+    // Nodes are heap allocated, so the lowest bits of their addresses carry no information
+    size_t hash = reinterpret_cast<size_t>(node);
+    hash ^= hash >> 16;
+    hash *= 0x45d9f3b;
+    hash ^= hash >> 16;
+
+    // Linear probing, ends at the node or at an empty slot
+    size_t mask = mSlots.size() - 1;
+    size_t slot = hash & mask;
+    while (mSlots[slot].mNode && mSlots[slot].mNode != node)
+        slot = (slot + 1) & mask;
+    return slot;
+}
+
+void ViewData::NodeIndex::grow()
+{
+    std::vector<Slot> slots;
+    Slot empty = { NULL, 0 };
+    slots.resize(std::max<size_t>(64, mSlots.size()*2), empty);
+    slots.swap(mSlots);
+
+    for (std::vector<Slot>::const_iterator it = slots.begin(); it != slots.end(); ++it)
+        if (it->mNode)
+            mSlots[getSlot(it->mNode)] = *it;
 }
 
 ViewData::Entry::Entry()
     : mNode(NULL)
     , mVisible(true)
     , mLodFlags(0)
+    , mLodFlagsDirty(true)
 {
 
 }
@@ -108,6 +317,7 @@ bool ViewData::Entry::set(QuadTreeNode *node, bool visible)
         mNode = node;
         // clear cached data
         mRenderingNode = NULL;
+        mLodFlagsDirty = true;
         return true;
     }
 }
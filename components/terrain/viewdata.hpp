@@ -25,7 +25,7 @@ namespace Terrain
 
         void clear();
 
-        bool contains(QuadTreeNode* node);
+        bool contains(QuadTreeNode* node) const;
 
         struct Entry
         {
@@ -37,6 +37,7 @@ namespace Terrain
             bool mVisible;
 
             unsigned int mLodFlags;
+            bool mLodFlagsDirty; ///< mLodFlags have to be recomputed
             osg::ref_ptr<osg::Node> mRenderingNode;
         };
 
@@ -44,6 +45,17 @@ namespace Terrain
 
         Entry& getEntry(unsigned int i);
 
+        /// @return The entry for @a node, or NULL if @a node was not added since the last reset.
+        Entry* findEntry(QuadTreeNode* node);
+
+        /// Recompute the LOD flags of entries showing a different node than before the last reset, and of entries
+        /// next to nodes that were added or removed since then. Entries with changed flags lose their rendering node.
+        void updateLodFlags();
+
+        /// Append the nodes that were added since the last reset, but not before it, and the nodes that were added
+        /// before the last reset, but not since then.
+        void getChangedNodes(std::vector<QuadTreeNode*>& out) const;
+
         osg::Object* getViewer() const { return mViewer.get(); }
         void setViewer(osg::Object* viewer) { mViewer = viewer; }
 
@@ -58,7 +70,41 @@ namespace Terrain
         const osg::Vec3f& getEyePoint() const;
 
     private:
+        /// @brief Open addressing hash table from nodes to entry indices
+        class NodeIndex
+        {
+        public:
+            NodeIndex();
+
+            /// Does nothing if @a node is already present.
+            void insert(QuadTreeNode* node, unsigned int index);
+
+            /// @return The entry index of @a node, or -1.
+            int find(QuadTreeNode* node) const;
+
+            void clear();
+
+            /// @return All nodes in insertion order
+            const std::vector<QuadTreeNode*>& getNodes() const { return mNodes; }
+
+        private:
+            struct Slot
+            {
+                QuadTreeNode* mNode;
+                unsigned int mIndex;
+            };
+
+            size_t getSlot(QuadTreeNode* node) const;
+
+            void grow();
+
+            std::vector<Slot> mSlots; ///< size is a power of two, at most half of the slots are used
+            std::vector<QuadTreeNode*> mNodes;
+        };
+
         std::vector<Entry> mEntries;
+        NodeIndex mIndex; ///< nodes added since the last reset
+        NodeIndex mPreviousIndex; ///< nodes added before the last reset
         unsigned int mNumEntries;
         unsigned int mFrameLastUsed;
         bool mChanged;
@@ -0,0 +1,107 @@
+#include "stringtable.hpp"
+
+#include <components/misc/stringops.hpp>
+
+namespace Translation
+{
+    StringTable::StringTable()
+        : mBuckets(16, 0)
+    {
+    }
+
+    void StringTable::add(const char* key, std::size_t keySize, const char* value, std::size_t valueSize)
+    {
+        std::size_t keyHash = hash(key, keySize);
+        std::size_t bucket = findBucket(key, keySize, keyHash);
+
+        if (mBuckets[bucket] != 0)
+            return;
+
+        Entry entry;
+        entry.mKey = mStrings.size();
+        entry.mKeySize = keySize;
+        entry.mValue = entry.mKey + keySize;
+        entry.mValueSize = valueSize;
+        entry.mHash = keyHash;
+
+        for (std::size_t i = 0; i < keySize; ++i)
+            mStrings += Misc::StringUtils::toLower(key[i]);
+        mStrings.append(value, valueSize);
+
+        mEntries.push_back(entry);
+        mBuckets[bucket] = mEntries.size();
+
+        // keep at most half of the buckets used, so that probing stays short
+        if (mEntries.size() * 2 > mBuckets.size())
+            rehash(mBuckets.size() * 2);
+    }
+
+    bool StringTable::find(const std::string& key, std::string& value) const
+    {
+        std::size_t index = mBuckets[findBucket(key.data(), key.size(), hash(key.data(), key.size()))];
+        if (index == 0)
+            return false;
+
+        const Entry& entry = mEntries[index - 1];
+        value.assign(mStrings, entry.mValue, entry.mValueSize);
+        return true;
+    }
+
+    bool StringTable::empty() const
+    {
+        return mEntries.empty();
+    }
+
+    std::size_t StringTable::size() const
+    {
+        return mEntries.size();
+    }
+
+    std::size_t StringTable::hash(const char* key, std::size_t size)
+    {
+        // FNV-1a
+        std::size_t hash = 2166136261u;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            hash ^= static_cast<unsigned char>(Misc::StringUtils::toLower(key[i]));
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+    std::size_t StringTable::findBucket(const char* key, std::size_t size, std::size_t hash) const
+    {
+        std::size_t mask = mBuckets.size() - 1;
+        for (std::size_t bucket = hash & mask;; bucket = (bucket + 1) & mask)
+        {
+            std::size_t index = mBuckets[bucket];
+            if (index == 0)
+                return bucket;
+
+            const Entry& entry = mEntries[index - 1];
+            if (entry.mHash != hash || entry.mKeySize != size)
+                continue;
+
+            const char* entryKey = mStrings.data() + entry.mKey;
+            std::size_t i = 0;
+            while (i < size && entryKey[i] == Misc::StringUtils::toLower(key[i]))
+                ++i;
+            if (i == size)
+                return bucket;
+        }
+    }
+
+    void StringTable::rehash(std::size_t numBuckets)
+    {
+        mBuckets.assign(numBuckets, 0);
+
+        std::size_t mask = numBuckets - 1;
+        for (std::size_t i = 0; i < mEntries.size(); ++i)
+        {
+            std::size_t bucket = mEntries[i].mHash & mask;
+            while (mBuckets[bucket] != 0)
+                bucket = (bucket + 1) & mask;
+            mBuckets[bucket] = i + 1;
+        }
+    }
+}
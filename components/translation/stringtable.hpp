@@ -0,0 +1,54 @@
+#ifndef COMPONENTS_TRANSLATION_STRINGTABLE_H
+#define COMPONENTS_TRANSLATION_STRINGTABLE_H
+
+#include <string>
+#include <vector>
+
+namespace Translation
+{
+    /// Pairs of strings, looked up by their key ignoring case.
+    ///
+    /// All strings are stored in one buffer and indexed by a hash table of the lower case keys,
+    /// so a lookup hashes the key once and doesn't allocate anything.
+    class StringTable
+    {
+    public:
+        StringTable();
+
+        /// Add an entry. If there is already an entry with this key, the first one is kept.
+        void add(const char* key, std::size_t keySize, const char* value, std::size_t valueSize);
+
+        /// \return Was there an entry for \a key? Its value is stored in \a value.
+        bool find(const std::string& key, std::string& value) const;
+
+        bool empty() const;
+
+        std::size_t size() const;
+
+    private:
+        struct Entry
+        {
+            std::size_t mKey;
+            std::size_t mKeySize;
+            std::size_t mValue;
+            std::size_t mValueSize;
+            std::size_t mHash;
+        };
+
+        /// Lower case keys and the values of all entries
+        std::string mStrings;
+        std::vector<Entry> mEntries;
+
+        /// Index + 1 of the entry in mEntries, 0 for empty buckets. The size is a power of two.
+        std::vector<std::size_t> mBuckets;
+
+        static std::size_t hash(const char* key, std::size_t size);
+
+        /// \return The bucket for \a key, which is empty if there is no such entry
+        std::size_t findBucket(const char* key, std::size_t size, std::size_t hash) const;
+
+        void rehash(std::size_t numBuckets);
+    };
+}
+
+#endif
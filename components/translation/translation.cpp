@@ -1,7 +1,11 @@
 #include "translation.hpp"
 
+#include <algorithm>
+
 #include <boost/filesystem/fstream.hpp>
 
+#include <components/misc/stringops.hpp>
+
 namespace Translation
 {
     Storage::Storage()
@@ -33,50 +37,53 @@ namespace Translation
         if (dataFileCollections.getCollection (extension).doesExist (fileName))
         {
             boost::filesystem::ifstream stream (
-                dataFileCollections.getCollection (extension).getPath (fileName));
+                dataFileCollections.getCollection (extension).getPath (fileName), std::ios::binary);
 
             if (!stream.is_open())
                 throw std::runtime_error ("failed to open translation file: " + fileName);
 
-            loadDataFromStream(container, stream);
+            // read the whole file at once and split it in memory
+            std::string data;
+            stream.seekg(0, std::ios::end);
+            std::streamoff size = stream.tellg();
+            stream.seekg(0, std::ios::beg);
+            if (size > 0)
+            {
+                data.resize(static_cast<size_t>(size));
+                stream.read(&data[0], size);
+                data.resize(static_cast<size_t>(stream.gcount()));
+            }
+
+            loadDataFromBuffer(container, mEncoder->getUtf8(data));
         }
     }
 
-    void Storage::loadDataFromStream(ContainerType& container, std::istream& stream)
+    void Storage::loadDataFromBuffer(ContainerType& container, const std::string& data)
     {
-        std::string line;
-        while (!stream.eof() && !stream.fail())
+        const char* end = data.data() + data.size();
+        for (const char* line = data.data(); line < end;)
         {
-            std::getline( stream, line );
-            if (!line.empty() && *line.rbegin() == '\r')
-              line.resize(line.size() - 1);
+            const char* lineEnd = std::find(line, end, '\n');
+            const char* next = lineEnd == end ? end : lineEnd + 1;
 
-            if (!line.empty())
-            {
-                line = mEncoder->getUtf8(line);
+            if (lineEnd != line && *(lineEnd - 1) == '\r')
+                --lineEnd;
 
-                size_t tab_pos = line.find('\t');
-                if (tab_pos != std::string::npos && tab_pos > 0 && tab_pos < line.size() - 1)
-                {
-                    std::string key = line.substr(0, tab_pos);
-                    std::string value = line.substr(tab_pos + 1);
+            const char* tab = std::find(line, lineEnd, '\t');
+            if (tab != lineEnd && tab > line && tab < lineEnd - 1)
+                container.add(line, tab - line, tab + 1, lineEnd - (tab + 1));
 
-                    if (!key.empty() && !value.empty())
-                        container.insert(std::make_pair(key, value));
-                }
-            }
+            line = next;
         }
     }
 
     std::string Storage::translateCellName(const std::string& cellName) const
     {
-        std::map<std::string, std::string>::const_iterator entry =
-            mCellNamesTranslations.find(cellName);
-
-        if (entry == mCellNamesTranslations.end())
+        std::string result;
+        if (!mCellNamesTranslations.find(cellName, result))
             return cellName;
 
-        return entry->second;
+        return result;
     }
 
     std::string Storage::topicID(const std::string& phrase) const
@@ -84,22 +91,18 @@ namespace Translation
         std::string result = topicStandardForm(phrase);
 
         //seeking for the topic ID
-        std::map<std::string, std::string>::const_iterator topicIDIterator =
-            mTopicIDs.find(result);
-
-        if (topicIDIterator != mTopicIDs.end())
-            result = topicIDIterator->second;
+        std::string topicId;
+        if (mTopicIDs.find(result, topicId))
+            return topicId;
 
         return result;
     }
 
     std::string Storage::topicStandardForm(const std::string& phrase) const
     {
-        std::map<std::string, std::string>::const_iterator phraseFormsIterator =
-            mPhraseForms.find(phrase);
-
-        if (phraseFormsIterator != mPhraseForms.end())
-            return phraseFormsIterator->second;
+        std::string result;
+        if (mPhraseForms.find(phrase, result))
+            return result;
         else
             return phrase;
     }
@@ -4,6 +4,8 @@
 #include <components/to_utf8/to_utf8.hpp>
 #include <components/files/collections.hpp>
 
+#include "stringtable.hpp"
+
 namespace Translation
 {
     class Storage
@@ -25,14 +27,15 @@ namespace Translation
         bool hasTranslation() const;
 
     private:
-        typedef std::map<std::string, std::string> ContainerType;
+        typedef StringTable ContainerType;
 
         void loadData(ContainerType& container,
                       const std::string& fileNameNoExtension,
                       const std::string& extension,
                       const Files::Collections& dataFileCollections);
 
-        void loadDataFromStream(ContainerType& container, std::istream& stream);
+        /// Add the lines of \a data with a key and a value separated by a tab to \a container
+        void loadDataFromBuffer(ContainerType& container, const std::string& data);
 
 
         ToUTF8::Utf8Encoder* mEncoder;
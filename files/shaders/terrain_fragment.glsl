@@ -8,10 +8,24 @@ uniform sampler2D diffuseMap;
 uniform sampler2D normalMap;
 #endif
 
-#if @blendMap
+#if @blendMap || @packedLayers > 1
 uniform sampler2D blendMap;
 #endif
 
+// Layers splatted in a single pass, with the blend values of layer i in channel i-1 of blendMap
+#if @packedLayers > 1
+uniform sampler2D diffuseMap1;
+#endif
+#if @packedLayers > 2
+uniform sampler2D diffuseMap2;
+#endif
+#if @packedLayers > 3
+uniform sampler2D diffuseMap3;
+#endif
+#if @packedLayers > 4
+uniform sampler2D diffuseMap4;
+#endif
+
 varying float depth;
 
 #define PER_PIXEL_LIGHTING (@normalMap || @forcePPL)
@@ -57,6 +71,21 @@ void main()
 #endif
 
     vec4 diffuseTex = texture2D(diffuseMap, adjustedUV);
+
+#if @packedLayers > 1
+    vec4 blendWeights = texture2D(blendMap, (gl_TextureMatrix[1] * vec4(uv, 0.0, 1.0)).xy);
+    diffuseTex.xyz = mix(diffuseTex.xyz, texture2D(diffuseMap1, adjustedUV).xyz, blendWeights.r);
+#endif
+#if @packedLayers > 2
+    diffuseTex.xyz = mix(diffuseTex.xyz, texture2D(diffuseMap2, adjustedUV).xyz, blendWeights.g);
+#endif
+#if @packedLayers > 3
+    diffuseTex.xyz = mix(diffuseTex.xyz, texture2D(diffuseMap3, adjustedUV).xyz, blendWeights.b);
+#endif
+#if @packedLayers > 4
+    diffuseTex.xyz = mix(diffuseTex.xyz, texture2D(diffuseMap4, adjustedUV).xyz, blendWeights.a);
+#endif
+
     gl_FragData[0] = vec4(diffuseTex.xyz, 1.0);
 
 #if @blendMap